@@ -0,0 +1,16 @@
+#!/bin/bash -ex
+
+# Runs every benchmark executable from a build directory and stores one JSON
+# report per benchmark, suitable for per-commit performance tracking.
+#
+# Usage: CI/run_benchmarks.sh <build-dir> [output-dir]
+
+BUILD_DIR="${1:?usage: $0 <build-dir> [output-dir]}"
+OUTPUT_DIR="${2:-benchmark_results}"
+
+mkdir -p "${OUTPUT_DIR}"
+
+find "${BUILD_DIR}" -type f -name 'openmw_*_benchmark' | sort | while read -r v; do
+    name=$(basename "${v}")
+    "${v}" --benchmark_out="${OUTPUT_DIR}/${name}.json" --benchmark_out_format=json
+done
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm/defs.hpp>
+#include <components/esm3/cellref.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/loadcell.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    // Closest component-level equivalent of what CellStore::loadRefs spends its time on:
+    // reading all cell references of a synthetic plugin.
+    std::string generatePlugin(std::size_t cells, std::size_t refsPerCell)
+    {
+        ESM::ESMWriter writer;
+        writer.setFormatVersion(ESM::CurrentContentFormatVersion);
+        std::stringstream stream;
+        writer.save(stream);
+
+        std::size_t nextRefNum = 1;
+        for (std::size_t i = 0; i < cells; ++i)
+        {
+            ESM::Cell cell;
+            cell.blank();
+            cell.mData.mX = static_cast<int>(i);
+            cell.mData.mY = 0;
+
+            writer.startRecord(ESM::REC_CELL);
+            cell.save(writer);
+
+            ESM::CellRef ref;
+            ref.blank();
+            for (std::size_t j = 0; j < refsPerCell; ++j)
+            {
+                ref.mRefNum.mIndex = static_cast<std::uint32_t>(nextRefNum++);
+                ref.mRefID = ESM::RefId::stringRefId("benchmark_object_" + std::to_string(j % 64));
+                ref.mPos.pos[0] = static_cast<float>(i);
+                ref.mPos.pos[1] = static_cast<float>(j);
+                ref.mPos.pos[2] = 0.0f;
+                ref.save(writer);
+            }
+
+            writer.endRecord(ESM::REC_CELL);
+        }
+
+        return stream.str();
+    }
+
+    void readCellRefs(benchmark::State& state)
+    {
+        const std::string plugin = generatePlugin(static_cast<std::size_t>(state.range(0)), 256);
+
+        std::size_t refs = 0;
+        for (auto _ : state)
+        {
+            ESM::ESMReader reader;
+            reader.open(std::make_unique<std::istringstream>(plugin), "benchmark.esp");
+
+            ESM::Cell cell;
+            ESM::CellRef ref;
+            while (reader.hasMoreRecs())
+            {
+                reader.getRecName();
+                reader.getRecHeader();
+                bool deleted = false;
+                cell.load(reader, deleted, /*saveContext*/ false);
+                while (ESM::Cell::getNextRef(reader, ref, deleted))
+                    ++refs;
+            }
+        }
+        benchmark::DoNotOptimize(refs);
+    }
+}
+
+BENCHMARK(readCellRefs)->Arg(1)->Arg(16)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm/exteriorcelllocation.hpp>
+#include <components/esm/refid.hpp>
+#include <components/esm3/landrecorddata.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/loadland.hpp>
+#include <components/esmterrain/storage.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <osg/Array>
+#include <osg/Vec2f>
+
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace
+{
+    osg::ref_ptr<const ESMTerrain::LandObject> generateLand(int cellX, int cellY)
+    {
+        constexpr int loadFlags
+            = ESM::Land::DATA_VHGT | ESM::Land::DATA_VNML | ESM::Land::DATA_VCLR | ESM::Land::DATA_VTEX;
+
+        auto data = std::make_unique<ESM::LandRecordData>();
+        for (unsigned y = 0; y < ESM::LandRecordData::sLandSize; ++y)
+        {
+            for (unsigned x = 0; x < ESM::LandRecordData::sLandSize; ++x)
+            {
+                const unsigned i = y * ESM::LandRecordData::sLandSize + x;
+                data->mHeights[i] = 128.0f * std::sin(0.1f * (cellX * 64 + static_cast<int>(x)))
+                    + 128.0f * std::cos(0.1f * (cellY * 64 + static_cast<int>(y)));
+                data->mNormals[3 * i] = 0;
+                data->mNormals[3 * i + 1] = 0;
+                data->mNormals[3 * i + 2] = 127;
+                data->mColours[3 * i] = 255;
+                data->mColours[3 * i + 1] = 255;
+                data->mColours[3 * i + 2] = 255;
+            }
+        }
+        data->mTextures.fill(0);
+        data->mMinHeight = -256.0f;
+        data->mMaxHeight = 256.0f;
+        data->mDataLoaded = loadFlags;
+
+        ESM::Land land;
+        land.mX = cellX;
+        land.mY = cellY;
+        land.mDataTypes = loadFlags;
+        land.mLandData = std::move(data);
+
+        return new ESMTerrain::LandObject(land, loadFlags);
+    }
+
+    class SyntheticLandStorage : public ESMTerrain::Storage
+    {
+    public:
+        explicit SyntheticLandStorage(const VFS::Manager* vfs)
+            : ESMTerrain::Storage(vfs)
+        {
+        }
+
+        osg::ref_ptr<const ESMTerrain::LandObject> getLand(ESM::ExteriorCellLocation cellLocation) override
+        {
+            const std::pair<int, int> key(cellLocation.mX, cellLocation.mY);
+            auto it = mLands.find(key);
+            if (it == mLands.end())
+                it = mLands.emplace(key, generateLand(cellLocation.mX, cellLocation.mY)).first;
+            return it->second;
+        }
+
+        const std::string* getLandTexture(std::uint16_t index, int plugin) override { return nullptr; }
+
+        void getBounds(float& minX, float& maxX, float& minY, float& maxY, ESM::RefId worldspace) override
+        {
+            minX = -8;
+            maxX = 8;
+            minY = -8;
+            maxY = 8;
+        }
+
+    private:
+        std::map<std::pair<int, int>, osg::ref_ptr<const ESMTerrain::LandObject>> mLands;
+    };
+
+    void fillVertexBuffers(benchmark::State& state)
+    {
+        VFS::Manager vfs;
+        SyntheticLandStorage storage(&vfs);
+        const ESM::RefId worldspace = ESM::Cell::sDefaultWorldspaceId;
+        const float chunkSize = static_cast<float>(state.range(0));
+
+        // Pre-generate the lands so the benchmark only measures buffer filling.
+        for (int x = -8; x < 8; ++x)
+            for (int y = -8; y < 8; ++y)
+                storage.getLand(ESM::ExteriorCellLocation(x, y, worldspace));
+
+        osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+
+        for (auto _ : state)
+        {
+            storage.fillVertexBuffers(
+                0, chunkSize, osg::Vec2f(chunkSize / 2, chunkSize / 2), worldspace, *positions, *normals, *colours);
+            benchmark::DoNotOptimize(positions->size());
+        }
+    }
+}
+
+BENCHMARK(fillVertexBuffers)->Arg(1)->Arg(4);
+
+BENCHMARK_MAIN();
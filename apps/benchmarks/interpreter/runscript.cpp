@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+
+#include <components/compiler/context.hpp>
+#include <components/compiler/errorhandler.hpp>
+#include <components/compiler/extensions.hpp>
+#include <components/compiler/extensions0.hpp>
+#include <components/compiler/fileparser.hpp>
+#include <components/compiler/scanner.hpp>
+#include <components/interpreter/context.hpp>
+#include <components/interpreter/installopcodes.hpp>
+#include <components/interpreter/interpreter.hpp>
+#include <components/interpreter/program.hpp>
+
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    class BenchmarkCompilerContext : public Compiler::Context
+    {
+    public:
+        bool canDeclareLocals() const override { return true; }
+        char getGlobalType(const std::string& name) const override { return ' '; }
+        std::pair<char, bool> getMemberType(const std::string& name, const ESM::RefId& id) const override
+        {
+            return { ' ', false };
+        }
+        bool isId(const ESM::RefId& name) const override { return false; }
+    };
+
+    class BenchmarkErrorHandler : public Compiler::ErrorHandler
+    {
+        void report(const std::string& message, const Compiler::TokenLoc& loc, Type type) override
+        {
+            if (type == ErrorMessage)
+                throw std::runtime_error("Failed to compile benchmark script: " + message);
+        }
+
+        void report(const std::string& message, Type type) override { report(message, {}, type); }
+    };
+
+    class BenchmarkInterpreterContext : public Interpreter::Context
+    {
+        std::vector<int> mShorts;
+        std::vector<int> mLongs;
+        std::vector<float> mFloats;
+
+        template <class T>
+        static T get(const std::vector<T>& values, int index)
+        {
+            if (static_cast<std::size_t>(index) < values.size())
+                return values[index];
+            return {};
+        }
+
+        template <class T>
+        static void set(std::vector<T>& values, int index, T value)
+        {
+            if (static_cast<std::size_t>(index) >= values.size())
+                values.resize(index + 1);
+            values[index] = value;
+        }
+
+    public:
+        ESM::RefId getTarget() const override { return ESM::RefId(); }
+
+        int getLocalShort(int index) const override { return get(mShorts, index); }
+        int getLocalLong(int index) const override { return get(mLongs, index); }
+        float getLocalFloat(int index) const override { return get(mFloats, index); }
+
+        void setLocalShort(int index, int value) override { set(mShorts, index, value); }
+        void setLocalLong(int index, int value) override { set(mLongs, index, value); }
+        void setLocalFloat(int index, float value) override { set(mFloats, index, value); }
+
+        void messageBox(std::string_view message, const std::vector<std::string>& buttons) override {}
+        void report(const std::string& message) override {}
+
+        int getGlobalShort(std::string_view name) const override { return {}; }
+        int getGlobalLong(std::string_view name) const override { return {}; }
+        float getGlobalFloat(std::string_view name) const override { return {}; }
+        void setGlobalShort(std::string_view name, int value) override {}
+        void setGlobalLong(std::string_view name, int value) override {}
+        void setGlobalFloat(std::string_view name, float value) override {}
+        std::vector<std::string> getGlobals() const override { return {}; }
+        char getGlobalType(std::string_view name) const override { return ' '; }
+
+        std::string getActionBinding(std::string_view action) const override { return {}; }
+        std::string_view getActorName() const override { return {}; }
+        std::string_view getNPCRace() const override { return {}; }
+        std::string_view getNPCClass() const override { return {}; }
+        std::string_view getNPCFaction() const override { return {}; }
+        std::string_view getNPCRank() const override { return {}; }
+        std::string_view getPCName() const override { return {}; }
+        std::string_view getPCRace() const override { return {}; }
+        std::string_view getPCClass() const override { return {}; }
+        std::string_view getPCRank() const override { return {}; }
+        std::string_view getPCNextRank() const override { return {}; }
+        int getPCBounty() const override { return {}; }
+        std::string_view getCurrentCellName() const override { return {}; }
+
+        int getMemberShort(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+        int getMemberLong(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+        float getMemberFloat(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+        void setMemberShort(ESM::RefId id, std::string_view name, int value, bool global) override {}
+        void setMemberLong(ESM::RefId id, std::string_view name, int value, bool global) override {}
+        void setMemberFloat(ESM::RefId id, std::string_view name, float value, bool global) override {}
+    };
+
+    constexpr std::string_view sScript = R"(begin benchmark_script
+
+short i
+short j
+long sum
+float x
+
+set sum to 0
+set x to 0
+set i to 0
+while ( i < 64 )
+    set j to 0
+    while ( j < 16 )
+        set sum to ( sum + i * j )
+        set x to ( x + sum * 0.001 )
+        set j to ( j + 1 )
+    endwhile
+    set i to ( i + 1 )
+endwhile
+
+end)";
+
+    Interpreter::Program compileScript()
+    {
+        Compiler::Extensions extensions;
+        Compiler::registerExtensions(extensions);
+        BenchmarkCompilerContext context;
+        context.setExtensions(&extensions);
+        BenchmarkErrorHandler errorHandler;
+        Compiler::FileParser parser(errorHandler, context);
+        std::istringstream input{ std::string(sScript) };
+        Compiler::Scanner scanner(errorHandler, input, context.getExtensions());
+        scanner.scan(parser);
+        return parser.getProgram();
+    }
+
+    void interpreterExecute(benchmark::State& state)
+    {
+        const Interpreter::Program program = compileScript();
+        Interpreter::Interpreter interpreter;
+        Interpreter::installOpcodes(interpreter);
+        BenchmarkInterpreterContext context;
+        for (auto _ : state)
+            interpreter.run(program, context);
+    }
+
+    // First run of a program also pays for the translation to threaded form.
+    void interpreterExecuteCold(benchmark::State& state)
+    {
+        const Interpreter::Program program = compileScript();
+        BenchmarkInterpreterContext context;
+        for (auto _ : state)
+        {
+            Interpreter::Interpreter interpreter;
+            Interpreter::installOpcodes(interpreter);
+            interpreter.run(program, context);
+        }
+    }
+}
+
+BENCHMARK(interpreterExecute);
+BENCHMARK(interpreterExecuteCold);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include "components/misc/strings/algorithm.hpp"
+#include "components/misc/strings/lower.hpp"
+#include "components/vfs/pathutil.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t stringsCount = 16 * 1024;
+
+    template <class Random>
+    std::string generatePath(std::size_t size, Random& random)
+    {
+        std::uniform_int_distribution<int> distribution('A', 'z');
+        std::string result;
+        result.reserve(size);
+        std::generate_n(std::back_inserter(result), size, [&] { return distribution(random); });
+        for (std::size_t i = 8; i < result.size(); i += 8)
+            result[i] = '\\';
+        return result;
+    }
+
+    template <class Random>
+    std::vector<std::string> generatePaths(std::size_t size, Random& random)
+    {
+        std::vector<std::string> result;
+        result.reserve(stringsCount);
+        std::generate_n(std::back_inserter(result), stringsCount, [&] { return generatePath(size, random); });
+        return result;
+    }
+
+    void ciEqual(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        std::vector<std::string> strings = generatePaths(state.range(0), random);
+        std::vector<std::string> others;
+        others.reserve(strings.size());
+        for (const std::string& v : strings)
+            others.push_back(Misc::StringUtils::lowerCase(v));
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Misc::StringUtils::ciEqual(strings[i], others[i]));
+            if (++i >= strings.size())
+                i = 0;
+        }
+    }
+
+    void lowerCase(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        std::vector<std::string> strings = generatePaths(state.range(0), random);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Misc::StringUtils::lowerCase(strings[i]));
+            if (++i >= strings.size())
+                i = 0;
+        }
+    }
+
+    void normalizeFilename(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        std::vector<std::string> strings = generatePaths(state.range(0), random);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(VFS::Path::normalizeFilename(strings[i]));
+            if (++i >= strings.size())
+                i = 0;
+        }
+    }
+}
+
+BENCHMARK(ciEqual)->RangeMultiplier(4)->Range(8, 128);
+BENCHMARK(lowerCase)->RangeMultiplier(4)->Range(8, 128);
+BENCHMARK(normalizeFilename)->RangeMultiplier(4)->Range(8, 128);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <components/nif/data.hpp>
+#include <components/nif/niffile.hpp>
+#include <components/nif/node.hpp>
+#include <components/nifosg/nifloader.hpp>
+#include <components/resource/bgsmfilemanager.hpp>
+#include <components/resource/imagemanager.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <osg/Vec2f>
+#include <osg/Vec3f>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // There is no NIF writer in the tree, so instead of parsing bytes this benchmark builds
+    // the record graph directly (like the nifosg tests do) and measures the conversion to an
+    // OSG scene graph, which is where the time goes when loading meshes.
+    void init(Nif::NiObjectNET& value)
+    {
+        value.mExtra = Nif::ExtraPtr(nullptr);
+        value.mExtraList = Nif::ExtraList();
+        value.mController = Nif::NiTimeControllerPtr(nullptr);
+    }
+
+    void init(Nif::NiAVObject& value)
+    {
+        init(static_cast<Nif::NiObjectNET&>(value));
+        value.mFlags = 0;
+        value.mTransform = Nif::NiTransform::getIdentity();
+    }
+
+    void init(Nif::NiGeometry& value)
+    {
+        init(static_cast<Nif::NiAVObject&>(value));
+        value.mData = Nif::NiGeometryDataPtr(nullptr);
+        value.mSkin = Nif::NiSkinInstancePtr(nullptr);
+    }
+
+    struct SyntheticModel
+    {
+        Nif::NIFFile mFile{ "benchmark.nif" };
+        Nif::NiNode mRoot;
+        std::vector<std::unique_ptr<Nif::NiTriShape>> mShapes;
+        std::vector<std::unique_ptr<Nif::NiTriShapeData>> mData;
+
+        explicit SyntheticModel(std::size_t shapes, std::size_t quadsPerSide)
+        {
+            init(mRoot);
+            mRoot.recType = Nif::RC_NiNode;
+
+            for (std::size_t i = 0; i < shapes; ++i)
+            {
+                auto data = std::make_unique<Nif::NiTriShapeData>();
+                data->recType = Nif::RC_NiTriShapeData;
+
+                const std::size_t verticesPerSide = quadsPerSide + 1;
+                for (std::size_t y = 0; y < verticesPerSide; ++y)
+                {
+                    for (std::size_t x = 0; x < verticesPerSide; ++x)
+                    {
+                        data->mVertices.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+                        data->mNormals.emplace_back(0.0f, 0.0f, 1.0f);
+                    }
+                }
+                data->mNumVertices = static_cast<uint16_t>(data->mVertices.size());
+
+                for (std::size_t y = 0; y < quadsPerSide; ++y)
+                {
+                    for (std::size_t x = 0; x < quadsPerSide; ++x)
+                    {
+                        const unsigned short base = static_cast<unsigned short>(y * verticesPerSide + x);
+                        const unsigned short next = static_cast<unsigned short>(base + verticesPerSide);
+                        data->mTriangles.insert(data->mTriangles.end(),
+                            { base, static_cast<unsigned short>(base + 1), next, static_cast<unsigned short>(base + 1),
+                                static_cast<unsigned short>(next + 1), next });
+                    }
+                }
+                data->mNumTriangles = static_cast<uint16_t>(data->mTriangles.size() / 3);
+
+                auto shape = std::make_unique<Nif::NiTriShape>();
+                init(*shape);
+                shape->recType = Nif::RC_NiTriShape;
+                shape->mName = "shape" + std::to_string(i);
+                shape->mData = Nif::NiGeometryDataPtr(data.get());
+
+                mRoot.mChildren.push_back(Nif::NiAVObjectPtr(shape.get()));
+                mData.push_back(std::move(data));
+                mShapes.push_back(std::move(shape));
+            }
+
+            mFile.mRoots.push_back(&mRoot);
+        }
+    };
+
+    void nifOsgLoad(benchmark::State& state)
+    {
+        const SyntheticModel model(static_cast<std::size_t>(state.range(0)), 16);
+        VFS::Manager vfs;
+        Resource::ImageManager imageManager(&vfs, 0);
+        Resource::BgsmFileManager materialManager(&vfs, 0);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(NifOsg::Loader::load(model.mFile, &imageManager, &materialManager));
+    }
+}
+
+BENCHMARK(nifOsgLoad)->Arg(1)->Arg(8)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include <components/sceneutil/riggeometry.hpp>
+#include <components/sceneutil/skeleton.hpp>
+
+#include <osg/Array>
+#include <osg/Geometry>
+#include <osg/Matrixf>
+#include <osg/MatrixTransform>
+#include <osg/NodeVisitor>
+#include <osg/PrimitiveSet>
+#include <osg/ref_ptr>
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Rig
+    {
+        osg::ref_ptr<SceneUtil::Skeleton> mSkeleton;
+        std::vector<osg::MatrixTransform*> mBones;
+        osg::ref_ptr<SceneUtil::RigGeometry> mRig;
+
+        Rig(std::size_t boneCount, std::size_t vertexCount)
+        {
+            mSkeleton = new SceneUtil::Skeleton;
+            mSkeleton->setActive(SceneUtil::Skeleton::Active);
+
+            // A chain of bones, like a spine: moving the root moves every vertex.
+            osg::Group* parent = mSkeleton;
+            for (std::size_t i = 0; i < boneCount; ++i)
+            {
+                osg::MatrixTransform* bone = new osg::MatrixTransform;
+                bone->setName("bone" + std::to_string(i));
+                bone->setMatrix(osg::Matrixf::translate(0.0f, 0.0f, 1.0f));
+                parent->addChild(bone);
+                mBones.push_back(bone);
+                parent = bone;
+            }
+
+            osg::ref_ptr<osg::Geometry> source = new osg::Geometry;
+            osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+            osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                const float angle = static_cast<float>(i) * 0.1f;
+                positions->push_back(
+                    osg::Vec3f(std::cos(angle), std::sin(angle), static_cast<float>(i % boneCount)));
+                normals->push_back(osg::Vec3f(0.0f, 0.0f, 1.0f));
+            }
+            source->setVertexArray(positions);
+            source->setNormalArray(normals, osg::Array::BIND_PER_VERTEX);
+
+            osg::ref_ptr<osg::DrawElementsUShort> triangles = new osg::DrawElementsUShort(GL_TRIANGLES);
+            for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+            {
+                triangles->push_back(static_cast<unsigned short>(i));
+                triangles->push_back(static_cast<unsigned short>(i + 1));
+                triangles->push_back(static_cast<unsigned short>(i + 2));
+            }
+            source->addPrimitiveSet(triangles);
+
+            mRig = new SceneUtil::RigGeometry;
+            mRig->setSourceGeometry(source);
+
+            std::vector<SceneUtil::RigGeometry::BoneInfo> boneInfo(boneCount);
+            for (std::size_t i = 0; i < boneCount; ++i)
+            {
+                boneInfo[i].mName = "bone" + std::to_string(i);
+                boneInfo[i].mBoundSphere = osg::BoundingSpheref(osg::Vec3f(0.0f, 0.0f, 0.0f), 1.0f);
+                boneInfo[i].mInvBindMatrix
+                    = osg::Matrixf::translate(0.0f, 0.0f, -static_cast<float>(i + 1));
+            }
+            mRig->setBoneInfo(std::move(boneInfo));
+
+            // Two weighted bones per vertex, like most skinned meshes.
+            std::vector<SceneUtil::RigGeometry::BoneWeights> influences(vertexCount);
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                const std::size_t bone = i % boneCount;
+                influences[i].emplace_back(bone, 0.75f);
+                influences[i].emplace_back((bone + 1) % boneCount, 0.25f);
+            }
+            mRig->setInfluences(influences);
+
+            mSkeleton->addChild(mRig);
+        }
+
+        void visit(osg::NodeVisitor& visitor)
+        {
+            visitor.pushOntoNodePath(mSkeleton);
+            mRig->accept(visitor);
+            visitor.popFromNodePath();
+        }
+    };
+
+    void rigGeometrySkinning(benchmark::State& state)
+    {
+        Rig rig(32, static_cast<std::size_t>(state.range(0)));
+
+        osg::NodeVisitor updateVisitor(osg::NodeVisitor::UPDATE_VISITOR, osg::NodeVisitor::TRAVERSE_NONE);
+        updateVisitor.setTraversalNumber(1);
+        rig.visit(updateVisitor);
+
+        osg::NodeVisitor cullVisitor(osg::NodeVisitor::CULL_VISITOR, osg::NodeVisitor::TRAVERSE_NONE);
+        unsigned int frame = 1;
+        for (auto _ : state)
+        {
+            // Move the root bone so every blend matrix changes and all vertices are skinned.
+            rig.mBones.front()->setMatrix(osg::Matrixf::translate(0.0f, 0.0f, 1.0f + 0.001f * frame));
+            cullVisitor.setTraversalNumber(++frame);
+            rig.visit(cullVisitor);
+        }
+    }
+
+    void rigGeometrySkinningStaticPose(benchmark::State& state)
+    {
+        Rig rig(32, static_cast<std::size_t>(state.range(0)));
+
+        osg::NodeVisitor updateVisitor(osg::NodeVisitor::UPDATE_VISITOR, osg::NodeVisitor::TRAVERSE_NONE);
+        updateVisitor.setTraversalNumber(1);
+        rig.visit(updateVisitor);
+
+        osg::NodeVisitor cullVisitor(osg::NodeVisitor::CULL_VISITOR, osg::NodeVisitor::TRAVERSE_NONE);
+        unsigned int frame = 1;
+        for (auto _ : state)
+        {
+            // Bones do not move: measures the cost of detecting that nothing needs skinning.
+            cullVisitor.setTraversalNumber(++frame);
+            rig.visit(cullVisitor);
+        }
+    }
+}
+
+BENCHMARK(rigGeometrySkinning)->Arg(1000)->Arg(10000);
+BENCHMARK(rigGeometrySkinningStaticPose)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
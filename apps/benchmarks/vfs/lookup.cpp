@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <components/testing/util.hpp>
+#include <components/vfs/manager.hpp>
+#include <components/vfs/pathutil.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Index
+    {
+        std::vector<std::unique_ptr<TestingOpenMW::VFSTestFile>> mFiles;
+        std::vector<VFS::Path::Normalized> mPaths;
+        std::unique_ptr<VFS::Manager> mVfs;
+
+        explicit Index(std::size_t fileCount)
+        {
+            VFS::FileMap map;
+            for (std::size_t i = 0; i < fileCount; ++i)
+            {
+                mFiles.push_back(std::make_unique<TestingOpenMW::VFSTestFile>("content"));
+                VFS::Path::Normalized path("meshes/architecture/subdirectory" + std::to_string(i % 64) + "/model"
+                    + std::to_string(i) + ".nif");
+                mPaths.push_back(path);
+                map.emplace(std::move(path), mFiles.back().get());
+            }
+            mVfs = TestingOpenMW::createTestVFS(std::move(map));
+        }
+    };
+
+    void vfsGet(benchmark::State& state)
+    {
+        const Index index(static_cast<std::size_t>(state.range(0)));
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(index.mVfs->get(index.mPaths[i]));
+            if (++i == index.mPaths.size())
+                i = 0;
+        }
+    }
+
+    void vfsExists(benchmark::State& state)
+    {
+        const Index index(static_cast<std::size_t>(state.range(0)));
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(index.mVfs->exists(index.mPaths[i]));
+            if (++i == index.mPaths.size())
+                i = 0;
+        }
+    }
+
+    // Lookup from a non-normalized name, like most resource paths taken from content files.
+    void vfsGetFromRawName(benchmark::State& state)
+    {
+        const Index index(static_cast<std::size_t>(state.range(0)));
+        std::vector<std::string> names;
+        names.reserve(index.mPaths.size());
+        for (const VFS::Path::Normalized& path : index.mPaths)
+        {
+            std::string name(path.value());
+            for (char& c : name)
+                if (c == '/')
+                    c = '\\';
+            name[0] = 'M';
+            names.push_back(std::move(name));
+        }
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(index.mVfs->get(VFS::Path::Normalized(names[i])));
+            if (++i == names.size())
+                i = 0;
+        }
+    }
+}
+
+BENCHMARK(vfsGet)->Arg(1000)->Arg(100000);
+BENCHMARK(vfsExists)->Arg(1000)->Arg(100000);
+BENCHMARK(vfsGetFromRawName)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -1,7 +1,12 @@
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <vector>
 
 #include <boost/program_options.hpp>
@@ -29,6 +34,7 @@ struct Arguments
 
     bool longformat;
     bool fullpath;
+    int jobs;
 };
 
 bool parseOptions(int argc, char** argv, Arguments& info)
@@ -57,6 +63,8 @@ Allowed options)");
     addOption("version,v", "print version information and quit.");
     addOption("long,l", "Include extra information in archive listing.");
     addOption("full-path,f", "Create directory hierarchy on file extraction (always true for extractall).");
+    addOption("jobs,j", bpo::value<int>()->default_value(0),
+        "Number of files to extract in parallel in extractall mode (0: number of hardware threads).");
 
     // input-file is hidden and used as a positional argument
     bpo::options_description hidden("Hidden Options");
@@ -154,6 +162,9 @@ Allowed options)");
 
     info.longformat = variables.count("long") != 0;
     info.fullpath = variables.count("full-path") != 0;
+    info.jobs = variables["jobs"].as<int>();
+    if (info.jobs <= 0)
+        info.jobs = std::max<int>(1, std::thread::hardware_concurrency());
 
     return true;
 }
@@ -243,36 +254,76 @@ int extract(std::unique_ptr<File>& bsa, Arguments& info)
 template <typename File>
 int extractAll(std::unique_ptr<File>& bsa, Arguments& info)
 {
-    for (const auto& file : bsa->getList())
+    const auto& files = bsa->getList();
+
+    // Resolve the target paths and create the directory hierarchy up front,
+    // each directory once, so the workers only have to write files.
+    std::vector<std::filesystem::path> targets;
+    targets.reserve(files.size());
+    std::set<std::filesystem::path> directories;
+    for (const auto& file : files)
     {
         std::string extractPath(file.name());
         Misc::StringUtils::replaceAll(extractPath, "\\", "/");
 
-        // Get the target path (the path the file will be extracted to)
         auto target = info.outdir;
         target /= Misc::StringUtils::stringToU8String(extractPath);
+        directories.insert(target.parent_path());
+        targets.push_back(std::move(target));
+    }
 
-        // Create the directory hierarchy
-        std::filesystem::create_directories(target.parent_path());
+    for (const std::filesystem::path& directory : directories)
+    {
+        std::filesystem::create_directories(directory);
 
-        std::filesystem::file_status s = std::filesystem::status(target.parent_path());
+        std::filesystem::file_status s = std::filesystem::status(directory);
         if (!std::filesystem::is_directory(s))
         {
-            std::cout << "ERROR: " << target.parent_path() << " is not a directory." << std::endl;
+            std::cout << "ERROR: " << directory << " is not a directory." << std::endl;
             return 3;
         }
+    }
 
-        // Get a stream for the file to extract
-        Files::IStreamPtr data = bsa->getFile(&file);
-        std::ofstream out(target, std::ios::binary);
+    // Extract the entries in parallel so decompression overlaps with disk writes.
+    // getFile() is safe to call concurrently: it opens a stream per call.
+    std::atomic<std::size_t> nextFile{ 0 };
+    std::atomic<bool> failed{ false };
+    std::mutex logMutex;
+    const auto worker = [&] {
+        for (std::size_t i = nextFile++; i < files.size(); i = nextFile++)
+        {
+            try
+            {
+                // Get a stream for the file to extract
+                Files::IStreamPtr data = bsa->getFile(&files[i]);
+                std::ofstream out(targets[i], std::ios::binary);
+
+                // Write the file to disk
+                {
+                    std::lock_guard lock(logMutex);
+                    std::cout << "Extracting " << Files::pathToUnicodeString(targets[i]) << std::endl;
+                }
+                out << data->rdbuf();
+                out.close();
+            }
+            catch (const std::exception& e)
+            {
+                failed = true;
+                std::lock_guard lock(logMutex);
+                std::cerr << "ERROR extracting " << Files::pathToUnicodeString(targets[i]) << ": " << e.what()
+                          << std::endl;
+            }
+        }
+    };
 
-        // Write the file to disk
-        std::cout << "Extracting " << Files::pathToUnicodeString(target) << std::endl;
-        out << data->rdbuf();
-        out.close();
-    }
+    const std::size_t threadCount = std::min<std::size_t>(std::max<std::size_t>(files.size(), 1), info.jobs);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    for (std::thread& thread : threads)
+        thread.join();
 
-    return 0;
+    return failed ? 3 : 0;
 }
 
 template <typename File>
@@ -6,6 +6,7 @@
 #include <components/detournavigator/navmeshdbutils.hpp>
 #include <components/detournavigator/serialization.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
+#include <components/misc/compression.hpp>
 
 #include <BulletCollision/CollisionShapes/btBoxShape.h>
 
@@ -146,8 +147,8 @@ namespace
         ShapeId nextShapeId{ 1 };
         const std::vector<DbRefGeometryObject> objects = makeDbRefGeometryObjects(recastMesh->getMeshSources(),
             [&](const MeshSource& v) { return resolveMeshSource(*dbPtr, v, nextShapeId); });
-        const auto tile = dbPtr->findTile(
-            mWorldspace, tilePosition, serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects));
+        const auto tile = dbPtr->findTile(mWorldspace, tilePosition,
+            Misc::compress(serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects)));
         ASSERT_TRUE(tile.has_value());
         EXPECT_EQ(tile->mTileId, 1);
         EXPECT_EQ(tile->mVersion, navMeshFormatVersion);
@@ -173,8 +174,8 @@ namespace
         ShapeId nextShapeId{ 1 };
         const std::vector<DbRefGeometryObject> objects = makeDbRefGeometryObjects(recastMesh->getMeshSources(),
             [&](const MeshSource& v) { return resolveMeshSource(*dbPtr, v, nextShapeId); });
-        const auto tile = dbPtr->findTile(
-            mWorldspace, tilePosition, serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects));
+        const auto tile = dbPtr->findTile(mWorldspace, tilePosition,
+            Misc::compress(serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects)));
         ASSERT_FALSE(tile.has_value());
     }
 
@@ -282,8 +283,8 @@ namespace
                     continue;
                 present += dbPtr
                                ->findTile(mWorldspace, tilePosition,
-                                   serialize(mSettings.mRecast, mAgentBounds, *recastMesh,
-                                       std::get<std::vector<DbRefGeometryObject>>(objects)))
+                                   Misc::compress(serialize(mSettings.mRecast, mAgentBounds, *recastMesh,
+                                       std::get<std::vector<DbRefGeometryObject>>(objects))))
                                .has_value();
             }
         }
@@ -321,8 +322,8 @@ namespace
         ShapeId nextShapeId{ 1 };
         const std::vector<DbRefGeometryObject> objects = makeDbRefGeometryObjects(recastMesh->getMeshSources(),
             [&](const MeshSource& v) { return resolveMeshSource(*dbPtr, v, nextShapeId); });
-        const auto tile = dbPtr->findTile(
-            mWorldspace, tilePosition, serialize(mSettings.mRecast, agentBounds, *recastMesh, objects));
+        const auto tile = dbPtr->findTile(mWorldspace, tilePosition,
+            Misc::compress(serialize(mSettings.mRecast, agentBounds, *recastMesh, objects)));
         ASSERT_TRUE(tile.has_value());
         EXPECT_EQ(tile->mTileId, 2);
         EXPECT_EQ(tile->mVersion, navMeshFormatVersion);
@@ -177,6 +177,41 @@ namespace
             << mPath;
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, find_path_with_corridor_should_return_same_path_as_full_search)
+    {
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(defaultHeightfieldData);
+        const int cellSize = heightfieldTileSize * static_cast<int>(surface.mSize - 1);
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        auto updateGuard = mNavigator->makeUpdateGuard();
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface, updateGuard.get());
+        mNavigator->update(mPlayerPosition, updateGuard.get());
+        updateGuard.reset();
+        mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+
+        PathCorridor corridor;
+        ASSERT_EQ(
+            findPath(*mNavigator, mAgentBounds, corridor, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+            Status::Success);
+        const std::deque<osg::Vec3f> firstPath = std::move(mPath);
+        ASSERT_FALSE(corridor.mPolygonPath.empty());
+
+        mPath.clear();
+        mOut = std::back_inserter(mPath);
+        EXPECT_EQ(
+            findPath(*mNavigator, mAgentBounds, corridor, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+            Status::Success);
+        EXPECT_EQ(mPath, firstPath) << mPath;
+
+        mPath.clear();
+        mOut = std::back_inserter(mPath);
+        const osg::Vec3f movedEnd = mEnd + osg::Vec3f(0, 128, 0);
+        EXPECT_EQ(findPath(*mNavigator, mAgentBounds, corridor, mStart, movedEnd, Flag_walk, mAreaCosts, mEndTolerance,
+                      mOut),
+            Status::Success);
+        EXPECT_FALSE(mPath.empty());
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, find_path_to_the_start_position_should_contain_single_point)
     {
         const HeightfieldSurface surface = makeSquareHeightfieldSurface(defaultHeightfieldData);
@@ -724,6 +759,27 @@ namespace
             << (result ? *result : osg::Vec3f());
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, raycast_with_cache_should_return_same_position_as_without)
+    {
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(defaultHeightfieldData);
+        const int cellSize = heightfieldTileSize * static_cast<int>(surface.mSize - 1);
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface, nullptr);
+        mNavigator->update(mPlayerPosition, nullptr);
+        mNavigator->wait(WaitConditionType::allJobsDone, &mListener);
+
+        const osg::Vec3f start(57, 460, 1);
+        const osg::Vec3f end(460, 57, 1);
+        const auto expected = raycast(*mNavigator, mAgentBounds, start, end, Flag_walk);
+
+        RaycastCache cache;
+        const auto result = raycast(*mNavigator, mAgentBounds, cache, start, end, Flag_walk);
+        EXPECT_EQ(result, expected);
+        const auto cached = raycast(*mNavigator, mAgentBounds, cache, start, end, Flag_walk);
+        EXPECT_EQ(cached, expected);
+    }
+
     TEST_F(DetourNavigatorNavigatorTest,
         update_for_oscillating_object_that_does_not_change_navmesh_should_not_trigger_navmesh_update)
     {
@@ -561,4 +561,55 @@ namespace
         expected.mMinY = 1;
         EXPECT_EQ(recastMesh->getHeightfields(), std::vector<Heightfield>({ expected }));
     }
+
+    TEST_F(DetourNavigatorRecastMeshBuilderTest, make_object_triangles_should_produce_same_mesh_as_add_object)
+    {
+        btTriangleMesh mesh;
+        mesh.addTriangle(btVector3(-1, -1, 0), btVector3(-1, 1, 0), btVector3(1, -1, 0));
+        btBvhTriangleMeshShape shape(&mesh, true);
+        const btTransform transform(btMatrix3x3::getIdentity().scaled(btVector3(1, 2, 3)), btVector3(1, 2, 3));
+
+        const std::vector<RecastMeshTriangle> triangles
+            = RecastMeshBuilder::makeObjectTriangles(shape, transform, AreaType_ground);
+
+        RecastMeshBuilder builder(mBounds);
+        builder.addObject(triangles, AreaType_ground, mSource, mObjectTransform);
+        const auto recastMesh = std::move(builder).create(mVersion);
+
+        RecastMeshBuilder expectedBuilder(mBounds);
+        expectedBuilder.addObject(
+            static_cast<const btCollisionShape&>(shape), transform, AreaType_ground, mSource, mObjectTransform);
+        const auto expected = std::move(expectedBuilder).create(mVersion);
+
+        EXPECT_EQ(recastMesh->getMesh().getVertices(), expected->getMesh().getVertices());
+        EXPECT_EQ(recastMesh->getMesh().getIndices(), expected->getMesh().getIndices());
+        EXPECT_EQ(recastMesh->getMesh().getAreaTypes(), expected->getMesh().getAreaTypes());
+    }
+
+    TEST_F(DetourNavigatorRecastMeshBuilderTest, add_object_triangles_should_filter_by_tile_bounds)
+    {
+        btTriangleMesh mesh;
+        mesh.addTriangle(btVector3(-1, -1, 0), btVector3(-1, 1, 0), btVector3(1, -1, 0));
+        mesh.addTriangle(btVector3(9, 9, 0), btVector3(9, 11, 0), btVector3(11, 9, 0));
+        btBvhTriangleMeshShape shape(&mesh, true);
+
+        const std::vector<RecastMeshTriangle> triangles
+            = RecastMeshBuilder::makeObjectTriangles(shape, btTransform::getIdentity(), AreaType_ground);
+        EXPECT_EQ(triangles.size(), 2);
+
+        mBounds.mMin = osg::Vec2f(-2, -2);
+        mBounds.mMax = osg::Vec2f(2, 2);
+        RecastMeshBuilder builder(mBounds);
+        builder.addObject(triangles, AreaType_ground, mSource, mObjectTransform);
+        const auto recastMesh = std::move(builder).create(mVersion);
+        EXPECT_EQ(recastMesh->getMesh().getVertices(),
+            std::vector<float>({
+                -1, -1, 0, // vertex 0
+                -1, 1, 0, // vertex 1
+                1, -1, 0, // vertex 2
+            }))
+            << recastMesh->getMesh().getVertices();
+        EXPECT_EQ(recastMesh->getMesh().getIndices(), std::vector<int>({ 2, 1, 0 }));
+        EXPECT_EQ(recastMesh->getMesh().getAreaTypes(), std::vector<AreaType>({ AreaType_ground }));
+    }
 }
@@ -81,4 +81,21 @@ namespace
         mBoxShapeImpl.setLocalScaling(btVector3(2, 2, 2));
         EXPECT_TRUE(object.update(mTransform, AreaType_ground));
     }
+
+    TEST_F(DetourNavigatorRecastMeshObjectTest, update_with_changes_should_reset_triangles)
+    {
+        RecastMeshObject object(mBoxShape, mTransform, AreaType_ground);
+        object.setTriangles(std::make_shared<const std::vector<RecastMeshTriangle>>());
+        ASSERT_NE(object.getTriangles(), nullptr);
+        EXPECT_TRUE(object.update(btTransform::getIdentity(), AreaType_ground));
+        EXPECT_EQ(object.getTriangles(), nullptr);
+    }
+
+    TEST_F(DetourNavigatorRecastMeshObjectTest, update_without_changes_should_keep_triangles)
+    {
+        RecastMeshObject object(mBoxShape, mTransform, AreaType_ground);
+        object.setTriangles(std::make_shared<const std::vector<RecastMeshTriangle>>());
+        EXPECT_FALSE(object.update(mTransform, AreaType_ground));
+        EXPECT_NE(object.getTriangles(), nullptr);
+    }
 }
@@ -0,0 +1,42 @@
+#include <components/detournavigator/tilegenerationtimings.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace DetourNavigator
+{
+    namespace
+    {
+        using namespace testing;
+
+        TEST(DetourNavigatorTileGenerationTimingsTest, add_should_fill_log2_buckets)
+        {
+            TileGenerationTimings timings;
+            timings.add(TileGenerationPhase::Rasterization, std::chrono::microseconds(1));
+            timings.add(TileGenerationPhase::Rasterization, std::chrono::microseconds(3));
+            timings.add(TileGenerationPhase::Rasterization, std::chrono::milliseconds(1));
+            const TileGenerationTimingsStats stats = timings.getStats();
+            const TileGenerationPhaseStats& phase
+                = stats.mPhases[static_cast<std::size_t>(TileGenerationPhase::Rasterization)];
+            EXPECT_EQ(phase.mCount, 3);
+            EXPECT_EQ(phase.mTotalMicroseconds, 1004);
+            EXPECT_EQ(phase.mHistogram[0], 1);
+            EXPECT_EQ(phase.mHistogram[1], 1);
+            EXPECT_EQ(phase.mHistogram[9], 1);
+        }
+
+        TEST(DetourNavigatorTileGenerationTimingsTest, add_should_clamp_outliers_to_last_bucket)
+        {
+            TileGenerationTimings timings;
+            timings.add(TileGenerationPhase::Polygonization, std::chrono::hours(1));
+            timings.add(TileGenerationPhase::Polygonization, -std::chrono::microseconds(1));
+            const TileGenerationTimingsStats stats = timings.getStats();
+            const TileGenerationPhaseStats& phase
+                = stats.mPhases[static_cast<std::size_t>(TileGenerationPhase::Polygonization)];
+            EXPECT_EQ(phase.mCount, 2);
+            EXPECT_EQ(phase.mHistogram[tileGenerationTimingsBuckets - 1], 1);
+            EXPECT_EQ(phase.mHistogram[0], 1);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#include <components/esm3/compressedsave.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+namespace ESM
+{
+    namespace
+    {
+        using namespace testing;
+
+        std::string generateData(std::size_t size)
+        {
+            std::string result(size, '\0');
+            for (std::size_t i = 0; i < size; ++i)
+                result[i] = static_cast<char>(i % 251);
+            return result;
+        }
+
+        TEST(Esm3CompressedSaveTest, decompressSaveIsInverseToCompressSave)
+        {
+            // Larger than one frame to exercise the frame split
+            const std::string data = generateData(3 * 1024 * 1024 + 17);
+            std::istringstream plain(data, std::ios::binary);
+            std::stringstream compressed(std::ios::in | std::ios::out | std::ios::binary);
+            compressSave(plain, compressed);
+            EXPECT_LT(compressed.str().size(), data.size());
+            const std::unique_ptr<std::istream> decompressed = decompressSave(compressed);
+            std::string result(data.size(), '\0');
+            decompressed->read(result.data(), result.size());
+            EXPECT_EQ(decompressed->gcount(), static_cast<std::streamsize>(result.size()));
+            EXPECT_EQ(result, data);
+            EXPECT_TRUE(decompressed->get() == std::istream::traits_type::eof());
+        }
+
+        TEST(Esm3CompressedSaveTest, isCompressedSaveShouldDetectContainerAndKeepPosition)
+        {
+            std::istringstream plain(generateData(64), std::ios::binary);
+            std::stringstream compressed(std::ios::in | std::ios::out | std::ios::binary);
+            compressSave(plain, compressed);
+            EXPECT_TRUE(isCompressedSave(compressed));
+            EXPECT_EQ(compressed.tellg(), std::streampos(0));
+        }
+
+        TEST(Esm3CompressedSaveTest, isCompressedSaveShouldRejectPlainStream)
+        {
+            std::istringstream plain("TES3 is not a compressed save", std::ios::binary);
+            EXPECT_FALSE(isCompressedSave(plain));
+            EXPECT_EQ(plain.tellg(), std::streampos(0));
+        }
+
+        TEST(Esm3CompressedSaveTest, isCompressedSaveShouldRejectShortStream)
+        {
+            std::istringstream plain("OMW", std::ios::binary);
+            EXPECT_FALSE(isCompressedSave(plain));
+        }
+
+        TEST(Esm3CompressedSaveTest, decompressSaveShouldThrowOnTruncatedFrame)
+        {
+            std::istringstream plain(generateData(1024), std::ios::binary);
+            std::stringstream compressed(std::ios::in | std::ios::out | std::ios::binary);
+            compressSave(plain, compressed);
+            std::string truncated = compressed.str();
+            truncated.resize(truncated.size() / 2);
+            std::istringstream input(truncated, std::ios::binary);
+            EXPECT_THROW(decompressSave(input), std::runtime_error);
+        }
+    }
+}
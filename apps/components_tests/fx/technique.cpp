@@ -105,7 +105,8 @@ namespace
         void compile(const std::string& name)
         {
             mTechnique = std::make_unique<Technique>(*mVFS.get(), mImageManager, name, 1, 1, true, true);
-            mTechnique->compile();
+            if (mTechnique->compile())
+                mTechnique->compilePasses();
         }
     };
 
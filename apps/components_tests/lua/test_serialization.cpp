@@ -193,6 +193,44 @@ namespace
         EXPECT_ERROR(lua.safe_script("ro_t.nested.x = 5"), "userdata value");
     }
 
+    TEST(LuaSerializationTest, StringInterning)
+    {
+        sol::state lua;
+        sol::table table(lua, sol::create);
+        for (int i = 1; i <= 3; i++)
+        {
+            sol::table item(lua, sol::create);
+            item["questState"] = i;
+            item["journalIndex"] = i * 10;
+            table[i] = item;
+        }
+
+        std::string serialized = LuaUtil::serialize(table);
+        // Each key is stored in full only once; its later occurrences are 3-byte back-references:
+        // version, table start, 3x (key number, table start, 2x (key, value number), table end), table end.
+        // The first item stores the keys inline (11 + 13 bytes), the other two reference them (3 + 3 bytes).
+        EXPECT_EQ(serialized.size(), 126);
+
+        sol::table res = LuaUtil::deserialize(lua, serialized);
+        for (int i = 1; i <= 3; i++)
+        {
+            EXPECT_EQ(res.get<sol::table>(i).get<int>("questState"), i);
+            EXPECT_EQ(res.get<sol::table>(i).get<int>("journalIndex"), i * 10);
+        }
+    }
+
+    TEST(LuaSerializationTest, FormatVersion0)
+    {
+        sol::state lua;
+        // A version 0 stream never contains back-references; apart from that the encoding is unchanged,
+        // so patching the version byte produces valid version 0 data.
+        std::string serialized = LuaUtil::serialize(sol::make_object<std::string_view>(lua, "hello"));
+        serialized[0] = 0;
+        sol::object value = LuaUtil::deserialize(lua, serialized);
+        ASSERT_TRUE(value.is<std::string>());
+        EXPECT_EQ(value.as<std::string>(), "hello");
+    }
+
     struct TestStruct1
     {
         double a, b;
@@ -0,0 +1,61 @@
+#include <components/misc/framearena.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+
+namespace Misc
+{
+    namespace
+    {
+        TEST(MiscFrameArenaTest, allocateShouldReturnAlignedMemory)
+        {
+            FrameArena arena;
+            void* pointer = arena.allocate(1, 1);
+            void* aligned = arena.allocate(sizeof(double), alignof(double));
+            EXPECT_NE(pointer, nullptr);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % alignof(double), 0);
+        }
+
+        TEST(MiscFrameArenaTest, allocateShouldHandleAllocationsLargerThanAPage)
+        {
+            FrameArena arena;
+            constexpr std::size_t size = 1024 * 1024;
+            char* pointer = static_cast<char*>(arena.allocate(size, alignof(char)));
+            ASSERT_NE(pointer, nullptr);
+            pointer[0] = 1;
+            pointer[size - 1] = 2;
+            EXPECT_EQ(pointer[0], 1);
+            EXPECT_EQ(pointer[size - 1], 2);
+        }
+
+        TEST(MiscFrameArenaTest, resetShouldReuseMemory)
+        {
+            FrameArena arena;
+            void* first = arena.allocate(64, 8);
+            arena.reset();
+            void* second = arena.allocate(64, 8);
+            EXPECT_EQ(first, second);
+        }
+
+        TEST(MiscFrameArenaTest, frameVectorShouldBehaveLikeVector)
+        {
+            FrameArena::instance().reset();
+            FrameVector<int> values;
+            for (int i = 0; i < 1000; ++i)
+                values.push_back(i);
+            EXPECT_EQ(values.size(), 1000);
+            EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 499500);
+        }
+
+        TEST(MiscFrameArenaTest, frameVectorsShouldNotOverlap)
+        {
+            FrameArena::instance().reset();
+            FrameVector<int> a(100, 1);
+            FrameVector<int> b(100, 2);
+            EXPECT_EQ(std::accumulate(a.begin(), a.end(), 0), 100);
+            EXPECT_EQ(std::accumulate(b.begin(), b.end(), 0), 200);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#include <components/misc/stablechunkedlist.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace Misc
+{
+    namespace
+    {
+        using TestList = StableChunkedList<std::string, 4>;
+
+        std::vector<std::string> toVector(const TestList& list)
+        {
+            return std::vector<std::string>(list.begin(), list.end());
+        }
+
+        TEST(MiscStableChunkedListTest, pushBackShouldPreserveInsertionOrder)
+        {
+            TestList list;
+            for (int i = 0; i < 10; ++i)
+                list.push_back(std::to_string(i));
+            EXPECT_EQ(list.size(), 10);
+            EXPECT_EQ(list.front(), "0");
+            EXPECT_EQ(toVector(list),
+                std::vector<std::string>({ "0", "1", "2", "3", "4", "5", "6", "7", "8", "9" }));
+        }
+
+        TEST(MiscStableChunkedListTest, pushBackShouldNotInvalidateElementAddresses)
+        {
+            TestList list;
+            std::vector<const std::string*> addresses;
+            for (int i = 0; i < 10; ++i)
+                addresses.push_back(&list.push_back(std::to_string(i)));
+            for (int i = 0; i < 10; ++i)
+                EXPECT_EQ(*addresses[i], std::to_string(i));
+        }
+
+        TEST(MiscStableChunkedListTest, eraseShouldRemoveOnlyGivenElement)
+        {
+            TestList list;
+            for (int i = 0; i < 6; ++i)
+                list.push_back(std::to_string(i));
+            for (auto it = list.begin(); it != list.end();)
+            {
+                if (*it == "1" || *it == "4")
+                    it = list.erase(it);
+                else
+                    ++it;
+            }
+            EXPECT_EQ(list.size(), 4);
+            EXPECT_EQ(toVector(list), std::vector<std::string>({ "0", "2", "3", "5" }));
+        }
+
+        TEST(MiscStableChunkedListTest, eraseShouldNotInvalidateAddressesOfOtherElements)
+        {
+            TestList list;
+            std::vector<const std::string*> addresses;
+            for (int i = 0; i < 6; ++i)
+                addresses.push_back(&list.push_back(std::to_string(i)));
+            auto it = list.begin();
+            ++it;
+            list.erase(it);
+            EXPECT_EQ(*addresses[0], "0");
+            for (int i = 2; i < 6; ++i)
+                EXPECT_EQ(*addresses[i], std::to_string(i));
+        }
+
+        TEST(MiscStableChunkedListTest, eraseLastElementShouldReturnEnd)
+        {
+            TestList list;
+            list.push_back("a");
+            EXPECT_EQ(list.erase(list.begin()), list.end());
+            EXPECT_TRUE(list.empty());
+        }
+
+        TEST(MiscStableChunkedListTest, copyShouldPreserveContent)
+        {
+            TestList list;
+            for (int i = 0; i < 5; ++i)
+                list.push_back(std::to_string(i));
+            list.erase(list.begin());
+            const TestList copy(list);
+            EXPECT_EQ(toVector(copy), toVector(list));
+        }
+
+        TEST(MiscStableChunkedListTest, clearShouldMakeContainerEmptyAndReusable)
+        {
+            TestList list;
+            for (int i = 0; i < 5; ++i)
+                list.push_back(std::to_string(i));
+            list.clear();
+            EXPECT_TRUE(list.empty());
+            list.push_back("a");
+            EXPECT_EQ(list.size(), 1);
+            EXPECT_EQ(list.front(), "a");
+        }
+    }
+}
@@ -373,5 +373,73 @@ namespace Resource
             cache->addEntryToObjectCache(key, value);
             EXPECT_TRUE(cache->checkInObjectCache(std::string_view("key"), 0));
         }
+
+        constexpr std::size_t unitSize(const osg::Object* /*value*/)
+        {
+            return 1;
+        }
+
+        TEST(ResourceGenericObjectCacheTest, removeLeastRecentlyUsedShouldDoNothingWhileUnderCapacity)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            cache->addEntryToObjectCache(1, nullptr, 1);
+            cache->addEntryToObjectCache(2, nullptr, 2);
+
+            cache->removeLeastRecentlyUsed(2, unitSize);
+
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(1), Optional(_));
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(2), Optional(_));
+        }
+
+        TEST(ResourceGenericObjectCacheTest, removeLeastRecentlyUsedShouldRemoveOldestItemsFirst)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            cache->addEntryToObjectCache(1, nullptr, 2);
+            cache->addEntryToObjectCache(2, nullptr, 1);
+            cache->addEntryToObjectCache(3, nullptr, 3);
+
+            cache->removeLeastRecentlyUsed(1, unitSize);
+
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(1), std::nullopt);
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(2), std::nullopt);
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(3), Optional(_));
+            EXPECT_EQ(cache->getStats().mExpired, 2);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, removeLeastRecentlyUsedShouldKeepExternallyReferencedItems)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            osg::ref_ptr<Object> value(new Object);
+            cache->addEntryToObjectCache(1, value, 1);
+            cache->addEntryToObjectCache(2, nullptr, 2);
+
+            cache->removeLeastRecentlyUsed(1, unitSize);
+
+            EXPECT_EQ(cache->getRefFromObjectCache(1), value);
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(2), std::nullopt);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, removeLeastRecentlyUsedShouldMeasureItemsWithGivenFunction)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+
+            osg::ref_ptr<Object> small(new Object);
+            osg::ref_ptr<Object> big(new Object);
+            const osg::Object* const bigPtr = big.get();
+            cache->addEntryToObjectCache(1, small, 1);
+            cache->addEntryToObjectCache(2, big, 2);
+            small = nullptr;
+            big = nullptr;
+
+            const auto getSize = [&](const osg::Object* value) -> std::size_t { return value == bigPtr ? 10 : 1; };
+
+            cache->removeLeastRecentlyUsed(10, getSize);
+
+            EXPECT_EQ(cache->getRefFromObjectCacheOrNone(1), std::nullopt);
+            EXPECT_THAT(cache->getRefFromObjectCacheOrNone(2), Optional(_));
+        }
     }
 }
@@ -56,6 +56,19 @@ namespace
         EXPECT_EQ(mSource, "13\n");
     }
 
+    TEST_F(ShaderParseDefinesTest, should_report_used_global_defines)
+    {
+        mDefines["foo"] = "13";
+        mGlobalDefines["foo"] = "42";
+        mGlobalDefines["bar"] = "1";
+        mGlobalDefines["baz"] = "2";
+        mSource = "@foo @bar\n";
+        std::set<std::string> usedGlobalDefines;
+        ASSERT_TRUE(parseDefines(mSource, mDefines, mGlobalDefines, mName, &usedGlobalDefines));
+        EXPECT_EQ(mSource, "13 1\n");
+        EXPECT_THAT(usedGlobalDefines, ElementsAre("bar"));
+    }
+
     namespace SupportedTerminals
     {
         struct ShaderParseDefinesTest : ::ShaderParseDefinesTest, WithParamInterface<char>
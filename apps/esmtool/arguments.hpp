@@ -23,6 +23,8 @@ namespace EsmTool
 
         std::vector<std::string> types;
         std::string name;
+
+        int threads = 1;
     };
 }
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <deque>
 #include <fstream>
@@ -6,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -73,6 +76,9 @@ Allowed options)");
             "Only affects dump mode.");
         addOption("quiet,q", "Suppress all record information. Useful for speed tests.");
         addOption("loadcells,C", "Browse through contents of all cells.");
+        addOption("threads", bpo::value<int>()->default_value(1),
+            "Parse records with this many worker threads in dump mode. "
+            "The output is identical to a single threaded dump.");
 
         addOption("encoding,e", bpo::value<std::string>(&(info.encoding))->default_value("win1252"),
             "Character encoding used in ESMTool:\n"
@@ -169,6 +175,7 @@ Allowed options)");
         info.quiet_given = variables.count("quiet") != 0;
         info.loadcells_given = variables.count("loadcells") != 0;
         info.plain_given = variables.count("plain") != 0;
+        info.threads = std::max(1, variables["threads"].as<int>());
 
         // Font encoding settings
         info.encoding = variables["encoding"].as<std::string>();
@@ -184,6 +191,7 @@ Allowed options)");
 
     void loadCell(const Arguments& info, ESM::Cell& cell, ESM::ESMReader& esm, ESMData* data);
 
+    int dumpTes3Parallel(const Arguments& info, ESM::ESMReader& esm);
     int load(const Arguments& info, ESMData* data);
     int clone(const Arguments& info);
     int comp(const Arguments& info);
@@ -222,34 +230,9 @@ int main(int argc, char** argv)
 namespace
 {
 
-    void loadCell(const Arguments& info, ESM::Cell& cell, ESM::ESMReader& esm, ESMData* data)
+    void printCellRef(const ESM::CellRef& ref, bool deleted, const ESM::MovedCellRef& movedCellRef, bool moved)
     {
-        bool quiet = (info.quiet_given || info.mode == "clone");
-        bool save = (info.mode == "clone");
-
-        // Skip back to the beginning of the reference list
-        // FIXME: Changes to the references backend required to support multiple plugins have
-        //  almost certainly broken this following line. I'll leave it as is for now, so that
-        //  the compiler does not complain.
-        cell.restore(esm, 0);
-
-        // Loop through all the references
-        ESM::CellRef ref;
-        if (!quiet)
-            std::cout << "  References:\n";
-
-        bool deleted = false;
-        ESM::MovedCellRef movedCellRef;
-        bool moved = false;
-        while (cell.getNextRef(esm, ref, deleted, movedCellRef, moved))
-        {
-            if (data != nullptr && save)
-                data->mCellRefs[&cell].push_back(std::make_pair(ref, deleted));
-
-            if (quiet)
-                continue;
-
-            std::cout << "  - Refnum: " << ref.mRefNum.mIndex << '\n';
+        std::cout << "  - Refnum: " << ref.mRefNum.mIndex << '\n';
             std::cout << "    ID: " << ref.mRefID << '\n';
             std::cout << "    Position: (" << ref.mPos.pos[0] << ", " << ref.mPos.pos[1] << ", " << ref.mPos.pos[2]
                       << ")\n";
@@ -282,13 +265,43 @@ namespace
                 if (!ref.mDestCell.empty())
                     std::cout << "    Destination cell: " << ref.mDestCell << '\n';
             }
-            std::cout << "    Moved: " << std::boolalpha << moved << std::noboolalpha << '\n';
-            if (moved)
-            {
-                std::cout << "    Moved refnum: " << movedCellRef.mRefNum.mIndex << '\n';
-                std::cout << "    Moved content file: " << movedCellRef.mRefNum.mContentFile << '\n';
-                std::cout << "    Target: " << movedCellRef.mTarget[0] << ", " << movedCellRef.mTarget[1] << '\n';
-            }
+        std::cout << "    Moved: " << std::boolalpha << moved << std::noboolalpha << '\n';
+        if (moved)
+        {
+            std::cout << "    Moved refnum: " << movedCellRef.mRefNum.mIndex << '\n';
+            std::cout << "    Moved content file: " << movedCellRef.mRefNum.mContentFile << '\n';
+            std::cout << "    Target: " << movedCellRef.mTarget[0] << ", " << movedCellRef.mTarget[1] << '\n';
+        }
+    }
+
+    void loadCell(const Arguments& info, ESM::Cell& cell, ESM::ESMReader& esm, ESMData* data)
+    {
+        bool quiet = (info.quiet_given || info.mode == "clone");
+        bool save = (info.mode == "clone");
+
+        // Skip back to the beginning of the reference list
+        // FIXME: Changes to the references backend required to support multiple plugins have
+        //  almost certainly broken this following line. I'll leave it as is for now, so that
+        //  the compiler does not complain.
+        cell.restore(esm, 0);
+
+        // Loop through all the references
+        ESM::CellRef ref;
+        if (!quiet)
+            std::cout << "  References:\n";
+
+        bool deleted = false;
+        ESM::MovedCellRef movedCellRef;
+        bool moved = false;
+        while (cell.getNextRef(esm, ref, deleted, movedCellRef, moved))
+        {
+            if (data != nullptr && save)
+                data->mCellRefs[&cell].push_back(std::make_pair(ref, deleted));
+
+            if (quiet)
+                continue;
+
+            printCellRef(ref, deleted, movedCellRef, moved);
         }
     }
 
@@ -316,6 +329,155 @@ namespace
         }
     }
 
+    // A record parsed by a dump worker, ready to be printed in file order.
+    struct ParsedRecord
+    {
+        ESM::NAME mName;
+        std::unique_ptr<EsmTool::RecordBase> mRecord;
+        bool mInterested = true;
+
+        struct Ref
+        {
+            ESM::CellRef mRef;
+            bool mDeleted = false;
+            ESM::MovedCellRef mMoved;
+            bool mIsMoved = false;
+        };
+        std::vector<Ref> mRefs;
+    };
+
+    int dumpTes3Parallel(const Arguments& info, ESM::ESMReader& esm)
+    {
+        const bool quiet = info.quiet_given;
+        const bool loadCells = info.loadcells_given;
+
+        // Index the records with the already open reader. Contexts store the file
+        // position, so a worker's reader can pick up parsing from any of them.
+        std::vector<ESM::ESM_Context> contexts;
+        while (esm.hasMoreRecs())
+        {
+            contexts.push_back(esm.getContext());
+            esm.getRecName();
+            esm.getRecHeader();
+            esm.skipRecord();
+        }
+
+        // Parse chunks of records in parallel. Each worker owns its reader and
+        // encoder; restoreContext() reopens the input file as needed.
+        constexpr std::size_t chunkSize = 1024;
+        const std::size_t chunkCount = (contexts.size() + chunkSize - 1) / chunkSize;
+        std::vector<std::vector<ParsedRecord>> chunks(chunkCount);
+        std::vector<std::string> errors(chunkCount);
+        std::atomic<std::size_t> nextChunk{ 0 };
+
+        const auto worker = [&] {
+            ESM::ESMReader reader;
+            ToUTF8::Utf8Encoder encoder(ToUTF8::calculateEncoding(info.encoding));
+            reader.setEncoder(&encoder);
+
+            for (std::size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+            {
+                const std::size_t begin = chunk * chunkSize;
+                const std::size_t end = std::min(begin + chunkSize, contexts.size());
+                std::vector<ParsedRecord>& parsed = chunks[chunk];
+                parsed.reserve(end - begin);
+                try
+                {
+                    reader.restoreContext(contexts[begin]);
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        ParsedRecord& out = parsed.emplace_back();
+                        out.mName = reader.getRecName();
+                        uint32_t flags;
+                        reader.getRecHeader(flags);
+
+                        out.mRecord = EsmTool::RecordBase::create(out.mName);
+                        if (out.mRecord == nullptr)
+                        {
+                            reader.skipRecord();
+                            continue;
+                        }
+
+                        out.mRecord->setFlags(static_cast<int>(flags));
+                        out.mRecord->setPrintPlain(info.plain_given);
+                        out.mRecord->load(reader);
+
+                        if (!info.types.empty()
+                            && std::find(info.types.begin(), info.types.end(), out.mName.toStringView())
+                                == info.types.end())
+                            out.mInterested = false;
+                        if (!info.name.empty() && !Misc::StringUtils::ciEqual(info.name, out.mRecord->getId()))
+                            out.mInterested = false;
+
+                        if (out.mRecord->getType().toInt() == ESM::REC_CELL && loadCells && out.mInterested)
+                        {
+                            ESM::Cell& cell = out.mRecord->cast<ESM::Cell>()->get();
+                            cell.restore(reader, 0);
+                            ParsedRecord::Ref ref;
+                            while (cell.getNextRef(reader, ref.mRef, ref.mDeleted, ref.mMoved, ref.mIsMoved))
+                                out.mRefs.push_back(ref);
+                        }
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    errors[chunk] = e.what();
+                }
+            }
+        };
+
+        const std::size_t threadCount = std::min<std::size_t>(info.threads, std::max<std::size_t>(chunkCount, 1));
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < threadCount; ++i)
+            threads.emplace_back(worker);
+        for (std::thread& thread : threads)
+            thread.join();
+
+        // Print the parsed records in file order.
+        std::unordered_set<uint32_t> skipped;
+        for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            for (const ParsedRecord& record : chunks[chunk])
+            {
+                if (record.mRecord == nullptr)
+                {
+                    if (!quiet)
+                    {
+                        if (skipped.count(record.mName.toInt()) == 0)
+                        {
+                            std::cout << "Skipping " << record.mName.toStringView() << " records.\n";
+                            skipped.emplace(record.mName.toInt());
+                        }
+                        std::cout << "  Skipping\n";
+                    }
+                    continue;
+                }
+
+                if (quiet || !record.mInterested)
+                    continue;
+
+                std::cout << "\nRecord: " << record.mName.toStringView() << " " << record.mRecord->getId() << "\n"
+                          << "Record flags: " << recordFlags(record.mRecord->getFlags()) << '\n';
+                record.mRecord->print();
+
+                if (record.mRecord->getType().toInt() == ESM::REC_CELL && loadCells)
+                {
+                    std::cout << "  References:\n";
+                    for (const ParsedRecord::Ref& ref : record.mRefs)
+                        printCellRef(ref.mRef, ref.mDeleted, ref.mMoved, ref.mIsMoved);
+                }
+            }
+
+            if (!errors[chunk].empty())
+            {
+                std::cout << "\nERROR:\n\n  " << errors[chunk] << std::endl;
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+
     int loadTes3(const Arguments& info, std::unique_ptr<std::ifstream>&& stream, ESMData* data)
     {
         std::cout << "Loading TES3 file: " << info.filename << '\n';
@@ -351,6 +513,9 @@ namespace
                 }
             }
 
+            if (info.threads > 1 && data == nullptr && info.mode == "dump")
+                return dumpTes3Parallel(info, esm);
+
             // Loop through all records
             while (esm.hasMoreRecs())
             {
@@ -2,7 +2,9 @@
 
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iomanip>
+#include <sstream>
 
 #include <osg/ImageUtils>
 #include <osgDB/ReadFile>
@@ -23,6 +25,7 @@
 #include <components/esm3/loadspel.hpp>
 #include <components/esm3/loadweap.hpp>
 
+#include <components/files/conversion.hpp>
 #include <components/misc/constants.hpp>
 
 #include <components/to_utf8/to_utf8.hpp>
@@ -34,12 +37,12 @@
 namespace
 {
 
-    void writeScreenshot(const ESM::Header& fileHeader, ESM::SavedGame& out)
+    std::vector<char> encodeScreenshot(const ESM::Header& fileHeader)
     {
         if (fileHeader.mSCRS.size() != 128 * 128 * 4)
         {
             std::cerr << "Error: unexpected screenshot size " << std::endl;
-            return;
+            return {};
         }
 
         osg::ref_ptr<osg::Image> image(new osg::Image);
@@ -67,7 +70,7 @@ namespace
         if (!readerwriter)
         {
             std::cerr << "Error: can't write screenshot: no jpg readerwriter found" << std::endl;
-            return;
+            return {};
         }
 
         osgDB::ReaderWriter::WriteResult result = readerwriter->writeImage(*image, ostream);
@@ -75,11 +78,11 @@ namespace
         {
             std::cerr << "Error: can't write screenshot: " << result.message() << " code " << result.status()
                       << std::endl;
-            return;
+            return {};
         }
 
         std::string data = ostream.str();
-        out.mScreenshot = std::vector<char>(data.begin(), data.end());
+        return std::vector<char>(data.begin(), data.end());
     }
 
 }
@@ -267,6 +270,11 @@ namespace ESSImport
         const ESM::Header& header = esm.getHeader();
         context.mPlayerCellName = header.mGameData.mCurrentCell.toString();
 
+        // The thumbnail only depends on the file header, so encode it while the records
+        // are being read and converted.
+        std::future<std::vector<char>> screenshot
+            = std::async(std::launch::async, [&header] { return encodeScreenshot(header); });
+
         const unsigned int recREFR = ESM::fourCC("REFR");
         const unsigned int recPCDT = ESM::fourCC("PCDT");
         const unsigned int recFMAP = ESM::fourCC("FMAP");
@@ -350,7 +358,10 @@ namespace ESSImport
 
         writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
 
-        std::ofstream stream(mOutFile, std::ios::out | std::ios::binary);
+        // Serialize to memory first: ESMWriter patches record headers by seeking
+        // backwards, which is much cheaper in a memory buffer, and the finished save is
+        // then written to the file in one batch.
+        std::stringstream stream;
         // all unused
         writer.setVersion(0);
         writer.setType(0);
@@ -382,7 +393,7 @@ namespace ESSImport
         profile.mPlayerLevel = context.mPlayerBase.mNpdt.mLevel;
         profile.mPlayerName = header.mGameData.mPlayerName.toString();
 
-        writeScreenshot(header, profile);
+        profile.mScreenshot = screenshot.get();
 
         writer.startRecord(ESM::REC_SAVE);
         profile.save(writer);
@@ -437,6 +448,11 @@ namespace ESSImport
         writer.startRecord(ESM::REC_INPU);
         context.mControlsState.save(writer);
         writer.endRecord(ESM::REC_INPU);
+
+        std::ofstream file(mOutFile, std::ios::out | std::ios::binary);
+        file << stream.rdbuf();
+        if (file.fail())
+            throw std::runtime_error("Failed to write output file: " + Files::pathToUnicodeString(mOutFile));
     }
 
 }
@@ -1,5 +1,10 @@
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -18,11 +23,15 @@ Allowed options)");
         bpo::positional_options_description p_desc;
         auto addOption = desc.add_options();
         addOption("help,h", "produce help message");
-        addOption("mwsave,m", bpo::value<Files::MaybeQuotedPath>(), "morrowind .ess save file");
-        addOption("output,o", bpo::value<Files::MaybeQuotedPath>(), "output file (.omwsave)");
+        addOption("mwsave,m", bpo::value<Files::MaybeQuotedPathContainer>()->multitoken(),
+            "morrowind .ess save file(s); pass the option several times to convert a batch");
+        addOption("output,o", bpo::value<Files::MaybeQuotedPath>(),
+            "output file (.omwsave), or an existing directory when converting several saves");
         addOption("compare,c", "compare two .ess files");
         addOption("encoding", boost::program_options::value<std::string>()->default_value("win1252"),
             "encoding of the save file");
+        addOption("jobs,j", bpo::value<int>()->default_value(0),
+            "number of saves to convert in parallel when converting a batch (0: number of hardware threads)");
         p_desc.add("mwsave", 1).add("output", 1);
         Files::ConfigurationManager::addCommonOptions(desc);
 
@@ -42,15 +51,17 @@ Allowed options)");
         Files::ConfigurationManager cfgManager(true);
         cfgManager.readConfiguration(variables, desc);
 
-        const auto& essFile = variables["mwsave"].as<Files::MaybeQuotedPath>();
+        const auto& essFiles = variables["mwsave"].as<Files::MaybeQuotedPathContainer>();
         const auto& outputFile = variables["output"].as<Files::MaybeQuotedPath>();
         std::string encoding = variables["encoding"].as<std::string>();
 
-        ESSImport::Importer importer(essFile, outputFile, encoding);
-
         if (variables.count("compare"))
-            importer.compare();
-        else
+        {
+            if (essFiles.size() != 1)
+                throw std::runtime_error("--compare expects exactly one input file");
+            ESSImport::Importer(essFiles.front(), outputFile, encoding).compare();
+        }
+        else if (essFiles.size() == 1 && !std::filesystem::is_directory(outputFile))
         {
             static constexpr std::u8string_view ext{ u8".omwsave" };
             const auto length = outputFile.native().size();
@@ -60,7 +71,52 @@ Allowed options)");
                 throw std::runtime_error(
                     "Output file already exists and does not end in .omwsave. Did you mean to use --compare?");
             }
-            importer.run();
+            ESSImport::Importer(essFiles.front(), outputFile, encoding).run();
+        }
+        else
+        {
+            // Batch mode: convert the given saves in parallel, one output file per input,
+            // into the output directory.
+            if (!std::filesystem::is_directory(outputFile))
+                throw std::runtime_error("Output must be an existing directory when converting several saves");
+
+            int jobs = variables["jobs"].as<int>();
+            if (jobs <= 0)
+                jobs = std::max<int>(1, std::thread::hardware_concurrency());
+            const std::size_t threadCount = std::min<std::size_t>(essFiles.size(), jobs);
+
+            std::atomic<std::size_t> nextJob{ 0 };
+            std::atomic<bool> failed{ false };
+            std::mutex logMutex;
+            const auto worker = [&] {
+                for (std::size_t i = nextJob++; i < essFiles.size(); i = nextJob++)
+                {
+                    const std::filesystem::path& essFile = essFiles[i];
+                    const std::filesystem::path target
+                        = outputFile / std::filesystem::path(essFile).filename().replace_extension(".omwsave");
+                    try
+                    {
+                        ESSImport::Importer(essFile, target, encoding).run();
+                        std::lock_guard lock(logMutex);
+                        std::cout << essFile << " -> " << target << std::endl;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        failed = true;
+                        std::lock_guard lock(logMutex);
+                        std::cerr << "Error converting " << essFile << ": " << e.what() << std::endl;
+                    }
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (std::size_t i = 0; i < threadCount; ++i)
+                threads.emplace_back(worker);
+            for (std::thread& thread : threads)
+                thread.join();
+
+            if (failed)
+                return 1;
         }
     }
     catch (std::exception& e)
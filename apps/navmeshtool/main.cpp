@@ -115,6 +115,13 @@ namespace NavMeshTool
             addOption("process-interior-cells", bpo::value<bool>()->implicit_value(true)->default_value(false),
                 "build navmesh for interior cells");
 
+            addOption("process-count", bpo::value<std::size_t>()->default_value(1),
+                "total number of navmeshtool processes generating the same navmesh db; tiles are partitioned "
+                "between the processes so each of them generates a disjoint subset");
+
+            addOption("process-index", bpo::value<std::size_t>()->default_value(0),
+                "zero-based index of this process among process-count cooperating processes");
+
             addOption("remove-unused-tiles", bpo::value<bool>()->implicit_value(true)->default_value(false),
                 "remove tiles from cache that will not be used with current content profile");
 
@@ -177,6 +184,21 @@ namespace NavMeshTool
                 return -1;
             }
 
+            const std::size_t processCount = variables["process-count"].as<std::size_t>();
+            const std::size_t processIndex = variables["process-index"].as<std::size_t>();
+
+            if (processCount < 1)
+            {
+                std::cerr << "Invalid process count: " << processCount << ", expected >= 1";
+                return -1;
+            }
+
+            if (processIndex >= processCount)
+            {
+                std::cerr << "Invalid process index: " << processIndex << ", expected < " << processCount;
+                return -1;
+            }
+
             const bool processInteriorCells = variables["process-interior-cells"].as<bool>();
             const bool removeUnusedTiles = variables["remove-unused-tiles"].as<bool>();
             const bool writeBinaryLog = variables["write-binary-log"].as<bool>();
@@ -233,7 +255,7 @@ namespace NavMeshTool
                 navigatorSettings, readers, vfs, bulletShapeManager, esmData, processInteriorCells, writeBinaryLog);
 
             const Status status = generateAllNavMeshTiles(agentBounds, navigatorSettings, threadsNumber,
-                removeUnusedTiles, writeBinaryLog, cellsData, std::move(db));
+                removeUnusedTiles, writeBinaryLog, processCount, processIndex, cellsData, std::move(db));
 
             switch (status)
             {
@@ -78,13 +78,15 @@ namespace NavMeshTool
         public:
             std::atomic_size_t mExpected{ 0 };
 
-            explicit NavMeshTileConsumer(NavMeshDb&& db, bool removeUnusedTiles, bool writeBinaryLog)
+            explicit NavMeshTileConsumer(NavMeshDb&& db, bool removeUnusedTiles, bool writeBinaryLog,
+                std::size_t processCount, std::size_t processIndex)
                 : mDb(std::move(db))
                 , mRemoveUnusedTiles(removeUnusedTiles)
                 , mWriteBinaryLog(writeBinaryLog)
+                , mIdStride(static_cast<std::int64_t>(processCount))
                 , mTransaction(mDb.startTransaction(Sqlite3::TransactionMode::Immediate))
-                , mNextTileId(mDb.getMaxTileId() + 1)
-                , mNextShapeId(mDb.getMaxShapeId() + 1)
+                , mNextTileId(mDb.getMaxTileId() + 1 + static_cast<std::int64_t>(processIndex))
+                , mNextShapeId(mDb.getMaxShapeId() + 1 + static_cast<std::int64_t>(processIndex))
             {
             }
 
@@ -103,15 +105,21 @@ namespace NavMeshTool
             std::int64_t resolveMeshSource(const MeshSource& source) override
             {
                 const std::lock_guard lock(mMutex);
-                return DetourNavigator::resolveMeshSource(mDb, source, mNextShapeId);
+                const std::int64_t before = mNextShapeId;
+                const ShapeId result = DetourNavigator::resolveMeshSource(mDb, source, mNextShapeId);
+                // Skip the shape ids reserved for other processes writing to the same database
+                // when a new shape has been inserted.
+                if (mNextShapeId != before)
+                    mNextShapeId.mValue += mIdStride - 1;
+                return result;
             }
 
-            std::optional<NavMeshTileInfo> find(
-                ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input) override
+            std::optional<NavMeshTileInfo> find(ESM::RefId worldspace, const TilePosition& tilePosition,
+                const std::vector<std::byte>& compressedInput) override
             {
                 std::optional<NavMeshTileInfo> result;
                 std::lock_guard lock(mMutex);
-                if (const auto tile = mDb.findTile(worldspace, tilePosition, input))
+                if (const auto tile = mDb.findTile(worldspace, tilePosition, compressedInput))
                 {
                     NavMeshTileInfo info;
                     info.mTileId = tile->mTileId;
@@ -143,16 +151,16 @@ namespace NavMeshTool
             }
 
             void insert(ESM::RefId worldspace, const TilePosition& tilePosition, std::int64_t version,
-                const std::vector<std::byte>& input, PreparedNavMeshData& data) override
+                const std::vector<std::byte>& compressedInput, PreparedNavMeshData& data) override
             {
                 {
                     std::lock_guard lock(mMutex);
                     if (mRemoveUnusedTiles)
                         mDeleted += static_cast<std::size_t>(mDb.deleteTilesAt(worldspace, tilePosition));
                     data.mUserId = static_cast<unsigned>(mNextTileId);
-                    mDb.insertTile(
-                        mNextTileId, worldspace, tilePosition, TileVersion{ version }, input, serialize(data));
-                    ++mNextTileId;
+                    mDb.insertTile(mNextTileId, worldspace, tilePosition, TileVersion{ version }, compressedInput,
+                        serialize(data));
+                    mNextTileId.mValue += mIdStride;
                 }
                 ++mInserted;
                 report();
@@ -236,6 +244,7 @@ namespace NavMeshTool
             NavMeshDb mDb;
             const bool mRemoveUnusedTiles;
             const bool mWriteBinaryLog;
+            const std::int64_t mIdStride;
             Transaction mTransaction;
             TileId mNextTileId;
             std::condition_variable mHasTile;
@@ -255,13 +264,18 @@ namespace NavMeshTool
     }
 
     Status generateAllNavMeshTiles(const AgentBounds& agentBounds, const Settings& settings, std::size_t threadsNumber,
-        bool removeUnusedTiles, bool writeBinaryLog, WorldspaceData& data, NavMeshDb&& db)
+        bool removeUnusedTiles, bool writeBinaryLog, std::size_t processCount, std::size_t processIndex,
+        WorldspaceData& data, NavMeshDb&& db)
     {
-        Log(Debug::Info) << "Generating navmesh tiles by " << threadsNumber << " parallel workers...";
+        if (processCount > 1)
+            Log(Debug::Info) << "Generating navmesh tiles by " << threadsNumber << " parallel workers as process "
+                             << processIndex << " of " << processCount << "...";
+        else
+            Log(Debug::Info) << "Generating navmesh tiles by " << threadsNumber << " parallel workers...";
 
         SceneUtil::WorkQueue workQueue(threadsNumber);
-        auto navMeshTileConsumer
-            = std::make_shared<NavMeshTileConsumer>(std::move(db), removeUnusedTiles, writeBinaryLog);
+        auto navMeshTileConsumer = std::make_shared<NavMeshTileConsumer>(
+            std::move(db), removeUnusedTiles, writeBinaryLog, processCount, processIndex);
         std::size_t tiles = 0;
         std::mt19937_64 random;
 
@@ -270,7 +284,7 @@ namespace NavMeshTool
             const auto range = DetourNavigator::makeTilesPositionsRange(Misc::Convert::toOsgXY(input->mAabb.m_min),
                 Misc::Convert::toOsgXY(input->mAabb.m_max), settings.mRecast);
 
-            if (removeUnusedTiles)
+            if (removeUnusedTiles && processIndex == 0)
                 navMeshTileConsumer->removeTilesOutsideRange(input->mWorldspace, range);
 
             std::vector<TilePosition> worldspaceTiles;
@@ -278,6 +292,15 @@ namespace NavMeshTool
             DetourNavigator::getTilesPositions(
                 range, [&](const TilePosition& tilePosition) { worldspaceTiles.push_back(tilePosition); });
 
+            if (processCount > 1)
+            {
+                // Tiles are enumerated in the same deterministic order by each process so every
+                // tile is generated by exactly one of them.
+                std::size_t tileIndex = 0;
+                std::erase_if(worldspaceTiles,
+                    [&](const TilePosition&) { return tileIndex++ % processCount != processIndex; });
+            }
+
             tiles += worldspaceTiles.size();
 
             if (writeBinaryLog)
@@ -306,8 +329,14 @@ namespace NavMeshTool
 
         if (inserted + updated + deleted > 0)
         {
-            Log(Debug::Info) << "Vacuuming the database...";
-            navMeshTileConsumer->vacuum();
+            if (processCount > 1)
+                Log(Debug::Info) << "Skipping database vacuum because other processes may still write to it, "
+                                 << "run the tool with --process-count 1 to compact the database";
+            else
+            {
+                Log(Debug::Info) << "Vacuuming the database...";
+                navMeshTileConsumer->vacuum();
+            }
         }
 
         return status;
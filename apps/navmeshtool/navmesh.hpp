@@ -21,9 +21,12 @@ namespace NavMeshTool
         NotEnoughSpace,
     };
 
+    /// When processCount is greater than 1 only every processCount-th tile starting from
+    /// processIndex is generated so several processes can fill the same database in parallel.
     Status generateAllNavMeshTiles(const DetourNavigator::AgentBounds& agentBounds,
         const DetourNavigator::Settings& settings, std::size_t threadsNumber, bool removeUnusedTiles,
-        bool writeBinaryLog, WorldspaceData& cellsData, DetourNavigator::NavMeshDb&& db);
+        bool writeBinaryLog, std::size_t processCount, std::size_t processIndex, WorldspaceData& cellsData,
+        DetourNavigator::NavMeshDb&& db);
 }
 
 #endif
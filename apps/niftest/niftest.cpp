@@ -1,10 +1,15 @@
 /// Program to test .nif files both on the FileSystem and in BSA archives.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <exception>
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -59,50 +64,53 @@ std::unique_ptr<VFS::Archive> makeArchive(const std::filesystem::path& path)
     return nullptr;
 }
 
-void readFile(
-    const std::filesystem::path& source, const std::filesystem::path& path, const VFS::Manager* vfs, bool quiet)
+/// A single file to test, together with the data source it comes from.
+struct ScanJob
 {
-    const std::string pathStr = Files::pathToUnicodeString(path);
-    const bool isNif = isNIF(path);
-    if (!quiet)
+    std::filesystem::path mSource; // archive or directory containing the file, if any
+    std::filesystem::path mPath;
+    const VFS::Manager* mVfs = nullptr;
+};
+
+void readFile(const ScanJob& job)
+{
+    const std::string pathStr = Files::pathToUnicodeString(job.mPath);
+    const std::filesystem::path fullPath = !job.mSource.empty() ? job.mSource / job.mPath : job.mPath;
+    if (isNIF(job.mPath))
     {
-        if (isNif)
-            std::cout << "Reading " << (hasExtension(path, ".nif") ? "NIF" : "KF") << " file '" << pathStr << "'";
+        Nif::NIFFile file(Files::pathToUnicodeString(fullPath));
+        Nif::Reader reader(file, nullptr);
+        if (job.mVfs != nullptr)
+            reader.parse(job.mVfs->get(pathStr));
         else
-            std::cout << "Reading " << (hasExtension(path, ".bgsm") ? "BGSM" : "BGEM") << " file '" << pathStr << "'";
-        if (!source.empty())
-            std::cout << " from '" << Files::pathToUnicodeString(isBSA(source) ? source.filename() : source) << "'";
-        std::cout << std::endl;
+            reader.parse(Files::openConstrainedFileStream(fullPath));
     }
-    const std::filesystem::path fullPath = !source.empty() ? source / path : path;
-    try
+    else
     {
-        if (isNif)
-        {
-            Nif::NIFFile file(Files::pathToUnicodeString(fullPath));
-            Nif::Reader reader(file, nullptr);
-            if (vfs != nullptr)
-                reader.parse(vfs->get(pathStr));
-            else
-                reader.parse(Files::openConstrainedFileStream(fullPath));
-        }
+        if (job.mVfs != nullptr)
+            Bgsm::parse(job.mVfs->get(pathStr));
         else
-        {
-            if (vfs != nullptr)
-                Bgsm::parse(vfs->get(pathStr));
-            else
-                Bgsm::parse(Files::openConstrainedFileStream(fullPath));
-        }
-    }
-    catch (std::exception& e)
-    {
-        std::cerr << "Failed to read '" << pathStr << "':" << std::endl << e.what() << std::endl;
+            Bgsm::parse(Files::openConstrainedFileStream(fullPath));
     }
 }
 
-/// Check all the nif files in a given VFS::Archive
+void printJob(const ScanJob& job)
+{
+    const std::filesystem::path& path = job.mPath;
+    std::cout << "Reading "
+              << (isNIF(path) ? (hasExtension(path, ".nif") ? "NIF" : "KF")
+                              : (hasExtension(path, ".bgsm") ? "BGSM" : "BGEM"))
+              << " file '" << Files::pathToUnicodeString(path) << "'";
+    if (!job.mSource.empty())
+        std::cout << " from '" << Files::pathToUnicodeString(isBSA(job.mSource) ? job.mSource.filename() : job.mSource)
+                  << "'";
+    std::cout << std::endl;
+}
+
+/// Collect all the nif files in a given VFS::Archive
 /// \note Can not read a bsa file inside of a bsa file.
-void readVFS(std::unique_ptr<VFS::Archive>&& archive, const std::filesystem::path& archivePath, bool quiet)
+void collectVFS(std::unique_ptr<VFS::Archive>&& archive, const std::filesystem::path& archivePath, bool quiet,
+    std::vector<std::unique_ptr<VFS::Manager>>& managers, std::vector<ScanJob>& jobs)
 {
     if (archive == nullptr)
         return;
@@ -110,18 +118,18 @@ void readVFS(std::unique_ptr<VFS::Archive>&& archive, const std::filesystem::pat
     if (!quiet)
         std::cout << "Reading data source '" << Files::pathToUnicodeString(archivePath) << "'" << std::endl;
 
-    VFS::Manager vfs;
-    vfs.addArchive(std::move(archive));
-    vfs.buildIndex();
+    auto vfs = std::make_unique<VFS::Manager>();
+    vfs->addArchive(std::move(archive));
+    vfs->buildIndex();
 
-    for (const auto& name : vfs.getRecursiveDirectoryIterator())
+    for (const auto& name : vfs->getRecursiveDirectoryIterator())
     {
         if (isNIF(name.value()) || isMaterial(name.value()))
-        {
-            readFile(archivePath, name.value(), &vfs, quiet);
-        }
+            jobs.push_back({ archivePath, name.value(), vfs.get() });
     }
 
+    managers.push_back(std::move(vfs));
+
     if (!archivePath.empty() && !isBSA(archivePath))
     {
         const Files::Collections fileCollections({ archivePath });
@@ -133,7 +141,7 @@ void readVFS(std::unique_ptr<VFS::Archive>&& archive, const std::filesystem::pat
             {
                 try
                 {
-                    readVFS(VFS::makeBsaArchive(file.second), file.second, quiet);
+                    collectVFS(VFS::makeBsaArchive(file.second), file.second, quiet, managers, jobs);
                 }
                 catch (const std::exception& e)
                 {
@@ -145,8 +153,70 @@ void readVFS(std::unique_ptr<VFS::Archive>&& archive, const std::filesystem::pat
     }
 }
 
+/// Test the collected files on a pool of worker threads and report aggregated
+/// failures and read time percentiles.
+void runScan(const std::vector<ScanJob>& jobs, bool quiet, int threadCount)
+{
+    std::vector<double> millis(jobs.size());
+    std::vector<std::pair<std::string, std::string>> failures;
+    std::atomic<std::size_t> nextJob{ 0 };
+    std::mutex mutex;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto worker = [&] {
+        for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            const ScanJob& job = jobs[i];
+            if (!quiet)
+            {
+                std::lock_guard lock(mutex);
+                printJob(job);
+            }
+            const auto fileStart = std::chrono::steady_clock::now();
+            try
+            {
+                readFile(job);
+            }
+            catch (std::exception& e)
+            {
+                std::lock_guard lock(mutex);
+                std::cerr << "Failed to read '" << Files::pathToUnicodeString(job.mPath) << "':" << std::endl
+                          << e.what() << std::endl;
+                failures.emplace_back(Files::pathToUnicodeString(job.mPath), e.what());
+            }
+            millis[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - fileStart).count();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread& thread : threads)
+        thread.join();
+
+    const double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::sort(millis.begin(), millis.end());
+    const auto percentile = [&](double p) { return millis[static_cast<std::size_t>(p * (millis.size() - 1))]; };
+
+    std::cout << "Read " << jobs.size() << " files in " << totalSeconds << "s, " << failures.size() << " failed"
+              << std::endl;
+    if (!millis.empty())
+        std::cout << "Read times: median " << percentile(0.5) << "ms, 90% " << percentile(0.9) << "ms, 99% "
+                  << percentile(0.99) << "ms, max " << millis.back() << "ms" << std::endl;
+
+    if (!failures.empty())
+    {
+        std::sort(failures.begin(), failures.end());
+        std::cerr << "\nFailed files:" << std::endl;
+        for (const auto& [path, error] : failures)
+            std::cerr << "  " << path << ": " << error << std::endl;
+    }
+}
+
 bool parseOptions(int argc, char** argv, Files::PathContainer& files, Files::PathContainer& archives,
-    bool& writeDebugLog, bool& quiet)
+    bool& writeDebugLog, bool& quiet, int& jobs)
 {
     bpo::options_description desc(R"(Ensure that OpenMW can use the provided NIF, KF, BGEM/BGSM and BSA/BA2 files
 
@@ -159,6 +229,8 @@ Allowed options)");
     addOption("help,h", "print help message.");
     addOption("write-debug-log,v", "write debug log for unsupported nif files");
     addOption("quiet,q", "do not log read archives/files");
+    addOption("jobs,j", bpo::value<int>()->default_value(0),
+        "number of files to test in parallel (0: number of hardware threads)");
     addOption("archives", bpo::value<Files::MaybeQuotedPathContainer>(), "path to archive files to provide files");
     addOption("input-file", bpo::value<Files::MaybeQuotedPathContainer>(), "input file");
 
@@ -179,6 +251,9 @@ Allowed options)");
         }
         writeDebugLog = variables.count("write-debug-log") > 0;
         quiet = variables.count("quiet") > 0;
+        jobs = variables["jobs"].as<int>();
+        if (jobs <= 0)
+            jobs = std::max<int>(1, std::thread::hardware_concurrency());
         if (variables.count("input-file"))
         {
             files = asPathContainer(variables["input-file"].as<Files::MaybeQuotedPathContainer>());
@@ -203,7 +278,8 @@ int main(int argc, char** argv)
     Files::PathContainer files, sources;
     bool writeDebugLog = false;
     bool quiet = false;
-    if (!parseOptions(argc, argv, files, sources, writeDebugLog, quiet))
+    int jobs = 1;
+    if (!parseOptions(argc, argv, files, sources, writeDebugLog, quiet, jobs))
         return 1;
 
     Nif::Reader::setLoadUnsupportedFiles(true);
@@ -235,6 +311,8 @@ int main(int argc, char** argv)
         vfs->buildIndex();
     }
 
+    std::vector<std::unique_ptr<VFS::Manager>> managers;
+    std::vector<ScanJob> jobList;
     for (const auto& path : files)
     {
         const std::string pathStr = Files::pathToUnicodeString(path);
@@ -242,11 +320,11 @@ int main(int argc, char** argv)
         {
             if (isNIF(path) || isMaterial(path))
             {
-                readFile({}, path, vfs.get(), quiet);
+                jobList.push_back({ {}, path, vfs.get() });
             }
             else if (auto archive = makeArchive(path))
             {
-                readVFS(std::move(archive), path, quiet);
+                collectVFS(std::move(archive), path, quiet, managers, jobList);
             }
             else
             {
@@ -259,5 +337,7 @@ int main(int argc, char** argv)
             std::cerr << "Failed to read '" << pathStr << "':  " << e.what() << std::endl;
         }
     }
+
+    runScan(jobList, quiet, jobs);
     return 0;
 }
@@ -70,8 +70,12 @@ void CSMDoc::Loader::load()
         if (iter->second.mRecordsLeft)
         {
             Messages messages(Message::Severity_Error);
-            const int batchingSize = 50;
-            for (int i = 0; i < batchingSize; ++i) // do not flood the system with update signals
+            // Load records in time-based batches: a fixed record count either floods the
+            // system with update signals on cheap records or stalls the event loop on
+            // expensive ones.
+            const auto batchEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds(25);
+            do
+            {
                 if (document->getData().continueLoading(messages))
                 {
                     iter->second.mRecordsLeft = false;
@@ -79,6 +83,7 @@ void CSMDoc::Loader::load()
                 }
                 else
                     ++(iter->second.mRecordsLoaded);
+            } while (std::chrono::steady_clock::now() < batchEnd);
 
             CSMWorld::UniversalId log(CSMWorld::UniversalId::Type_LoadErrorLog, 0);
 
@@ -1,7 +1,11 @@
 #include "operation.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <QTimer>
@@ -138,6 +142,11 @@ void CSMDoc::Operation::executeStage()
 
     Messages messages(mDefaultSeverity);
 
+    // Perform steps in time-based batches instead of one step per timer tick: a
+    // queued progress signal per step dominates operations with many cheap steps,
+    // while returning to the event loop regularly keeps abort() responsive.
+    const auto batchEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds(25);
+
     while (mCurrentStage != mStages.end())
     {
         if (mCurrentStep >= mCurrentStage->second)
@@ -145,6 +154,11 @@ void CSMDoc::Operation::executeStage()
             mCurrentStep = 0;
             ++mCurrentStage;
         }
+        else if (mCurrentStage->first->isThreadSafe())
+        {
+            executeThreadSafeStage(batchEnd, messages);
+            break;
+        }
         else
         {
             try
@@ -159,7 +173,9 @@ void CSMDoc::Operation::executeStage()
             }
 
             ++mCurrentStepTotal;
-            break;
+
+            if (std::chrono::steady_clock::now() >= batchEnd)
+                break;
         }
     }
 
@@ -182,6 +198,78 @@ void CSMDoc::Operation::executeStage()
     }
 }
 
+void CSMDoc::Operation::executeThreadSafeStage(std::chrono::steady_clock::time_point batchEnd, Messages& messages)
+{
+    // Data-parallel execution over the remaining steps of a read-only stage. The
+    // results are merged in step order, so the report is identical to a sequential
+    // run; errors abort the operation just like in the sequential path.
+    Stage& stage = *mCurrentStage->first;
+    const int totalSteps = mCurrentStage->second;
+
+    std::atomic<int> nextStep{ mCurrentStep };
+    std::atomic<bool> stop{ false };
+
+    const int threadCount
+        = std::min(std::max<int>(1, std::thread::hardware_concurrency()), totalSteps - mCurrentStep);
+    std::vector<std::vector<std::pair<int, Messages>>> results(threadCount);
+    std::vector<std::string> errors(threadCount);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&, i] {
+            for (int step = nextStep++; step < totalSteps && !stop; step = nextStep++)
+            {
+                Messages stepMessages(mDefaultSeverity);
+
+                try
+                {
+                    stage.perform(step, stepMessages);
+                }
+                catch (const std::exception& e)
+                {
+                    errors[i] = e.what();
+                    stop = true;
+                    return;
+                }
+
+                results[i].emplace_back(step, std::move(stepMessages));
+
+                if (std::chrono::steady_clock::now() >= batchEnd)
+                    return;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    const int newStep = std::min(nextStep.load(), totalSteps);
+    mCurrentStepTotal += newStep - mCurrentStep;
+    mCurrentStep = newStep;
+
+    std::vector<std::pair<int, Messages>> merged;
+    for (std::vector<std::pair<int, Messages>>& result : results)
+        for (std::pair<int, Messages>& item : result)
+            merged.push_back(std::move(item));
+
+    std::sort(merged.begin(), merged.end(), [](const auto& left, const auto& right) { return left.first < right.first; });
+
+    for (const auto& [step, stepMessages] : merged)
+        for (const Message& message : stepMessages)
+            messages.add(message.mId, message.mMessage, message.mHint, message.mSeverity);
+
+    for (const std::string& error : errors)
+    {
+        if (!error.empty())
+        {
+            emit reportMessage(Message(CSMWorld::UniversalId(), error, "", Message::Severity_SeriousError), mType);
+            abort();
+            break;
+        }
+    }
+}
+
 void CSMDoc::Operation::operationDone()
 {
     mTimer->stop();
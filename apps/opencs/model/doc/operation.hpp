@@ -38,6 +38,9 @@ namespace CSMDoc
 
         void prepareStages();
 
+        void executeThreadSafeStage(std::chrono::steady_clock::time_point batchEnd, Messages& messages);
+        ///< Execute steps of the current stage on a thread pool until \a batchEnd.
+
     public:
         Operation(State type, bool ordered, bool finalAlways = false);
         ///< \param ordered Stages must be executed in the given order.
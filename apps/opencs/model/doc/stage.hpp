@@ -14,6 +14,10 @@ namespace CSMDoc
 
         virtual void perform(int stage, Messages& messages) = 0;
         ///< Messages resulting from this stage will be appended to \a messages.
+
+        virtual bool isThreadSafe() const { return false; }
+        ///< Return true if perform() only reads shared state, so different steps can
+        /// be executed concurrently on multiple threads.
     };
 }
 
@@ -16,6 +16,10 @@ CSMFilter::TextNode::TextNode(int columnId, const std::string& text)
     , mRegExp(QRegularExpression::anchoredPattern(QString::fromUtf8(mText.c_str())),
           QRegularExpression::CaseInsensitiveOption)
 {
+    // Cache the enum values so testing an enum column (e.g. Record Type) does not
+    // copy the value list for every row.
+    if (CSMWorld::Columns::hasEnums(static_cast<CSMWorld::Columns::ColumnId>(mColumnId)))
+        mEnums = CSMWorld::Columns::getEnums(static_cast<CSMWorld::Columns::ColumnId>(mColumnId));
 }
 
 bool CSMFilter::TextNode::test(const CSMWorld::IdTableBase& table, int row, const std::map<int, int>& columns) const
@@ -38,16 +42,12 @@ bool CSMFilter::TextNode::test(const CSMWorld::IdTableBase& table, int row, cons
     {
         string = data.toString();
     }
-    else if ((data.type() == QVariant::Int || data.type() == QVariant::UInt)
-        && CSMWorld::Columns::hasEnums(static_cast<CSMWorld::Columns::ColumnId>(mColumnId)))
+    else if ((data.type() == QVariant::Int || data.type() == QVariant::UInt) && !mEnums.empty())
     {
         int value = data.toInt();
 
-        std::vector<std::pair<int, std::string>> enums
-            = CSMWorld::Columns::getEnums(static_cast<CSMWorld::Columns::ColumnId>(mColumnId));
-
-        if (value >= 0 && value < static_cast<int>(enums.size()))
-            string = QString::fromUtf8(enums[value].second.c_str());
+        if (value >= 0 && value < static_cast<int>(mEnums.size()))
+            string = QString::fromUtf8(mEnums[value].second.c_str());
     }
     else if (data.type() == QVariant::Bool)
     {
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <QRegularExpression>
@@ -18,6 +19,7 @@ namespace CSMFilter
         int mColumnId;
         std::string mText;
         QRegularExpression mRegExp;
+        std::vector<std::pair<int, std::string>> mEnums; // empty unless the column is an enum column
 
     public:
         TextNode(int columnId, const std::string& text);
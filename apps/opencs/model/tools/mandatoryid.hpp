@@ -36,6 +36,8 @@ namespace CSMTools
 
         void perform(int stage, CSMDoc::Messages& messages) override;
         ///< Messages resulting from this tage will be appended to \a messages.
+
+        bool isThreadSafe() const override { return true; }
     };
 }
 
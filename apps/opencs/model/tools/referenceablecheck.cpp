@@ -274,7 +274,13 @@ void CSMTools::ReferenceableCheckStage::perform(int stage, CSMDoc::Messages& mes
 
 int CSMTools::ReferenceableCheckStage::setup()
 {
-    mPlayerPresent = false;
+    // Detect if player is present. Resolved up front so perform() stays read-only
+    // and the steps can run concurrently.
+    const CSMWorld::RefIdData::LocalIndex playerIndex
+        = mReferencables.searchId(ESM::RefId::stringRefId("Player"));
+    mPlayerPresent = playerIndex.first != -1 && playerIndex.second == CSMWorld::UniversalId::Type_Npc
+        && !mReferencables.getRecord(playerIndex).isDeleted();
+
     mIgnoreBaseRecords = CSMPrefs::get()["Reports"]["ignore-base-records"].isTrue();
 
     return mReferencables.getSize() + 1;
@@ -676,10 +682,6 @@ void CSMTools::ReferenceableCheckStage::npcCheck(
     const ESM::NPC& npc = (dynamic_cast<const CSMWorld::Record<ESM::NPC>&>(baseRecord)).get();
     CSMWorld::UniversalId id(CSMWorld::UniversalId::Type_Npc, npc.mId);
 
-    // Detect if player is present
-    if (npc.mId == "Player") // Happy now, scrawl?
-        mPlayerPresent = true;
-
     // Skip "Base" records (setting!)
     if (mIgnoreBaseRecords && baseRecord.mState == CSMWorld::RecordBase::State_BaseOnly)
         return;
@@ -37,6 +37,8 @@ namespace CSMTools
             const CSMWorld::IdCollection<ESM::BodyPart>& bodyparts);
 
         void perform(int stage, CSMDoc::Messages& messages) override;
+
+        bool isThreadSafe() const override { return true; }
         int setup() override;
 
     private:
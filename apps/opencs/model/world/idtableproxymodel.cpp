@@ -172,7 +172,16 @@ void CSMWorld::IdTableProxyModel::sourceRowsRemoved(const QModelIndex& /*parent*
     refreshFilter();
 }
 
-void CSMWorld::IdTableProxyModel::sourceDataChanged(const QModelIndex& /*topLeft*/, const QModelIndex& /*bottomRight*/)
+void CSMWorld::IdTableProxyModel::sourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight)
 {
-    refreshFilter();
+    // Only re-run the filter when it references one of the changed columns.
+    // Re-testing every row of a large table on each edit is too slow.
+    for (const auto& [columnId, columnIndex] : mColumnMap)
+    {
+        if (columnIndex >= topLeft.column() && columnIndex <= bottomRight.column())
+        {
+            refreshFilter();
+            return;
+        }
+    }
 }
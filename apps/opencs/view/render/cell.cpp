@@ -97,13 +97,15 @@ bool CSVRender::Cell::addObjects(int start, int end)
 
     for (int i = start; i <= end; ++i)
     {
-        const auto& cellId = ESM::RefId::stringRefId(collection.getRecord(i).get().mCell.toString());
+        const CSMWorld::Record<CSMWorld::CellRef>& record = collection.getRecord(i);
 
-        CSMWorld::RecordBase::State state = collection.getRecord(i).mState;
-
-        if (cellId == mId && state != CSMWorld::RecordBase::State_Deleted)
+        // Both cell ids are interned strings, so this is a pointer comparison. The previous
+        // toString()/stringRefId() round trip locked and searched the intern table for every
+        // reference in the data set each time a cell was built, which dominated scrolling
+        // across exteriors.
+        if (record.get().mCell == mId && record.mState != CSMWorld::RecordBase::State_Deleted)
         {
-            const std::string& id = collection.getRecord(i).get().mId.getRefIdString();
+            const std::string& id = record.get().mId.getRefIdString();
 
             auto object = std::make_unique<Object>(mData, mCellNode, id, false);
 
@@ -1,9 +1,18 @@
 #include "engine.hpp"
 
+#include <algorithm>
 #include <cerrno>
 #include <chrono>
+#include <cmath>
 #include <future>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <string_view>
 #include <system_error>
+#include <utility>
+#include <vector>
 
 #include <osgDB/WriteFile>
 #include <osgViewer/ViewerEventHandlers>
@@ -13,6 +22,7 @@
 #include <components/debug/debuglog.hpp>
 #include <components/debug/gldebug.hpp>
 
+#include <components/misc/framearena.hpp>
 #include <components/misc/rng.hpp>
 #include <components/misc/strings/format.hpp>
 
@@ -22,6 +32,7 @@
 #include <components/sdlutil/imagetosurface.hpp>
 #include <components/sdlutil/sdlgraphicswindow.hpp>
 
+#include <components/resource/cachestats.hpp>
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/scenemanager.hpp>
 #include <components/resource/stats.hpp>
@@ -174,18 +185,107 @@ namespace
         for (osg::Camera* camera : cameras)
             camera->getStats()->report(stream, frameNumber);
     }
+
+    struct BenchmarkAggregate
+    {
+        double mSum = 0;
+        double mMax = 0;
+        std::size_t mCount = 0;
+    };
+
+    void writeBenchmarkJsonString(std::string_view value, std::ostream& out)
+    {
+        out << '"';
+        for (const char c : value)
+        {
+            if (c == '"' || c == '\\')
+                out << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20)
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                    << std::setfill(' ');
+            else
+                out << c;
+        }
+        out << '"';
+    }
+
+    void writeBenchmarkSummary(const std::filesystem::path& path, std::vector<double>&& frameTimes,
+        const std::map<std::string, BenchmarkAggregate>& aggregates)
+    {
+        std::ofstream out(path);
+        if (!out.is_open())
+        {
+            Log(Debug::Warning) << "Failed to open file to write benchmark summary \"" << path
+                                << "\": " << std::generic_category().message(errno);
+            return;
+        }
+
+        std::sort(frameTimes.begin(), frameTimes.end());
+        const auto quantile = [&](double q) {
+            const std::size_t index = static_cast<std::size_t>(q * static_cast<double>(frameTimes.size() - 1));
+            return frameTimes[index];
+        };
+
+        out.precision(std::numeric_limits<double>::max_digits10);
+        out << "{\n";
+        out << "  \"frames\": " << frameTimes.size() << ",\n";
+        out << "  \"frameTimeSeconds\": {";
+        if (!frameTimes.empty())
+        {
+            const double sum = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0);
+            out << "\"mean\": " << sum / static_cast<double>(frameTimes.size()) << ", \"min\": " << frameTimes.front()
+                << ", \"p50\": " << quantile(0.5) << ", \"p90\": " << quantile(0.9) << ", \"p95\": " << quantile(0.95)
+                << ", \"p99\": " << quantile(0.99) << ", \"max\": " << frameTimes.back();
+        }
+        out << "},\n";
+        out << "  \"stats\": {";
+        bool first = true;
+        for (const auto& [name, aggregate] : aggregates)
+        {
+            if (!std::exchange(first, false))
+                out << ',';
+            out << "\n    ";
+            writeBenchmarkJsonString(name, out);
+            out << ": {\"mean\": " << aggregate.mSum / static_cast<double>(aggregate.mCount)
+                << ", \"max\": " << aggregate.mMax << ", \"frames\": " << aggregate.mCount << '}';
+        }
+        out << "\n  }\n}\n";
+
+        Log(Debug::Info) << "Benchmark summary written to: " << path;
+    }
 }
 
-void OMW::Engine::executeLocalScripts()
+void OMW::Engine::executeLocalScripts(unsigned frameNumber)
 {
     MWWorld::LocalScripts& localScripts = mWorld->getLocalScripts();
 
+    const float frameDuration = mEnvironment.getFrameDuration();
+    const osg::Vec3f playerPos = mWorld->getPlayerPtr().getRefData().getPosition().asVec3();
+
+    // Scripts on actors well outside activation range tick every few frames instead of every
+    // frame, staggered so the load spreads evenly. Scripts that reposition objects and
+    // scripts on the full rate list are exempt; GetSecondsPassed reports the actually
+    // elapsed time, so timer based scripts keep exact time at the reduced rate.
+    constexpr float fullRateDistance = 1024.f;
+    constexpr unsigned reducedRateDivisor = 4;
+
     localScripts.startIteration();
-    std::pair<ESM::RefId, MWWorld::Ptr> script;
-    while (localScripts.getNext(script))
+    while (MWWorld::LocalScripts::Script* script = localScripts.getNext())
     {
-        MWScript::InterpreterContext interpreterContext(&script.second.getRefData().getLocals(), script.second);
-        mScriptManager->run(script.first, interpreterContext);
+        script->mElapsed += frameDuration;
+
+        const MWWorld::Ptr& ptr = script->mPtr;
+        if (mScriptManager->isIntervalTolerant(script->mId) && ptr.getClass().isActor() && ptr.isInCell()
+            && (ptr.getRefData().getPosition().asVec3() - playerPos).length2()
+                > fullRateDistance * fullRateDistance
+            && (frameNumber + script->mPhase) % reducedRateDivisor != 0
+            && !std::binary_search(mScriptFullRateList.begin(), mScriptFullRateList.end(), script->mId))
+            continue;
+
+        MWScript::InterpreterContext interpreterContext(&ptr.getRefData().getLocals(), ptr);
+        interpreterContext.setSecondsPassed(script->mElapsed);
+        mScriptManager->run(script->mId, interpreterContext);
+        script->mElapsed = 0.f;
     }
 }
 
@@ -197,6 +297,9 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
 
     mEnvironment.setFrameDuration(frametime);
 
+    // Reclaim the main thread's frame-scoped temporaries from the previous frame
+    Misc::FrameArena::instance().reset();
+
     try
     {
         // update input
@@ -250,7 +353,7 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
                     if (mWorld->getScriptsEnabled())
                     {
                         // local scripts
-                        executeLocalScripts();
+                        executeLocalScripts(frameNumber);
 
                         // global scripts
                         mScriptManager->getGlobalScripts().run();
@@ -319,7 +422,10 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
     const bool reportResource = stats->collectStats("resource");
 
     if (reportResource)
+    {
         stats->setAttribute(frameNumber, "UnrefQueue", mUnrefQueue->getSize());
+        stats->setAttribute(frameNumber, "UnrefBacklog", mUnrefQueue->getBacklog());
+    }
 
     mUnrefQueue->flush(*mWorkQueue);
 
@@ -329,6 +435,10 @@ bool OMW::Engine::frame(unsigned frameNumber, float frametime)
 
         mResourceSystem->reportStats(frameNumber, stats);
 
+        Resource::CacheStats archiveStats;
+        mVFS->getArchiveCacheStats(archiveStats);
+        Resource::reportStats("BSA Decompress", frameNumber, archiveStats, *stats);
+
         stats->setAttribute(frameNumber, "WorkQueue", mWorkQueue->getNumItems());
         stats->setAttribute(frameNumber, "WorkThread", mWorkQueue->getNumActiveThreads());
 
@@ -735,9 +845,11 @@ void OMW::Engine::prepareEngine()
         false); // keep to Off for now to allow better state sharing
     mResourceSystem->getSceneManager()->setFilterSettings(Settings::general().mTextureMagFilter,
         Settings::general().mTextureMinFilter, Settings::general().mTextureMipmap, Settings::general().mAnisotropy);
+    mResourceSystem->getSceneManager()->setAutoCompressTextures(Settings::general().mCompressUncompressedTextures);
     mEnvironment.setResourceSystem(*mResourceSystem);
 
     mWorkQueue = new SceneUtil::WorkQueue(Settings::cells().mPreloadNumThreads);
+    mResourceSystem->getSceneManager()->setWorkQueue(mWorkQueue);
     mUnrefQueue = std::make_unique<SceneUtil::UnrefQueue>();
 
     mScreenCaptureOperation = new SceneUtil::AsyncScreenCaptureOperation(mWorkQueue,
@@ -746,7 +858,7 @@ void OMW::Engine::prepareEngine()
             Settings::general().mNotifyOnSavedScreenshot ? std::function<void(std::string)>(ScreenCaptureMessageBox{})
                                                          : std::function<void(std::string)>(IgnoreString{})));
 
-    mScreenCaptureHandler = new osgViewer::ScreenCaptureHandler(mScreenCaptureOperation);
+    mScreenCaptureHandler = new SceneUtil::AsyncScreenCaptureHandler(mScreenCaptureOperation);
 
     mViewer->addEventHandler(mScreenCaptureHandler);
 
@@ -754,7 +866,7 @@ void OMW::Engine::prepareEngine()
     mL10nManager->setPreferredLocales(Settings::general().mPreferredLocales, Settings::general().mGmstOverridesL10n);
     mEnvironment.setL10nManager(*mL10nManager);
 
-    mLuaManager = std::make_unique<MWLua::LuaManager>(mVFS.get(), mResDir / "lua_libs");
+    mLuaManager = std::make_unique<MWLua::LuaManager>(mVFS.get(), mResDir / "lua_libs", mCfgMgr.getLogPath());
     mEnvironment.setLuaManager(*mLuaManager);
 
     // Create input and UI first to set up a bootstrapping environment for
@@ -807,6 +919,11 @@ void OMW::Engine::prepareEngine()
     mStereoManager->disableStereoForNode(guiRoot);
     rootNode->addChild(guiRoot);
 
+    // Opening the audio device only depends on the settings, so overlap it with the
+    // font and texture loading done while constructing the GUI.
+    auto soundInit = std::async(
+        std::launch::async, [&] { return std::make_unique<MWSound::SoundManager>(mVFS.get(), mUseSound); });
+
     mWindowManager = std::make_unique<MWGui::WindowManager>(mWindow, mViewer, guiRoot, mResourceSystem.get(),
         mWorkQueue.get(), mCfgMgr.getLogPath(), mScriptConsoleMode, mTranslationDataStorage, mEncoding,
         Version::getOpenmwVersionDescription(), shadersSupported, mCfgMgr);
@@ -816,8 +933,8 @@ void OMW::Engine::prepareEngine()
         keybinderUserExists, userGameControllerdb, gameControllerdb, mGrab);
     mEnvironment.setInputManager(*mInputManager);
 
-    // Create sound system
-    mSoundManager = std::make_unique<MWSound::SoundManager>(mVFS.get(), mUseSound);
+    // Sound system needs to be in place before any video can be played
+    mSoundManager = soundInit.get();
     mEnvironment.setSoundManager(*mSoundManager);
 
     // Create the world
@@ -832,6 +949,17 @@ void OMW::Engine::prepareEngine()
     auto dataLoading = std::async(std::launch::async,
         [&] { mWorld->loadData(mFileCollections, mContentFiles, mGroundcoverFiles, mEncoder.get(), &asyncListener); });
 
+    // The translation files are separate from the content files, so parse them while the
+    // content files load. mEncoder is busy on the loading thread and keeps internal state,
+    // so use a dedicated encoder here.
+    auto translationLoading = std::async(std::launch::async, [&] {
+        ToUTF8::Utf8Encoder encoder(mEncoding);
+        mTranslationDataStorage.setEncoder(&encoder);
+        for (auto& contentFile : mContentFiles)
+            mTranslationDataStorage.loadTranslationData(mFileCollections, contentFile);
+        mTranslationDataStorage.setEncoder(mEncoder.get());
+    });
+
     if (!mSkipMenu)
     {
         std::string_view logo = Fallback::Map::getString("Movies_Company_Logo");
@@ -845,6 +973,7 @@ void OMW::Engine::prepareEngine()
         while (dataLoading.wait_for(50ms) != std::future_status::ready)
             asyncListener.update();
         dataLoading.get();
+        translationLoading.get();
     }
     listener->loadingOff();
 
@@ -873,11 +1002,6 @@ void OMW::Engine::prepareEngine()
     mWindowManager->setStore(mWorld->getStore());
     mWindowManager->initUI();
 
-    // Load translation data
-    mTranslationDataStorage.setEncoder(mEncoder.get());
-    for (auto& mContentFile : mContentFiles)
-        mTranslationDataStorage.loadTranslationData(mFileCollections, mContentFile);
-
     Compiler::registerExtensions(mExtensions);
 
     // Create script system
@@ -933,6 +1057,16 @@ void OMW::Engine::go()
     Log(Debug::Info) << "SDL version: " << (int)sdlVersion.major << "." << (int)sdlVersion.minor << "."
                      << (int)sdlVersion.patch;
 
+    const bool benchmark = !mBenchmarkScript.empty();
+    if (benchmark)
+    {
+        // A benchmark run must be reproducible: skip the menu, run the recorded script and use
+        // a fixed simulation timestep so AI, weather and scripts see the same sequence of
+        // updates regardless of how fast the frames actually render.
+        mSkipMenu = true;
+        Log(Debug::Info) << "Benchmark mode enabled, random seed: " << mRandomSeed;
+    }
+
     Misc::Rng::init(mRandomSeed);
 
     Settings::ShaderManager::get().load(mCfgMgr.getUserConfigPath() / "shaders.yaml");
@@ -974,17 +1108,40 @@ void OMW::Engine::go()
                                 << "\": " << std::generic_category().message(errno);
     }
 
+#ifdef _WIN32
+    const auto* stats_json_file = _wgetenv(L"OPENMW_STATS_JSON_FILE");
+#else
+    const auto* stats_json_file = std::getenv("OPENMW_STATS_JSON_FILE");
+#endif
+
+    std::filesystem::path jsonPath;
+    if (stats_json_file != nullptr)
+        jsonPath = stats_json_file;
+
+    std::ofstream statsJson;
+    if (!jsonPath.empty())
+    {
+        statsJson.open(jsonPath, std::ios_base::out);
+        if (statsJson.is_open())
+            Log(Debug::Info) << "Stats will be written as JSON lines to: " << jsonPath;
+        else
+            Log(Debug::Warning) << "Failed to open file to write JSON stats \"" << jsonPath
+                                << "\": " << std::generic_category().message(errno);
+    }
+
+    const bool offlineCollect = stats.is_open() || statsJson.is_open() || benchmark;
+
     // Setup profiler
-    osg::ref_ptr<Resource::Profiler> statsHandler = new Resource::Profiler(stats.is_open(), *mVFS);
+    osg::ref_ptr<Resource::Profiler> statsHandler = new Resource::Profiler(offlineCollect, *mVFS);
 
     initStatsHandler(*statsHandler);
 
     mViewer->addEventHandler(statsHandler);
 
-    osg::ref_ptr<Resource::StatsHandler> resourcesHandler = new Resource::StatsHandler(stats.is_open(), *mVFS);
+    osg::ref_ptr<Resource::StatsHandler> resourcesHandler = new Resource::StatsHandler(offlineCollect, *mVFS);
     mViewer->addEventHandler(resourcesHandler);
 
-    if (stats.is_open())
+    if (offlineCollect)
         Resource::collectStatistics(*mViewer);
 
     // Start the game
@@ -1016,17 +1173,37 @@ void OMW::Engine::go()
         mWindowManager->executeInConsole(mStartupScript);
     }
 
+    if (benchmark && mStateManager->getState() == MWState::StateManager::State_Running)
+    {
+        mWindowManager->executeInConsole(mBenchmarkScript);
+    }
+
     // Start the main rendering loop
     MWWorld::DateTimeManager& timeManager = *mWorld->getTimeManager();
-    Misc::FrameRateLimiter frameRateLimiter = Misc::makeFrameRateLimiter(mEnvironment.getFrameRateLimit());
+    // Benchmark runs are not frame rate limited so the measured frame times reflect the actual
+    // cost of a frame.
+    Misc::FrameRateLimiter frameRateLimiter
+        = Misc::makeFrameRateLimiter(benchmark ? 0.f : mEnvironment.getFrameRateLimit());
     const std::chrono::steady_clock::duration maxSimulationInterval(std::chrono::milliseconds(200));
+    constexpr double benchmarkTimeStep = 1.0 / 60.0;
+    std::vector<double> benchmarkFrameTimes;
+    std::map<std::string, BenchmarkAggregate> benchmarkAggregates;
+    // Frames that ran a nested loading screen measure loading rather than rendering, so they are
+    // excluded from the frame time statistics. The first frame is excluded for the same reason.
+    bool excludeFrameTime = true;
     while (!mViewer->done() && !mStateManager->hasQuitRequest())
     {
-        const double dt = std::chrono::duration_cast<std::chrono::duration<double>>(
-                              std::min(frameRateLimiter.getLastFrameDuration(), maxSimulationInterval))
-                              .count()
+        const double dt = (benchmark ? benchmarkTimeStep
+                                     : std::chrono::duration_cast<std::chrono::duration<double>>(
+                                           std::min(frameRateLimiter.getLastFrameDuration(), maxSimulationInterval))
+                                           .count())
             * timeManager.getSimulationTimeScale();
 
+        if (benchmark && !std::exchange(excludeFrameTime, false))
+            benchmarkFrameTimes.push_back(
+                std::chrono::duration_cast<std::chrono::duration<double>>(frameRateLimiter.getLastFrameDuration())
+                    .count());
+
         mViewer->advance(timeManager.getRenderingSimulationTime());
 
         const unsigned frameNumber = mViewer->getFrameStamp()->getFrameNumber();
@@ -1043,7 +1220,7 @@ void OMW::Engine::go()
             timeManager.setRenderingSimulationTime(timeManager.getRenderingSimulationTime() + dt);
         }
 
-        if (stats)
+        if (stats || statsJson || benchmark)
         {
             // The delay is required because rendering happens in parallel to the main thread and stats from there is
             // available with delay.
@@ -1054,7 +1231,30 @@ void OMW::Engine::go()
                 // frames inside a simulation frame.
                 const unsigned currentFrameNumber = mViewer->getFrameStamp()->getFrameNumber();
                 for (unsigned i = frameNumber; i <= currentFrameNumber; ++i)
-                    reportStats(i - statsReportDelay, *mViewer, stats);
+                {
+                    if (stats)
+                        reportStats(i - statsReportDelay, *mViewer, stats);
+                    if (statsJson)
+                        Resource::reportStatsJson(*mViewer->getViewerStats(), i - statsReportDelay, statsJson);
+                    if (benchmark)
+                    {
+                        const auto& attributes = mViewer->getViewerStats()->getAttributeMap(i - statsReportDelay);
+                        if (attributes.find("Loading") == attributes.end())
+                        {
+                            for (const auto& [name, value] : attributes)
+                            {
+                                if (!std::isfinite(value))
+                                    continue;
+                                BenchmarkAggregate& aggregate = benchmarkAggregates[name];
+                                aggregate.mSum += value;
+                                aggregate.mMax = std::max(aggregate.mMax, value);
+                                ++aggregate.mCount;
+                            }
+                        }
+                    }
+                }
+                if (currentFrameNumber != frameNumber)
+                    excludeFrameTime = true;
             }
         }
 
@@ -1063,6 +1263,9 @@ void OMW::Engine::go()
 
     mLuaWorker->join();
 
+    if (benchmark)
+        writeBenchmarkSummary(mBenchmarkOutput, std::move(benchmarkFrameTimes), benchmarkAggregates);
+
     // Save user settings
     Settings::Manager::saveUser(mCfgMgr.getUserConfigPath() / "settings.cfg");
     Settings::ShaderManager::get().save();
@@ -1101,6 +1304,12 @@ void OMW::Engine::setStartupScript(const std::filesystem::path& path)
     mStartupScript = path;
 }
 
+void OMW::Engine::setBenchmark(const std::filesystem::path& script, const std::filesystem::path& output)
+{
+    mBenchmarkScript = script;
+    mBenchmarkOutput = output;
+}
+
 void OMW::Engine::setActivationDistanceOverride(int distance)
 {
     mActivationDistanceOverride = distance;
@@ -1121,6 +1330,13 @@ void OMW::Engine::setScriptBlacklistUse(bool use)
     mScriptBlacklistUse = use;
 }
 
+void OMW::Engine::setScriptFullRateList(const std::vector<ESM::RefId>& list)
+{
+    mScriptFullRateList = list;
+
+    std::sort(mScriptFullRateList.begin(), mScriptFullRateList.end());
+}
+
 void OMW::Engine::setSaveGameFile(const std::filesystem::path& savegame)
 {
     mSaveGameFile = savegame;
@@ -22,6 +22,7 @@ namespace Resource
 namespace SceneUtil
 {
     class WorkQueue;
+    class AsyncScreenCaptureHandler;
     class AsyncScreenCaptureOperation;
     class UnrefQueue;
 }
@@ -52,11 +53,6 @@ namespace Files
     struct ConfigurationManager;
 }
 
-namespace osgViewer
-{
-    class ScreenCaptureHandler;
-}
-
 namespace SceneUtil
 {
     class SelectDepthFormatOperation;
@@ -148,7 +144,7 @@ namespace OMW
         std::vector<std::string> mArchives;
         std::filesystem::path mResDir;
         osg::ref_ptr<osgViewer::Viewer> mViewer;
-        osg::ref_ptr<osgViewer::ScreenCaptureHandler> mScreenCaptureHandler;
+        osg::ref_ptr<SceneUtil::AsyncScreenCaptureHandler> mScreenCaptureHandler;
         osg::ref_ptr<SceneUtil::AsyncScreenCaptureOperation> mScreenCaptureOperation;
         osg::ref_ptr<SceneUtil::SelectDepthFormatOperation> mSelectDepthFormatOperation;
         osg::ref_ptr<SceneUtil::Color::SelectColorFormatOperation> mSelectColorFormatOperation;
@@ -166,6 +162,8 @@ namespace OMW
         std::string mFocusName;
         bool mScriptConsoleMode;
         std::filesystem::path mStartupScript;
+        std::filesystem::path mBenchmarkScript;
+        std::filesystem::path mBenchmarkOutput;
         int mActivationDistanceOverride;
         std::filesystem::path mSaveGameFile;
         // Grab mouse?
@@ -180,13 +178,14 @@ namespace OMW
         Translation::Storage mTranslationDataStorage;
         std::vector<ESM::RefId> mScriptBlacklist;
         bool mScriptBlacklistUse;
+        std::vector<ESM::RefId> mScriptFullRateList;
         bool mNewGame;
 
         // not implemented
         Engine(const Engine&);
         Engine& operator=(const Engine&);
 
-        void executeLocalScripts();
+        void executeLocalScripts(unsigned frameNumber);
 
         bool frame(unsigned frameNumber, float dt);
 
@@ -248,6 +247,10 @@ namespace OMW
         /// Set path for a script that is run on startup in the console.
         void setStartupScript(const std::filesystem::path& path);
 
+        /// Run the given console script in benchmark mode (fixed simulation timestep, no frame
+        /// rate limit) and write a JSON summary of frame times and stats to \a output on exit.
+        void setBenchmark(const std::filesystem::path& script, const std::filesystem::path& output);
+
         /// Override the game setting specified activation distance.
         void setActivationDistanceOverride(int distance);
 
@@ -257,6 +260,9 @@ namespace OMW
 
         void setScriptBlacklistUse(bool use);
 
+        /// Set the scripts that are always run every frame, exempt from reduced rate scheduling.
+        void setScriptFullRateList(const std::vector<ESM::RefId>& list);
+
         /// Set the save game file to load after initialising the engine.
         void setSaveGameFile(const std::filesystem::path& savegame);
 
@@ -157,6 +157,10 @@ bool parseOptions(int argc, char** argv, OMW::Engine& engine, Files::Configurati
     }
     engine.setScriptBlacklist(scriptBlacklist);
     engine.setScriptBlacklistUse(variables["script-blacklist-use"].as<bool>());
+    std::vector<ESM::RefId> scriptFullRateList;
+    for (const auto& fullRateString : variables["script-full-rate"].as<StringsVector>())
+        scriptFullRateList.push_back(ESM::RefId::stringRefId(fullRateString));
+    engine.setScriptFullRateList(scriptFullRateList);
     engine.setSaveGameFile(variables["load-savegame"].as<Files::MaybeQuotedPath>().u8string());
 
     // other settings
@@ -165,6 +169,16 @@ bool parseOptions(int argc, char** argv, OMW::Engine& engine, Files::Configurati
     engine.setActivationDistanceOverride(variables["activate-dist"].as<int>());
     engine.setRandomSeed(variables["random-seed"].as<unsigned int>());
 
+    const auto& benchmarkScript = variables["benchmark"].as<Files::MaybeQuotedPath>();
+    if (!benchmarkScript.empty())
+    {
+        engine.setBenchmark(benchmarkScript, variables["benchmark-output"].as<Files::MaybeQuotedPath>());
+        // A benchmark must be reproducible across runs, so only use a random seed if one was
+        // given explicitly.
+        if (variables["random-seed"].defaulted())
+            engine.setRandomSeed(0);
+    }
+
     return true;
 }
 
@@ -1,5 +1,7 @@
 #include "creature.hpp"
 
+#include <cassert>
+
 #include <MyGUI_TextIterator.h>
 #include <MyGUI_UString.h>
 
@@ -12,6 +14,7 @@
 #include <components/settings/values.hpp>
 
 #include "../mwmechanics/actorutil.hpp"
+#include "../mwmechanics/aiplanner.hpp"
 #include "../mwmechanics/aisetting.hpp"
 #include "../mwmechanics/combat.hpp"
 #include "../mwmechanics/creaturecustomdataresetter.hpp"
@@ -119,6 +122,9 @@ namespace MWClass
     {
         if (!ptr.getRefData().getCustomData())
         {
+            // Everything the AI planning phase rates has been set up by the main thread;
+            // instantiating actor data from a planning task would race with other tasks.
+            assert(!MWMechanics::AiPlanner::isPlanning());
             MWBase::Environment::get().getWorldModel()->registerPtr(ptr);
             auto tempData = std::make_unique<CreatureCustomData>();
             CreatureCustomData* data = tempData.get();
@@ -30,6 +30,7 @@
 #include "../mwbase/world.hpp"
 
 #include "../mwmechanics/actorutil.hpp"
+#include "../mwmechanics/aiplanner.hpp"
 #include "../mwmechanics/aisetting.hpp"
 #include "../mwmechanics/autocalcspell.hpp"
 #include "../mwmechanics/combat.hpp"
@@ -314,6 +315,9 @@ namespace MWClass
     {
         if (!ptr.getRefData().getCustomData())
         {
+            // Everything the AI planning phase rates has been set up by the main thread;
+            // instantiating actor data from a planning task would race with other tasks.
+            assert(!MWMechanics::AiPlanner::isPlanning());
             MWBase::Environment::get().getWorldModel()->registerPtr(ptr);
             bool recalculate = false;
             auto tempData = std::make_unique<NpcCustomData>();
@@ -1,5 +1,7 @@
 #include "filter.hpp"
 
+#include <unordered_map>
+
 #include <components/compiler/locals.hpp>
 #include <components/esm/refid.hpp>
 #include <components/esm3/loadcrea.hpp>
@@ -28,6 +30,35 @@
 
 namespace
 {
+    // Compiled form of an INFO record's filter conditions. SelectWrapper resolves the
+    // function type, argument, id and case-folded variable name on construction, so
+    // compiling once per INFO and reusing the wrappers avoids re-interpreting (and
+    // re-allocating) the conditions every time a topic list refreshes.
+    struct CompiledInfo
+    {
+        ESM::RefId mId;
+        std::vector<MWDialogue::SelectWrapper> mSelects;
+    };
+
+    const std::vector<MWDialogue::SelectWrapper>& getCompiledSelects(const ESM::DialInfo& info)
+    {
+        // INFO records are stored in std::list on the Dialogue store, so their addresses are
+        // stable for the lifetime of the store. Dialogue filtering only happens on the main
+        // thread. The id check recompiles an entry in case storage was reused for a
+        // different record.
+        static std::unordered_map<const ESM::DialInfo*, CompiledInfo> cache;
+        CompiledInfo& entry = cache[&info];
+        if (entry.mId != info.mId || entry.mSelects.size() != info.mSelects.size())
+        {
+            entry.mId = info.mId;
+            entry.mSelects.clear();
+            entry.mSelects.reserve(info.mSelects.size());
+            for (const ESM::DialogueCondition& select : info.mSelects)
+                entry.mSelects.emplace_back(select);
+        }
+        return entry.mSelects;
+    }
+
     bool matchesStaticFilters(const MWDialogue::SelectWrapper& select, const MWWorld::Ptr& actor)
     {
         const ESM::RefId selectId = select.getId();
@@ -47,9 +78,8 @@ namespace
 
     bool matchesStaticFilters(const ESM::DialInfo& info, const MWWorld::Ptr& actor)
     {
-        for (const auto& select : info.mSelects)
+        for (const MWDialogue::SelectWrapper& wrapper : getCompiledSelects(info))
         {
-            MWDialogue::SelectWrapper wrapper = select;
             if (wrapper.getType() == MWDialogue::SelectWrapper::Type_Boolean)
             {
                 if (!wrapper.selectCompare(matchesStaticFilters(wrapper, actor)))
@@ -207,7 +237,7 @@ bool MWDialogue::Filter::testPlayer(const ESM::DialInfo& info) const
 
 bool MWDialogue::Filter::testSelectStructs(const ESM::DialInfo& info) const
 {
-    for (const auto& select : info.mSelects)
+    for (const SelectWrapper& select : getCompiledSelects(info))
         if (!testSelectStruct(select))
             return false;
 
@@ -234,7 +264,7 @@ bool MWDialogue::Filter::testFunctionLocal(const MWDialogue::SelectWrapper& sele
     if (scriptName.empty())
         return false; // no script
 
-    std::string name = select.getName();
+    const std::string& name = select.getName();
 
     const Compiler::Locals& localDefs = MWBase::Environment::get().getScriptManager()->getLocals(scriptName);
 
@@ -1,18 +1,26 @@
 #ifndef GAME_MWDIALOGUE_KEYWORDSEARCH_H
 #define GAME_MWDIALOGUE_KEYWORDSEARCH_H
 
-#include <algorithm> // std::reverse
-#include <cctype>
-#include <map>
-#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
 #include <vector>
 
-#include <components/misc/strings/algorithm.hpp>
 #include <components/misc/strings/lower.hpp>
 
 namespace MWDialogue
 {
 
+    /// Case-insensitive (ASCII) substring search for a set of keywords, used for dialogue
+    /// hypertext and journal topic links.
+    ///
+    /// Keywords are collected into a flat list by seed() and compiled on first query into a
+    /// trie laid out in a single contiguous node array, with each node's children stored as
+    /// an adjacent, byte-ordered run. Matching therefore walks index ranges instead of
+    /// chasing per-character map nodes, and adding a topic later (e.g. when the journal
+    /// unlocks one) is a cheap append followed by one lazy recompile before the next query.
     template <typename value_t>
     class KeywordSearch
     {
@@ -30,119 +38,71 @@ namespace MWDialogue
         {
             if (keyword.empty())
                 return;
-            seed_impl(keyword, std::move(value), 0, mRoot);
+            mSeeds.emplace_back(Misc::StringUtils::lowerCase(keyword), std::move(value));
+            mDirty = true;
         }
 
         void clear()
         {
-            mRoot.mChildren.clear();
-            mRoot.mKeyword.clear();
+            mSeeds.clear();
+            mNodes.clear();
+            mDirty = true;
         }
 
-        bool containsKeyword(std::string_view keyword, value_t& value)
+        bool containsKeyword(std::string_view keyword, value_t& value) const
         {
-            auto it = keyword.begin();
-            auto current = mRoot.mChildren.find(Misc::StringUtils::toLower(*it));
-            if (current == mRoot.mChildren.end())
-                return false;
-            else if (Misc::StringUtils::ciEqual(current->second.mKeyword, keyword))
-            {
-                value = current->second.mValue;
-                return true;
-            }
-
-            for (++it; it != keyword.end(); ++it)
+            compile();
+            const Node* node = &mNodes.front();
+            for (char ch : keyword)
             {
-                auto next = current->second.mChildren.find(Misc::StringUtils::toLower(*it));
-                if (next == current->second.mChildren.end())
+                node = findChild(*node, Misc::StringUtils::toLower(ch));
+                if (node == nullptr)
                     return false;
-                if (Misc::StringUtils::ciEqual(next->second.mKeyword, keyword))
-                {
-                    value = next->second.mValue;
-                    return true;
-                }
-                current = next;
             }
-            return false;
+            if (node->mKeyword < 0)
+                return false;
+            value = mSeeds[node->mKeyword].second;
+            return true;
         }
 
         static bool sortMatches(const Match& left, const Match& right) { return left.mBeg < right.mBeg; }
 
         void highlightKeywords(Point beg, Point end, std::vector<Match>& out) const
         {
+            compile();
+
             std::vector<Match> matches;
             for (Point i = beg; i != end; ++i)
             {
-                // check first character
-                typename Entry::childen_t::const_iterator candidate
-                    = mRoot.mChildren.find(Misc::StringUtils::toLower(*i));
-
-                // no match, on to next character
-                if (candidate == mRoot.mChildren.end())
-                    continue;
-
-                // see how far the match goes
-                Point j = i;
-
-                // some keywords might be longer variations of other keywords, so we definitely need a list of
-                // candidates the first element in the pair is length of the match, i.e. depth from the first character
-                // on
-                std::vector<typename std::pair<std::ptrdiff_t, typename Entry::childen_t::const_iterator>> candidates;
-
-                while ((j + 1) != end)
+                // Walk the trie as far as the text allows, remembering the longest complete
+                // keyword passed on the way: keywords might be longer variations of other
+                // keywords.
+                const Node* node = &mNodes.front();
+                std::int32_t keyword = -1;
+                Point keywordEnd = i;
+                for (Point j = i; j != end; ++j)
                 {
-                    typename Entry::childen_t::const_iterator next
-                        = candidate->second.mChildren.find(Misc::StringUtils::toLower(*++j));
-
-                    if (next == candidate->second.mChildren.end())
-                    {
-                        if (candidate->second.mKeyword.size() > 0)
-                            candidates.push_back(std::make_pair((j - i), candidate));
+                    node = findChild(*node, Misc::StringUtils::toLower(*j));
+                    if (node == nullptr)
                         break;
+                    if (node->mKeyword >= 0)
+                    {
+                        keyword = node->mKeyword;
+                        keywordEnd = j + 1;
                     }
-
-                    candidate = next;
-
-                    if (candidate->second.mKeyword.size() > 0)
-                        candidates.push_back(std::make_pair((j - i), candidate));
                 }
 
-                if (candidates.empty())
-                    continue; // didn't match enough to disambiguate, on to next character
-
-                // shorter candidates will be added to the vector first. however, we want to check against longer
-                // candidates first
-                std::reverse(candidates.begin(), candidates.end());
-
-                for (const auto& [pos, c] : candidates)
-                {
-                    candidate = c;
-                    // try to match the rest of the keyword
-                    Point k = i + pos;
-                    Point t = candidate->second.mKeyword.begin() + (k - i);
-
-                    while (k != end && t != candidate->second.mKeyword.end())
-                    {
-                        if (Misc::StringUtils::toLower(*k) != Misc::StringUtils::toLower(*t))
-                            break;
-
-                        ++k, ++t;
-                    }
+                if (keyword < 0)
+                    continue;
 
-                    // didn't match full keyword, try the next candidate
-                    if (t != candidate->second.mKeyword.end())
-                        continue;
-
-                    // found a keyword, but there might still be longer keywords that start somewhere _within_ this
-                    // keyword we will resolve these overlapping keywords later, choosing the longest one in case of
-                    // conflict
-                    Match match;
-                    match.mValue = candidate->second.mValue;
-                    match.mBeg = i;
-                    match.mEnd = k;
-                    matches.push_back(match);
-                    break;
-                }
+                // found a keyword, but there might still be longer keywords that start somewhere
+                // _within_ this keyword; we will resolve these overlapping keywords later,
+                // choosing the longest one in case of conflict
+                Match match;
+                match.mValue = mSeeds[keyword].second;
+                match.mBeg = i;
+                match.mEnd = keywordEnd;
+                matches.push_back(match);
             }
 
             // resolve overlapping keywords
@@ -188,52 +148,84 @@ namespace MWDialogue
         }
 
     private:
-        struct Entry
+        struct Node
         {
-            typedef std::map<wchar_t, Entry> childen_t;
-
-            std::string mKeyword;
-            value_t mValue;
-            childen_t mChildren;
+            char mChar;
+            std::int32_t mKeyword; // index into mSeeds of the keyword ending here, or -1
+            std::uint32_t mFirstChild;
+            std::uint32_t mChildCount;
         };
 
-        void seed_impl(std::string_view keyword, value_t value, size_t depth, Entry& entry)
+        void compile() const
         {
-            auto ch = Misc::StringUtils::toLower(keyword.at(depth));
-
-            typename Entry::childen_t::iterator j = entry.mChildren.find(ch);
-
-            if (j == entry.mChildren.end())
+            if (!mDirty)
+                return;
+            mDirty = false;
+
+            mNodes.clear();
+            mNodes.push_back(Node{ '\0', -1, 0, 0 });
+
+            // Sort so that each node's children form a contiguous run in byte order;
+            // stable so that the earliest seed of a duplicate keyword wins.
+            std::vector<std::uint32_t> order(mSeeds.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                [&](std::uint32_t l, std::uint32_t r) { return mSeeds[l].first < mSeeds[r].first; });
+            order.erase(std::unique(order.begin(), order.end(),
+                            [&](std::uint32_t l, std::uint32_t r) { return mSeeds[l].first == mSeeds[r].first; }),
+                order.end());
+
+            struct Range
             {
-                entry.mChildren[ch].mValue = std::move(value);
-                entry.mChildren[ch].mKeyword = keyword;
-            }
-            else
+                std::uint32_t mNode;
+                std::uint32_t mBegin;
+                std::uint32_t mEnd;
+                std::uint32_t mDepth;
+            };
+            std::vector<Range> pending;
+            pending.push_back({ 0, 0, static_cast<std::uint32_t>(order.size()), 0 });
+
+            // Breadth-first so the children allocated for each range stay adjacent.
+            for (std::size_t next = 0; next < pending.size(); ++next)
             {
-                if (j->second.mKeyword.size() > 0)
+                const Range range = pending[next];
+                std::uint32_t i = range.mBegin;
+                if (i < range.mEnd && mSeeds[order[i]].first.size() == range.mDepth)
                 {
-                    if (keyword == j->second.mKeyword)
-                        throw std::runtime_error("duplicate keyword inserted");
-
-                    const auto& pushKeyword = j->second.mKeyword;
-
-                    if (depth >= pushKeyword.size())
-                        throw std::runtime_error("unexpected");
-
-                    if (depth + 1 < pushKeyword.size())
-                    {
-                        seed_impl(pushKeyword, j->second.mValue, depth + 1, j->second);
-                        j->second.mKeyword.clear();
-                    }
+                    mNodes[range.mNode].mKeyword = static_cast<std::int32_t>(order[i]);
+                    ++i;
+                }
+                mNodes[range.mNode].mFirstChild = static_cast<std::uint32_t>(mNodes.size());
+                while (i < range.mEnd)
+                {
+                    const char ch = mSeeds[order[i]].first[range.mDepth];
+                    std::uint32_t j = i + 1;
+                    while (j < range.mEnd && mSeeds[order[j]].first[range.mDepth] == ch)
+                        ++j;
+                    pending.push_back({ static_cast<std::uint32_t>(mNodes.size()), i, j, range.mDepth + 1 });
+                    mNodes.push_back(Node{ ch, -1, 0, 0 });
+                    ++mNodes[range.mNode].mChildCount;
+                    i = j;
                 }
-                if (depth + 1 == keyword.size())
-                    j->second.mKeyword = value;
-                else // depth+1 < keyword.size()
-                    seed_impl(keyword, std::move(value), depth + 1, j->second);
             }
         }
 
-        Entry mRoot;
+        const Node* findChild(const Node& node, char ch) const
+        {
+            const auto first = mNodes.begin() + node.mFirstChild;
+            const auto last = first + node.mChildCount;
+            // std::string sorts bytes as unsigned, so the children runs do too
+            const auto it = std::lower_bound(first, last, ch, [](const Node& child, char value) {
+                return static_cast<unsigned char>(child.mChar) < static_cast<unsigned char>(value);
+            });
+            if (it == last || it->mChar != ch)
+                return nullptr;
+            return &*it;
+        }
+
+        std::vector<std::pair<std::string, value_t>> mSeeds;
+        mutable std::vector<Node> mNodes;
+        mutable bool mDirty = true;
     };
 
 }
@@ -37,22 +37,10 @@ namespace
         return std::visit(
             [&](auto value) { return selectCompareImp(select.mComparison, value1, value); }, select.mValue);
     }
-}
-
-MWDialogue::SelectWrapper::SelectWrapper(const ESM::DialogueCondition& select)
-    : mSelect(select)
-{
-}
-
-ESM::DialogueCondition::Function MWDialogue::SelectWrapper::getFunction() const
-{
-    return mSelect.mFunction;
-}
-
-int MWDialogue::SelectWrapper::getArgument() const
-{
-    switch (mSelect.mFunction)
+    int getArgumentImpl(ESM::DialogueCondition::Function function)
     {
+        switch (function)
+        {
         // AI settings
         case ESM::DialogueCondition::Function_Fight:
             return 1;
@@ -146,13 +134,13 @@ int MWDialogue::SelectWrapper::getArgument() const
             return 0;
         default:
             return 0;
+        }
     }
-}
 
-MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
-{
-    switch (mSelect.mFunction)
+    MWDialogue::SelectWrapper::Type getTypeImpl(ESM::DialogueCondition::Function function)
     {
+        switch (function)
+        {
         case ESM::DialogueCondition::Function_Journal:
         case ESM::DialogueCondition::Function_Item:
         case ESM::DialogueCondition::Function_Dead:
@@ -211,7 +199,7 @@ MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
         case ESM::DialogueCondition::Function_FacReactionLowest:
         case ESM::DialogueCondition::Function_FacReactionHighest:
         case ESM::DialogueCondition::Function_CreatureTarget:
-            return Type_Integer;
+            return MWDialogue::SelectWrapper::Type_Integer;
         case ESM::DialogueCondition::Function_Global:
         case ESM::DialogueCondition::Function_Local:
         case ESM::DialogueCondition::Function_NotLocal:
@@ -220,7 +208,7 @@ MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
         case ESM::DialogueCondition::Function_PcFatigue:
         case ESM::DialogueCondition::Function_PcHealthPercent:
         case ESM::DialogueCondition::Function_Health_Percent:
-            return Type_Numeric;
+            return MWDialogue::SelectWrapper::Type_Numeric;
         case ESM::DialogueCondition::Function_SameSex:
         case ESM::DialogueCondition::Function_SameRace:
         case ESM::DialogueCondition::Function_SameFaction:
@@ -235,21 +223,38 @@ MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
         case ESM::DialogueCondition::Function_Attacked:
         case ESM::DialogueCondition::Function_ShouldAttack:
         case ESM::DialogueCondition::Function_Werewolf:
-            return Type_Boolean;
+            return MWDialogue::SelectWrapper::Type_Boolean;
         case ESM::DialogueCondition::Function_NotId:
         case ESM::DialogueCondition::Function_NotFaction:
         case ESM::DialogueCondition::Function_NotClass:
         case ESM::DialogueCondition::Function_NotRace:
         case ESM::DialogueCondition::Function_NotCell:
-            return Type_Inverted;
+            return MWDialogue::SelectWrapper::Type_Inverted;
         default:
-            return Type_None;
-    };
+            return MWDialogue::SelectWrapper::Type_None;
+        };
+    }
+
+    bool usesName(ESM::DialogueCondition::Function function)
+    {
+        return function == ESM::DialogueCondition::Function_Global
+            || function == ESM::DialogueCondition::Function_Local
+            || function == ESM::DialogueCondition::Function_NotLocal;
+    }
+}
+
+MWDialogue::SelectWrapper::SelectWrapper(const ESM::DialogueCondition& select)
+    : mSelect(&select)
+    , mType(getTypeImpl(select.mFunction))
+    , mArgument(getArgumentImpl(select.mFunction))
+    , mId(ESM::RefId::stringRefId(select.mVariable))
+    , mName(usesName(select.mFunction) ? Misc::StringUtils::lowerCase(select.mVariable) : std::string())
+{
 }
 
 bool MWDialogue::SelectWrapper::isNpcOnly() const
 {
-    switch (mSelect.mFunction)
+    switch (mSelect->mFunction)
     {
         case ESM::DialogueCondition::Function_NotFaction:
         case ESM::DialogueCondition::Function_NotClass:
@@ -272,30 +277,20 @@ bool MWDialogue::SelectWrapper::isNpcOnly() const
 
 bool MWDialogue::SelectWrapper::selectCompare(int value) const
 {
-    return selectCompareImp(mSelect, value);
+    return selectCompareImp(*mSelect, value);
 }
 
 bool MWDialogue::SelectWrapper::selectCompare(float value) const
 {
-    return selectCompareImp(mSelect, value);
+    return selectCompareImp(*mSelect, value);
 }
 
 bool MWDialogue::SelectWrapper::selectCompare(bool value) const
 {
-    return selectCompareImp(mSelect, static_cast<int>(value));
-}
-
-std::string MWDialogue::SelectWrapper::getName() const
-{
-    return Misc::StringUtils::lowerCase(mSelect.mVariable);
+    return selectCompareImp(*mSelect, static_cast<int>(value));
 }
 
 std::string_view MWDialogue::SelectWrapper::getCellName() const
 {
-    return mSelect.mVariable;
-}
-
-ESM::RefId MWDialogue::SelectWrapper::getId() const
-{
-    return ESM::RefId::stringRefId(mSelect.mVariable);
+    return mSelect->mVariable;
 }
@@ -7,7 +7,7 @@ namespace MWDialogue
 {
     class SelectWrapper
     {
-        const ESM::DialogueCondition& mSelect;
+        const ESM::DialogueCondition* mSelect;
 
     public:
         enum Type
@@ -19,14 +19,22 @@ namespace MWDialogue
             Type_Inverted
         };
 
+    private:
+        // Derived values are resolved once on construction so that wrappers can be compiled
+        // per INFO record and reused across evaluations without re-interpreting the condition.
+        Type mType;
+        int mArgument;
+        ESM::RefId mId;
+        std::string mName;
+
     public:
         SelectWrapper(const ESM::DialogueCondition& select);
 
-        ESM::DialogueCondition::Function getFunction() const;
+        ESM::DialogueCondition::Function getFunction() const { return mSelect->mFunction; }
 
-        int getArgument() const;
+        int getArgument() const { return mArgument; }
 
-        Type getType() const;
+        Type getType() const { return mType; }
 
         bool isNpcOnly() const;
         ///< \attention Do not call any of the select functions for this select struct!
@@ -37,12 +45,12 @@ namespace MWDialogue
 
         bool selectCompare(bool value) const;
 
-        std::string getName() const;
+        const std::string& getName() const { return mName; }
         ///< Return case-smashed name.
 
         std::string_view getCellName() const;
 
-        ESM::RefId getId() const;
+        const ESM::RefId& getId() const { return mId; }
     };
 }
 
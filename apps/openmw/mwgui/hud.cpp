@@ -632,7 +632,9 @@ namespace MWGui
         mEnemyHealth->setProgressRange(100);
         // Health is usually cast to int before displaying. Actors die whenever they are < 1 health.
         // Therefore any value < 1 should show as an empty health bar. We do the same in statswindow :)
-        mEnemyHealth->setProgressPosition(static_cast<size_t>(stats.getHealth().getRatio() * 100));
+        const size_t position = static_cast<size_t>(stats.getHealth().getRatio() * 100);
+        if (mEnemyHealth->getProgressPosition() != position)
+            mEnemyHealth->setProgressPosition(position);
 
         static const float fNPCHealthBarFade = MWBase::Environment::get()
                                                    .getESMStore()
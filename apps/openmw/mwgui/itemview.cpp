@@ -1,6 +1,7 @@
 #include "itemview.hpp"
 
 #include <cmath>
+#include <cstddef>
 
 #include <MyGUI_FactoryManager.h>
 #include <MyGUI_Gui.h>
@@ -15,6 +16,7 @@ namespace MWGui
 
     ItemView::ItemView()
         : mScrollView(nullptr)
+        , mDragArea(nullptr)
     {
     }
 
@@ -38,29 +40,33 @@ namespace MWGui
 
     void ItemView::layoutWidgets()
     {
-        if (!mScrollView->getChildCount())
+        if (mDragArea == nullptr)
             return;
 
+        // Only the leading, visible part of the widget pool belongs to the current model.
+        std::size_t count = 0;
+        while (count < mItemWidgets.size() && mItemWidgets[count]->getVisible())
+            ++count;
+
         int x = 0;
         int y = 0;
-        MyGUI::Widget* dragArea = mScrollView->getChildAt(0);
         int maxHeight = mScrollView->getHeight();
 
         int rows = maxHeight / 42;
         rows = std::max(rows, 1);
-        bool showScrollbar = int(std::ceil(dragArea->getChildCount() / float(rows))) > mScrollView->getWidth() / 42;
+        bool showScrollbar = int(std::ceil(count / float(rows))) > mScrollView->getWidth() / 42;
         if (showScrollbar)
             maxHeight -= 18;
 
-        for (unsigned int i = 0; i < dragArea->getChildCount(); ++i)
+        for (std::size_t i = 0; i < count; ++i)
         {
-            MyGUI::Widget* w = dragArea->getChildAt(i);
+            MyGUI::Widget* w = mItemWidgets[i];
 
             w->setPosition(x, y);
 
             y += 42;
 
-            if (y > maxHeight - 42 && i < dragArea->getChildCount() - 1)
+            if (y > maxHeight - 42 && i + 1 < count)
             {
                 x += 42;
                 y = 0;
@@ -77,33 +83,49 @@ namespace MWGui
         mScrollView->setCanvasSize(size);
         mScrollView->setVisibleVScroll(true);
         mScrollView->setVisibleHScroll(true);
-        dragArea->setSize(size);
+        mDragArea->setSize(size);
     }
 
     void ItemView::update()
     {
-        while (mScrollView->getChildCount())
-            MyGUI::Gui::getInstance().destroyWidget(mScrollView->getChildAt(0));
-
         if (!mModel)
+        {
+            while (mScrollView->getChildCount())
+                MyGUI::Gui::getInstance().destroyWidget(mScrollView->getChildAt(0));
+            mDragArea = nullptr;
+            mItemWidgets.clear();
             return;
+        }
 
         mModel->update();
 
-        MyGUI::Widget* dragArea = mScrollView->createWidget<MyGUI::Widget>(
-            {}, 0, 0, mScrollView->getWidth(), mScrollView->getHeight(), MyGUI::Align::Stretch);
-        dragArea->setNeedMouseFocus(true);
-        dragArea->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedBackground);
-        dragArea->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
-
-        for (ItemModel::ModelIndex i = 0; i < static_cast<int>(mModel->getItemCount()); ++i)
+        if (mDragArea == nullptr)
         {
-            const ItemStack& item = mModel->getItem(i);
+            mDragArea = mScrollView->createWidget<MyGUI::Widget>(
+                {}, 0, 0, mScrollView->getWidth(), mScrollView->getHeight(), MyGUI::Align::Stretch);
+            mDragArea->setNeedMouseFocus(true);
+            mDragArea->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedBackground);
+            mDragArea->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
+        }
 
-            ItemWidget* itemWidget = dragArea->createWidget<ItemWidget>(
+        const std::size_t count = mModel->getItemCount();
+        while (mItemWidgets.size() < count)
+        {
+            ItemWidget* itemWidget = mDragArea->createWidget<ItemWidget>(
                 "MW_ItemIcon", MyGUI::IntCoord(0, 0, 42, 42), MyGUI::Align::Default);
             itemWidget->setUserString("ToolTipType", "ItemModelIndex");
-            itemWidget->setUserData(std::make_pair(i, mModel.get()));
+            itemWidget->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedItem);
+            itemWidget->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
+            mItemWidgets.push_back(itemWidget);
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const ItemModel::ModelIndex index = static_cast<ItemModel::ModelIndex>(i);
+            const ItemStack& item = mModel->getItem(index);
+            ItemWidget* itemWidget = mItemWidgets[i];
+
+            itemWidget->setUserData(std::make_pair(index, mModel.get()));
             ItemWidget::ItemState state = ItemWidget::None;
             if (item.mType == ItemStack::Type_Barter)
                 state = ItemWidget::Barter;
@@ -111,11 +133,13 @@ namespace MWGui
                 state = ItemWidget::Equip;
             itemWidget->setItem(item.mBase, state);
             itemWidget->setCount(item.mCount);
-
-            itemWidget->eventMouseButtonClick += MyGUI::newDelegate(this, &ItemView::onSelectedItem);
-            itemWidget->eventMouseWheel += MyGUI::newDelegate(this, &ItemView::onMouseWheelMoved);
+            itemWidget->setVisible(true);
         }
 
+        // Surplus pooled widgets are hidden rather than destroyed for the next update.
+        for (std::size_t i = count; i < mItemWidgets.size(); ++i)
+            mItemWidgets[i]->setVisible(false);
+
         layoutWidgets();
     }
 
@@ -1,12 +1,15 @@
 #ifndef MWGUI_ITEMVIEW_H
 #define MWGUI_ITEMVIEW_H
 
+#include <vector>
+
 #include <MyGUI_Widget.h>
 
 #include "itemmodel.hpp"
 
 namespace MWGui
 {
+    class ItemWidget;
 
     class ItemView final : public MyGUI::Widget
     {
@@ -45,6 +48,11 @@ namespace MWGui
 
         std::unique_ptr<ItemModel> mModel;
         MyGUI::ScrollView* mScrollView;
+        MyGUI::Widget* mDragArea;
+
+        // Widgets are expensive to create and destroy, so they are pooled across updates:
+        // the first getItemCount() entries are reconfigured in place, the rest stay hidden.
+        std::vector<ItemWidget*> mItemWidgets;
     };
 
 }
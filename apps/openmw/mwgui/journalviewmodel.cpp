@@ -24,8 +24,22 @@ namespace MWGui
     {
         typedef MWDialogue::KeywordSearch<intptr_t> KeywordSearchT;
 
+        /// Cached result of parsing one journal or topic entry into display text and hyperlink
+        /// runs. Kept across journal opens; reparsing is only needed when new topics (and thus
+        /// new keywords) were added.
+        struct ParsedEntry
+        {
+            bool mParsed = false;
+            std::string mText;
+            std::map<std::pair<size_t, size_t>, intptr_t> mHyperLinks;
+        };
+
+        typedef std::pair<const void*, ESM::RefId> ParsedEntryKey;
+
         mutable bool mKeywordSearchLoaded;
         mutable KeywordSearchT mKeywordSearch;
+        mutable std::map<ParsedEntryKey, ParsedEntry> mParsedEntries;
+        mutable std::size_t mSeenTopicCount = 0;
 
         JournalViewModelImpl() { mKeywordSearchLoaded = false; }
 
@@ -42,12 +56,28 @@ namespace MWGui
             return Utf8Span(point, point + str.size());
         }
 
-        void load() override {}
+        void load() override
+        {
+            // The keyword index and the parsed entries are kept across journal opens. They only
+            // have to be rebuilt when new topics were added, since the topic keywords determine
+            // how entry text is split into hyperlink runs.
+            MWBase::Journal* journal = MWBase::Environment::get().getJournal();
+            const std::size_t topicCount = std::distance(journal->topicBegin(), journal->topicEnd());
+            if (topicCount != mSeenTopicCount)
+            {
+                mKeywordSearch.clear();
+                mKeywordSearchLoaded = false;
+                mParsedEntries.clear();
+                mSeenTopicCount = topicCount;
+            }
+        }
 
         void unload() override
         {
             mKeywordSearch.clear();
             mKeywordSearchLoaded = false;
+            mParsedEntries.clear();
+            mSeenTopicCount = 0;
         }
 
         void ensureKeyWordSearchLoaded() const
@@ -81,70 +111,78 @@ namespace MWGui
             BaseEntry(JournalViewModelImpl const* model, iterator_t itr)
                 : itr(itr)
                 , mModel(model)
-                , loaded(false)
+                , mParsed(nullptr)
             {
             }
 
             virtual ~BaseEntry() {}
 
-            mutable bool loaded;
-            mutable std::string utf8text;
+            // Points into the model's parse cache; map nodes are stable so the pointer remains
+            // valid for the lifetime of this wrapper.
+            mutable const ParsedEntry* mParsed;
 
             typedef std::pair<size_t, size_t> Range;
 
-            // hyperlinks in @link# notation
-            mutable std::map<Range, intptr_t> mHyperLinks;
-
             virtual std::string getText() const = 0;
 
+            /// Key identifying this entry in the model's parse cache. Must stay stable while the
+            /// game session is running.
+            virtual ParsedEntryKey cacheKey() const = 0;
+
             void ensureLoaded() const
             {
-                if (!loaded)
-                {
-                    mModel->ensureKeyWordSearchLoaded();
+                if (mParsed != nullptr)
+                    return;
 
-                    utf8text = getText();
+                mModel->ensureKeyWordSearchLoaded();
 
-                    size_t pos_end = 0;
-                    for (;;)
-                    {
-                        size_t pos_begin = utf8text.find('@');
-                        if (pos_begin != std::string::npos)
-                            pos_end = utf8text.find('#', pos_begin);
+                ParsedEntry& parsed = mModel->mParsedEntries[cacheKey()];
+                mParsed = &parsed;
+                if (parsed.mParsed)
+                    return;
 
-                        if (pos_begin != std::string::npos && pos_end != std::string::npos)
-                        {
-                            std::string link = utf8text.substr(pos_begin + 1, pos_end - pos_begin - 1);
-                            const char specialPseudoAsteriskCharacter = 127;
-                            std::replace(link.begin(), link.end(), specialPseudoAsteriskCharacter, '*');
-                            std::string_view topicName = MWBase::Environment::get()
-                                                             .getWindowManager()
-                                                             ->getTranslationDataStorage()
-                                                             .topicStandardForm(link);
-
-                            std::string displayName = link;
-                            while (displayName[displayName.size() - 1] == '*')
-                                displayName.erase(displayName.size() - 1, 1);
-
-                            utf8text.replace(pos_begin, pos_end + 1 - pos_begin, displayName);
-
-                            intptr_t value = 0;
-                            if (mModel->mKeywordSearch.containsKeyword(topicName, value))
-                                mHyperLinks[std::make_pair(pos_begin, pos_begin + displayName.size())] = value;
-                        }
-                        else
-                            break;
-                    }
+                std::string& utf8text = parsed.mText;
+                utf8text = getText();
+
+                size_t pos_end = 0;
+                for (;;)
+                {
+                    size_t pos_begin = utf8text.find('@');
+                    if (pos_begin != std::string::npos)
+                        pos_end = utf8text.find('#', pos_begin);
 
-                    loaded = true;
+                    if (pos_begin != std::string::npos && pos_end != std::string::npos)
+                    {
+                        std::string link = utf8text.substr(pos_begin + 1, pos_end - pos_begin - 1);
+                        const char specialPseudoAsteriskCharacter = 127;
+                        std::replace(link.begin(), link.end(), specialPseudoAsteriskCharacter, '*');
+                        std::string_view topicName = MWBase::Environment::get()
+                                                         .getWindowManager()
+                                                         ->getTranslationDataStorage()
+                                                         .topicStandardForm(link);
+
+                        std::string displayName = link;
+                        while (displayName[displayName.size() - 1] == '*')
+                            displayName.erase(displayName.size() - 1, 1);
+
+                        utf8text.replace(pos_begin, pos_end + 1 - pos_begin, displayName);
+
+                        intptr_t value = 0;
+                        if (mModel->mKeywordSearch.containsKeyword(topicName, value))
+                            parsed.mHyperLinks[std::make_pair(pos_begin, pos_begin + displayName.size())] = value;
+                    }
+                    else
+                        break;
                 }
+
+                parsed.mParsed = true;
             }
 
             Utf8Span body() const override
             {
                 ensureLoaded();
 
-                return toUtf8Span(utf8text);
+                return toUtf8Span(mParsed->mText);
             }
 
             void visitSpans(std::function<void(TopicId, size_t, size_t)> visitor) const override
@@ -152,11 +190,14 @@ namespace MWGui
                 ensureLoaded();
                 mModel->ensureKeyWordSearchLoaded();
 
-                if (mHyperLinks.size()
+                const std::string& utf8text = mParsed->mText;
+                const std::map<Range, intptr_t>& hyperLinks = mParsed->mHyperLinks;
+
+                if (hyperLinks.size()
                     && MWBase::Environment::get().getWindowManager()->getTranslationDataStorage().hasTranslation())
                 {
                     size_t formatted = 0; // points to the first character that is not laid out yet
-                    for (std::map<Range, intptr_t>::const_iterator it = mHyperLinks.begin(); it != mHyperLinks.end();
+                    for (std::map<Range, intptr_t>::const_iterator it = hyperLinks.begin(); it != hyperLinks.end();
                          ++it)
                     {
                         intptr_t topicId = it->second;
@@ -202,16 +243,15 @@ namespace MWGui
             // Note that for purposes of the journal GUI, quests are identified by the name, not the ID, so several
             // different quest IDs can end up in the same quest log. A quest log should be considered finished
             // when any quest ID in that log is finished.
+            std::map<std::string_view, bool> finishedByName;
+            for (MWBase::Journal::TQuestIter i = journal->questBegin(); i != journal->questEnd(); ++i)
+                finishedByName[i->second.getName()] |= i->second.isFinished();
+
             for (MWBase::Journal::TQuestIter i = journal->questBegin(); i != journal->questEnd(); ++i)
             {
                 const MWDialogue::Quest& quest = i->second;
 
-                bool isFinished = false;
-                for (MWBase::Journal::TQuestIter j = journal->questBegin(); j != journal->questEnd(); ++j)
-                {
-                    if (quest.getName() == j->second.getName() && j->second.isFinished())
-                        isFinished = true;
-                }
+                const bool isFinished = finishedByName[quest.getName()];
 
                 if (active_only && isFinished)
                     continue;
@@ -246,6 +286,10 @@ namespace MWGui
 
             std::string getText() const override { return itr->getText(); }
 
+            // Journal entries live in a deque that is only ever appended to, so the entry address
+            // is stable.
+            ParsedEntryKey cacheKey() const override { return ParsedEntryKey(&*itr, ESM::RefId()); }
+
             Utf8Span timestamp() const override
             {
                 if (timestamp_buffer.empty())
@@ -336,6 +380,10 @@ namespace MWGui
 
             std::string getText() const override { return itr->getText(); }
 
+            // Topic entries live in a vector that may reallocate when entries are added, so key
+            // by the topic (map node, stable) and the info id instead of the entry address.
+            ParsedEntryKey cacheKey() const override { return ParsedEntryKey(&mTopic, itr->mInfoId); }
+
             Utf8Span source() const override { return toUtf8Span(itr->mActorName); }
         };
 
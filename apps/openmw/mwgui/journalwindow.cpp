@@ -1,5 +1,7 @@
 #include "journalwindow.hpp"
 
+#include <cstddef>
+#include <iterator>
 #include <set>
 #include <stack>
 #include <string>
@@ -57,6 +59,13 @@ namespace
 
         DisplayStateStack mStates;
         Book mTopicIndexBook;
+
+        // Typeset main journal from the previous open, reused as long as no entries were
+        // added. Entries are append-only, so the count identifies the content; the cache is
+        // dropped in clear() when a different game is loaded.
+        Book mJournalBook;
+        std::size_t mJournalBookEntryCount = 0;
+
         bool mQuestMode;
         bool mOptionsMode;
         bool mTopicsMode;
@@ -230,13 +239,19 @@ namespace
 
             setBookMode();
 
-            Book journalBook;
-            if (mModel->isEmpty())
-                journalBook = createEmptyJournalBook();
-            else
-                journalBook = createJournalBook();
+            MWBase::Journal* journal = MWBase::Environment::get().getJournal();
+            const std::size_t entryCount = std::distance(journal->begin(), journal->end());
+
+            if (!mJournalBook || entryCount != mJournalBookEntryCount)
+            {
+                if (mModel->isEmpty())
+                    mJournalBook = createEmptyJournalBook();
+                else
+                    mJournalBook = createJournalBook();
+                mJournalBookEntryCount = entryCount;
+            }
 
-            pushBook(journalBook, 0);
+            pushBook(mJournalBook, 0);
 
             // fast forward to the last page
             if (!mStates.empty())
@@ -253,8 +268,8 @@ namespace
 
         void onClose() override
         {
-            mModel->unload();
-
+            // The model keeps its parsed entries and keyword index across opens; it is fully
+            // reset through clear() when the game session changes.
             getPage(LeftBookPage)->showPage(Book(), 0);
             getPage(RightBookPage)->showPage(Book(), 0);
 
@@ -264,6 +279,13 @@ namespace
             mTopicIndexBook.reset();
         }
 
+        void clear() override
+        {
+            mModel->unload();
+            mJournalBook.reset();
+            mJournalBookEntryCount = 0;
+        }
+
         void setVisible(bool newValue) override { WindowBase::setVisible(newValue); }
 
         void setBookMode()
@@ -121,6 +121,12 @@ namespace MWGui
 
         void operator()(osg::RenderInfo& renderInfo) const override
         {
+            // Only the frame rendered before the loading screen came up is wanted; afterwards the
+            // framebuffer contains the loading screen itself, so copying it again every frame
+            // would only waste GPU time.
+            if (!mOneshot)
+                return;
+
             int w = renderInfo.getCurrentCamera()->getViewport()->width();
             int h = renderInfo.getCurrentCamera()->getViewport()->height();
             mTexture->copyTexImage2D(*renderInfo.getState(), 0, 0, w, h);
@@ -130,6 +136,8 @@ namespace MWGui
 
         void reset() { mOneshot = true; }
 
+        bool isDone() const { return !mOneshot; }
+
     private:
         mutable bool mOneshot;
         osg::ref_ptr<osg::Texture2D> mTexture;
@@ -352,6 +360,10 @@ namespace MWGui
         mViewer->renderingTraversals();
         mViewer->advance(mViewer->getFrameStamp()->getSimulationTime());
 
+        // Once the scene has been captured there is no reason to keep invoking the callback.
+        if (mCopyFramebufferToTextureCallback != nullptr && mCopyFramebufferToTextureCallback->isDone())
+            mViewer->getCamera()->removeInitialDrawCallback(mCopyFramebufferToTextureCallback);
+
         mLastRenderTime = mTimer.time_m();
     }
 
@@ -339,41 +339,58 @@ namespace MWGui
 
     void LocalMapBase::updateCustomMarkers()
     {
-        for (MyGUI::Widget* widget : mCustomMarkerWidgets)
-            MyGUI::Gui::getInstance().destroyWidget(widget);
-        mCustomMarkerWidgets.clear();
-        if (!mActiveCell)
-            return;
-        for (int dX = -mCellDistance; dX <= mCellDistance; ++dX)
+        // Marker widgets are pooled across updates: existing ones are moved and relabelled in
+        // place, surplus ones stay hidden for the next update.
+        std::size_t usedWidgets = 0;
+        if (mActiveCell)
         {
-            for (int dY = -mCellDistance; dY <= mCellDistance; ++dY)
+            for (int dX = -mCellDistance; dX <= mCellDistance; ++dX)
             {
-                ESM::RefId cellRefId
-                    = getCellIdInWorldSpace(*mActiveCell, mActiveCell->getGridX() + dX, mActiveCell->getGridY() + dY);
-
-                CustomMarkerCollection::RangeType markers = mCustomMarkers.getMarkers(cellRefId);
-                for (CustomMarkerCollection::ContainerType::const_iterator it = markers.first; it != markers.second;
-                     ++it)
+                for (int dY = -mCellDistance; dY <= mCellDistance; ++dY)
                 {
-                    const ESM::CustomMarker& marker = it->second;
-
-                    MarkerUserData markerPos(mLocalMapRender);
-                    MarkerWidget* markerWidget = mLocalMap->createWidget<MarkerWidget>("CustomMarkerButton",
-                        getMarkerCoordinates(marker.mWorldX, marker.mWorldY, markerPos, 16), MyGUI::Align::Default);
-                    markerWidget->setDepth(Local_MarkerAboveFogLayer);
-                    markerWidget->setUserString("ToolTipType", "Layout");
-                    markerWidget->setUserString("ToolTipLayout", "TextToolTipOneLine");
-                    markerWidget->setUserString("Caption_TextOneLine", MyGUI::TextIterator::toTagsString(marker.mNote));
-                    markerWidget->setNormalColour(MyGUI::Colour(0.6f, 0.6f, 0.6f));
-                    markerWidget->setHoverColour(MyGUI::Colour(1.0f, 1.0f, 1.0f));
-                    markerWidget->setUserData(marker);
-                    markerWidget->setNeedMouseFocus(true);
-                    customMarkerCreated(markerWidget);
-                    mCustomMarkerWidgets.push_back(markerWidget);
+                    ESM::RefId cellRefId = getCellIdInWorldSpace(
+                        *mActiveCell, mActiveCell->getGridX() + dX, mActiveCell->getGridY() + dY);
+
+                    CustomMarkerCollection::RangeType markers = mCustomMarkers.getMarkers(cellRefId);
+                    for (CustomMarkerCollection::ContainerType::const_iterator it = markers.first;
+                         it != markers.second; ++it)
+                    {
+                        const ESM::CustomMarker& marker = it->second;
+
+                        MarkerUserData markerPos(mLocalMapRender);
+                        MarkerWidget* markerWidget;
+                        if (usedWidgets < mCustomMarkerWidgets.size())
+                        {
+                            markerWidget = static_cast<MarkerWidget*>(mCustomMarkerWidgets[usedWidgets]);
+                            markerWidget->setCoord(getMarkerCoordinates(marker.mWorldX, marker.mWorldY, markerPos, 16));
+                            markerWidget->setVisible(true);
+                        }
+                        else
+                        {
+                            markerWidget = mLocalMap->createWidget<MarkerWidget>("CustomMarkerButton",
+                                getMarkerCoordinates(marker.mWorldX, marker.mWorldY, markerPos, 16),
+                                MyGUI::Align::Default);
+                            markerWidget->setDepth(Local_MarkerAboveFogLayer);
+                            markerWidget->setUserString("ToolTipType", "Layout");
+                            markerWidget->setUserString("ToolTipLayout", "TextToolTipOneLine");
+                            markerWidget->setNormalColour(MyGUI::Colour(0.6f, 0.6f, 0.6f));
+                            markerWidget->setHoverColour(MyGUI::Colour(1.0f, 1.0f, 1.0f));
+                            markerWidget->setNeedMouseFocus(true);
+                            customMarkerCreated(markerWidget);
+                            mCustomMarkerWidgets.push_back(markerWidget);
+                        }
+                        markerWidget->setUserString(
+                            "Caption_TextOneLine", MyGUI::TextIterator::toTagsString(marker.mNote));
+                        markerWidget->setUserData(marker);
+                        ++usedWidgets;
+                    }
                 }
             }
         }
 
+        for (std::size_t i = usedWidgets; i < mCustomMarkerWidgets.size(); ++i)
+            mCustomMarkerWidgets[i]->setVisible(false);
+
         redraw();
     }
 
@@ -735,6 +752,8 @@ namespace MWGui
 
         for (MyGUI::Widget* widget : mCustomMarkerWidgets)
         {
+            if (!widget->getVisible())
+                continue;
             const auto& marker = *widget->getUserData<ESM::CustomMarker>();
             widget->setCoord(getMarkerCoordinates(marker.mWorldX, marker.mWorldY, markerPos, 16));
         }
@@ -1,5 +1,7 @@
 #include "sortfilteritemmodel.hpp"
 
+#include <utility>
+
 #include <components/debug/debuglog.hpp>
 #include <components/esm3/loadalch.hpp>
 #include <components/esm3/loadappa.hpp>
@@ -69,13 +71,19 @@ namespace
 
     struct Compare
     {
+        // Items paired with their pre-computed lower-cased name: lower-casing UTF-8 dominates
+        // the comparison cost, so it is done once per item instead of once per comparison.
+        using Entry = std::pair<MWGui::ItemStack, std::string>;
+
         bool mSortByType;
         Compare()
             : mSortByType(true)
         {
         }
-        bool operator()(const MWGui::ItemStack& left, const MWGui::ItemStack& right)
+        bool operator()(const Entry& leftEntry, const Entry& rightEntry)
         {
+            const MWGui::ItemStack& left = leftEntry.first;
+            const MWGui::ItemStack& right = rightEntry.first;
             if (mSortByType && left.mType != right.mType)
                 return left.mType < right.mType;
 
@@ -89,10 +97,7 @@ namespace
                 return compareType(leftType, rightType);
 
             // compare items by name
-            std::string leftName = Utf8Stream::lowerCaseUtf8(left.mBase.getClass().getName(left.mBase));
-            std::string rightName = Utf8Stream::lowerCaseUtf8(right.mBase.getClass().getName(right.mBase));
-
-            result = leftName.compare(rightName);
+            result = leftEntry.second.compare(rightEntry.second);
             if (result != 0)
                 return result < 0;
 
@@ -394,9 +399,21 @@ namespace MWGui
                 mItems.push_back(item);
         }
 
+        std::vector<Compare::Entry> entries;
+        entries.reserve(mItems.size());
+        for (ItemStack& item : mItems)
+        {
+            std::string name = Utf8Stream::lowerCaseUtf8(item.mBase.getClass().getName(item.mBase));
+            entries.emplace_back(std::move(item), std::move(name));
+        }
+
         Compare cmp;
         cmp.mSortByType = mSortByType;
-        std::sort(mItems.begin(), mItems.end(), cmp);
+        std::sort(entries.begin(), entries.end(), cmp);
+
+        mItems.clear();
+        for (Compare::Entry& entry : entries)
+            mItems.push_back(std::move(entry.first));
     }
 
     void SortFilterItemModel::onClose()
@@ -1,5 +1,6 @@
 #include "spellicons.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
@@ -21,6 +22,26 @@
 
 #include "tooltips.hpp"
 
+namespace
+{
+    // Equality at display precision. Remaining time only shows through the tooltip duration,
+    // which is rounded to whole seconds, so continuous sub-second changes do not require
+    // rebuilding the widgets - except below the fade threshold, where the icon alpha is
+    // animated every frame.
+    bool sameDisplay(const MWGui::MagicEffectInfo& lhs, const MWGui::MagicEffectInfo& rhs, float fadeTime)
+    {
+        if (lhs.mPermanent != rhs.mPermanent || lhs.mMagnitude != rhs.mMagnitude || !(lhs.mKey == rhs.mKey)
+            || lhs.mSource != rhs.mSource)
+            return false;
+        if (lhs.mPermanent)
+            return true;
+        if (lhs.mRemainingTime < fadeTime || rhs.mRemainingTime < fadeTime)
+            return false;
+        return lhs.mTotalTime == rhs.mTotalTime
+            && static_cast<int>(lhs.mRemainingTime) == static_cast<int>(rhs.mRemainingTime);
+    }
+}
+
 namespace MWGui
 {
     void SpellIcons::updateWidgets(MyGUI::Widget* parent, bool adjustSize)
@@ -46,8 +67,26 @@ namespace MWGui
             }
         }
 
-        int w = 2;
         const auto& store = MWBase::Environment::get().getESMStore();
+
+        static const float fadeTime = store->get<ESM::GameSetting>().find("fMagicStartIconBlink")->mValue.getFloat();
+
+        // The string building and MyGUI writes below are the expensive part; skip them while
+        // the displayed state has not changed.
+        const bool dirty = mMustUpdate || effects.size() != mLastEffects.size()
+            || !std::equal(effects.begin(), effects.end(), mLastEffects.begin(),
+                [](const auto& lhs, const auto& rhs) {
+                    return lhs.first == rhs.first
+                        && std::equal(lhs.second.begin(), lhs.second.end(), rhs.second.begin(), rhs.second.end(),
+                            [](const MagicEffectInfo& l, const MagicEffectInfo& r) {
+                                return sameDisplay(l, r, fadeTime);
+                            });
+                });
+        if (!dirty)
+            return;
+        mMustUpdate = false;
+
+        int w = 2;
         for (const auto& [effectId, effectInfos] : effects)
         {
             const ESM::MagicEffect* effect = store->get<ESM::MagicEffect>().find(effectId);
@@ -57,9 +96,6 @@ namespace MWGui
 
             std::string sourcesDescription;
 
-            static const float fadeTime
-                = store->get<ESM::GameSetting>().find("fMagicStartIconBlink")->mValue.getFloat();
-
             bool addNewLine = false;
             for (const MagicEffectInfo& effectInfo : effectInfos)
             {
@@ -202,6 +238,8 @@ namespace MWGui
             if (effects.find(widgetPair.first) == effects.end())
                 widgetPair.second->setVisible(false);
         }
+
+        mLastEffects = std::move(effects);
     }
 
 }
@@ -45,6 +45,11 @@ namespace MWGui
 
     private:
         std::map<int, MyGUI::ImageBox*> mWidgetMap;
+
+        // Effects as of the last widget rebuild, used to skip the rebuild while nothing
+        // visible changed.
+        std::map<int, std::vector<MagicEffectInfo>> mLastEffects;
+        bool mMustUpdate = true;
     };
 
 }
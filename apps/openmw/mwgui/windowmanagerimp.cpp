@@ -55,6 +55,8 @@
 
 #include <components/settings/values.hpp>
 
+#include "../profile.hpp"
+
 #include "../mwbase/environment.hpp"
 #include "../mwbase/inputmanager.hpp"
 #include "../mwbase/luamanager.hpp"
@@ -956,7 +958,13 @@ namespace MWGui
 
         mDragAndDrop->onFrame();
 
-        mHud->onFrame(frameDuration);
+        {
+            // HUD work remaining after the dirty checks (fades, timers, enemy bar) is measured
+            // separately from the rest of the GUI update.
+            OMW::ScopedProfile<OMW::UserStatsType::Hud> profile(mViewer->getStartTick(),
+                mViewer->getFrameStamp()->getFrameNumber(), *osg::Timer::instance(), *mViewer->getViewerStats());
+            mHud->onFrame(frameDuration);
+        }
 
         mPostProcessorHud->onFrame(frameDuration);
 
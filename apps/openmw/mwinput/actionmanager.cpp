@@ -28,7 +28,7 @@ namespace MWInput
 {
 
     ActionManager::ActionManager(BindingsManager* bindingsManager, osg::ref_ptr<osgViewer::Viewer> viewer,
-        osg::ref_ptr<osgViewer::ScreenCaptureHandler> screenCaptureHandler)
+        osg::ref_ptr<SceneUtil::AsyncScreenCaptureHandler> screenCaptureHandler)
         : mBindingsManager(bindingsManager)
         , mViewer(std::move(viewer))
         , mScreenCaptureHandler(std::move(screenCaptureHandler))
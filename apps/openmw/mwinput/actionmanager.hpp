@@ -2,12 +2,12 @@
 #define MWINPUT_ACTIONMANAGER_H
 
 #include <osg/ref_ptr>
-#include <osgViewer/ViewerEventHandlers>
+
+#include <components/sceneutil/screencapture.hpp>
 
 namespace osgViewer
 {
     class Viewer;
-    class ScreenCaptureHandler;
 }
 
 namespace MWInput
@@ -18,7 +18,7 @@ namespace MWInput
     {
     public:
         ActionManager(BindingsManager* bindingsManager, osg::ref_ptr<osgViewer::Viewer> viewer,
-            osg::ref_ptr<osgViewer::ScreenCaptureHandler> screenCaptureHandler);
+            osg::ref_ptr<SceneUtil::AsyncScreenCaptureHandler> screenCaptureHandler);
 
         void update(float dt);
 
@@ -46,7 +46,7 @@ namespace MWInput
 
         BindingsManager* mBindingsManager;
         osg::ref_ptr<osgViewer::Viewer> mViewer;
-        osg::ref_ptr<osgViewer::ScreenCaptureHandler> mScreenCaptureHandler;
+        osg::ref_ptr<SceneUtil::AsyncScreenCaptureHandler> mScreenCaptureHandler;
 
         float mTimeIdle;
     };
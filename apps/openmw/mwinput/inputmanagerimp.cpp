@@ -25,7 +25,7 @@
 namespace MWInput
 {
     InputManager::InputManager(SDL_Window* window, osg::ref_ptr<osgViewer::Viewer> viewer,
-        osg::ref_ptr<osgViewer::ScreenCaptureHandler> screenCaptureHandler, const std::filesystem::path& userFile,
+        osg::ref_ptr<SceneUtil::AsyncScreenCaptureHandler> screenCaptureHandler, const std::filesystem::path& userFile,
         bool userFileExists, const std::filesystem::path& userControllerBindingsFile,
         const std::filesystem::path& controllerBindingsFile, bool grab)
         : mControlsDisabled(false)
@@ -29,6 +29,11 @@ namespace SDLUtil
     class InputWrapper;
 }
 
+namespace SceneUtil
+{
+    class AsyncScreenCaptureHandler;
+}
+
 struct SDL_Window;
 
 namespace MWInput
@@ -49,7 +54,7 @@ namespace MWInput
     {
     public:
         InputManager(SDL_Window* window, osg::ref_ptr<osgViewer::Viewer> viewer,
-            osg::ref_ptr<osgViewer::ScreenCaptureHandler> screenCaptureHandler, const std::filesystem::path& userFile,
+            osg::ref_ptr<SceneUtil::AsyncScreenCaptureHandler> screenCaptureHandler, const std::filesystem::path& userFile,
             bool userFileExists, const std::filesystem::path& userControllerBindingsFile,
             const std::filesystem::path& controllerBindingsFile, bool grab);
 
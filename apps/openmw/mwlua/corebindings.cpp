@@ -128,6 +128,10 @@ namespace MWLua
             return sol::nil;
         };
 
+        api["setEventCoalescing"] = [context](std::string_view eventName, bool enable) {
+            context.mLuaEvents->setEventCoalescing(eventName, enable);
+        };
+
         if (context.mType != Context::Menu)
         {
             api["sendGlobalEvent"] = [context](std::string eventName, const sol::object& eventData) {
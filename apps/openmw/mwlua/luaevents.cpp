@@ -18,6 +18,15 @@
 namespace MWLua
 {
 
+    namespace
+    {
+        const std::string& dataOrEmpty(const std::shared_ptr<const std::string>& data)
+        {
+            static const std::string empty;
+            return data ? *data : empty;
+        }
+    }
+
     void LuaEvents::clear()
     {
         mGlobalEventBatch.clear();
@@ -25,6 +34,8 @@ namespace MWLua
         mNewGlobalEventBatch.clear();
         mNewLocalEventBatch.clear();
         mMenuEvents.clear();
+        mNewGlobalCoalesced.clear();
+        mNewLocalCoalesced.clear();
     }
 
     void LuaEvents::finalizeEventBatch()
@@ -33,6 +44,49 @@ namespace MWLua
         mNewLocalEventBatch.swap(mLocalEventBatch);
         mNewGlobalEventBatch.clear();
         mNewLocalEventBatch.clear();
+        mNewGlobalCoalesced.clear();
+        mNewLocalCoalesced.clear();
+    }
+
+    void LuaEvents::addGlobalEvent(Global event)
+    {
+        if (mCoalescedEvents.count(event.mEventName) > 0)
+        {
+            const auto [it, inserted] = mNewGlobalCoalesced.emplace(event.mEventName, mNewGlobalEventBatch.size());
+            if (!inserted)
+            {
+                mNewGlobalEventBatch[it->second].mEventData = std::move(event.mEventData);
+                return;
+            }
+        }
+        mNewGlobalEventBatch.push_back(std::move(event));
+    }
+
+    void LuaEvents::addLocalEvent(Local event)
+    {
+        if (mCoalescedEvents.count(event.mEventName) > 0)
+        {
+            const auto [it, inserted] = mNewLocalCoalesced.emplace(
+                std::make_pair(event.mDest, event.mEventName), mNewLocalEventBatch.size());
+            if (!inserted)
+            {
+                mNewLocalEventBatch[it->second].mEventData = std::move(event.mEventData);
+                return;
+            }
+        }
+        mNewLocalEventBatch.push_back(std::move(event));
+    }
+
+    void LuaEvents::setEventCoalescing(std::string_view eventName, bool enable)
+    {
+        if (enable)
+            mCoalescedEvents.emplace(eventName);
+        else
+        {
+            const auto it = mCoalescedEvents.find(eventName);
+            if (it != mCoalescedEvents.end())
+                mCoalescedEvents.erase(it);
+        }
     }
 
     void LuaEvents::callEventHandlers()
@@ -45,7 +99,7 @@ namespace MWLua
             MWWorld::Ptr ptr = MWBase::Environment::get().getWorldModel()->getPtr(e.mDest);
             LocalScripts* scripts = ptr.isEmpty() ? nullptr : ptr.getRefData().getLuaScripts();
             if (scripts)
-                scripts->receiveEvent(e.mEventName, e.mEventData);
+                scripts->receiveEvent(e.mEventName, dataOrEmpty(e.mEventData));
             else
                 Log(Debug::Debug) << "Ignored event " << e.mEventName << " to L" << e.mDest.toString()
                                   << ". Object not found or has no attached scripts";
@@ -60,13 +114,12 @@ namespace MWLua
         mMenuEvents.clear();
     }
 
-    template <typename Event>
-    static void saveEvent(ESM::ESMWriter& esm, ESM::RefNum dest, const Event& event)
+    static void saveEvent(ESM::ESMWriter& esm, ESM::RefNum dest, std::string_view name, const std::string& data)
     {
-        esm.writeHNString("LUAE", event.mEventName);
+        esm.writeHNString("LUAE", name);
         esm.writeFormId(dest, true);
-        if (!event.mEventData.empty())
-            saveLuaBinaryData(esm, event.mEventData);
+        if (!data.empty())
+            saveLuaBinaryData(esm, data);
     }
 
     void LuaEvents::load(lua_State* lua, ESM::ESMReader& esm, const std::map<int, int>& contentFileMapping,
@@ -91,7 +144,8 @@ namespace MWLua
                 auto it = contentFileMapping.find(dest.mContentFile);
                 if (it != contentFileMapping.end())
                     dest.mContentFile = it->second;
-                mLocalEventBatch.push_back({ dest, std::move(name), std::move(data) });
+                mLocalEventBatch.push_back(
+                    { dest, std::move(name), std::make_shared<const std::string>(std::move(data)) });
             }
             else
                 mGlobalEventBatch.push_back({ std::move(name), std::move(data) });
@@ -104,13 +158,13 @@ namespace MWLua
         constexpr ESM::RefNum globalId;
 
         for (const Global& e : mGlobalEventBatch)
-            saveEvent(esm, globalId, e);
+            saveEvent(esm, globalId, e.mEventName, e.mEventData);
         for (const Global& e : mNewGlobalEventBatch)
-            saveEvent(esm, globalId, e);
+            saveEvent(esm, globalId, e.mEventName, e.mEventData);
         for (const Local& e : mLocalEventBatch)
-            saveEvent(esm, e.mDest, e);
+            saveEvent(esm, e.mDest, e.mEventName, dataOrEmpty(e.mEventData));
         for (const Local& e : mNewLocalEventBatch)
-            saveEvent(esm, e.mDest, e);
+            saveEvent(esm, e.mDest, e.mEventName, dataOrEmpty(e.mEventData));
     }
 
 }
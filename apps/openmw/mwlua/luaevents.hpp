@@ -2,7 +2,11 @@
 #define MWLUA_LUAEVENTS_H
 
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <components/esm3/cellref.hpp> // defines RefNum that is used as a unique id
 
@@ -43,12 +47,17 @@ namespace MWLua
         {
             ESM::RefNum mDest;
             std::string mEventName;
-            std::string mEventData;
+            // Shared so that an event fanned out to many objects serializes the payload only once.
+            std::shared_ptr<const std::string> mEventData;
         };
 
-        void addGlobalEvent(Global event) { mNewGlobalEventBatch.push_back(std::move(event)); }
+        void addGlobalEvent(Global event);
         void addMenuEvent(Global event) { mMenuEvents.push_back(std::move(event)); }
-        void addLocalEvent(Local event) { mNewLocalEventBatch.push_back(std::move(event)); }
+        void addLocalEvent(Local event);
+
+        // While enabled for an event name, only the latest not yet delivered event with this name
+        // is kept per destination; older pending ones are replaced (latest-wins).
+        void setEventCoalescing(std::string_view eventName, bool enable);
 
         void clear();
         void finalizeEventBatch();
@@ -67,6 +76,10 @@ namespace MWLua
         std::vector<Global> mGlobalEventBatch;
         std::vector<Local> mLocalEventBatch;
         std::vector<Global> mMenuEvents;
+        std::set<std::string, std::less<>> mCoalescedEvents;
+        // Positions of pending coalesced events in the new batches; cleared when the batches are finalized.
+        std::map<std::string, size_t, std::less<>> mNewGlobalCoalesced;
+        std::map<std::pair<ESM::RefNum, std::string>, size_t> mNewLocalCoalesced;
     };
 
 }
@@ -1,6 +1,8 @@
 #include "luamanagerimp.hpp"
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 
 #include <MyGUI_InputManager.h>
 #include <osg/Stats>
@@ -13,6 +15,8 @@
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/esmwriter.hpp>
 
+#include <components/files/conversion.hpp>
+
 #include <components/settings/values.hpp>
 
 #include <components/l10n/manager.hpp>
@@ -52,8 +56,10 @@ namespace MWLua
             .mLogMemoryUsage = Settings::lua().mLogMemoryUsage };
     }
 
-    LuaManager::LuaManager(const VFS::Manager* vfs, const std::filesystem::path& libsDir)
+    LuaManager::LuaManager(
+        const VFS::Manager* vfs, const std::filesystem::path& libsDir, const std::filesystem::path& logDir)
         : mLua(vfs, &mConfiguration, createLuaStateSettings())
+        , mLogDir(logDir)
     {
         Log(Debug::Info) << "Lua version: " << LuaUtil::getLuaVersion();
         mLua.addInternalLibSearchPath(libsDir);
@@ -688,6 +694,11 @@ namespace MWLua
     void LuaManager::handleConsoleCommand(
         const std::string& consoleMode, const std::string& command, const MWWorld::Ptr& selectedPtr)
     {
+        if (consoleMode.empty() && std::string_view(command).substr(0, 11) == "luaprofiler")
+        {
+            profilerConsoleCommand(command);
+            return;
+        }
         PlayerScripts* playerScripts = nullptr;
         if (!mPlayer.isEmpty())
             playerScripts = dynamic_cast<PlayerScripts*>(mPlayer.getRefData().getLuaScripts());
@@ -705,6 +716,59 @@ namespace MWLua
                 "No Lua handlers for console\n", MWBase::WindowManager::sConsoleColor_Error);
     }
 
+    void LuaManager::profilerConsoleCommand(std::string_view command)
+    {
+        MWBase::WindowManager* windowManager = MWBase::Environment::get().getWindowManager();
+        const auto print = [&](std::string msg, std::string_view color = MWBase::WindowManager::sConsoleColor_Default) {
+            windowManager->printToConsole(msg + "\n", color);
+        };
+
+        std::string_view arg = command.substr(std::min(command.size(), size_t(11)));
+        while (!arg.empty() && arg.front() == ' ')
+            arg.remove_prefix(1);
+
+        if (!LuaUtil::LuaState::isProfilerEnabled())
+        {
+            print("Lua profiler is disabled; enable [Lua] lua profiler in settings.cfg",
+                MWBase::WindowManager::sConsoleColor_Error);
+            return;
+        }
+
+        if (arg == "start")
+        {
+            mLua.clearSampledStacks();
+            mLua.setStackSamplingEnabled(true);
+            print("Lua stack sampling started", MWBase::WindowManager::sConsoleColor_Success);
+        }
+        else if (arg == "stop")
+        {
+            mLua.setStackSamplingEnabled(false);
+            print("Lua stack sampling stopped", MWBase::WindowManager::sConsoleColor_Success);
+        }
+        else if (arg == "dump" || std::string_view(arg).substr(0, 5) == "dump ")
+        {
+            std::string_view name = arg.size() > 5 ? arg.substr(5) : std::string_view("lua_profile.txt");
+            const std::filesystem::path path = mLogDir / name;
+            std::ofstream file(path);
+            file << mLua.formatSampledStacks();
+            if (file.fail())
+                print("Failed to write " + Files::pathToUnicodeString(path), MWBase::WindowManager::sConsoleColor_Error);
+            else
+                print("Lua stack samples written to " + Files::pathToUnicodeString(path)
+                        + " (collapsed stack format, e.g. for flamegraph.pl)",
+                    MWBase::WindowManager::sConsoleColor_Success);
+        }
+        else
+        {
+            print("Usage:", MWBase::WindowManager::sConsoleColor_Info);
+            print("  luaprofiler start - start collecting Lua stack samples",
+                MWBase::WindowManager::sConsoleColor_Info);
+            print("  luaprofiler stop - stop collecting", MWBase::WindowManager::sConsoleColor_Info);
+            print("  luaprofiler dump [filename] - write collected samples to a file in the logs directory",
+                MWBase::WindowManager::sConsoleColor_Info);
+        }
+    }
+
     LuaManager::DelayedAction::DelayedAction(LuaUtil::LuaState* state, std::function<void()> fn, std::string_view name)
         : mFn(std::move(fn))
         , mName(name)
@@ -783,7 +847,10 @@ namespace MWLua
         out << " (not tracked)\n";
         out << "  Memory allocations >  " << smallAllocSize << " bytes:";
         outMemSize(mLua.getTotalMemoryUsage() - mLua.getSmallAllocMemoryUsage());
-        out << " (see the table below)\n\n";
+        out << " (see the table below)\n";
+        out << "  Small allocation arena reserved:";
+        outMemSize(mLua.getSmallAllocPoolReservedMemory());
+        out << "\n\n";
 
         using Stats = LuaUtil::ScriptsContainer::ScriptStats;
 
@@ -809,6 +876,7 @@ namespace MWLua
         out << "Legend\n";
         out << "  ops:        Averaged number of Lua instruction per frame;\n";
         out << "  memory:     Aggregated size of Lua allocations > " << smallAllocSize << " bytes;\n";
+        out << "  allocs:     Number of Lua allocations attributed to the script since startup;\n";
         out << "  [all]:      Sum over all instances of each script;\n";
         out << "  [active]:   Sum over all active (i.e. currently in scene) instances of each script;\n";
         out << "  [inactive]: Sum over all inactive instances of each script;\n";
@@ -819,6 +887,7 @@ namespace MWLua
         out << " " << std::setw(nameW + 2) << "*** Resource usage per script";
         out << std::right;
         out << std::setw(valueW) << "ops";
+        out << std::setw(valueW) << "allocs";
         out << std::setw(valueW) << "memory";
         out << std::setw(valueW) << "memory";
         out << std::setw(valueW) << "ops";
@@ -826,6 +895,7 @@ namespace MWLua
         out << "\n";
         out << std::left << " " << std::setw(nameW + 2) << "[name]" << std::right;
         out << std::setw(valueW) << "[all]";
+        out << std::setw(valueW) << "[all]";
         out << std::setw(valueW) << "[active]";
         out << std::setw(valueW) << "[inactive]";
         out << std::setw(valueW * 2) << "[for selected object]";
@@ -842,6 +912,7 @@ namespace MWLua
                 out << "\n " << std::setw(nameW) << ""; // if path is too long, break line
             out << std::right;
             out << std::setw(valueW) << static_cast<int64_t>(activeStats[i].mAvgInstructionCount);
+            out << std::setw(valueW) << mLua.getAllocationCountByScriptIndex(i);
             outMemSize(activeStats[i].mMemoryUsage);
             outMemSize(mLua.getMemoryUsageByScriptIndex(i) - activeStats[i].mMemoryUsage);
 
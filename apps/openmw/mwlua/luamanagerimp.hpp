@@ -33,7 +33,7 @@ namespace MWLua
     class LuaManager : public MWBase::LuaManager
     {
     public:
-        LuaManager(const VFS::Manager* vfs, const std::filesystem::path& libsDir);
+        LuaManager(const VFS::Manager* vfs, const std::filesystem::path& libsDir, const std::filesystem::path& logDir);
         LuaManager(const LuaManager&) = delete;
         LuaManager(LuaManager&&) = delete;
         ~LuaManager();
@@ -169,6 +169,8 @@ namespace MWLua
         LocalScripts* createLocalScripts(const MWWorld::Ptr& ptr,
             std::optional<LuaUtil::ScriptIdsWithInitializationData> autoStartConf = std::nullopt);
         void reloadAllScriptsImpl();
+        // Handles the built-in `luaprofiler` console command (stack sampling control and dump).
+        void profilerConsoleCommand(std::string_view command);
 
         bool mInitialized = false;
         bool mGlobalScriptsStarted = false;
@@ -178,6 +180,7 @@ namespace MWLua
         bool mReloadAllScriptsRequested = false;
         LuaUtil::ScriptsConfiguration mConfiguration;
         LuaUtil::LuaState mLua;
+        std::filesystem::path mLogDir;
         LuaUi::ResourceManager mUiResourceManager;
         std::map<std::string, sol::object> mLocalPackages;
         std::map<std::string, sol::object> mPlayerPackages;
@@ -120,22 +120,22 @@ namespace MWLua
                 return rayCasting->castSphere(from, to, radius, collisionType);
             }
         };
-        // TODO: async raycasting
-        /*api["asyncCastRay"] = [luaManager = context.mLuaManager](
-            const Callback& luaCallback, const osg::Vec3f& from, const osg::Vec3f& to, sol::optional<sol::table>
-        options)
-        {
-            std::function<void(MWPhysics::RayCastingResult)> callback =
-                luaManager->wrapLuaCallback<MWPhysics::RayCastingResult>(luaCallback);
-            MWPhysics::RayCastingInterface* rayCasting = MWBase::Environment::get().getWorld()->getRayCasting();
-
-            // Handle options the same way as in `castRay`.
-
-            // NOTE: `callback` is not thread safe. If MWPhysics works in separate thread, it must put results to a
-        queue
-            //       and use this callback from the main thread at the beginning of the next frame processing.
-            rayCasting->asyncCastRay(callback, from, to, ignore, std::vector<MWWorld::Ptr>(), collisionType);
-        };*/
+        api["asyncCastRay"] = [context](const sol::table& callback, const osg::Vec3f& from, const osg::Vec3f& to,
+                                  sol::optional<sol::table> options) {
+            std::vector<MWWorld::ConstPtr> ignore;
+            int collisionType = MWPhysics::CollisionType_Default;
+            if (options)
+            {
+                ignore = parseIgnoreList<MWWorld::ConstPtr>(*options);
+                collisionType = options->get<sol::optional<int>>("collisionType").value_or(collisionType);
+            }
+            const MWPhysics::RayCastingInterface* rayCasting = MWBase::Environment::get().getWorld()->getRayCasting();
+            // The Lua callback is not thread safe, so the physics system queues the result and invokes
+            // the wrapper on the main thread at the beginning of the next frame processing.
+            rayCasting->asyncCastRay(context.mLuaManager->wrapLuaCallback<const MWPhysics::RayCastingResult&>(
+                                         LuaUtil::Callback::fromLua(callback)),
+                from, to, ignore, collisionType);
+        };
         api["castRenderingRay"] = [manager = context.mLuaManager](const osg::Vec3f& from, const osg::Vec3f& to,
                                       const sol::optional<sol::table>& options) {
             if (!manager->isProcessingInputEvents())
@@ -1,5 +1,7 @@
 #include "objectbindings.hpp"
 
+#include <memory>
+
 #include <components/esm3/loadfact.hpp>
 #include <components/esm3/loadnpc.hpp>
 #include <components/lua/luastate.hpp>
@@ -175,6 +177,12 @@ namespace MWLua
                 else
                     return sol::nullopt;
             };
+            listT["sendEvent"] = [context](const ListT& list, std::string_view eventName, const sol::object& eventData) {
+                // The payload is serialized once and shared between all queued events.
+                auto data = std::make_shared<const std::string>(LuaUtil::serialize(eventData, context.mSerializer));
+                for (const ObjectId& id : *list.mIds)
+                    context.mLuaEvents->addLocalEvent({ id, std::string(eventName), data });
+            };
             listT[sol::meta_function::pairs] = lua["ipairsForArray"].template get<sol::function>();
             listT[sol::meta_function::ipairs] = lua["ipairsForArray"].template get<sol::function>();
         }
@@ -337,8 +345,8 @@ namespace MWLua
             objectT[sol::meta_function::equal_to] = [](const ObjectT& a, const ObjectT& b) { return a.id() == b.id(); };
             objectT[sol::meta_function::to_string] = &ObjectT::toString;
             objectT["sendEvent"] = [context](const ObjectT& dest, std::string eventName, const sol::object& eventData) {
-                context.mLuaEvents->addLocalEvent(
-                    { dest.id(), std::move(eventName), LuaUtil::serialize(eventData, context.mSerializer) });
+                context.mLuaEvents->addLocalEvent({ dest.id(), std::move(eventName),
+                    std::make_shared<const std::string>(LuaUtil::serialize(eventData, context.mSerializer)) });
             };
 
             objectT["activateBy"] = [](const ObjectT& object, const ObjectT& actor) {
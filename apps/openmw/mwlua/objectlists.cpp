@@ -71,31 +71,51 @@ namespace MWLua
 
     void ObjectLists::ObjectGroup::updateList()
     {
-        if (mChanged)
+        // Applying the deltas in the order they were recorded keeps the list consistent
+        // even if the same object was removed and re-added within one frame.
+        for (const auto& [id, added] : mPending)
         {
-            mList->clear();
-            for (ObjectId id : mSet)
-                mList->push_back(id);
-            mChanged = false;
+            if (added)
+            {
+                if (mIndex.emplace(id, mList->size()).second)
+                    mList->push_back(id);
+            }
+            else
+            {
+                const auto it = mIndex.find(id);
+                if (it == mIndex.end())
+                    continue;
+                const size_t index = it->second;
+                const ObjectId last = mList->back();
+                (*mList)[index] = last;
+                mList->pop_back();
+                mIndex.erase(it);
+                if (last != id)
+                    mIndex[last] = index;
+            }
         }
+        mPending.clear();
     }
 
     void ObjectLists::ObjectGroup::clear()
     {
-        mChanged = false;
         mList->clear();
         mSet.clear();
+        mIndex.clear();
+        mPending.clear();
     }
 
     void ObjectLists::addToGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
-        group.mSet.insert(getId(ptr));
-        group.mChanged = true;
+        const ObjectId id = getId(ptr);
+        if (group.mSet.insert(id).second)
+            group.mPending.emplace_back(id, true);
     }
 
     void ObjectLists::removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
-        group.mSet.erase(getId(ptr));
-        group.mChanged = true;
+        const ObjectId id = getId(ptr);
+        if (group.mSet.erase(id) > 0)
+            group.mPending.emplace_back(id, false);
     }
 }
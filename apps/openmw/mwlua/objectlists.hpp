@@ -2,6 +2,9 @@
 #define MWLUA_OBJECTLISTS_H
 
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "object.hpp"
 
@@ -28,14 +31,19 @@ namespace MWLua
         void setPlayer(const MWWorld::Ptr& player) { *mPlayers = { getId(player) }; }
 
     private:
+        // The list the Lua side iterates is a stable shared vector; scene changes are
+        // recorded as add/remove deltas on the main thread and applied to the vector in
+        // updateList() at the sync point, so a scene change costs O(changed objects)
+        // instead of a full rebuild. The list is therefore in insertion order, not id order.
         struct ObjectGroup
         {
             void updateList();
             void clear();
 
-            bool mChanged = false;
             ObjectIdList mList = std::make_shared<std::vector<ObjectId>>();
-            std::set<ObjectId> mSet;
+            std::set<ObjectId> mSet; // logical membership, updated immediately
+            std::unordered_map<ObjectId, size_t> mIndex; // position in mList, updated in updateList()
+            std::vector<std::pair<ObjectId, bool>> mPending; // (id, added) in event order
         };
 
         ObjectGroup* chooseGroup(const MWWorld::Ptr& ptr);
@@ -1,5 +1,6 @@
 #include "activespells.hpp"
 
+#include <map>
 #include <optional>
 
 #include <components/debug/debuglog.hpp>
@@ -27,6 +28,7 @@
 #include "../mwrender/animation.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/inventorystore.hpp"
 #include "../mwworld/manualref.hpp"
@@ -317,11 +319,20 @@ namespace MWMechanics
         const MWWorld::Ptr player = MWMechanics::getPlayer();
         bool updatedHitOverlay = false;
         bool updatedEnemy = false;
+        // Looking up a caster by actor id scans the active cells, avoid repeating it for
+        // casters with several active spells on this actor
+        std::map<int, MWWorld::Ptr> casters;
         // Update effects
         for (auto spellIt = mSpells.begin(); spellIt != mSpells.end();)
         {
-            const auto caster = MWBase::Environment::get().getWorld()->searchPtrViaActorId(
-                spellIt->mCasterActorId); // Maybe make this search outside active grid?
+            auto casterIt = casters.find(spellIt->mCasterActorId);
+            if (casterIt == casters.end())
+                casterIt = casters
+                               .emplace(spellIt->mCasterActorId,
+                                   MWBase::Environment::get().getWorld()->searchPtrViaActorId(
+                                       spellIt->mCasterActorId)) // Maybe make this search outside active grid?
+                               .first;
+            const MWWorld::Ptr caster = casterIt->second;
             bool removedSpell = false;
             std::optional<ActiveSpellParams> reflected;
             for (auto it = spellIt->mEffects.begin(); it != spellIt->mEffects.end();)
@@ -364,7 +375,7 @@ namespace MWMechanics
             if (reflected)
             {
                 const ESM::Static* reflectStatic = MWBase::Environment::get().getESMStore()->get<ESM::Static>().find(
-                    ESM::RefId::stringRefId("VFX_Reflect"));
+                    MWWorld::CommonIds::VFX_Reflect);
                 MWRender::Animation* animation = MWBase::Environment::get().getWorld()->getAnimation(ptr);
                 if (animation && !reflectStatic->mModel.empty())
                     animation->addEffect(Misc::ResourceHelpers::correctMeshPath(reflectStatic->mModel),
@@ -1,6 +1,7 @@
 #include "actors.hpp"
 
 #include <array>
+#include <functional>
 #include <optional>
 
 #include <components/esm3/esmreader.hpp>
@@ -20,6 +21,7 @@
 
 #include "../mwworld/cellstore.hpp"
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/datetimemanager.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/inventorystore.hpp"
@@ -57,6 +59,10 @@
 
 namespace
 {
+    // Distance to the player within which actors always run their AI every frame; beyond it
+    // actors that are not fighting are time-sliced across aiDistantUpdatePeriod frames.
+    constexpr float aiFullRateDistance = 1792;
+    constexpr std::size_t aiDistantUpdatePeriod = 4;
 
     bool isConscious(const MWWorld::Ptr& ptr)
     {
@@ -212,7 +218,7 @@ namespace
                     MWBase::Environment::get().getWindowManager()->messageBox("#{sSoultrapSuccess}");
 
                 const ESM::Static* const fx
-                    = world->getStore().get<ESM::Static>().search(ESM::RefId::stringRefId("VFX_Soul_Trap"));
+                    = world->getStore().get<ESM::Static>().search(MWWorld::CommonIds::VFX_SoulTrap);
                 if (fx != nullptr)
                     world->spawnEffect(Misc::ResourceHelpers::correctMeshPath(fx->mModel), "",
                         creature.getRefData().getPosition().asVec3());
@@ -438,10 +444,10 @@ namespace MWMechanics
         // We chose to use the chance MW would have when run at 60 FPS with the default value of the GMST.
         const float delta = MWBase::Environment::get().getFrameDuration() * 6.f;
         static const float fVoiceIdleOdds
-            = world->getStore().get<ESM::GameSetting>().find("fVoiceIdleOdds")->mValue.getFloat();
+            = world->getStore().get<ESM::GameSetting>().find(MWWorld::CommonIds::fVoiceIdleOdds)->mValue.getFloat();
         if (Misc::Rng::rollProbability(world->getPrng()) * 10000.f < fVoiceIdleOdds * delta
             && world->getLOS(getPlayer(), actor))
-            MWBase::Environment::get().getDialogueManager()->say(actor, ESM::RefId::stringRefId("idle"));
+            MWBase::Environment::get().getDialogueManager()->say(actor, MWWorld::CommonIds::TopicIdle);
     }
 
     void Actors::updateMovementSpeed(const MWWorld::Ptr& actor) const
@@ -534,7 +540,7 @@ namespace MWMechanics
             if (greetingTimer >= GREETING_SHOULD_START)
             {
                 greetingState = Greet_InProgress;
-                MWBase::Environment::get().getDialogueManager()->say(actor, ESM::RefId::stringRefId("hello"));
+                MWBase::Environment::get().getDialogueManager()->say(actor, MWWorld::CommonIds::TopicHello);
                 greetingTimer = 0;
             }
         }
@@ -728,7 +734,7 @@ namespace MWMechanics
         {
             // Check if the creature is too far
             static const float fAlarmRadius
-                = world->getStore().get<ESM::GameSetting>().find("fAlarmRadius")->mValue.getFloat();
+                = world->getStore().get<ESM::GameSetting>().find(MWWorld::CommonIds::fAlarmRadius)->mValue.getFloat();
             if (sqrDist > fAlarmRadius * fAlarmRadius)
                 return;
 
@@ -998,14 +1004,14 @@ namespace MWMechanics
             {
                 // If drowning, apply 3 points of damage per second
                 static const float fSuffocationDamage
-                    = world->getStore().get<ESM::GameSetting>().find("fSuffocationDamage")->mValue.getFloat();
+                    = world->getStore().get<ESM::GameSetting>().find(MWWorld::CommonIds::fSuffocationDamage)->mValue.getFloat();
                 DynamicStat<float> health = stats.getHealth();
                 health.setCurrent(health.getCurrent() - fSuffocationDamage * duration);
                 stats.setHealth(health);
 
                 // Play a drowning sound
                 MWBase::SoundManager* sndmgr = MWBase::Environment::get().getSoundManager();
-                auto soundDrown = ESM::RefId::stringRefId("drown");
+                const ESM::RefId& soundDrown = MWWorld::CommonIds::Drown;
                 if (!sndmgr->getSoundPlaying(ptr, soundDrown))
                     sndmgr->playSound3D(ptr, soundDrown, 1.0f, 1.0f);
 
@@ -1470,6 +1476,8 @@ namespace MWMechanics
     {
         if (!paused)
         {
+            ++mAiUpdateFrame;
+
             const float updateEquippedLightInterval = 1.0f;
 
             if (mTimerUpdateHeadTrack >= 0.3f)
@@ -1506,6 +1514,41 @@ namespace MWMechanics
             }
             const int actorsProcessingRange = Settings::game().mActorsProcessingRange;
 
+            // Read-only planning phase: rate the combat targets of all fighting actors on a
+            // worker thread before anything below mutates the world. AiSequence::execute
+            // consumes the ratings and falls back to computing them inline for any target
+            // that was not planned (e.g. combat packages stacked by engageCombat this frame).
+            if (aiActive)
+            {
+                std::vector<MWWorld::Ptr> fightingActors;
+                for (const Actor& actor : mActors)
+                {
+                    const MWWorld::Ptr& ptr = actor.getPtr();
+                    if (ptr == player)
+                        continue;
+                    const CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
+                    if (stats.isDead() || !stats.getAiSequence().isInCombat())
+                        continue;
+                    const float distSqr = (playerPos - ptr.getRefData().getPosition().asVec3()).length2();
+                    if (distSqr > static_cast<float>(actorsProcessingRange) * actorsProcessingRange)
+                        continue;
+                    // Resolve the combat targets and warm the lazily computed fatigue terms
+                    // while still on the main thread; the planning tasks themselves must not
+                    // write shared state, not even through caches (see AiPlanner).
+                    stats.getFatigueTerm();
+                    for (const auto& package : stats.getAiSequence())
+                    {
+                        if (package->getTypeId() != AiPackageTypeId::Combat)
+                            break;
+                        const MWWorld::Ptr target = package->getTarget();
+                        if (!target.isEmpty())
+                            target.getClass().getCreatureStats(target).getFatigueTerm();
+                    }
+                    fightingActors.push_back(ptr);
+                }
+                mAiPlanner.plan(std::move(fightingActors));
+            }
+
             // AI and magic effects update
             for (Actor& actor : mActors)
             {
@@ -1579,18 +1622,34 @@ namespace MWMechanics
                         if (mTimerUpdateHeadTrack == 0)
                             updateHeadTracking(actor.getPtr(), mActors, isPlayer, ctrl);
 
-                        if (actor.getPtr().getClass().isNpc() && !isPlayer)
-                            updateCrimePursuit(actor.getPtr(), duration, cachedAllies);
-
-                        if (!isPlayer)
+                        // Actors close to the player or fighting run their AI every frame, the
+                        // rest are updated round-robin every aiDistantUpdatePeriod frames with the
+                        // skipped time accumulated, so crowds of background NPCs cost a fraction
+                        // of the full rate while combat and nearby actors stay responsive.
+                        actor.addAiDuration(duration);
+                        const bool fullRateAi = isPlayer || distSqr <= aiFullRateDistance * aiFullRateDistance
+                            || actor.getPtr().getClass().getCreatureStats(actor.getPtr()).getAiSequence().isInCombat();
+                        const bool runAi = fullRateAi
+                            || (mAiUpdateFrame + std::hash<const void*>{}(actor.getPtr().getBase()))
+                                    % aiDistantUpdatePeriod
+                                == 0;
+                        if (runAi)
                         {
-                            CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
-                            if (isConscious(actor.getPtr()) && !(luaControls && luaControls->mDisableAI))
+                            const float aiDuration = actor.takeAiDuration();
+
+                            if (actor.getPtr().getClass().isNpc() && !isPlayer)
+                                updateCrimePursuit(actor.getPtr(), aiDuration, cachedAllies);
+
+                            if (!isPlayer)
                             {
-                                stats.getAiSequence().execute(actor.getPtr(), ctrl, duration);
-                                updateGreetingState(actor.getPtr(), actor, mTimerUpdateHello > 0);
-                                playIdleDialogue(actor.getPtr());
-                                updateMovementSpeed(actor.getPtr());
+                                CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
+                                if (isConscious(actor.getPtr()) && !(luaControls && luaControls->mDisableAI))
+                                {
+                                    stats.getAiSequence().execute(actor.getPtr(), ctrl, aiDuration);
+                                    updateGreetingState(actor.getPtr(), actor, mTimerUpdateHello > 0);
+                                    playIdleDialogue(actor.getPtr());
+                                    updateMovementSpeed(actor.getPtr());
+                                }
                             }
                         }
                     }
@@ -1645,6 +1704,13 @@ namespace MWMechanics
                 CharacterController& ctrl = actor.getCharacterController();
                 ctrl.setActive(active);
 
+                // Skeletons of visible far away actors are posed at half rate; the character
+                // state itself still advances every frame so timers and text keys stay exact.
+                unsigned int updateRateDivisor = 1;
+                if (!isPlayer && dist > actorsProcessingRange / 2 && !stats.getAiSequence().isInCombat())
+                    updateRateDivisor = 2;
+                ctrl.setUpdateRateDivisor(updateRateDivisor);
+
                 if (!inRange)
                 {
                     actor.getPtr().getRefData().getBaseNode()->setNodeMask(0);
@@ -1756,7 +1822,7 @@ namespace MWMechanics
                 // Play dying words
                 // Note: It's not known whether the soundgen tags scream, roar, and moan are reliable
                 // for NPCs since some of the npc death animation files are missing them.
-                MWBase::Environment::get().getDialogueManager()->say(actor.getPtr(), ESM::RefId::stringRefId("hit"));
+                MWBase::Environment::get().getDialogueManager()->say(actor.getPtr(), MWWorld::CommonIds::TopicHit);
 
                 // Apply soultrap
                 if (actor.getPtr().getType() == ESM::Creature::sRecordId)
@@ -1802,7 +1868,7 @@ namespace MWMechanics
             MWBase::Environment::get().getWorld()->deleteObject(ptr);
 
             const ESM::Static* fx = MWBase::Environment::get().getESMStore()->get<ESM::Static>().search(
-                ESM::RefId::stringRefId("VFX_Summon_End"));
+                MWWorld::CommonIds::VFX_SummonEnd);
             if (fx)
                 MWBase::Environment::get().getWorld()->spawnEffect(
                     Misc::ResourceHelpers::correctMeshPath(fx->mModel), "", ptr.getRefData().getPosition().asVec3());
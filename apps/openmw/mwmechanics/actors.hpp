@@ -1,6 +1,7 @@
 #ifndef GAME_MWMECHANICS_ACTORS_H
 #define GAME_MWMECHANICS_ACTORS_H
 
+#include <cstddef>
 #include <list>
 #include <map>
 #include <set>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "actor.hpp"
+#include "aiplanner.hpp"
 
 namespace ESM
 {
@@ -178,6 +180,8 @@ namespace MWMechanics
         float mTimerUpdateHello = 0;
         float mSneakTimer = 0; // Times update of sneak icon
         float mSneakSkillTimer = 0; // Times sneak skill progress from "avoid notice"
+        std::size_t mAiUpdateFrame = 0; // Spreads throttled distant actor AI updates across frames
+        AiPlanner mAiPlanner;
 
         void updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const;
 
@@ -13,6 +13,7 @@
 #include "../mwphysics/raycasting.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 
 #include "../mwbase/dialoguemanager.hpp"
@@ -224,7 +225,7 @@ namespace MWMechanics
             if (currentAction->isFleeing())
             {
                 storage.startFleeing();
-                MWBase::Environment::get().getDialogueManager()->say(actor, ESM::RefId::stringRefId("flee"));
+                MWBase::Environment::get().getDialogueManager()->say(actor, MWWorld::CommonIds::TopicFlee);
                 return false;
             }
             else
@@ -303,8 +304,8 @@ namespace MWMechanics
                 // If there is no path, try to find a point on a line from the actor position to target projected
                 // on navmesh to attack the target from there.
                 const auto navigator = world->getNavigator();
-                const auto hit
-                    = DetourNavigator::raycast(*navigator, agentBounds, vActorPos, vTargetPos, navigatorFlags);
+                const auto hit = DetourNavigator::raycast(
+                    *navigator, agentBounds, storage.mRaycastCache, vActorPos, vTargetPos, navigatorFlags);
 
                 if (hit.has_value() && (*hit - vTargetPos).length() <= rangeAttack)
                 {
@@ -327,7 +328,7 @@ namespace MWMechanics
                     currentAction = std::make_unique<ActionFlee>();
                     actionCooldown = currentAction->getActionCooldown();
                     storage.startFleeing();
-                    MWBase::Environment::get().getDialogueManager()->say(actor, ESM::RefId::stringRefId("flee"));
+                    MWBase::Environment::get().getDialogueManager()->say(actor, MWWorld::CommonIds::TopicFlee);
                 }
             }
             else
@@ -660,20 +661,20 @@ namespace MWMechanics
 
                 const MWWorld::ESMStore& store = *MWBase::Environment::get().getESMStore();
 
-                float baseDelay = store.get<ESM::GameSetting>().find("fCombatDelayCreature")->mValue.getFloat();
+                float baseDelay = store.get<ESM::GameSetting>().find(MWWorld::CommonIds::fCombatDelayCreature)->mValue.getFloat();
                 if (actor.getClass().isNpc())
                 {
-                    baseDelay = store.get<ESM::GameSetting>().find("fCombatDelayNPC")->mValue.getFloat();
+                    baseDelay = store.get<ESM::GameSetting>().find(MWWorld::CommonIds::fCombatDelayNPC)->mValue.getFloat();
                 }
 
                 if (canShout)
                 {
                     // Say a provoking combat phrase
                     const int iVoiceAttackOdds
-                        = store.get<ESM::GameSetting>().find("iVoiceAttackOdds")->mValue.getInteger();
+                        = store.get<ESM::GameSetting>().find(MWWorld::CommonIds::iVoiceAttackOdds)->mValue.getInteger();
                     if (Misc::Rng::roll0to99(prng) < iVoiceAttackOdds)
                     {
-                        MWBase::Environment::get().getDialogueManager()->say(actor, ESM::RefId::stringRefId("attack"));
+                        MWBase::Environment::get().getDialogueManager()->say(actor, MWWorld::CommonIds::TopicAttack);
                     }
                 }
                 mAttackCooldown = std::min(baseDelay + 0.01 * Misc::Rng::roll0to99(prng), baseDelay + 0.9);
@@ -4,6 +4,8 @@
 #include "aitemporarybase.hpp"
 #include "typedaipackage.hpp"
 
+#include <components/detournavigator/raycastcache.hpp>
+
 #include "../mwworld/cellstore.hpp" // for Doors
 
 #include "aitimer.hpp"
@@ -57,6 +59,8 @@ namespace MWMechanics
         bool mUseCustomDestination;
         osg::Vec3f mCustomDestination;
 
+        DetourNavigator::RaycastCache mRaycastCache;
+
         AiCombatStorage();
 
         void startCombatMove(bool isDistantCombat, float distToTarget, float rangeAttack, const MWWorld::Ptr& actor,
@@ -87,6 +87,10 @@ namespace MWMechanics
 
         /// Get the target actor the AI is targeted at (not applicable to all AI packages, default return empty Ptr)
         virtual MWWorld::Ptr getTarget() const;
+        /// The target resolved by the last getTarget() call, if any, without attempting to
+        /// resolve it again. Resolving runs cell searches that write cell state, so this is the
+        /// only variant the AI planning phase may use (see AiPlanner).
+        const MWWorld::Ptr& getCachedTarget() const { return mCachedTarget; }
         /// Optimized version of getTarget() == ptr
         virtual bool targetIs(const MWWorld::Ptr& ptr) const;
 
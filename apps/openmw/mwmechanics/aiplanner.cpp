@@ -0,0 +1,88 @@
+#include "aiplanner.hpp"
+
+#include <components/debug/debuglog.hpp>
+
+#include "../mwworld/class.hpp"
+
+#include "aisequence.hpp"
+#include "creaturestats.hpp"
+
+namespace MWMechanics
+{
+    std::atomic<bool> AiPlanner::sPlanning{ false };
+
+    AiPlanner::AiPlanner()
+        : mThread([this] { run(); })
+    {
+    }
+
+    AiPlanner::~AiPlanner()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mJoinRequest = true;
+        }
+        mHasWork.notify_one();
+        mThread.join();
+    }
+
+    void AiPlanner::plan(std::vector<MWWorld::Ptr>&& actors)
+    {
+        if (actors.empty())
+            return;
+        sPlanning.store(true, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mActors = std::move(actors);
+            mNextTask = 0;
+            mFinishedTasks = 0;
+        }
+        mHasWork.notify_one();
+        while (planNext())
+        {
+        }
+        std::unique_lock<std::mutex> lock(mMutex);
+        mBatchDone.wait(lock, [this] { return mFinishedTasks == mActors.size(); });
+        mActors.clear();
+        sPlanning.store(false, std::memory_order_relaxed);
+    }
+
+    bool AiPlanner::planNext()
+    {
+        MWWorld::Ptr actor;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mNextTask >= mActors.size())
+                return false;
+            actor = mActors[mNextTask++];
+        }
+        try
+        {
+            actor.getClass().getCreatureStats(actor).getAiSequence().planCombatTargets(actor);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to plan AI for " << actor.getCellRef().getRefId() << ": " << e.what();
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (++mFinishedTasks == mActors.size())
+            mBatchDone.notify_one();
+        return true;
+    }
+
+    void AiPlanner::run() noexcept
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mHasWork.wait(lock, [this] { return mJoinRequest || mNextTask < mActors.size(); });
+                if (mJoinRequest)
+                    return;
+            }
+            while (planNext())
+            {
+            }
+        }
+    }
+}
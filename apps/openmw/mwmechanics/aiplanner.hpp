@@ -0,0 +1,61 @@
+#ifndef GAME_MWMECHANICS_AIPLANNER_H
+#define GAME_MWMECHANICS_AIPLANNER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../mwworld/ptr.hpp"
+
+namespace MWMechanics
+{
+    /// \brief Runs the read-only AI planning phase for a batch of actors on a worker thread.
+    /** Follows the snapshot discipline established by MWLua::Worker: while a batch is being
+        planned the main thread works through the same queue inside plan() and does not mutate
+        the world. Each task writes only to the plan stored in its own actor's AiSequence, which
+        the main thread consumes afterwards in AiSequence::execute.
+
+        Because tasks for different actors still read the same shared state (a target's stats and
+        inventory are rated by every actor fighting it), read-only also means free of lazy mutable
+        writes: anything a task calls must either not populate caches under the hood (see
+        AiSequence::planCombatTargets rating only targets already resolved by Actors) or populate
+        them in a thread-safe manner (see CreatureStats::getFatigueTerm). isPlanning() lets the
+        remaining lazy writers assert that they are not reached from a planning task. **/
+    class AiPlanner
+    {
+    public:
+        AiPlanner();
+
+        ~AiPlanner();
+
+        /// Plan all given actors, sharing the work between the calling thread and the worker.
+        /// Returns once every actor has been planned.
+        void plan(std::vector<MWWorld::Ptr>&& actors);
+
+        /// Is a planning batch in flight on any AiPlanner? While this is true no thread may
+        /// mutate world state, including lazily populated caches reachable from const accessors.
+        static bool isPlanning() { return sPlanning.load(std::memory_order_relaxed); }
+
+    private:
+        /// Plan a single not yet planned actor, return false if there is none left.
+        bool planNext();
+
+        void run() noexcept;
+
+        std::mutex mMutex;
+        std::condition_variable mHasWork;
+        std::condition_variable mBatchDone;
+        std::vector<MWWorld::Ptr> mActors;
+        std::size_t mNextTask = 0;
+        std::size_t mFinishedTasks = 0;
+        bool mJoinRequest = false;
+        std::thread mThread;
+
+        static std::atomic<bool> sPlanning;
+    };
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "aisequence.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 
 #include <components/debug/debuglog.hpp>
@@ -9,6 +10,8 @@
 #include "../mwbase/environment.hpp"
 #include "../mwbase/mechanicsmanager.hpp"
 #include "../mwworld/class.hpp"
+#include "../mwworld/inventorystore.hpp"
+
 #include "actorutil.hpp"
 #include "aiactivate.hpp"
 #include "aicombat.hpp"
@@ -241,6 +244,56 @@ namespace MWMechanics
         }
     }
 
+    bool AiSequence::combatRatingsValid(const MWWorld::Ptr& actor, std::chrono::steady_clock::time_point now) const
+    {
+        // Ratings also depend on slowly changing state without a change signal (health,
+        // magicka, fatigue), so they additionally expire after a fixed time.
+        constexpr std::chrono::milliseconds timeToLive{ 500 };
+        if (mCombatRatings.empty() || now - mCombatRatingsTime > timeToLive)
+            return false;
+        const MWWorld::Class& cls = actor.getClass();
+        if (cls.getCreatureStats(actor).getMagicEffects().getRevision() != mCombatRatingsEffectsRevision)
+            return false;
+        return !cls.hasInventoryStore(actor)
+            || cls.getInventoryStore(actor).getRevision() == mCombatRatingsInventoryRevision;
+    }
+
+    const float* AiSequence::findCombatRating(const MWWorld::Ptr& target) const
+    {
+        const auto it = std::find_if(mCombatRatings.begin(), mCombatRatings.end(),
+            [&](const auto& rating) { return rating.first == target; });
+        if (it == mCombatRatings.end())
+            return nullptr;
+        return &it->second;
+    }
+
+    void AiSequence::planCombatTargets(const MWWorld::Ptr& actor)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (!combatRatingsValid(actor, now))
+        {
+            const MWWorld::Class& cls = actor.getClass();
+            mCombatRatings.clear();
+            mCombatRatingsTime = now;
+            mCombatRatingsEffectsRevision = cls.getCreatureStats(actor).getMagicEffects().getRevision();
+            mCombatRatingsInventoryRevision
+                = cls.hasInventoryStore(actor) ? cls.getInventoryStore(actor).getRevision() : 0;
+        }
+        for (const auto& package : mPackages)
+        {
+            if (package->getTypeId() != AiPackageTypeId::Combat)
+                break;
+
+            // Actors resolves the targets on the main thread before dispatching the batch;
+            // resolving here would run cell searches that write cell state concurrently.
+            const MWWorld::Ptr& target = package->getCachedTarget();
+            if (target.isEmpty() || findCombatRating(target) != nullptr)
+                continue;
+
+            mCombatRatings.emplace_back(target, MWMechanics::getBestActionRating(actor, target));
+        }
+    }
+
     void AiSequence::execute(
         const MWWorld::Ptr& actor, CharacterController& characterController, float duration, bool outOfRange)
     {
@@ -250,6 +303,9 @@ namespace MWMechanics
             return;
         }
 
+        // Memoized ratings from the planning phase are reused while they are still valid.
+        const bool combatRatingsUsable = combatRatingsValid(actor, std::chrono::steady_clock::now());
+
         if (mResetFriendlyHits)
         {
             actor.getClass().getCreatureStats(actor).resetFriendlyHits();
@@ -296,7 +352,13 @@ namespace MWMechanics
                 {
                     float rating = 0.f;
                     if (MWMechanics::canFight(actor, target))
-                        rating = MWMechanics::getBestActionRating(actor, target);
+                    {
+                        const float* planned = combatRatingsUsable ? findCombatRating(target) : nullptr;
+                        if (planned != nullptr)
+                            rating = *planned;
+                        else
+                            rating = MWMechanics::getBestActionRating(actor, target);
+                    }
 
                     const ESM::Position& targetPos = target.getRefData().getPosition();
 
@@ -367,6 +429,7 @@ namespace MWMechanics
     void AiSequence::clear()
     {
         mPackages.clear();
+        mCombatRatings.clear();
         mNumCombatPackages = 0;
         mNumPursuitPackages = 0;
     }
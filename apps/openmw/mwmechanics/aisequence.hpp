@@ -2,18 +2,18 @@
 #define GAME_MWMECHANICS_AISEQUENCE_H
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "aipackagetypeid.hpp"
 #include "aistate.hpp"
 
-#include <components/esm3/loadnpc.hpp>
+#include "../mwworld/ptr.hpp"
 
-namespace MWWorld
-{
-    class Ptr;
-}
+#include <components/esm3/loadnpc.hpp>
 
 namespace ESM
 {
@@ -51,6 +51,17 @@ namespace MWMechanics
         AiPackageTypeId mLastAiPackage;
         AiState mAiState;
 
+        /// Combat target ratings produced by planCombatTargets, reused by execute until they
+        /// expire or the actor's magic effects or inventory change
+        std::vector<std::pair<MWWorld::Ptr, float>> mCombatRatings;
+        std::chrono::steady_clock::time_point mCombatRatingsTime;
+        std::size_t mCombatRatingsEffectsRevision = 0;
+        std::size_t mCombatRatingsInventoryRevision = 0;
+
+        inline bool combatRatingsValid(const MWWorld::Ptr& actor, std::chrono::steady_clock::time_point now) const;
+
+        inline const float* findCombatRating(const MWWorld::Ptr& target) const;
+
         void onPackageAdded(const AiPackage& package);
         void onPackageRemoved(const AiPackage& package);
 
@@ -145,6 +156,14 @@ namespace MWMechanics
         /// Removes all pursue packages until first non-pursue or stack empty.
         void stopPursuit();
 
+        /// Rate the targets of all active combat packages against the given actor.
+        /** Read-only planning phase that may run on a worker thread while the world is not
+            being mutated. Ratings are memoized: they are recomputed only when they expired,
+            the actor's magic effects or inventory changed, or a target has no rating yet.
+            execute reuses valid ratings and falls back to an inline computation otherwise.
+            \see AiPlanner **/
+        void planCombatTargets(const MWWorld::Ptr& actor);
+
         /// Execute current package, switching if needed.
         void execute(const MWWorld::Ptr& actor, CharacterController& characterController, float duration,
             bool outOfRange = false);
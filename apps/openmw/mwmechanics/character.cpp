@@ -43,6 +43,7 @@
 #include "../mwbase/world.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/inventorystore.hpp"
 #include "../mwworld/player.hpp"
@@ -1486,7 +1487,7 @@ namespace MWMechanics
 
         if (isWerewolf)
         {
-            const ESM::RefId wolfRun = ESM::RefId::stringRefId("WolfRun");
+            const ESM::RefId& wolfRun = MWWorld::CommonIds::WolfRun;
             if (isRunning() && !world->isSwimming(mPtr) && mWeaponType == ESM::Weapon::None)
             {
                 if (!sndMgr->getSoundPlaying(mPtr, wolfRun))
@@ -1588,7 +1589,7 @@ namespace MWMechanics
                                     effects->back().mData.mEffectID); // use last effect of list for color of VFX_Hands
 
                                 const ESM::Static* castStatic
-                                    = world->getStore().get<ESM::Static>().find(ESM::RefId::stringRefId("VFX_Hands"));
+                                    = world->getStore().get<ESM::Static>().find(MWWorld::CommonIds::VFX_Hands);
 
                                 if (mAnimation->getNode("Bip01 L Hand"))
                                     mAnimation->addEffect(Misc::ResourceHelpers::correctMeshPath(castStatic->mModel),
@@ -2223,7 +2224,7 @@ namespace MWMechanics
                             float realHealthLost = healthLost * (1.0f - 0.25f * fatigueTerm);
                             health.setCurrent(health.getCurrent() - realHealthLost);
                             cls.getCreatureStats(mPtr).setHealth(health);
-                            sndMgr->playSound3D(mPtr, ESM::RefId::stringRefId("Health Damage"), 1.0f, 1.0f);
+                            sndMgr->playSound3D(mPtr, MWWorld::CommonIds::HealthDamage, 1.0f, 1.0f);
                             if (isPlayer)
                                 MWBase::Environment::get().getWindowManager()->activateHitOverlay();
                         }
@@ -2750,6 +2751,7 @@ namespace MWMechanics
         if (!mAnimation)
             return;
         clearAnimQueue();
+        mMagicEffectsRevision = static_cast<std::size_t>(-1);
 
         // Make sure we canceled the current attack or spellcasting,
         // because we disabled attack animations anyway.
@@ -2824,11 +2826,18 @@ namespace MWMechanics
         }
     }
 
-    void CharacterController::updateMagicEffects() const
+    void CharacterController::updateMagicEffects()
     {
         if (!mPtr.getClass().isActor())
             return;
 
+        // Effects feed the animation only through the magnitudes read below, skip the
+        // update entirely while they are unchanged.
+        const std::size_t revision = mPtr.getClass().getCreatureStats(mPtr).getMagicEffects().getRevision();
+        if (revision == mMagicEffectsRevision)
+            return;
+        mMagicEffectsRevision = revision;
+
         float light = mPtr.getClass()
                           .getCreatureStats(mPtr)
                           .getMagicEffects()
@@ -3018,6 +3027,11 @@ namespace MWMechanics
         mAnimation->setActive(active);
     }
 
+    void CharacterController::setUpdateRateDivisor(unsigned int divisor) const
+    {
+        mAnimation->setUpdateRateDivisor(divisor);
+    }
+
     void CharacterController::setHeadTrackTarget(const MWWorld::ConstPtr& target)
     {
         mHeadTrackTarget = target;
@@ -3025,8 +3039,7 @@ namespace MWMechanics
 
     void CharacterController::playSwishSound() const
     {
-        static ESM::RefId weaponSwish = ESM::RefId::stringRefId("Weapon Swish");
-        const ESM::RefId* soundId = &weaponSwish;
+        const ESM::RefId* soundId = &MWWorld::CommonIds::WeaponSwish;
         float volume = 0.98f + mAttackStrength * 0.02f;
         float pitch = 0.75f + mAttackStrength * 0.4f;
 
@@ -1,6 +1,7 @@
 #ifndef GAME_MWMECHANICS_CHARACTER_HPP
 #define GAME_MWMECHANICS_CHARACTER_HPP
 
+#include <cstddef>
 #include <deque>
 
 #include <components/esm3/loadweap.hpp>
@@ -197,6 +198,9 @@ namespace MWMechanics
         bool mIsMovingBackward{ false };
         osg::Vec2f mSmoothedSpeed;
 
+        // last magic effects revision consumed by updateMagicEffects
+        std::size_t mMagicEffectsRevision{ static_cast<std::size_t>(-1) };
+
         std::string_view getMovementBasedAttackType() const;
 
         void clearStateAnimation(std::string& anim) const;
@@ -226,7 +230,7 @@ namespace MWMechanics
 
         void updateHeadTracking(float duration);
 
-        void updateMagicEffects() const;
+        void updateMagicEffects();
 
         void playDeath(float startpoint, CharacterState death);
         CharacterState chooseRandomDeathState() const;
@@ -328,6 +332,9 @@ namespace MWMechanics
         /// @see Animation::setActive
         void setActive(int active) const;
 
+        /// @see Animation::setUpdateRateDivisor
+        void setUpdateRateDivisor(unsigned int divisor) const;
+
         /// Make this character turn its head towards \a target. To turn off head tracking, pass an empty Ptr.
         void setHeadTrackTarget(const MWWorld::ConstPtr& target);
 
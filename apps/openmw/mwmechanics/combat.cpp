@@ -18,6 +18,7 @@
 #include "../mwbase/world.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/globals.hpp"
 #include "../mwworld/inventorystore.hpp"
@@ -138,11 +139,11 @@ namespace MWMechanics
             MWBase::SoundManager* sndMgr = MWBase::Environment::get().getSoundManager();
             const ESM::RefId skill = shield->getClass().getEquipmentSkill(*shield);
             if (skill == ESM::Skill::LightArmor)
-                sndMgr->playSound3D(blocker, ESM::RefId::stringRefId("Light Armor Hit"), 1.0f, 1.0f);
+                sndMgr->playSound3D(blocker, MWWorld::CommonIds::LightArmorHit, 1.0f, 1.0f);
             else if (skill == ESM::Skill::MediumArmor)
-                sndMgr->playSound3D(blocker, ESM::RefId::stringRefId("Medium Armor Hit"), 1.0f, 1.0f);
+                sndMgr->playSound3D(blocker, MWWorld::CommonIds::MediumArmorHit, 1.0f, 1.0f);
             else if (skill == ESM::Skill::HeavyArmor)
-                sndMgr->playSound3D(blocker, ESM::RefId::stringRefId("Heavy Armor Hit"), 1.0f, 1.0f);
+                sndMgr->playSound3D(blocker, MWWorld::CommonIds::HeavyArmorHit, 1.0f, 1.0f);
 
             // Reduce shield durability by incoming damage
             int shieldhealth = shield->getClass().getItemHealth(*shield);
@@ -281,7 +282,7 @@ namespace MWMechanics
                 damage *= fCombatKODamageMult;
                 if (!knockedDown)
                     MWBase::Environment::get().getSoundManager()->playSound3D(
-                        victim, ESM::RefId::stringRefId("critical damage"), 1.0f, 1.0f);
+                        victim, MWWorld::CommonIds::CriticalDamage, 1.0f, 1.0f);
             }
         }
 
@@ -398,7 +399,7 @@ namespace MWMechanics
             attackerStats.setHealth(health);
 
             MWBase::Environment::get().getSoundManager()->playSound3D(
-                attacker, ESM::RefId::stringRefId("Health Damage"), 1.0f, 1.0f);
+                attacker, MWWorld::CommonIds::HealthDamage, 1.0f, 1.0f);
         }
     }
 
@@ -511,7 +512,7 @@ namespace MWMechanics
                 sndMgr->playSound3D(victim, sound->mId, 1.0f, 1.0f);
         }
         else if (!healthdmg)
-            sndMgr->playSound3D(victim, ESM::RefId::stringRefId("Hand To Hand Hit"), 1.0f, 1.0f);
+            sndMgr->playSound3D(victim, MWWorld::CommonIds::HandToHandHit, 1.0f, 1.0f);
     }
 
     void applyFatigueLoss(const MWWorld::Ptr& attacker, const MWWorld::Ptr& weapon, float attackStrength)
@@ -699,7 +700,7 @@ namespace MWMechanics
             return false;
 
         if (complain)
-            MWBase::Environment::get().getDialogueManager()->say(target, ESM::RefId::stringRefId("hit"));
+            MWBase::Environment::get().getDialogueManager()->say(target, MWWorld::CommonIds::TopicHit);
         return true;
     }
 
@@ -1,6 +1,7 @@
 #include "creaturestats.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <type_traits>
 
 #include <components/esm3/creaturestats.hpp>
@@ -15,12 +16,16 @@
 #include "../mwbase/environment.hpp"
 #include "../mwbase/world.hpp"
 
+#include "aiplanner.hpp"
+
 namespace MWMechanics
 {
     int CreatureStats::sActorId = 0;
 
     CreatureStats::CreatureStats()
         : mDrawState(DrawState::Nothing)
+        , mFatigueTerm(0)
+        , mFatigueTermUpToDate(false)
         , mDead(false)
         , mDeathAnimationFinished(false)
         , mDied(false)
@@ -64,6 +69,9 @@ namespace MWMechanics
 
     float CreatureStats::getFatigueTerm() const
     {
+        if (mFatigueTermUpToDate)
+            return mFatigueTerm;
+
         float max = getFatigue().getModified();
         float current = getFatigue().getCurrent();
 
@@ -75,7 +83,19 @@ namespace MWMechanics
         static const float fFatigueBase = gmst.find("fFatigueBase")->mValue.getFloat();
         static const float fFatigueMult = gmst.find("fFatigueMult")->mValue.getFloat();
 
-        return fFatigueBase - fFatigueMult * (1 - normalised);
+        const float term = fFatigueBase - fFatigueMult * (1 - normalised);
+
+        // The AI planning threads may get here concurrently on a shared target whose cache was
+        // cold (Actors only pre-warms batch actors and resolved targets). Stats do not change
+        // while a batch is in flight, so every access above is a stable read; just skip
+        // populating the cache rather than racing on it.
+        if (!AiPlanner::isPlanning())
+        {
+            mFatigueTerm = term;
+            mFatigueTermUpToDate = true;
+        }
+
+        return term;
     }
 
     const AttributeValue& CreatureStats::getAttribute(ESM::RefId id) const
@@ -200,8 +220,15 @@ namespace MWMechanics
         if (index < 0 || index > 2)
             throw std::runtime_error("dynamic stat index is out of range");
 
+        // The AI planning phase reads stats from two threads and relies on them not changing
+        // while a batch is in flight (see AiPlanner).
+        assert(!AiPlanner::isPlanning());
+
         mDynamic[index] = value;
 
+        if (index == 2)
+            mFatigueTermUpToDate = false;
+
         if (index == 0 && mDynamic[index].getCurrent() < 1)
         {
             if (!mDead)
@@ -602,6 +629,7 @@ namespace MWMechanics
 
             for (size_t i = 0; i < state.mDynamic.size(); ++i)
                 mDynamic[i].readState(state.mDynamic[i]);
+            mFatigueTermUpToDate = false;
 
             mGoldPool = state.mGoldPool;
             mTalkedTo = state.mTalkedTo;
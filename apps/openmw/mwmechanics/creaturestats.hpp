@@ -42,6 +42,12 @@ namespace MWMechanics
         DrawState mDrawState;
         std::map<ESM::RefId, AttributeValue> mAttributes;
         DynamicStat<float> mDynamic[3]; // health, magicka, fatigue
+        // Derived from mDynamic[2] on demand; stays valid until fatigue is written again.
+        // Read concurrently by the AI planning threads, so getFatigueTerm() only writes these
+        // outside the planning phase (see AiPlanner); the invalidating writers are main thread
+        // only and assert that no batch is in flight.
+        mutable float mFatigueTerm;
+        mutable bool mFatigueTermUpToDate;
         Spells mSpells;
         ActiveSpells mActiveSpells;
         MagicEffects mMagicEffects;
@@ -171,7 +177,7 @@ namespace MWMechanics
         AiSequence& getAiSequence();
 
         float getFatigueTerm() const;
-        ///< Return effective fatigue
+        ///< Return effective fatigue. Cached; only recomputed after the fatigue stat changed.
 
         bool isParalyzed() const;
 
@@ -123,11 +123,16 @@ namespace MWMechanics
 
     void MagicEffects::remove(const EffectKey& key)
     {
-        mCollection.erase(key);
+        if (mCollection.erase(key) > 0)
+            ++mRevision;
     }
 
     void MagicEffects::add(const EffectKey& key, const EffectParam& param)
     {
+        // applying an unchanged magnitude must not count as a change
+        if (param.getBase() == 0 && param.getModifier() == 0.f)
+            return;
+
         Collection::iterator iter = mCollection.find(key);
 
         if (iter == mCollection.end())
@@ -138,24 +143,37 @@ namespace MWMechanics
         {
             iter->second += param;
         }
+        ++mRevision;
     }
 
     void MagicEffects::modifyBase(const EffectKey& key, int diff)
     {
+        if (diff == 0)
+            return;
         mCollection[key].modifyBase(diff);
+        ++mRevision;
     }
 
     void MagicEffects::setModifiers(const MagicEffects& effects)
     {
+        bool changed = false;
+
         for (Collection::iterator it = mCollection.begin(); it != mCollection.end(); ++it)
         {
-            it->second.setModifier(effects.getOrDefault(it->first).getModifier());
+            const float modifier = effects.getOrDefault(it->first).getModifier();
+            changed = changed || modifier != it->second.getModifier();
+            it->second.setModifier(modifier);
         }
 
         for (Collection::const_iterator it = effects.begin(); it != effects.end(); ++it)
         {
-            mCollection[it->first].setModifier(it->second.getModifier());
+            EffectParam& param = mCollection[it->first];
+            changed = changed || param.getModifier() != it->second.getModifier();
+            param.setModifier(it->second.getModifier());
         }
+
+        if (changed)
+            ++mRevision;
     }
 
     EffectParam MagicEffects::getOrDefault(const EffectKey& key) const
@@ -227,6 +245,7 @@ namespace MWMechanics
             mCollection[EffectKey(key)].setBase(params.first);
             mCollection[EffectKey(key)].setModifier(params.second);
         }
+        ++mRevision;
     }
 
     std::string getMagicEffectString(
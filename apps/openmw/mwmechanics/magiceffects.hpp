@@ -1,6 +1,7 @@
 #ifndef GAME_MWMECHANICS_MAGICEFFECTS_H
 #define GAME_MWMECHANICS_MAGICEFFECTS_H
 
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <string>
@@ -93,6 +94,7 @@ namespace MWMechanics
 
     private:
         Collection mCollection;
+        std::size_t mRevision = 0;
 
     public:
         Collection::const_iterator begin() const { return mCollection.begin(); }
@@ -110,6 +112,10 @@ namespace MWMechanics
         /// Copy Modifier values from \a effects, but keep original mBase values.
         void setModifiers(const MagicEffects& effects);
 
+        /// Incremented whenever an effect value changes. Consumers can compare it against a
+        /// stored value to skip recomputing state derived from the effects.
+        std::size_t getRevision() const { return mRevision; }
+
         EffectParam getOrDefault(const EffectKey& key) const;
         std::optional<EffectParam> get(const EffectKey& key) const;
         ///< This function can safely be used for keys that are not present.
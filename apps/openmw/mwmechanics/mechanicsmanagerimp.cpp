@@ -16,6 +16,7 @@
 #include <components/sceneutil/positionattitudetransform.hpp>
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/globals.hpp"
 #include "../mwworld/inventorystore.hpp"
@@ -90,7 +91,7 @@ namespace
         const MWWorld::CellRef& cellref = target.getCellRef();
 
         const ESM::RefId& owner = cellref.getOwner();
-        bool isOwned = !owner.empty() && owner != ESM::RefId::stringRefId("Player");
+        bool isOwned = !owner.empty() && owner != MWWorld::CommonIds::Player;
 
         const ESM::RefId& faction = cellref.getFaction();
         bool isFactionOwned = false;
@@ -1149,7 +1150,7 @@ namespace MWMechanics
 
         osg::Vec3f from(player.getRefData().getPosition().asVec3());
         const MWWorld::ESMStore& esmStore = *MWBase::Environment::get().getESMStore();
-        float radius = esmStore.get<ESM::GameSetting>().find("fAlarmRadius")->mValue.getFloat();
+        float radius = esmStore.get<ESM::GameSetting>().find(MWWorld::CommonIds::fAlarmRadius)->mValue.getFloat();
 
         mActors.getObjectsInRange(from, radius, neighbors);
 
@@ -1172,12 +1173,14 @@ namespace MWMechanics
                 // Murder crime can be reported even if no one saw it (hearing is enough, I guess).
                 // TODO: Add mod support for stealth executions!
                 || (type == OT_Murder && neighbor != victim)
-                || (MWBase::Environment::get().getWorld()->getLOS(player, neighbor)
-                    && awarenessCheck(player, neighbor)))
+                // awarenessCheck is plain math over distance, facing and stats, so let it
+                // filter the candidates before paying for a line of sight ray per witness
+                || (awarenessCheck(player, neighbor)
+                    && MWBase::Environment::get().getWorld()->getLOS(player, neighbor)))
             {
                 // NPC will complain about theft even if he will do nothing about it
                 if (type == OT_Theft || type == OT_Pickpocket)
-                    MWBase::Environment::get().getDialogueManager()->say(neighbor, ESM::RefId::stringRefId("thief"));
+                    MWBase::Environment::get().getDialogueManager()->say(neighbor, MWWorld::CommonIds::TopicThief);
 
                 crimeSeen = true;
             }
@@ -1267,7 +1270,7 @@ namespace MWMechanics
         const MWWorld::ESMStore& esmStore = *MWBase::Environment::get().getESMStore();
 
         osg::Vec3f from(player.getRefData().getPosition().asVec3());
-        float radius = esmStore.get<ESM::GameSetting>().find("fAlarmRadius")->mValue.getFloat();
+        float radius = esmStore.get<ESM::GameSetting>().find(MWWorld::CommonIds::fAlarmRadius)->mValue.getFloat();
 
         mActors.getObjectsInRange(from, radius, neighbors);
 
@@ -1315,7 +1318,7 @@ namespace MWMechanics
                 reported = true;
 
                 if (type == OT_Trespassing)
-                    MWBase::Environment::get().getDialogueManager()->say(actor, ESM::RefId::stringRefId("intruder"));
+                    MWBase::Environment::get().getDialogueManager()->say(actor, MWWorld::CommonIds::TopicIntruder);
             }
         }
 
@@ -1676,7 +1679,7 @@ namespace MWMechanics
         {
             // We don't care about dialogue filters since the target is invalid.
             // We still want to play the combat taunt.
-            MWBase::Environment::get().getDialogueManager()->say(ptr, ESM::RefId::stringRefId("attack"));
+            MWBase::Environment::get().getDialogueManager()->say(ptr, MWWorld::CommonIds::TopicAttack);
             if (!stats.getAiSequence().isInCombat())
                 stats.resetFriendlyHits();
             return;
@@ -1742,7 +1745,7 @@ namespace MWMechanics
 
         // Must be done after the target is set up, so that CreatureTargetted dialogue filter works properly
         if (shout)
-            MWBase::Environment::get().getDialogueManager()->say(ptr, ESM::RefId::stringRefId("attack"));
+            MWBase::Environment::get().getDialogueManager()->say(ptr, MWWorld::CommonIds::TopicAttack);
     }
 
     void MechanicsManager::stopCombat(const MWWorld::Ptr& actor)
@@ -1976,7 +1979,7 @@ namespace MWMechanics
             const MWWorld::Store<ESM::GameSetting>& gmst
                 = MWBase::Environment::get().getESMStore()->get<ESM::GameSetting>();
             getActorsInRange(
-                actor.getRefData().getPosition().asVec3(), gmst.find("fAlarmRadius")->mValue.getFloat(), neighbors);
+                actor.getRefData().getPosition().asVec3(), gmst.find(MWWorld::CommonIds::fAlarmRadius)->mValue.getFloat(), neighbors);
 
             bool detected = false, reported = false;
             for (const MWWorld::Ptr& neighbor : neighbors)
@@ -1984,7 +1987,8 @@ namespace MWMechanics
                 if (neighbor == actor || !neighbor.getClass().isNpc())
                     continue;
 
-                if (MWBase::Environment::get().getWorld()->getLOS(neighbor, actor) && awarenessCheck(actor, neighbor))
+                // cheap awareness math first, line of sight ray only for candidates that pass
+                if (awarenessCheck(actor, neighbor) && MWBase::Environment::get().getWorld()->getLOS(neighbor, actor))
                 {
                     detected = true;
                     if (neighbor.getClass()
@@ -106,10 +106,12 @@ namespace
         const DetourNavigator::Navigator* mNavigator;
         const DetourNavigator::AgentBounds mAgentBounds;
         const DetourNavigator::Flags mFlags;
+        DetourNavigator::RaycastCache* mRaycastCache;
 
         bool operator()(const osg::Vec3f& start, const osg::Vec3f& end) const
         {
-            const auto position = DetourNavigator::raycast(*mNavigator, mAgentBounds, start, end, mFlags);
+            const auto position
+                = DetourNavigator::raycast(*mNavigator, mAgentBounds, *mRaycastCache, start, end, mFlags);
             return position.has_value()
                 && std::abs((position.value() - start).length2() - (end - start).length2()) <= 1;
         }
@@ -315,7 +317,7 @@ namespace MWMechanics
             mPath.pop_front();
 
         const IsValidShortcut isValidShortcut{ MWBase::Environment::get().getWorld()->getNavigator(), agentBounds,
-            pathFlags };
+            pathFlags, &mRaycastCache };
 
         if ((updateFlags & UpdateFlag_ShortenIfAlmostStraight) != 0)
         {
@@ -434,7 +436,7 @@ namespace MWMechanics
         const auto world = MWBase::Environment::get().getWorld();
         const auto navigator = world->getNavigator();
         const auto status = DetourNavigator::findPath(
-            *navigator, agentBounds, startPoint, endPoint, flags, areaCosts, endTolerance, out);
+            *navigator, agentBounds, mCorridor, startPoint, endPoint, flags, areaCosts, endTolerance, out);
 
         if (pathType == PathType::Partial && status == DetourNavigator::Status::PartialPath)
             return DetourNavigator::Status::Success;
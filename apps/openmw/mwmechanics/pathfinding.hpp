@@ -7,6 +7,8 @@
 
 #include <components/detournavigator/areatype.hpp>
 #include <components/detournavigator/flags.hpp>
+#include <components/detournavigator/pathcorridor.hpp>
+#include <components/detournavigator/raycastcache.hpp>
 #include <components/detournavigator/status.hpp>
 #include <components/esm/position.hpp>
 #include <components/esm3/loadpgrd.hpp>
@@ -98,6 +100,7 @@ namespace MWMechanics
             mConstructed = false;
             mPath.clear();
             mCell = nullptr;
+            mCorridor.clear();
         }
 
         void buildStraightPath(const osg::Vec3f& endPoint);
@@ -204,6 +207,8 @@ namespace MWMechanics
         bool mConstructed = false;
         std::deque<osg::Vec3f> mPath;
         const MWWorld::CellStore* mCell = nullptr;
+        DetourNavigator::PathCorridor mCorridor;
+        DetourNavigator::RaycastCache mRaycastCache;
 
         void buildPathByPathgridImpl(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
             const PathgridGraph& pathgridGraph, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
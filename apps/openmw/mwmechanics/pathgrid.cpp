@@ -1,8 +1,12 @@
 #include "pathgrid.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <list>
+#include <queue>
 #include <set>
+#include <utility>
 
 namespace
 {
@@ -45,6 +49,13 @@ namespace
     }
 
     constexpr size_t NoIndex = static_cast<size_t>(-1);
+
+    constexpr uint16_t NoHop = std::numeric_limits<uint16_t>::max();
+
+    // The routing table is quadratic in the number of pathgrid points, anything
+    // larger than this falls back to a per-request A* search. Vanilla pathgrids
+    // stay well below this limit.
+    constexpr size_t maxRoutingTablePoints = 1024;
 }
 
 namespace MWMechanics
@@ -188,6 +199,62 @@ namespace MWMechanics
             // mGraph[edge.mV1].edges.push_back(neighbour);
         }
         Builder(*this);
+        buildRoutingTable();
+    }
+
+    /*
+     * Precompute the next hop of the shortest path between every pair of points
+     * with one Dijkstra run per source point.
+     *
+     * Dijkstra settles points in the order of increasing distance from the
+     * source, so when a point is settled the next hop towards its parent is
+     * already known and the hop towards the point itself is either the point
+     * (if the source is its parent) or the hop towards its parent.
+     */
+    void PathgridGraph::buildRoutingTable()
+    {
+        const size_t graphSize = mGraph.size();
+        if (graphSize == 0 || graphSize > maxRoutingTablePoints)
+            return;
+
+        mNextHop.resize(graphSize * graphSize, NoHop);
+
+        std::vector<float> dist(graphSize);
+        std::vector<size_t> parent(graphSize);
+        using QueueEntry = std::pair<float, size_t>; // distance from the source, point index
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+        for (size_t start = 0; start < graphSize; ++start)
+        {
+            std::fill(dist.begin(), dist.end(), std::numeric_limits<float>::max());
+            std::fill(parent.begin(), parent.end(), NoIndex);
+            dist[start] = 0;
+            queue.emplace(0, start);
+
+            uint16_t* const row = mNextHop.data() + start * graphSize;
+
+            while (!queue.empty())
+            {
+                const auto [current_dist, current] = queue.top();
+                queue.pop();
+                if (current_dist > dist[current])
+                    continue; // stale entry, the point was already settled
+
+                if (current != start)
+                    row[current] = parent[current] == start ? static_cast<uint16_t>(current) : row[parent[current]];
+
+                for (const auto& edge : mGraph[current].edges)
+                {
+                    const float tentative = dist[current] + edge.cost;
+                    if (tentative < dist[edge.index])
+                    {
+                        dist[edge.index] = tentative;
+                        parent[edge.index] = current;
+                        queue.emplace(tentative, edge.index);
+                    }
+                }
+            }
+        }
     }
 
     const PathgridGraph PathgridGraph::sEmpty = {};
@@ -241,6 +308,23 @@ namespace MWMechanics
             return path; // there is no path, return an empty path
         }
 
+        if (!mNextHop.empty())
+        {
+            // follow the precomputed next hops, no search needed
+            const size_t tableSize = mGraph.size();
+            size_t current = start;
+            path.push_back(mPathgrid->mPoints[current]);
+            while (current != goal)
+            {
+                const uint16_t next = mNextHop[current * tableSize + goal];
+                if (next == NoHop)
+                    return {}; // for some reason couldn't build a path
+                current = next;
+                path.push_back(mPathgrid->mPoints[current]);
+            }
+            return path;
+        }
+
         size_t graphSize = mGraph.size();
         std::vector<float> gScore(graphSize, -1);
         std::vector<float> fScore(graphSize, -1);
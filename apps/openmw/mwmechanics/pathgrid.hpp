@@ -1,7 +1,9 @@
 #ifndef GAME_MWMECHANICS_PATHGRID_H
 #define GAME_MWMECHANICS_PATHGRID_H
 
+#include <cstdint>
 #include <deque>
+#include <vector>
 
 #include <components/esm3/loadpgrd.hpp>
 
@@ -30,6 +32,9 @@ namespace MWMechanics
         // the output list is in local (internal cells) or world (external
         // cells) coordinates
         //
+        // Answered from the precomputed routing table when available, falling
+        // back to an A* search for oversized pathgrids.
+        //
         // NOTE: if start equals end an empty path is returned
         std::deque<ESM::Pathgrid::Point> aStarSearch(const size_t start, const size_t end) const;
 
@@ -62,6 +67,14 @@ namespace MWMechanics
         //   all other pathgrid points are the third set
         //
         std::vector<Node> mGraph;
+
+        // All-pairs next-hop routing table, row-major: mNextHop[from * n + to] is the
+        // point index of the next step on the shortest path from "from" to "to", or
+        // no value for unreachable pairs. Pathgrids are small and static so the table
+        // is built once per cell load; it is left empty for oversized pathgrids.
+        std::vector<uint16_t> mNextHop;
+
+        void buildRoutingTable();
     };
 }
 
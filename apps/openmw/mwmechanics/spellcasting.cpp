@@ -15,6 +15,7 @@
 #include "../mwbase/world.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/containerstore.hpp"
 #include "../mwworld/esmstore.hpp"
 
@@ -66,7 +67,7 @@ namespace MWMechanics
             if (!effect->mArea.empty())
                 areaStatic = world->getStore().get<ESM::Static>().find(effect->mArea);
             else
-                areaStatic = world->getStore().get<ESM::Static>().find(ESM::RefId::stringRefId("VFX_DefaultArea"));
+                areaStatic = world->getStore().get<ESM::Static>().find(MWWorld::CommonIds::VFX_DefaultArea);
 
             const std::string& texture = effect->mParticle;
 
@@ -499,7 +500,7 @@ namespace MWMechanics
             if (!effect->mCasting.empty())
                 castStatic = store.get<ESM::Static>().find(effect->mCasting);
             else
-                castStatic = store.get<ESM::Static>().find(ESM::RefId::stringRefId("VFX_DefaultCast"));
+                castStatic = store.get<ESM::Static>().find(MWWorld::CommonIds::VFX_DefaultCast);
 
             // check if the effect was already added
             if (std::find(addedEffects.begin(), addedEffects.end(),
@@ -576,7 +577,7 @@ namespace MWMechanics
         if (!magicEffect.mHit.empty())
             castStatic = store->get<ESM::Static>().find(magicEffect.mHit);
         else
-            castStatic = store->get<ESM::Static>().find(ESM::RefId::stringRefId("VFX_DefaultHit"));
+            castStatic = store->get<ESM::Static>().find(MWWorld::CommonIds::VFX_DefaultHit);
 
         bool loop = (magicEffect.mData.mFlags & ESM::MagicEffect::ContinuousVfx) != 0;
         MWRender::Animation* anim = MWBase::Environment::get().getWorld()->getAnimation(target);
@@ -30,6 +30,7 @@
 #include "../mwworld/actionteleport.hpp"
 #include "../mwworld/cellstore.hpp"
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/inventorystore.hpp"
 #include "../mwworld/player.hpp"
@@ -283,7 +284,7 @@ namespace
         const MWWorld::Ptr& target)
     {
         const auto& esmStore = *MWBase::Environment::get().getESMStore();
-        const ESM::Static* absorbStatic = esmStore.get<ESM::Static>().find(ESM::RefId::stringRefId("VFX_Absorb"));
+        const ESM::Static* absorbStatic = esmStore.get<ESM::Static>().find(MWWorld::CommonIds::VFX_Absorb);
         MWRender::Animation* animation = MWBase::Environment::get().getWorld()->getAnimation(target);
         if (animation && !absorbStatic->mModel.empty())
             animation->addEffect(Misc::ResourceHelpers::correctMeshPath(absorbStatic->mModel),
@@ -454,7 +455,7 @@ namespace MWMechanics
                         MWRender::Animation* anim = world->getAnimation(caster);
                         anim->removeEffect(ESM::MagicEffect::indexToName(effect.mEffectId));
                         const ESM::Static* fx
-                            = world->getStore().get<ESM::Static>().search(ESM::RefId::stringRefId("VFX_Summon_end"));
+                            = world->getStore().get<ESM::Static>().search(MWWorld::CommonIds::VFX_SummonEnd);
                         if (fx)
                             anim->addEffect(Misc::ResourceHelpers::correctMeshPath(fx->mModel), "");
                     }
@@ -563,7 +564,7 @@ namespace MWMechanics
                         (magnitudes.getOrDefault(effect.mEffectId).getModifier() + effect.mMagnitude) / 100.f, 0.f,
                         1.f);
                     MWBase::Environment::get().getSoundManager()->playSound3D(target,
-                        ESM::RefId::stringRefId("magic sound"), volume, 1.f, MWSound::Type::Sfx,
+                        MWWorld::CommonIds::MagicSound, volume, 1.f, MWSound::Type::Sfx,
                         MWSound::PlayMode::LoopNoEnv);
                 }
                 break;
@@ -1118,7 +1119,7 @@ namespace MWMechanics
             case ESM::MagicEffect::Sound:
                 if (magnitudes.getOrDefault(effect.mEffectId).getModifier() <= 0.f && target == getPlayer())
                     MWBase::Environment::get().getSoundManager()->stopSound3D(
-                        target, ESM::RefId::stringRefId("magic sound"));
+                        target, MWWorld::CommonIds::MagicSound);
                 break;
             case ESM::MagicEffect::SummonScamp:
             case ESM::MagicEffect::SummonClannfear:
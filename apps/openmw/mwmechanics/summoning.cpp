@@ -11,6 +11,7 @@
 #include "../mwbase/world.hpp"
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/manualref.hpp"
 
@@ -103,7 +104,7 @@ namespace MWMechanics
                 if (anim)
                 {
                     const ESM::Static* fx
-                        = world->getStore().get<ESM::Static>().search(ESM::RefId::stringRefId("VFX_Summon_Start"));
+                        = world->getStore().get<ESM::Static>().search(MWWorld::CommonIds::VFX_SummonStart);
                     if (fx)
                         anim->addEffect(Misc::ResourceHelpers::correctMeshPath(fx->mModel), "", false);
                 }
@@ -241,6 +241,8 @@ namespace MWPhysics
     void Actor::updateScale()
     {
         std::scoped_lock lock(mPositionMutex);
+        // the collision shape changes, so the cached ground contact no longer applies
+        mGroundContact.mValid = false;
         updateScaleUnsafe();
     }
 
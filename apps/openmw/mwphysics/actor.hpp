@@ -1,6 +1,7 @@
 #ifndef OPENMW_MWPHYSICS_ACTOR_H
 #define OPENMW_MWPHYSICS_ACTOR_H
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
 
@@ -11,6 +12,7 @@
 #include <osg/Quat>
 #include <osg/Vec3f>
 
+class btCollisionObject;
 class btCollisionShape;
 class btCollisionWorld;
 class btConvexShape;
@@ -24,6 +26,18 @@ namespace MWPhysics
 {
     class PhysicsTaskScheduler;
 
+    /// Ground contact resolved by a previous simulation step, kept so the movement solver can
+    /// skip the ground sweep for an idle actor as long as neither the actor nor the world
+    /// geometry around it changed. See MovementSolver::move.
+    struct GroundContact
+    {
+        std::size_t mWorldGeometryStamp = 0;
+        osg::Vec3f mPosition;
+        const btCollisionObject* mStandingOn = nullptr;
+        bool mWalkingOnWater = false;
+        bool mValid = false;
+    };
+
     class Actor final : public PtrHolder
     {
     public:
@@ -140,6 +154,9 @@ namespace MWPhysics
         const osg::Vec3f& getLastStuckPosition() const { return mLastStuckPosition; }
         void setLastStuckPosition(osg::Vec3f position) { mLastStuckPosition = position; }
 
+        const GroundContact& getGroundContact() const { return mGroundContact; }
+        void setGroundContact(const GroundContact& contact) { mGroundContact = contact; }
+
         bool canMoveToWaterSurface(float waterlevel, const btCollisionWorld* world) const;
 
         bool isActive() const { return mActive; }
@@ -183,6 +200,7 @@ namespace MWPhysics
         osg::Vec3f mLastStuckPosition;
 
         osg::Vec3f mForce;
+        GroundContact mGroundContact;
         bool mOnGround;
         bool mOnSlope;
         bool mInternalCollisionMode;
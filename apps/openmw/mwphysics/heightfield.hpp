@@ -34,6 +34,8 @@ namespace MWPhysics
     private:
         std::unique_ptr<btHeightfieldTerrainShape> mShape;
         std::unique_ptr<btCollisionObject> mCollisionObject;
+        // mShape references the caller's height data (normally the land object also used by the
+        // terrain storage) instead of copying it; mHoldObject keeps that data alive.
         osg::ref_ptr<const osg::Object> mHoldObject;
 #if BT_BULLET_VERSION < 310
         std::vector<btScalar> mHeights;
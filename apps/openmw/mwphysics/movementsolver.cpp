@@ -139,6 +139,22 @@ namespace MWPhysics
             return;
         }
 
+        // An idle actor keeps the ground contact resolved by a previous step: no movement was
+        // requested, no inertia acts on it and nothing changed in the world geometry around it
+        // (same stamp, checked when the frame data was built), so re-running the sweeps below
+        // would find the same supporting surface. This makes actors standing around - the
+        // majority of any populated cell - nearly free.
+        if (actor.mGroundContactCached && !actor.mFlying && actor.mMovement == osg::Vec3f()
+            && actor.mInertia == osg::Vec3f() && actor.mPosition == actor.mCachedGroundPosition
+            && actor.mPosition.z() >= actor.mSwimLevel)
+        {
+            actor.mIsOnGround = true;
+            actor.mIsOnSlope = false;
+            actor.mStandingOn = actor.mCachedStandingOn;
+            actor.mWalkingOnWater = actor.mCachedWalkingOnWater;
+            return;
+        }
+
         // Adjust for collision mesh offset relative to actor's "location"
         // (doTrace doesn't take local/interior collision shape translation into account, so we have to do it on our
         // own) for compatibility with vanilla assets, we have to derive this from the vertical half extent instead of
@@ -189,7 +205,18 @@ namespace MWPhysics
             velocity *= 1.f - (fStromWalkMult * (angleDegrees / 180.f));
         }
 
-        Stepper stepper(collisionWorld, actor.mCollisionObject);
+        // All sweeps this step happen within a conservative envelope around the starting position:
+        // the movement itself, the stair stepping (whose fixed-distance attempts can move up to
+        // sMinStep2 horizontally and which can step down up to sStepSizeDown per iteration), the
+        // final ground test and the collision margin nudges. Query the broadphase once for that
+        // envelope so the individual sweeps can be run against the overlaps directly.
+        const float sweepDistance = velocity.length() * time + sMinStep2 + 4 * sCollisionMargin;
+        SweepCandidates sweepCandidates;
+        sweepCandidates.gather(actor.mCollisionObject,
+            osg::Vec3f(sweepDistance, sweepDistance, sweepDistance + sMaxIterations * sStepSizeDown + 2 * sGroundOffset),
+            osg::Vec3f(sweepDistance, sweepDistance, sweepDistance + Constants::sStepSizeUp), collisionWorld);
+
+        Stepper stepper(collisionWorld, actor.mCollisionObject, &sweepCandidates);
         osg::Vec3f origVelocity = velocity;
         osg::Vec3f newPosition = actor.mPosition;
         /*
@@ -221,7 +248,8 @@ namespace MWPhysics
             if ((newPosition - nextpos).length2() > 0.0001)
             {
                 // trace to where character would go if there were no obstructions
-                tracer.doTrace(actor.mCollisionObject, newPosition, nextpos, collisionWorld, actor.mIsOnGround);
+                tracer.doTrace(actor.mCollisionObject, newPosition, nextpos, collisionWorld, actor.mIsOnGround,
+                    &sweepCandidates);
 
                 // check for obstructions
                 if (tracer.mFraction >= 1.0f)
@@ -332,7 +360,8 @@ namespace MWPhysics
                             auto averageNormal = bestNormal + origPlaneNormal;
                             averageNormal.normalize();
                             tracer.doTrace(actor.mCollisionObject, newPosition,
-                                newPosition + averageNormal * (sCollisionMargin * 2.0), collisionWorld);
+                                newPosition + averageNormal * (sCollisionMargin * 2.0), collisionWorld, false,
+                                &sweepCandidates);
                             newPosition = (newPosition + tracer.mEndPos) / 2.0;
 
                             usedSeamLogic = true;
@@ -348,7 +377,7 @@ namespace MWPhysics
                 if (!usedSeamLogic)
                 {
                     tracer.doTrace(actor.mCollisionObject, newPosition,
-                        newPosition + planeNormal * (sCollisionMargin * 2.0), collisionWorld);
+                        newPosition + planeNormal * (sCollisionMargin * 2.0), collisionWorld, false, &sweepCandidates);
                     newPosition = (newPosition + tracer.mEndPos) / 2.0;
                 }
 
@@ -387,7 +416,7 @@ namespace MWPhysics
             osg::Vec3f from = newPosition;
             auto dropDistance = 2 * sGroundOffset + (actor.mIsOnGround ? sStepSizeDown : 0);
             osg::Vec3f to = newPosition - osg::Vec3f(0, 0, dropDistance);
-            tracer.doTrace(actor.mCollisionObject, from, to, collisionWorld, actor.mIsOnGround);
+            tracer.doTrace(actor.mCollisionObject, from, to, collisionWorld, actor.mIsOnGround, &sweepCandidates);
             if (tracer.mFraction < 1.0f)
             {
                 if (!isActor(tracer.mHitObject))
@@ -406,7 +435,8 @@ namespace MWPhysics
                         {
                             newPosition.z() = tracer.mEndPos.z();
                             tracer.doTrace(actor.mCollisionObject, newPosition,
-                                newPosition + osg::Vec3f(0, 0, 2 * sGroundOffset), collisionWorld);
+                                newPosition + osg::Vec3f(0, 0, 2 * sGroundOffset), collisionWorld, false,
+                                &sweepCandidates);
                             newPosition = (newPosition + tracer.mEndPos) / 2.0;
                         }
                     }
@@ -449,6 +479,14 @@ namespace MWPhysics
         actor.mPosition = newPosition;
         // remove what was added earlier in compensating for doTrace not taking interior transformation into account
         actor.mPosition.z() -= actor.mHalfExtentsZ; // vanilla-accurate
+
+        // Remember the resolved ground contact for the early-out above. Contacts with other
+        // actors are never cached since actors move without bumping the world geometry stamp.
+        actor.mGroundContactCached
+            = isOnGround && !isOnSlope && actor.mStandingOn != nullptr && !isActor(actor.mStandingOn);
+        actor.mCachedGroundPosition = actor.mPosition;
+        actor.mCachedStandingOn = actor.mStandingOn;
+        actor.mCachedWalkingOnWater = actor.mWalkingOnWater;
     }
 
     void MovementSolver::move(ProjectileFrameData& projectile, float time, const btCollisionWorld* collisionWorld)
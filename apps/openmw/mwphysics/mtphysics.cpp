@@ -15,6 +15,7 @@
 #include <osg/Stats>
 
 #include "components/debug/debuglog.hpp"
+#include "components/debug/trace.hpp"
 #include "components/misc/convert.hpp"
 #include <components/misc/barrier.hpp>
 #include <components/settings/values.hpp>
@@ -30,6 +31,7 @@
 #include "../mwbase/world.hpp"
 
 #include "actor.hpp"
+#include "closestnotmerayresultcallback.hpp"
 #include "contacttestwrapper.h"
 #include "movementsolver.hpp"
 #include "object.hpp"
@@ -290,6 +292,10 @@ namespace
                     actor->setOnSlope(frameData.mIsOnSlope);
                     actor->setWalkingOnWater(frameData.mWalkingOnWater);
                     actor->setInertialForce(frameData.mInertia);
+                    actor->setGroundContact(
+                        MWPhysics::GroundContact{ frameData.mWorldGeometryStamp, frameData.mCachedGroundPosition,
+                            frameData.mCachedStandingOn, frameData.mCachedWalkingOnWater,
+                            frameData.mGroundContactCached });
                 }
             }
             void operator()(MWPhysics::ProjectileSimulation& sim) const
@@ -414,6 +420,8 @@ namespace MWPhysics
         , mAdvanceSimulation(false)
         , mNextJob(0)
         , mNextLOS(0)
+        , mNextRayCast(0)
+        , mWorldGeometryStamp(0)
         , mFrameNumber(0)
         , mTimer(osg::Timer::instance())
         , mPrevStepCount(1)
@@ -535,6 +543,9 @@ namespace MWPhysics
             updateStats(frameStart, frameNumber, stats);
         }
 
+        // deliver the ray casts resolved during the previous run and queue up the next batch
+        prepareAsyncRayCasts();
+
         auto [numSteps, newDelta] = calculateStepConfig(timeAccum);
         timeAccum -= numSteps * newDelta;
 
@@ -653,6 +664,8 @@ namespace MWPhysics
     void PhysicsTaskScheduler::addCollisionObject(
         btCollisionObject* collisionObject, int collisionFilterGroup, int collisionFilterMask)
     {
+        if ((collisionFilterGroup & (CollisionType_Actor | CollisionType_Projectile)) == 0)
+            mWorldGeometryStamp.fetch_add(1, std::memory_order_relaxed);
         MaybeExclusiveLock lock(mCollisionWorldMutex, mLockingPolicy);
         mCollisionObjects.insert(collisionObject);
         mCollisionWorld->addCollisionObject(collisionObject, collisionFilterGroup, collisionFilterMask);
@@ -660,6 +673,9 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::removeCollisionObject(btCollisionObject* collisionObject)
     {
+        const btBroadphaseProxy* proxy = collisionObject->getBroadphaseHandle();
+        if (proxy != nullptr && (proxy->m_collisionFilterGroup & (CollisionType_Actor | CollisionType_Projectile)) == 0)
+            mWorldGeometryStamp.fetch_add(1, std::memory_order_relaxed);
         MaybeExclusiveLock lock(mCollisionWorldMutex, mLockingPolicy);
         mCollisionObjects.erase(collisionObject);
         mCollisionWorld->removeCollisionObject(collisionObject);
@@ -667,6 +683,10 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::updateSingleAabb(const std::shared_ptr<PtrHolder>& ptr, bool immediate)
     {
+        // actors and projectiles move every frame and are handled separately by the movement
+        // solver; only non-actor geometry invalidates cached ground contacts
+        if (std::dynamic_pointer_cast<Object>(ptr) != nullptr)
+            mWorldGeometryStamp.fetch_add(1, std::memory_order_relaxed);
         if (immediate || mNumThreads == 0)
         {
             updatePtrAabb(ptr);
@@ -695,6 +715,69 @@ namespace MWPhysics
         return result->mResult;
     }
 
+    void PhysicsTaskScheduler::asyncRayTest(const btVector3& from, const btVector3& to, int mask, int group,
+        std::vector<const btCollisionObject*> ignore, std::function<void(const RayCastingResult&)> callback)
+    {
+        MaybeExclusiveLock lock(mPendingRayCastsMutex, mLockingPolicy);
+        mPendingRayCasts.push_back(
+            AsyncRayCastRequest{ from, to, mask, group, std::move(ignore), std::move(callback) });
+    }
+
+    void PhysicsTaskScheduler::prepareAsyncRayCasts()
+    {
+        // This function runs on the main thread while the workers are idle, so
+        // mProcessingRayCasts can be accessed without a lock.
+        std::vector<AsyncRayCastRequest> finished;
+        {
+            MaybeExclusiveLock lock(mPendingRayCastsMutex, mLockingPolicy);
+            finished = std::move(mProcessingRayCasts);
+            mProcessingRayCasts = std::move(mPendingRayCasts);
+            mPendingRayCasts.clear();
+        }
+        mNextRayCast.store(0, std::memory_order_relaxed);
+
+        // Invoke the callbacks without holding any lock, they are free to issue new queries.
+        for (const AsyncRayCastRequest& request : finished)
+        {
+            RayCastingResult result;
+            result.mHit = request.mHit;
+            if (request.mHit)
+            {
+                result.mHitPos = Misc::Convert::toOsg(request.mHitPos);
+                result.mHitNormal = Misc::Convert::toOsg(request.mHitNormal);
+                if (auto* ptrHolder = static_cast<PtrHolder*>(getUserPointer(request.mHitObject)))
+                    result.mHitObject = ptrHolder->getPtr();
+            }
+            request.mCallback(result);
+        }
+    }
+
+    void PhysicsTaskScheduler::resolveAsyncRayCasts()
+    {
+        int job = 0;
+        const int numRequests = static_cast<int>(mProcessingRayCasts.size());
+        while ((job = mNextRayCast.fetch_add(1, std::memory_order_relaxed)) < numRequests)
+        {
+            AsyncRayCastRequest& request = mProcessingRayCasts[job];
+            if (request.mFrom == request.mTo)
+                continue;
+            ClosestNotMeRayResultCallback callback(request.mIgnore, {}, request.mFrom, request.mTo);
+            callback.m_collisionFilterGroup = request.mGroup;
+            callback.m_collisionFilterMask = request.mMask;
+            {
+                MaybeLock lock(mCollisionWorldMutex, mLockingPolicy);
+                mCollisionWorld->rayTest(request.mFrom, request.mTo, callback);
+            }
+            request.mHit = callback.hasHit();
+            if (request.mHit)
+            {
+                request.mHitPos = callback.m_hitPointWorld;
+                request.mHitNormal = callback.m_hitNormalWorld;
+                request.mHitObject = callback.m_collisionObject;
+            }
+        }
+    }
+
     void PhysicsTaskScheduler::refreshLOSCache()
     {
         MaybeSharedLock lock(mLOSCacheMutex, mLockingPolicy);
@@ -782,18 +865,26 @@ namespace MWPhysics
     {
         while (mRemainingSteps)
         {
+            const Debug::TraceZone zone("PhysicsStep");
             mPreStepBarrier->wait([this] { afterPreStep(); });
             int job = 0;
             const Visitors::Move impl{ mPhysicsDt, mCollisionWorld, *mWorldFrameData };
             const Visitors::WithLockedPtr<Visitors::Move, MaybeLock> vis{ impl, mCollisionWorldMutex, mLockingPolicy };
+            // Workers claim one simulation at a time from a shared counter, so load balances
+            // dynamically: a worker stuck on an expensive actor simply claims fewer jobs while
+            // the others drain the rest of the queue.
             while ((job = mNextJob.fetch_add(1, std::memory_order_relaxed)) < mNumJobs)
                 std::visit(vis, (*mSimulations)[job]);
 
             mPostStepBarrier->wait([this] { afterPostStep(); });
         }
 
-        refreshLOSCache();
-        mPostSimBarrier->wait([this] { afterPostSim(); });
+        {
+            const Debug::TraceZone zone("PhysicsPostSim");
+            refreshLOSCache();
+            resolveAsyncRayCasts();
+            mPostSimBarrier->wait([this] { afterPostSim(); });
+        }
     }
 
     void PhysicsTaskScheduler::updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
@@ -828,13 +919,16 @@ namespace MWPhysics
     void PhysicsTaskScheduler::releaseSharedStates()
     {
         waitForWorkers();
-        std::scoped_lock lock(mSimulationMutex, mUpdateAabbMutex);
+        std::scoped_lock lock(mSimulationMutex, mUpdateAabbMutex, mPendingRayCastsMutex);
         if (mSimulations != nullptr)
         {
             mSimulations->clear();
             mSimulations = nullptr;
         }
         mUpdateAabb.clear();
+        // unresolved ray casts are dropped, their callbacks may hold references we can't keep
+        mPendingRayCasts.clear();
+        mProcessingRayCasts.clear();
     }
 
     void PhysicsTaskScheduler::afterPreStep()
@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <set>
@@ -67,6 +68,14 @@ namespace MWPhysics
         void removeCollisionObject(btCollisionObject* collisionObject);
         void updateSingleAabb(const std::shared_ptr<PtrHolder>& ptr, bool immediate = false);
         bool getLineOfSight(const std::shared_ptr<Actor>& actor1, const std::shared_ptr<Actor>& actor2);
+        /// Queue a ray test to be resolved on the physics threads alongside the next simulation.
+        /// The callback is invoked on the main thread once the results have been synchronized,
+        /// normally during the next frame's physics update.
+        void asyncRayTest(const btVector3& from, const btVector3& to, int mask, int group,
+            std::vector<const btCollisionObject*> ignore, std::function<void(const RayCastingResult&)> callback);
+        /// Monotonic counter bumped whenever a non-actor collision object is added, removed or
+        /// moved. Lets callers detect that the world geometry around a position is unchanged.
+        std::size_t getWorldGeometryStamp() const { return mWorldGeometryStamp.load(std::memory_order_relaxed); }
         void debugDraw();
         void* getUserPointer(const btCollisionObject* object) const;
         void releaseSharedStates(); // destroy all objects whose destructor can't be safely called from
@@ -75,11 +84,28 @@ namespace MWPhysics
     private:
         class WorkersSync;
 
+        struct AsyncRayCastRequest
+        {
+            btVector3 mFrom;
+            btVector3 mTo;
+            int mMask;
+            int mGroup;
+            std::vector<const btCollisionObject*> mIgnore;
+            std::function<void(const RayCastingResult&)> mCallback;
+            // filled in by the workers
+            bool mHit = false;
+            btVector3 mHitPos;
+            btVector3 mHitNormal;
+            const btCollisionObject* mHitObject = nullptr;
+        };
+
         void doSimulation();
         void worker();
         void updateActorsPositions();
         bool hasLineOfSight(const Actor* actor1, const Actor* actor2);
         void refreshLOSCache();
+        void prepareAsyncRayCasts();
+        void resolveAsyncRayCasts();
         void updateAabbs();
         void updatePtrAabb(const std::shared_ptr<PtrHolder>& ptr);
         void updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats);
@@ -101,6 +127,10 @@ namespace MWPhysics
         btCollisionWorld* mCollisionWorld;
         MWRender::DebugDrawer* mDebugDrawer;
         std::vector<LOSRequest> mLOSCache;
+        // ray casts queued by the main thread, picked up for the next background run
+        std::vector<AsyncRayCastRequest> mPendingRayCasts;
+        // ray casts being resolved by the workers; only the main thread touches this between runs
+        std::vector<AsyncRayCastRequest> mProcessingRayCasts;
         std::set<std::weak_ptr<PtrHolder>, std::owner_less<std::weak_ptr<PtrHolder>>> mUpdateAabb;
 
         // TODO: use std::experimental::flex_barrier or std::barrier once it becomes a thing
@@ -116,12 +146,15 @@ namespace MWPhysics
         bool mAdvanceSimulation;
         std::atomic<int> mNextJob;
         std::atomic<int> mNextLOS;
+        std::atomic<int> mNextRayCast;
+        std::atomic<std::size_t> mWorldGeometryStamp;
         std::vector<std::thread> mThreads;
 
         mutable std::shared_mutex mSimulationMutex;
         mutable std::shared_mutex mCollisionWorldMutex;
         mutable std::shared_mutex mLOSCacheMutex;
         mutable std::mutex mUpdateAabbMutex;
+        mutable std::mutex mPendingRayCastsMutex;
 
         unsigned int mFrameNumber;
         const osg::Timer* mTimer;
@@ -70,6 +70,10 @@ namespace MWPhysics
         if (mScaleUpdatePending)
         {
             mShapeInstance->setLocalScaling(mScale);
+            // The compound's local scaling factors into the animated child transforms, so they all
+            // need to be synchronized again even if their nodes didn't move.
+            for (auto& [recIndex, node] : mAnimatedNodes)
+                node.mWorldMatrixValid = false;
             mScaleUpdatePending = false;
         }
         if (mTransformUpdatePending)
@@ -120,8 +124,8 @@ namespace MWPhysics
         bool result = false;
         for (const auto& [recIndex, shapeIndex] : mShapeInstance->mAnimatedShapes)
         {
-            auto nodePathFound = mRecIndexToNodePath.find(recIndex);
-            if (nodePathFound == mRecIndexToNodePath.end())
+            auto nodeFound = mAnimatedNodes.find(recIndex);
+            if (nodeFound == mAnimatedNodes.end())
             {
                 NifOsg::FindGroupByRecIndex visitor(recIndex);
                 mPtr.getRefData().getBaseNode()->accept(visitor);
@@ -136,11 +140,19 @@ namespace MWPhysics
                 }
                 osg::NodePath nodePath = visitor.mFoundPath;
                 nodePath.erase(nodePath.begin());
-                nodePathFound = mRecIndexToNodePath.emplace(recIndex, nodePath).first;
+                nodeFound = mAnimatedNodes.emplace(recIndex, AnimatedNode{ std::move(nodePath), {}, false }).first;
             }
 
-            osg::NodePath& nodePath = nodePathFound->second;
-            osg::Matrixf matrix = osg::computeLocalToWorld(nodePath);
+            AnimatedNode& node = nodeFound->second;
+            osg::Matrixf matrix = osg::computeLocalToWorld(node.mNodePath);
+            // Animation controllers write the node transforms every frame whether or not the
+            // animation advanced, so compare against the last synchronized matrix to skip the
+            // decomposition and shape update for nodes that did not actually move.
+            if (node.mWorldMatrixValid && matrix == node.mWorldMatrix)
+                continue;
+            node.mWorldMatrix = matrix;
+            node.mWorldMatrixValid = true;
+
             btVector3 scale = Misc::Convert::toBullet(matrix.getScale());
             matrix.orthoNormalize(matrix);
 
@@ -51,8 +51,17 @@ namespace MWPhysics
         void resetCollisions();
 
     private:
+        struct AnimatedNode
+        {
+            osg::NodePath mNodePath;
+            // Last world matrix the collision shape was synchronized to, so unchanged nodes can be
+            // skipped without decomposing their transform again.
+            osg::Matrixf mWorldMatrix;
+            bool mWorldMatrixValid = false;
+        };
+
         osg::ref_ptr<Resource::BulletShapeInstance> mShapeInstance;
-        std::map<int, osg::NodePath> mRecIndexToNodePath;
+        std::map<int, AnimatedNode> mAnimatedNodes;
         bool mSolid;
         btVector3 mScale;
         osg::Vec3f mPosition;
@@ -251,6 +251,31 @@ namespace MWPhysics
         return result;
     }
 
+    void PhysicsSystem::asyncCastRay(std::function<void(const RayCastingResult&)> callback, const osg::Vec3f& from,
+        const osg::Vec3f& to, const std::vector<MWWorld::ConstPtr>& ignore, int mask, int group) const
+    {
+        std::vector<const btCollisionObject*> ignoreList;
+
+        for (const auto& ptr : ignore)
+        {
+            if (!ptr.isEmpty())
+            {
+                const Actor* actor = getActor(ptr);
+                if (actor)
+                    ignoreList.push_back(actor->getCollisionObject());
+                else
+                {
+                    const Object* object = getObject(ptr);
+                    if (object)
+                        ignoreList.push_back(object->getCollisionObject());
+                }
+            }
+        }
+
+        mTaskScheduler->asyncRayTest(Misc::Convert::toBullet(from), Misc::Convert::toBullet(to), mask, group,
+            std::move(ignoreList), std::move(callback));
+    }
+
     RayCastingResult PhysicsSystem::castSphere(
         const osg::Vec3f& from, const osg::Vec3f& to, float radius, int mask, int group) const
     {
@@ -681,8 +706,9 @@ namespace MWPhysics
             const bool inert = stats.isDead()
                 || (!godmode && stats.getMagicEffects().getOrDefault(ESM::MagicEffect::Paralyze).getModifier() > 0);
 
-            simulations.emplace_back(ActorSimulation{
-                physicActor, ActorFrameData{ *physicActor, inert, waterCollision, slowFall, waterlevel, isPlayer } });
+            simulations.emplace_back(ActorSimulation{ physicActor,
+                ActorFrameData{ *physicActor, inert, waterCollision, slowFall, waterlevel, isPlayer,
+                    mTaskScheduler->getWorldGeometryStamp() } });
 
             // if the simulation will run, a jump request will be fulfilled. Update mechanics accordingly.
             if (willSimulate)
@@ -898,8 +924,8 @@ namespace MWPhysics
             mDebugDrawer->addCollision(position, normal);
     }
 
-    ActorFrameData::ActorFrameData(
-        Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel, bool isPlayer)
+    ActorFrameData::ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel,
+        bool isPlayer, std::size_t worldGeometryStamp)
         : mPosition()
         , mStandingOn(nullptr)
         , mIsOnGround(actor.getOnGround())
@@ -927,6 +953,12 @@ namespace MWPhysics
         , mWaterCollision(waterCollision)
         , mSkipCollisionDetection(!actor.getCollisionMode())
         , mIsPlayer(isPlayer)
+        , mWorldGeometryStamp(worldGeometryStamp)
+        , mCachedGroundPosition(actor.getGroundContact().mPosition)
+        , mCachedStandingOn(actor.getGroundContact().mStandingOn)
+        , mCachedWalkingOnWater(actor.getGroundContact().mWalkingOnWater)
+        , mGroundContactCached(
+              actor.getGroundContact().mValid && actor.getGroundContact().mWorldGeometryStamp == worldGeometryStamp)
     {
     }
 
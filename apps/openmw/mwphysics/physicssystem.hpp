@@ -78,7 +78,8 @@ namespace MWPhysics
 
     struct ActorFrameData
     {
-        ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel, bool isPlayer);
+        ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel, bool isPlayer,
+            std::size_t worldGeometryStamp);
         osg::Vec3f mPosition;
         osg::Vec3f mInertia;
         const btCollisionObject* mStandingOn;
@@ -102,6 +103,13 @@ namespace MWPhysics
         const bool mWaterCollision;
         const bool mSkipCollisionDetection;
         const bool mIsPlayer;
+        // ground contact cached from the previous frame; reusable while the actor stands still
+        // and the world geometry stamp is unchanged (see MovementSolver::move)
+        const std::size_t mWorldGeometryStamp;
+        osg::Vec3f mCachedGroundPosition;
+        const btCollisionObject* mCachedStandingOn;
+        bool mCachedWalkingOnWater;
+        bool mGroundContactCached;
     };
 
     struct ProjectileFrameData
@@ -217,6 +225,10 @@ namespace MWPhysics
         RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius,
             int mask = CollisionType_Default, int group = 0xff) const override;
 
+        void asyncCastRay(std::function<void(const RayCastingResult&)> callback, const osg::Vec3f& from,
+            const osg::Vec3f& to, const std::vector<MWWorld::ConstPtr>& ignore = {}, int mask = CollisionType_Default,
+            int group = 0xff) const override;
+
         /// Return true if actor1 can see actor2.
         bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const override;
 
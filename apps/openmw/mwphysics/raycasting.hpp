@@ -1,6 +1,8 @@
 #ifndef OPENMW_MWPHYSICS_RAYCASTING_H
 #define OPENMW_MWPHYSICS_RAYCASTING_H
 
+#include <functional>
+
 #include <osg/Vec3f>
 
 #include "../mwworld/ptr.hpp"
@@ -37,6 +39,14 @@ namespace MWPhysics
         virtual RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius,
             int mask = CollisionType_Default, int group = 0xff) const = 0;
 
+        /// Queue a ray cast for asynchronous resolution on the physics threads. The callback is
+        /// invoked on the main thread when the result is available, normally during the next
+        /// frame's physics update.
+        /// @param ignore Optional, a list of Ptr to ignore in the list of results.
+        virtual void asyncCastRay(std::function<void(const RayCastingResult&)> callback, const osg::Vec3f& from,
+            const osg::Vec3f& to, const std::vector<MWWorld::ConstPtr>& ignore = {}, int mask = CollisionType_Default,
+            int group = 0xff) const = 0;
+
         /// Return true if actor1 can see actor2.
         virtual bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const = 0;
     };
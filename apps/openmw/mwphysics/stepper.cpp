@@ -22,9 +22,11 @@ namespace MWPhysics
         return stepper.mHitObject->getBroadphaseHandle()->m_collisionFilterGroup != CollisionType_Actor;
     }
 
-    Stepper::Stepper(const btCollisionWorld* colWorld, const btCollisionObject* colObj)
+    Stepper::Stepper(const btCollisionWorld* colWorld, const btCollisionObject* colObj,
+        const SweepCandidates* candidates)
         : mColWorld(colWorld)
         , mColObj(colObj)
+        , mCandidates(candidates)
     {
     }
 
@@ -38,8 +40,8 @@ namespace MWPhysics
         // ground. This algorithm has a couple of minor problems, but they don't cause problems for sane geometry, and
         // just prevent stepping on insane geometry.
 
-        mUpStepper.doTrace(
-            mColObj, position, position + osg::Vec3f(0.0f, 0.0f, Constants::sStepSizeUp), mColWorld, onGround);
+        mUpStepper.doTrace(mColObj, position, position + osg::Vec3f(0.0f, 0.0f, Constants::sStepSizeUp), mColWorld,
+            onGround, mCandidates);
 
         float upDistance = 0;
         if (!mUpStepper.mHitObject)
@@ -91,7 +93,7 @@ namespace MWPhysics
                 tracerDest = tracerPos + normalMove * sMinStep2;
             }
 
-            mTracer.doTrace(mColObj, tracerPos, tracerDest, mColWorld);
+            mTracer.doTrace(mColObj, tracerPos, tracerDest, mColWorld, false, mCandidates);
             if (mTracer.mHitObject)
             {
                 // map against what we hit, minus the safety margin
@@ -108,7 +110,7 @@ namespace MWPhysics
                 auto tempDest = tracerDest + mTracer.mPlaneNormal * sCollisionMargin * 2;
 
                 ActorTracer tempTracer;
-                tempTracer.doTrace(mColObj, tracerDest, tempDest, mColWorld);
+                tempTracer.doTrace(mColObj, tracerDest, tempDest, mColWorld, false, mCandidates);
 
                 if (tempTracer.mFraction > 0.5f) // distance to any object is greater than sCollisionMargin (we checked
                                                  // sCollisionMargin*2 distance)
@@ -122,8 +124,8 @@ namespace MWPhysics
                 downStepSize = upDistance;
             else
                 downStepSize = moveDistance + upDistance + sStepSizeDown;
-            mDownStepper.doTrace(
-                mColObj, tracerDest, tracerDest + osg::Vec3f(0.0f, 0.0f, -downStepSize), mColWorld, onGround);
+            mDownStepper.doTrace(mColObj, tracerDest, tracerDest + osg::Vec3f(0.0f, 0.0f, -downStepSize), mColWorld,
+                onGround, mCandidates);
 
             // can't step down onto air, non-walkable-slopes, or actors
             // NOTE: using a capsule causes isWalkableSlope (used in canStepDown) to fail on certain geometry that were
@@ -18,11 +18,13 @@ namespace MWPhysics
     private:
         const btCollisionWorld* mColWorld;
         const btCollisionObject* mColObj;
+        const SweepCandidates* mCandidates;
 
         ActorTracer mTracer, mUpStepper, mDownStepper;
 
     public:
-        Stepper(const btCollisionWorld* colWorld, const btCollisionObject* colObj);
+        Stepper(const btCollisionWorld* colWorld, const btCollisionObject* colObj,
+            const SweepCandidates* candidates = nullptr);
 
         bool step(osg::Vec3f& position, osg::Vec3f& velocity, float& remainingTime, const bool& onGround,
             bool firstIteration);
@@ -2,6 +2,7 @@
 
 #include <components/misc/convert.hpp>
 
+#include <BulletCollision/BroadphaseCollision/btBroadphaseInterface.h>
 #include <BulletCollision/CollisionDispatch/btCollisionWorld.h>
 #include <BulletCollision/CollisionShapes/btConvexShape.h>
 
@@ -11,9 +12,39 @@
 
 namespace MWPhysics
 {
+    namespace
+    {
+        struct AabbOverlapsCallback : public btBroadphaseAabbCallback
+        {
+            std::vector<const btCollisionObject*>& mObjects;
+
+            explicit AabbOverlapsCallback(std::vector<const btCollisionObject*>& objects)
+                : mObjects(objects)
+            {
+            }
+
+            bool process(const btBroadphaseProxy* proxy) override
+            {
+                mObjects.push_back(static_cast<const btCollisionObject*>(proxy->m_clientObject));
+                return true;
+            }
+        };
+    }
+
+    void SweepCandidates::gather(const btCollisionObject* actor, const osg::Vec3f& expandMin,
+        const osg::Vec3f& expandMax, const btCollisionWorld* world)
+    {
+        mObjects.clear();
+        btVector3 aabbMin, aabbMax;
+        actor->getCollisionShape()->getAabb(actor->getWorldTransform(), aabbMin, aabbMax);
+        AabbOverlapsCallback callback(mObjects);
+        // FIXME: aabbTest doesn't modify the broadphase, but bullet doesn't mark it const
+        const_cast<btCollisionWorld*>(world)->getBroadphase()->aabbTest(
+            aabbMin - Misc::Convert::toBullet(expandMin), aabbMax + Misc::Convert::toBullet(expandMax), callback);
+    }
 
     ActorConvexCallback sweepHelper(const btCollisionObject* actor, const btVector3& from, const btVector3& to,
-        const btCollisionWorld* world, bool actorFilter)
+        const btCollisionWorld* world, bool actorFilter, const SweepCandidates* candidates = nullptr)
     {
         const btTransform& trans = actor->getWorldTransform();
         btTransform transFrom(trans);
@@ -33,12 +64,27 @@ namespace MWPhysics
         if (actorFilter)
             traceCallback.m_collisionFilterMask &= ~CollisionType_Actor;
 
-        world->convexSweepTest(static_cast<const btConvexShape*>(shape), transFrom, transTo, traceCallback);
+        if (candidates != nullptr)
+        {
+            // The broadphase has already been queried for the whole volume this sweep stays inside
+            // of, so test the cached overlaps directly instead of going through the broadphase again.
+            const btScalar allowedPenetration = world->getDispatchInfo().m_allowedCcdPenetration;
+            for (const btCollisionObject* object : candidates->get())
+            {
+                if (object == actor || !traceCallback.needsCollision(object->getBroadphaseHandle()))
+                    continue;
+                btCollisionWorld::objectQuerySingle(static_cast<const btConvexShape*>(shape), transFrom, transTo,
+                    const_cast<btCollisionObject*>(object), object->getCollisionShape(), object->getWorldTransform(),
+                    traceCallback, allowedPenetration);
+            }
+        }
+        else
+            world->convexSweepTest(static_cast<const btConvexShape*>(shape), transFrom, transTo, traceCallback);
         return traceCallback;
     }
 
     void ActorTracer::doTrace(const btCollisionObject* actor, const osg::Vec3f& start, const osg::Vec3f& end,
-        const btCollisionWorld* world, bool attempt_short_trace)
+        const btCollisionWorld* world, bool attempt_short_trace, const SweepCandidates* candidates)
     {
         const btVector3 btstart = Misc::Convert::toBullet(start);
         btVector3 btend = Misc::Convert::toBullet(end);
@@ -62,7 +108,7 @@ namespace MWPhysics
             doing_short_trace = true;
         }
 
-        const auto traceCallback = sweepHelper(actor, btstart, btend, world, false);
+        const auto traceCallback = sweepHelper(actor, btstart, btend, world, false, candidates);
 
         // Copy the hit data over to our trace results struct:
         if (traceCallback.hasHit())
@@ -81,7 +127,7 @@ namespace MWPhysics
             if (doing_short_trace)
             {
                 btend = Misc::Convert::toBullet(end);
-                const auto newTraceCallback = sweepHelper(actor, btstart, btend, world, false);
+                const auto newTraceCallback = sweepHelper(actor, btstart, btend, world, false, candidates);
 
                 if (newTraceCallback.hasHit())
                 {
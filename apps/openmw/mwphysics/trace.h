@@ -1,6 +1,8 @@
 #ifndef OENGINE_BULLET_TRACE_H
 #define OENGINE_BULLET_TRACE_H
 
+#include <vector>
+
 #include <osg/Vec3f>
 
 class btCollisionObject;
@@ -10,6 +12,25 @@ namespace MWPhysics
 {
     class Actor;
 
+    /// Caches the collision objects whose broadphase AABB overlaps a given volume.
+    /// The movement solver performs a dozen or more sweeps per actor and step, all within a small
+    /// and known region; querying the broadphase once for that region and sweeping against the
+    /// cached objects only is cheaper than dispatching every sweep through the whole world.
+    class SweepCandidates
+    {
+    public:
+        /// Collect the objects overlapping the actor's AABB expanded by expandMin towards the lower
+        /// corner and expandMax towards the upper corner. Sweeps that leave this volume must not use
+        /// the cache, or they will miss collisions.
+        void gather(const btCollisionObject* actor, const osg::Vec3f& expandMin, const osg::Vec3f& expandMax,
+            const btCollisionWorld* world);
+
+        const std::vector<const btCollisionObject*>& get() const { return mObjects; }
+
+    private:
+        std::vector<const btCollisionObject*> mObjects;
+    };
+
     struct ActorTracer
     {
         osg::Vec3f mEndPos;
@@ -20,7 +41,8 @@ namespace MWPhysics
         float mFraction;
 
         void doTrace(const btCollisionObject* actor, const osg::Vec3f& start, const osg::Vec3f& end,
-            const btCollisionWorld* world, bool attempt_short_trace = false);
+            const btCollisionWorld* world, bool attempt_short_trace = false,
+            const SweepCandidates* candidates = nullptr);
         void findGround(
             const Actor* actor, const osg::Vec3f& start, const osg::Vec3f& end, const btCollisionWorld* world);
     };
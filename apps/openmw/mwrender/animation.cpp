@@ -609,6 +609,12 @@ namespace MWRender
             mSkeleton->setActive(static_cast<SceneUtil::Skeleton::ActiveType>(active));
     }
 
+    void Animation::setUpdateRateDivisor(unsigned int divisor)
+    {
+        if (mSkeleton)
+            mSkeleton->setUpdateRateDivisor(divisor);
+    }
+
     void Animation::updatePtr(const MWWorld::Ptr& ptr)
     {
         mPtr = ptr;
@@ -1139,6 +1145,8 @@ namespace MWRender
 
         mAccumCtrl = nullptr;
 
+        const bool useSmoothAnims = Settings::game().mSmoothAnimTransitions;
+
         for (size_t blendMask = 0; blendMask < sNumBlendMasks; blendMask++)
         {
             AnimStateMap::const_iterator active = mStates.end();
@@ -1170,8 +1178,6 @@ namespace MWRender
                     osg::ref_ptr<osg::Node> node = getNodeMap().at(
                         it->first); // this should not throw, we already checked for the node existing in addAnimSource
 
-                    const bool useSmoothAnims = Settings::game().mSmoothAnimTransitions;
-
                     osg::Callback* callback = it->second->getAsCallback();
                     if (useSmoothAnims)
                     {
@@ -325,6 +325,9 @@ namespace MWRender
         MWWorld::Ptr getPtr() { return mPtr; }
 
         /// Set active flag on the object skeleton, if one exists.
+        /// @see SceneUtil::Skeleton::setUpdateRateDivisor
+        void setUpdateRateDivisor(unsigned int divisor);
+
         /// @see SceneUtil::Skeleton::setActive
         /// 0 = Inactive, 1 = Active in place, 2 = Active
         void setActive(int active);
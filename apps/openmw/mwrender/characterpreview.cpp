@@ -414,10 +414,24 @@ namespace MWRender
         if (!mAnimation.get())
             return;
 
+        MWWorld::InventoryStore& inv = mCharacter.getClass().getInventoryStore(mCharacter);
+
+        // The doll only depends on what's equipped; inventory changes that leave
+        // the slots alone keep the previous render.
+        std::vector<ESM::RefId> equipment;
+        equipment.reserve(MWWorld::InventoryStore::Slots);
+        for (int slot = 0; slot < MWWorld::InventoryStore::Slots; ++slot)
+        {
+            MWWorld::ContainerStoreIterator it = inv.getSlot(slot);
+            equipment.push_back(it != inv.end() ? it->getCellRef().getRefId() : ESM::RefId());
+        }
+        if (equipment == mRenderedEquipment)
+            return;
+        mRenderedEquipment = std::move(equipment);
+
         mAnimation->showWeapons(true);
         mAnimation->updateParts();
 
-        MWWorld::InventoryStore& inv = mCharacter.getClass().getInventoryStore(mCharacter);
         MWWorld::ContainerStoreIterator iter = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
         std::string groupname = "inventoryhandtohand";
         bool showCarriedLeft = true;
@@ -518,6 +532,11 @@ namespace MWRender
     void InventoryPreview::onSetup()
     {
         CharacterPreview::onSetup();
+
+        // The animation was rebuilt from scratch, so the next update must render
+        // regardless of what the slots hold.
+        mRenderedEquipment.clear();
+
         osg::Vec3f scale(1.f, 1.f, 1.f);
         mCharacter.getClass().adjustScale(mCharacter, scale, true);
 
@@ -543,12 +562,25 @@ namespace MWRender
 
     void RaceSelectionPreview::setAngle(float angleRadians)
     {
+        // Rotation ticks repeat the same scroll position a lot; the RTT result
+        // for it is already on screen.
+        if (mAngleRadians == angleRadians)
+            return;
+        mAngleRadians = angleRadians;
+
         mNode->setAttitude(osg::Quat(mPitchRadians, osg::Vec3(1, 0, 0)) * osg::Quat(angleRadians, osg::Vec3(0, 0, 1)));
         redraw();
     }
 
     void RaceSelectionPreview::setPrototype(const ESM::NPC& proto)
     {
+        // Only the race, sex, head and hair vary between the prototypes the race
+        // dialog feeds us; when they all match, the current render is already
+        // correct and the NpcAnimation rebuild can be skipped.
+        if (mAnimation != nullptr && proto.mRace == mBase.mRace && proto.mHead == mBase.mHead
+            && proto.mHair == mBase.mHair && proto.isMale() == mBase.isMale())
+            return;
+
         mBase = proto;
         mBase.mId = ESM::RefId::stringRefId("Player");
         rebuild();
@@ -2,6 +2,9 @@
 #define MWRENDER_CHARACTERPREVIEW_H
 
 #include <memory>
+#include <optional>
+#include <vector>
+
 #include <osg/ref_ptr>
 
 #include <osg/PositionAttitudeTransform>
@@ -90,6 +93,11 @@ namespace MWRender
         osg::ref_ptr<osg::Viewport> mViewport;
 
         void onSetup() override;
+
+    private:
+        // Equipped item per slot as of the last render, so update() can skip
+        // re-rendering when an inventory change didn't affect the doll.
+        std::vector<ESM::RefId> mRenderedEquipment;
     };
 
     class UpdateCameraCallback;
@@ -117,6 +125,9 @@ namespace MWRender
         osg::ref_ptr<UpdateCameraCallback> mUpdateCameraCallback;
 
         float mPitchRadians;
+        // Angle of the last render, so repeated rotation ticks at the same
+        // position don't trigger redraws.
+        std::optional<float> mAngleRadians;
     };
 
 }
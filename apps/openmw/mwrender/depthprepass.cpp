@@ -0,0 +1,122 @@
+#include "depthprepass.hpp"
+
+#include <osg/BlendFunc>
+#include <osg/ColorMask>
+#include <osg/Depth>
+#include <osg/Texture2D>
+
+#include <osgUtil/RenderStage>
+
+#include <components/sceneutil/depth.hpp>
+#include <components/shader/shadermanager.hpp>
+#include <components/stereo/stereomanager.hpp>
+
+namespace MWRender
+{
+    namespace
+    {
+        void drawOwnLeaves(osgUtil::RenderBin* bin, osg::RenderInfo& renderInfo, osgUtil::RenderLeaf*& previous)
+        {
+            for (osgUtil::RenderLeaf* leaf : bin->getRenderLeafList())
+            {
+                leaf->render(renderInfo, previous);
+                previous = leaf;
+            }
+            for (osgUtil::StateGraph* graph : bin->getStateGraphList())
+            {
+                for (const osg::ref_ptr<osgUtil::RenderLeaf>& leaf : graph->_leaves)
+                {
+                    leaf->render(renderInfo, previous);
+                    previous = leaf.get();
+                }
+            }
+        }
+    }
+
+    OpaqueDepthPrePassCallback::OpaqueDepthPrePassCallback(Shader::ShaderManager& shaderManager)
+        : mPrePassStateSet(new osg::StateSet)
+        , mEqualDepthStateSet(new osg::StateSet)
+    {
+        constexpr osg::StateAttribute::OverrideValue modeOff = osg::StateAttribute::OFF | osg::StateAttribute::OVERRIDE;
+        constexpr osg::StateAttribute::OverrideValue modeOn = osg::StateAttribute::ON | osg::StateAttribute::OVERRIDE;
+
+        // Each leaf keeps its own texture on unit 0 so "depthclipped" discards
+        // alpha-tested fragments exactly like the shaded pass will; untextured
+        // leaves fall back to this opaque dummy.
+        osg::ref_ptr<osg::Image> image = new osg::Image;
+        image->allocateImage(1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+        image->setColor(osg::Vec4(1, 1, 1, 1), 0, 0);
+        osg::ref_ptr<osg::Texture2D> dummyTexture = new osg::Texture2D(image);
+        dummyTexture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
+        dummyTexture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
+        mPrePassStateSet->setTextureAttributeAndModes(0, dummyTexture);
+
+        Shader::ShaderManager::DefineMap defines;
+        Stereo::shaderStereoDefines(defines);
+
+        mPrePassStateSet->setAttributeAndModes(new osg::ColorMask(false, false, false, false), modeOn);
+        mPrePassStateSet->setAttributeAndModes(new osg::BlendFunc, modeOff);
+        mPrePassStateSet->setAttributeAndModes(shaderManager.getProgram("depthclipped", defines), modeOn);
+        mPrePassStateSet->setAttributeAndModes(new SceneUtil::AutoDepth, modeOn);
+
+        for (unsigned int unit = 1; unit < 8; ++unit)
+            mPrePassStateSet->setTextureMode(unit, GL_TEXTURE_2D, modeOff);
+
+        // The prepass wrote final depth, so the shaded pass only has to test for
+        // equality and can leave depth writes off.
+        mEqualDepthStateSet->setAttributeAndModes(new osg::Depth(osg::Depth::EQUAL, 0.0, 1.0, false), modeOn);
+    }
+
+    void OpaqueDepthPrePassCallback::drawImplementation(
+        osgUtil::RenderBin* bin, osg::RenderInfo& renderInfo, osgUtil::RenderLeaf*& previous)
+    {
+        osg::State& state = *renderInfo.getState();
+
+        // Like the transparent depth postpass, only the main scene pass gets the
+        // extra work; other stages drawing this bin (shadow maps, water
+        // reflections, the local map) render it the normal way.
+        const unsigned int frameId = state.getFrameStamp()->getFrameNumber() % 2;
+        const auto& fbo = mFbo[frameId];
+        const auto& msaaFbo = mMsaaFbo[frameId];
+
+        bool validFbo = false;
+        if (bin->getStage()->getMultisampleResolveFramebufferObject()
+            && bin->getStage()->getMultisampleResolveFramebufferObject() == fbo)
+            validFbo = true;
+        else if (bin->getStage()->getFrameBufferObject()
+            && (bin->getStage()->getFrameBufferObject() == fbo || bin->getStage()->getFrameBufferObject() == msaaFbo))
+            validFbo = true;
+
+        if (!validFbo)
+        {
+            bin->drawImplementation(renderInfo, previous);
+            return;
+        }
+
+        unsigned int numToPop = previous ? osgUtil::StateGraph::numToPop(previous->_parent) : 0;
+        if (numToPop > 1)
+            numToPop--;
+        const unsigned int insertStateSetPosition = state.getStateSetStackSize() - numToPop;
+
+        // Mirror osgUtil::RenderBin::drawImplementation's ordering: bins with a
+        // negative number first, this bin's leaves, remaining bins last. Only the
+        // leaves are drawn twice.
+        osgUtil::RenderBin::RenderBinList& binList = bin->getRenderBinList();
+        osgUtil::RenderBin::RenderBinList::iterator rbitr = binList.begin();
+        for (; rbitr != binList.end() && rbitr->first < 0; ++rbitr)
+            rbitr->second->draw(renderInfo, previous);
+
+        state.insertStateSet(insertStateSetPosition, mPrePassStateSet);
+        drawOwnLeaves(bin, renderInfo, previous);
+        state.removeStateSet(insertStateSetPosition);
+
+        state.insertStateSet(insertStateSetPosition, mEqualDepthStateSet);
+        drawOwnLeaves(bin, renderInfo, previous);
+        state.removeStateSet(insertStateSetPosition);
+
+        for (; rbitr != binList.end(); ++rbitr)
+            rbitr->second->draw(renderInfo, previous);
+
+        state.checkGLErrors("after OpaqueDepthPrePassCallback::drawImplementation");
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef OPENMW_MWRENDER_DEPTHPREPASS_H
+#define OPENMW_MWRENDER_DEPTHPREPASS_H
+
+#include <array>
+
+#include <osg/FrameBufferObject>
+#include <osg/StateSet>
+
+#include <osgUtil/RenderBin>
+
+namespace Shader
+{
+    class ShaderManager;
+}
+
+namespace MWRender
+{
+    /// Draw callback for the named opaque bin the scene is routed into when the
+    /// depth prepass is enabled. The bin's own leaves are first drawn depth-only
+    /// with alpha-clipping intact, then shaded with an equal depth test, so the
+    /// expensive fragment work (per-pixel lights, parallax, shadow sampling) only
+    /// runs for surfaces that end up visible. Child bins (sky, water,
+    /// transparents) draw normally in their usual order.
+    class OpaqueDepthPrePassCallback : public osgUtil::RenderBin::DrawCallback
+    {
+    public:
+        explicit OpaqueDepthPrePassCallback(Shader::ShaderManager& shaderManager);
+
+        void drawImplementation(
+            osgUtil::RenderBin* bin, osg::RenderInfo& renderInfo, osgUtil::RenderLeaf*& previous) override;
+
+        std::array<osg::ref_ptr<osg::FrameBufferObject>, 2> mFbo;
+        std::array<osg::ref_ptr<osg::FrameBufferObject>, 2> mMsaaFbo;
+
+    private:
+        osg::ref_ptr<osg::StateSet> mPrePassStateSet;
+        osg::ref_ptr<osg::StateSet> mEqualDepthStateSet;
+    };
+
+}
+
+#endif
@@ -2,6 +2,8 @@
 
 #include <osg/PositionAttitudeTransform>
 
+#include <osgParticle/ParticleSystem>
+
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/scenemanager.hpp>
 
@@ -15,6 +17,34 @@
 
 namespace MWRender
 {
+    namespace
+    {
+        // Keep at most this many idle instances per model.
+        constexpr std::size_t sMaxPooledPerModel = 8;
+        // Idle instances not reused within this many seconds are dropped.
+        constexpr float sMaxPooledAge = 10.f;
+
+        // Kills all live particles so a reused instance starts from a clean state, as if freshly
+        // instanced.
+        class RewindParticlesVisitor : public osg::NodeVisitor
+        {
+        public:
+            RewindParticlesVisitor()
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            {
+            }
+
+            void apply(osg::Drawable& drawable) override
+            {
+                if (osgParticle::ParticleSystem* partsys = dynamic_cast<osgParticle::ParticleSystem*>(&drawable))
+                {
+                    for (int i = 0; i < partsys->numParticles(); ++i)
+                        partsys->getParticle(i)->kill();
+                }
+                traverse(drawable);
+            }
+        };
+    }
 
     EffectManager::EffectManager(osg::ref_ptr<osg::Group> parent, Resource::ResourceSystem* resourceSystem)
         : mParentNode(std::move(parent))
@@ -30,24 +60,31 @@ namespace MWRender
     void EffectManager::addEffect(const std::string& model, std::string_view textureOverride,
         const osg::Vec3f& worldPosition, float scale, bool isMagicVFX)
     {
-        osg::ref_ptr<osg::Node> node = mResourceSystem->getSceneManager()->getInstance(model);
+        osg::ref_ptr<osg::PositionAttitudeTransform> trans = takeFromPool(model);
+        if (trans == nullptr)
+        {
+            trans = new osg::PositionAttitudeTransform;
+            trans->addChild(mResourceSystem->getSceneManager()->getInstance(model));
+        }
+        osg::ref_ptr<osg::Node> node = trans->getChild(0);
 
         node->setNodeMask(Mask_Effect);
 
         Effect effect;
         effect.mAnimTime = std::make_shared<EffectAnimationTime>();
+        effect.mModel = model;
 
         SceneUtil::FindMaxControllerLengthVisitor findMaxLengthVisitor;
         node->accept(findMaxLengthVisitor);
         effect.mMaxControllerLength = findMaxLengthVisitor.getMaxLength();
 
-        osg::ref_ptr<osg::PositionAttitudeTransform> trans = new osg::PositionAttitudeTransform;
         trans->setPosition(worldPosition);
         trans->setScale(osg::Vec3f(scale, scale, scale));
-        trans->addChild(node);
 
         effect.mTransform = trans;
 
+        // Re-keys the controllers of a pooled instance to the fresh time source, rewinding the
+        // animation.
         SceneUtil::AssignControllerSourcesVisitor assignVisitor(effect.mAnimTime);
         node->accept(assignVisitor);
 
@@ -68,10 +105,41 @@ namespace MWRender
                                effect.mAnimTime->addTime(dt);
                                const auto remove = effect.mAnimTime->getTime() >= effect.mMaxControllerLength;
                                if (remove)
+                               {
                                    mParentNode->removeChild(effect.mTransform);
+                                   retire(std::move(effect));
+                               }
                                return remove;
                            }),
             mEffects.end());
+
+        for (auto it = mPool.begin(); it != mPool.end();)
+        {
+            it->second.mAge += dt;
+            if (it->second.mAge >= sMaxPooledAge)
+                it = mPool.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    void EffectManager::retire(Effect&& effect)
+    {
+        if (mPool.count(effect.mModel) >= sMaxPooledPerModel)
+            return;
+        mPool.emplace(std::move(effect.mModel), PooledEffect{ 0.f, std::move(effect.mTransform) });
+    }
+
+    osg::ref_ptr<osg::PositionAttitudeTransform> EffectManager::takeFromPool(const std::string& model)
+    {
+        const auto it = mPool.find(model);
+        if (it == mPool.end())
+            return nullptr;
+        osg::ref_ptr<osg::PositionAttitudeTransform> trans = std::move(it->second.mTransform);
+        mPool.erase(it);
+        RewindParticlesVisitor rewindVisitor;
+        trans->accept(rewindVisitor);
+        return trans;
     }
 
     void EffectManager::clear()
@@ -81,6 +149,7 @@ namespace MWRender
             mParentNode->removeChild(effect.mTransform);
         }
         mEffects.clear();
+        mPool.clear();
     }
 
 }
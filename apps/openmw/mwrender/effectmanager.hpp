@@ -1,6 +1,7 @@
 #ifndef OPENMW_MWRENDER_EFFECTMANAGER_H
 #define OPENMW_MWRENDER_EFFECTMANAGER_H
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -47,10 +48,28 @@ namespace MWRender
             float mMaxControllerLength;
             std::shared_ptr<EffectAnimationTime> mAnimTime;
             osg::ref_ptr<osg::PositionAttitudeTransform> mTransform;
+            std::string mModel;
         };
 
+        struct PooledEffect
+        {
+            float mAge;
+            osg::ref_ptr<osg::PositionAttitudeTransform> mTransform;
+        };
+
+        /// Move a finished effect subgraph into the pool for reuse, unless the pool is full.
+        void retire(Effect&& effect);
+
+        /// Take a pooled instance of the given model, rewinding its particles. Returns nullptr if none is
+        /// pooled.
+        osg::ref_ptr<osg::PositionAttitudeTransform> takeFromPool(const std::string& model);
+
         std::vector<Effect> mEffects;
 
+        // Finished effect subgraphs kept warm for reuse, so spell-spam does not clone a scene graph per
+        // cast. Instances not reused in a while are dropped in update().
+        std::multimap<std::string, PooledEffect> mPool;
+
         osg::ref_ptr<osg::Group> mParentNode;
         Resource::ResourceSystem* mResourceSystem;
     };
@@ -266,6 +266,9 @@ namespace MWRender
     GlobalMap::GlobalMap(osg::Group* root, SceneUtil::WorkQueue* workQueue)
         : mRoot(root)
         , mWorkQueue(workQueue)
+        , mOverlayRevision(1)
+        , mWritePngRevision(0)
+        , mEncodedRevision(0)
         , mWidth(0)
         , mHeight(0)
         , mMinX(0)
@@ -431,6 +434,7 @@ namespace MWRender
         ensureLoaded();
 
         memset(mOverlayImage->data(), 0, mOverlayImage->getTotalSizeInBytes());
+        ++mOverlayRevision;
 
         mPendingImageDest.clear();
 
@@ -451,12 +455,17 @@ namespace MWRender
         if (mWritePng != nullptr)
         {
             mWritePng->waitTillDone();
-            map.mImageData = std::move(mWritePng->mImageData);
+            mEncodedImageData = std::move(mWritePng->mImageData);
+            mEncodedRevision = mWritePngRevision;
             mWritePng = nullptr;
-            return;
+        }
+        else if (mEncodedRevision != mOverlayRevision || mEncodedImageData.empty())
+        {
+            mEncodedImageData = writePng(*mOverlayImage);
+            mEncodedRevision = mOverlayRevision;
         }
 
-        map.mImageData = writePng(*mOverlayImage);
+        map.mImageData = mEncodedImageData;
     }
 
     struct Box
@@ -554,6 +563,10 @@ namespace MWRender
         if (srcBox == destBox && imageWidth == mWidth && imageHeight == mHeight)
         {
             mOverlayImage = image;
+            ++mOverlayRevision;
+            // the loaded data is exactly what a save would encode, keep it for the next one
+            mEncodedImageData = map.mImageData;
+            mEncodedRevision = mOverlayRevision;
 
             requestOverlayTextureUpdate(0, 0, mWidth, mHeight, std::move(texture), true, false);
         }
@@ -616,6 +629,7 @@ namespace MWRender
             }
 
             mOverlayImage->copySubImage(imageDest.mX, imageDest.mY, 0, imageDest.mImage);
+            ++mOverlayRevision;
             mPendingImageDest.erase(it);
             return true;
         }
@@ -651,8 +665,12 @@ namespace MWRender
     {
         if (mOverlayImage == nullptr)
             return;
+        // Nothing changed since the last encode, write() will reuse the cached data
+        if (mEncodedRevision == mOverlayRevision && !mEncodedImageData.empty())
+            return;
         // Use deep copy to avoid any sychronization
         mWritePng = new WritePng(new osg::Image(*mOverlayImage, osg::CopyOp::DEEP_COPY_ALL));
-        mWorkQueue->addWorkItem(mWritePng, /*front=*/true);
+        mWritePngRevision = mOverlayRevision;
+        mWorkQueue->addWorkItem(mWritePng, SceneUtil::WorkPriority::Urgent);
     }
 }
@@ -125,6 +125,13 @@ namespace MWRender
         osg::ref_ptr<CreateMapWorkItem> mWorkItem;
         osg::ref_ptr<WritePng> mWritePng;
 
+        // Bumped whenever mOverlayImage changes, so saves can reuse the last encoded image
+        // instead of re-encoding an unchanged overlay.
+        unsigned int mOverlayRevision;
+        unsigned int mWritePngRevision;
+        unsigned int mEncodedRevision;
+        std::vector<char> mEncodedImageData;
+
         int mWidth;
         int mHeight;
 
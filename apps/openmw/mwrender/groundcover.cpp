@@ -1,5 +1,10 @@
 #include "groundcover.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include <osg/AlphaFunc>
 #include <osg/BlendFunc>
 #include <osg/ComputeBoundsVisitor>
@@ -101,9 +106,13 @@ namespace MWRender
                         if (dNear < computedZNear)
                         {
                             dNear = computedZNear;
-                            for (const auto& instanceMatrix : mInstanceMatrices)
+                            // Refine the nearest instances first so the rest can be skipped as soon as their
+                            // bounds cannot be closer than the near plane computed so far.
+                            std::vector<std::pair<value_type, std::size_t>> candidates;
+                            candidates.reserve(mInstanceMatrices.size());
+                            for (std::size_t i = 0; i < mInstanceMatrices.size(); ++i)
                             {
-                                osg::Matrix fullMatrix = instanceMatrix * matrix;
+                                osg::Matrix fullMatrix = mInstanceMatrices[i] * matrix;
                                 osg::Vec3 instanceLookVector(-fullMatrix(0, 2), -fullMatrix(1, 2), -fullMatrix(2, 2));
                                 unsigned int instanceBbCornerFar = (instanceLookVector.x() >= 0 ? 1 : 0)
                                     | (instanceLookVector.y() >= 0 ? 2 : 0) | (instanceLookVector.z() >= 0 ? 4 : 0);
@@ -116,9 +125,18 @@ namespace MWRender
                                 if (instanceDNear > instanceDFar)
                                     std::swap(instanceDNear, instanceDFar);
 
-                                if (instanceDFar < 0 || instanceDNear > dNear)
+                                if (instanceDFar < 0)
                                     continue;
 
+                                candidates.emplace_back(instanceDNear, i);
+                            }
+                            std::sort(candidates.begin(), candidates.end());
+                            for (const auto& [instanceDNear, index] : candidates)
+                            {
+                                if (instanceDNear > dNear)
+                                    break;
+
+                                osg::Matrix fullMatrix = mInstanceMatrices[index] * matrix;
                                 frustum.setAndTransformProvidingInverse(
                                     cullVisitor.getProjectionCullingStack().back().getFrustum(), fullMatrix);
                                 osg::Polytope::PlaneList planes;
@@ -141,9 +159,12 @@ namespace MWRender
                         if (cnfMode == osg::CullSettings::COMPUTE_NEAR_FAR_USING_PRIMITIVES && dFar > computedZFar)
                         {
                             dFar = computedZFar;
-                            for (const auto& instanceMatrix : mInstanceMatrices)
+                            // Same as above, but starting with the furthest instances.
+                            std::vector<std::pair<value_type, std::size_t>> candidates;
+                            candidates.reserve(mInstanceMatrices.size());
+                            for (std::size_t i = 0; i < mInstanceMatrices.size(); ++i)
                             {
-                                osg::Matrix fullMatrix = instanceMatrix * matrix;
+                                osg::Matrix fullMatrix = mInstanceMatrices[i] * matrix;
                                 osg::Vec3 instanceLookVector(-fullMatrix(0, 2), -fullMatrix(1, 2), -fullMatrix(2, 2));
                                 unsigned int instanceBbCornerFar = (instanceLookVector.x() >= 0 ? 1 : 0)
                                     | (instanceLookVector.y() >= 0 ? 2 : 0) | (instanceLookVector.z() >= 0 ? 4 : 0);
@@ -156,9 +177,18 @@ namespace MWRender
                                 if (instanceDNear > instanceDFar)
                                     std::swap(instanceDNear, instanceDFar);
 
-                                if (instanceDFar < 0 || instanceDFar < dFar)
+                                if (instanceDFar < 0)
                                     continue;
 
+                                candidates.emplace_back(instanceDFar, i);
+                            }
+                            std::sort(candidates.begin(), candidates.end(), std::greater<>());
+                            for (const auto& [instanceDFar, index] : candidates)
+                            {
+                                if (instanceDFar < dFar)
+                                    break;
+
+                                osg::Matrix fullMatrix = mInstanceMatrices[index] * matrix;
                                 frustum.setAndTransformProvidingInverse(
                                     cullVisitor.getProjectionCullingStack().back().getFrustum(), fullMatrix);
                                 osg::Polytope::PlaneList planes;
@@ -170,8 +200,8 @@ namespace MWRender
                                     selectorMask <<= 1;
                                 }
 
-                                value_type newFar = cullVisitor.computeFurthestPointInFrustum(
-                                    instanceMatrix * matrix, planes, *drawable);
+                                value_type newFar
+                                    = cullVisitor.computeFurthestPointInFrustum(fullMatrix, planes, *drawable);
                                 dFar = std::max(dFar, newFar);
                             }
                             if (dFar > computedZFar)
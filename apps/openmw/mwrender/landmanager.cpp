@@ -49,6 +49,22 @@ namespace MWRender
         return landObj;
     }
 
+    void LandManager::updateCache(double referenceTime)
+    {
+        GenericResourceManager<ESM::ExteriorCellLocation>::updateCache(referenceTime);
+
+        const std::uint64_t budget = Settings::terrain().mLandCacheSize;
+        if (budget == 0)
+            return;
+
+        mCache->removeLeastRecentlyUsed(budget, [](const osg::Object* obj) -> std::size_t {
+            // nullptr entries record cells without land data
+            if (obj == nullptr)
+                return 0;
+            return static_cast<const ESMTerrain::LandObject*>(obj)->getByteSize();
+        });
+    }
+
     void LandManager::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
         Resource::reportStats("Land", frameNumber, mCache->getStats(), *stats);
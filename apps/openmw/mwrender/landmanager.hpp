@@ -23,6 +23,10 @@ namespace MWRender
         /// @note Will return nullptr if not found.
         osg::ref_ptr<ESMTerrain::LandObject> getLand(ESM::ExteriorCellLocation cellIndex);
 
+        /// In addition to the time based expiry, evict the least recently used land data once the
+        /// cache grows past the configured memory budget.
+        void updateCache(double referenceTime) override;
+
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override;
 
     private:
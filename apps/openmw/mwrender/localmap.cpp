@@ -107,6 +107,7 @@ namespace MWRender
     {
         mExteriorSegments.clear();
         mInteriorSegments.clear();
+        mPendingRTTs.clear();
     }
 
     void LocalMap::saveFogOfWar(MWWorld::CellStore* cell)
@@ -164,14 +165,14 @@ namespace MWRender
     void LocalMap::setupRenderToTexture(
         int segment_x, int segment_y, float left, float top, const osg::Vec3d& upVector, float zmin, float zmax)
     {
-        mLocalMapRTTs.emplace_back(
+        // The render is queued up instead of attached right away; cleanupCameras attaches a limited
+        // number per frame so a request for many segments doesn't stall a single frame.
+        mPendingRTTs.emplace_back(
             new LocalMapRenderToTexture(mSceneRoot, mMapResolution, mMapWorldSize, left, top, upVector, zmin, zmax));
 
-        mRoot->addChild(mLocalMapRTTs.back());
-
         MapSegment& segment = mInterior ? mInteriorSegments[std::make_pair(segment_x, segment_y)]
                                         : mExteriorSegments[std::make_pair(segment_x, segment_y)];
-        segment.mMapTexture = static_cast<osg::Texture2D*>(mLocalMapRTTs.back()->getColorTexture(nullptr));
+        segment.mMapTexture = static_cast<osg::Texture2D*>(mPendingRTTs.back()->getColorTexture(nullptr));
     }
 
     void LocalMap::requestMap(const MWWorld::CellStore* cell)
@@ -248,6 +249,13 @@ namespace MWRender
             else
                 it++;
         }
+
+        for (int i = 0; i < sMaxRendersPerFrame && !mPendingRTTs.empty(); ++i)
+        {
+            mLocalMapRTTs.emplace_back(std::move(mPendingRTTs.front()));
+            mPendingRTTs.pop_front();
+            mRoot->addChild(mLocalMapRTTs.back());
+        }
     }
 
     void LocalMap::requestExteriorMap(const MWWorld::CellStore* cell, MapSegment& segment)
@@ -537,25 +545,32 @@ namespace MWRender
                 if (!segment.mFogOfWarImage || !segment.mMapTexture)
                     continue;
 
-                std::uint32_t* data = reinterpret_cast<std::uint32_t*>(segment.mFogOfWarImage->data());
+                // Texels outside the explore radius keep their alpha, so restrict the update to the
+                // bounding rect of the explored circle instead of walking the whole fog texture.
+                const float centerU = (u - mx) * (sFogOfWarResolution - 1);
+                const float centerV = (v - my) * (sFogOfWarResolution - 1);
+                const int minU = std::max(0, static_cast<int>(std::floor(centerU - exploreRadius)));
+                const int maxU = std::min(sFogOfWarResolution - 1, static_cast<int>(std::ceil(centerU + exploreRadius)));
+                const int minV = std::max(0, static_cast<int>(std::floor(centerV - exploreRadius)));
+                const int maxV = std::min(sFogOfWarResolution - 1, static_cast<int>(std::ceil(centerV + exploreRadius)));
+
+                std::uint32_t* const data = reinterpret_cast<std::uint32_t*>(segment.mFogOfWarImage->data());
                 bool changed = false;
-                for (int texV = 0; texV < sFogOfWarResolution; ++texV)
+                for (int texV = minV; texV <= maxV; ++texV)
                 {
-                    for (int texU = 0; texU < sFogOfWarResolution; ++texU)
+                    for (int texU = minU; texU <= maxU; ++texU)
                     {
-                        float sqrDist = square((texU + mx * (sFogOfWarResolution - 1)) - u * (sFogOfWarResolution - 1))
-                            + square((texV + my * (sFogOfWarResolution - 1)) - v * (sFogOfWarResolution - 1));
+                        float sqrDist = square(texU - centerU) + square(texV - centerV);
 
+                        std::uint32_t& texel = data[texV * sFogOfWarResolution + texU];
                         const std::uint8_t alpha = std::min<std::uint8_t>(
-                            *data >> 24, std::clamp(sqrDist / sqrExploreRadius, 0.f, 1.f) * 255);
+                            texel >> 24, std::clamp(sqrDist / sqrExploreRadius, 0.f, 1.f) * 255);
                         std::uint32_t val = static_cast<std::uint32_t>(alpha << 24);
-                        if (*data != val)
+                        if (texel != val)
                         {
-                            *data = val;
+                            texel = val;
                             changed = true;
                         }
-
-                        ++data;
                     }
                 }
 
@@ -2,6 +2,7 @@
 #define GAME_RENDER_LOCALMAP_H
 
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <set>
 #include <vector>
@@ -49,7 +50,8 @@ namespace MWRender
 
         /**
          * Request a map render for the given cell. Render textures will be immediately created and can be retrieved
-         * with the getMapTexture function.
+         * with the getMapTexture function. The renders themselves are spread over the next frames, see
+         * cleanupCameras.
          */
         void requestMap(const MWWorld::CellStore* cell);
 
@@ -63,8 +65,9 @@ namespace MWRender
         osg::ref_ptr<osg::Texture2D> getFogOfWarTexture(int x, int y);
 
         /**
-         * Removes cameras that have already been rendered. Should be called every frame to ensure that
-         * we do not render the same map more than once. Note, this cleanup is difficult to implement in an
+         * Removes cameras that have already been rendered and schedules a limited number of pending segment
+         * renders, so that requesting many segments at once (e.g. on interior entry) does not render them all
+         * in a single frame. Should be called every frame. Note, this cleanup is difficult to implement in an
          * automated fashion, since we can't alter the scene graph structure from within an update callback.
          */
         void cleanupCameras();
@@ -105,6 +108,9 @@ namespace MWRender
         typedef std::vector<osg::ref_ptr<LocalMapRenderToTexture>> RTTVector;
         RTTVector mLocalMapRTTs;
 
+        // requested renders that have not been attached to the scene yet
+        std::deque<osg::ref_ptr<LocalMapRenderToTexture>> mPendingRTTs;
+
         typedef std::set<std::pair<int, int>> Grid;
         Grid mCurrentGrid;
 
@@ -143,6 +149,9 @@ namespace MWRender
         // the dynamic texture is a bottleneck, so don't set this too high
         static const int sFogOfWarResolution = 32;
 
+        // render at most this many segments per frame to spread the cost of map updates
+        static const int sMaxRendersPerFrame = 2;
+
         // size of a map segment (for exteriors, 1 cell)
         float mMapWorldSize;
 
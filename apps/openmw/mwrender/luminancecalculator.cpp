@@ -3,6 +3,7 @@
 #include <components/misc/mathutil.hpp>
 #include <components/settings/values.hpp>
 #include <components/shader/shadermanager.hpp>
+#include <components/stereo/stereomanager.hpp>
 
 #include "pingpongcanvas.hpp"
 
@@ -13,6 +14,9 @@ namespace MWRender
         Shader::ShaderManager::DefineMap defines = {
             { "hdrExposureTime", std::to_string(Settings::postProcessing().mAutoExposureSpeed) },
         };
+        // Only the fragment stage needs the stereo defines: the scene color is a layered
+        // texture with multiview, but the luminance targets themselves stay single-layer.
+        Stereo::shaderStereoDefines(defines);
 
         auto vertex = shaderManager.getShader("fullscreen_tri.vert", {});
         auto luminanceFragment = shaderManager.getShader("luminance/luminance.frag", defines);
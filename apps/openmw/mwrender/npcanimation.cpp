@@ -592,7 +592,7 @@ namespace MWRender
         {
             MWWorld::ConstContainerStoreIterator store = inv.getSlot(slotlist[i].mSlot);
 
-            removePartGroup(slotlist[i].mSlot);
+            releasePartGroup(slotlist[i].mSlot);
 
             if (store == inv.end())
                 continue;
@@ -660,6 +660,8 @@ namespace MWRender
         showWeapons(mShowWeapons);
         showCarriedLeft(mShowCarriedLeft);
 
+        dropReleasedParts();
+
         bool isWerewolf = (getNpcType() == Type_Werewolf);
         ESM::RefId race = (isWerewolf ? ESM::RefId::stringRefId("werewolf") : mNpc->mRace);
 
@@ -746,6 +748,39 @@ namespace MWRender
         }
     }
 
+    void NpcAnimation::releasePartGroup(int group)
+    {
+        for (int i = 0; i < ESM::PRT_Count; i++)
+        {
+            if (mPartslots[i] == group)
+            {
+                // Keep the built part aside instead of destroying it: if the slot
+                // resolves to the same mesh again, addOrReplaceIndividualPart picks
+                // it up unchanged.
+                mReleasedParts[i] = std::move(mObjectParts[i]);
+                mPartPriorities[i] = 0;
+                mPartslots[i] = -1;
+            }
+        }
+    }
+
+    void NpcAnimation::dropReleasedParts()
+    {
+        for (int i = 0; i < ESM::PRT_Count; i++)
+        {
+            if (mReleasedParts[i] == nullptr)
+                continue;
+            mReleasedParts[i].reset();
+            // The part is gone for good and nothing replaced it: stop its looping
+            // sound like removeIndividualPart would have.
+            if (mObjectParts[i] == nullptr && mSounds[i] != nullptr && !mSoundsDisabled)
+            {
+                MWBase::Environment::get().getSoundManager()->stopSound(mSounds[i]);
+                mSounds[i] = nullptr;
+            }
+        }
+    }
+
     bool NpcAnimation::isFemalePart(const ESM::BodyPart* bodypart)
     {
         return bodypart->mData.mFlags & ESM::BodyPart::BPF_Female;
@@ -785,7 +820,21 @@ namespace MWRender
             // PRT_Hair seems to be the only type that breaks consistency and uses a filter that's different from the
             // attachment bone
             const std::string_view bonefilter = (type == ESM::PRT_Hair) ? std::string_view{ "hair" } : bonename;
+
+            // Reuse the part released by updateParts if it was built from the same
+            // mesh on the same bone, so re-equipping one slot leaves the others'
+            // scene graph untouched. Enchanted and light parts are always rebuilt
+            // to keep their glow updater and light tied to the current item.
+            PartInfo& info = mPartInfo[type];
+            if (mReleasedParts[type] != nullptr && !enchantedGlow && !isLight && !info.mEnchantedGlow && !info.mIsLight
+                && info.mMesh == mesh && info.mBone == bonename)
+            {
+                mObjectParts[type] = std::move(mReleasedParts[type]);
+                return true;
+            }
+
             mObjectParts[type] = insertBoundedPart(mesh, bonename, bonefilter, enchantedGlow, glowColor, isLight);
+            info = { mesh, std::string(bonename), enchantedGlow, isLight };
         }
         catch (std::exception& e)
         {
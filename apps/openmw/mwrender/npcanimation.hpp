@@ -49,6 +49,21 @@ namespace MWRender
         PartHolderPtr mObjectParts[ESM::PRT_Count];
         std::array<MWSound::Sound*, ESM::PRT_Count> mSounds;
 
+        // What each built part was created from, so updateParts can tell whether a
+        // released part can be reused as-is for a slot's new resolution.
+        struct PartInfo
+        {
+            std::string mMesh;
+            std::string mBone;
+            bool mEnchantedGlow = false;
+            bool mIsLight = false;
+        };
+        PartInfo mPartInfo[ESM::PRT_Count];
+
+        // Parts released from their slots during updateParts, kept aside for reuse
+        // instead of being destroyed up front.
+        PartHolderPtr mReleasedParts[ESM::PRT_Count];
+
         const ESM::NPC* mNpc;
         std::string mHeadModel;
         std::string mHairModel;
@@ -89,6 +104,11 @@ namespace MWRender
         void removeIndividualPart(ESM::PartReferenceType type);
         void reserveIndividualPart(ESM::PartReferenceType type, int group, int priority);
 
+        /// Moves all parts taken by the given slot into mReleasedParts for possible reuse.
+        void releasePartGroup(int group);
+        /// Destroys released parts that no slot reused.
+        void dropReleasedParts();
+
         bool addOrReplaceIndividualPart(ESM::PartReferenceType type, int group, int priority, const std::string& mesh,
             bool enchantedGlow = false, osg::Vec4f* glowColor = nullptr, bool isLight = false);
         void removePartGroup(int group);
@@ -1,5 +1,9 @@
 #include "objectpaging.hpp"
 
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
@@ -8,6 +12,7 @@
 #include <osg/MatrixTransform>
 #include <osg/Sequence>
 #include <osg/Switch>
+#include <osg/VertexAttribDivisor>
 #include <osgAnimation/BasicAnimationManager>
 #include <osgParticle/ParticleProcessor>
 #include <osgParticle/ParticleSystemUpdater>
@@ -20,6 +25,7 @@
 #include <components/esm3/loaddoor.hpp>
 #include <components/esm3/loadstat.hpp>
 #include <components/esm3/readerscache.hpp>
+#include <components/files/conversion.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/rng.hpp>
 #include <components/resource/scenemanager.hpp>
@@ -31,6 +37,7 @@
 #include <components/sceneutil/riggeometryosgaextension.hpp>
 #include <components/sceneutil/util.hpp>
 #include <components/settings/values.hpp>
+#include <components/shader/shadermanager.hpp>
 #include <components/vfs/manager.hpp>
 
 #include "apps/openmw/mwbase/environment.hpp"
@@ -429,6 +436,100 @@ namespace MWRender
             }
         };
 
+        // The smallest number of instances for which emitting an instanced template copy is
+        // considered worthwhile compared to merging or cloning the instances individually.
+        constexpr std::size_t sMinInstances = 4;
+
+        // Decides whether a template copy may be drawn with instanced arrays. The vertex shader
+        // applies the instance transform before the model-view matrix, so nothing between the
+        // chunk root and the geometry may transform or cull on a per-node basis.
+        class CanInstanceVisitor : public osg::NodeVisitor
+        {
+        public:
+            CanInstanceVisitor()
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            {
+            }
+
+            bool mEligible = true;
+
+            void apply(osg::Node& node) override
+            {
+                if (node.getCullCallback() != nullptr || node.getDataVariance() == osg::Object::DYNAMIC)
+                {
+                    mEligible = false;
+                    return;
+                }
+                traverse(node);
+            }
+            void apply(osg::Transform& node) override
+            {
+                const osg::MatrixTransform* transform = node.asMatrixTransform();
+                if (transform == nullptr || !transform->getMatrix().isIdentity())
+                {
+                    mEligible = false;
+                    return;
+                }
+                apply(static_cast<osg::Node&>(node));
+            }
+            void apply(osg::LOD& node) override { mEligible = false; }
+            void apply(osg::Drawable& node) override
+            {
+                if (node.asGeometry() == nullptr || node.getCullCallback() != nullptr)
+                    mEligible = false;
+            }
+        };
+
+        // Attaches per-instance transform arrays to every geometry of an instanced template copy,
+        // following the attribute convention established by the groundcover shaders.
+        class InstancingVisitor : public osg::NodeVisitor
+        {
+        public:
+            InstancingVisitor(const std::vector<const PagedCellRef*>& instances, const osg::Vec3f& chunkPosition)
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+                , mInstances(instances)
+                , mChunkPosition(chunkPosition)
+            {
+            }
+
+            void apply(osg::Geometry& geom) override
+            {
+                for (unsigned int i = 0; i < geom.getNumPrimitiveSets(); ++i)
+                    geom.getPrimitiveSet(i)->setNumInstances(mInstances.size());
+
+                // The geometry rotates around the model origin, so bound each instance by its
+                // largest possible extent under rotation.
+                const osg::BoundingBox localBox = geom.getBoundingBox();
+                float radius = 0.f;
+                for (unsigned int i = 0; i < 8; ++i)
+                    radius = std::max(radius, localBox.corner(i).length());
+
+                osg::ref_ptr<osg::Vec4Array> transforms = new osg::Vec4Array(mInstances.size());
+                osg::ref_ptr<osg::Vec3Array> rotations = new osg::Vec3Array(mInstances.size());
+                osg::BoundingBox box;
+                for (unsigned int i = 0; i < transforms->getNumElements(); ++i)
+                {
+                    const PagedCellRef& ref = *mInstances[i];
+                    const osg::Vec3f relativePos = ref.mPosition - mChunkPosition;
+                    (*transforms)[i] = osg::Vec4f(relativePos, ref.mScale);
+                    (*rotations)[i] = ref.mRotation;
+                    box.expandBy(osg::BoundingSphere(relativePos, radius * ref.mScale));
+                }
+                geom.setInitialBound(box);
+
+                // Display lists do not support instancing
+                geom.setUseDisplayList(false);
+                geom.setUseVertexBufferObjects(true);
+
+                geom.setVertexAttribArray(6, transforms.get(), osg::Array::BIND_PER_VERTEX);
+                geom.setVertexAttribArray(7, rotations.get(), osg::Array::BIND_PER_VERTEX);
+            }
+
+        private:
+            const std::vector<const PagedCellRef*>& mInstances;
+            osg::Vec3f mChunkPosition;
+        };
+
         class AddRefnumMarkerVisitor : public osg::NodeVisitor
         {
         public:
@@ -459,25 +560,172 @@ namespace MWRender
         , mMinSize(Settings::terrain().mObjectPagingMinSize)
         , mMinSizeMergeFactor(Settings::terrain().mObjectPagingMinSizeMergeFactor)
         , mMinSizeCostMultiplier(Settings::terrain().mObjectPagingMinSizeCostMultiplier)
+        // The shadow casting shader is unaware of instance transforms, so instancing must not be
+        // used while statics cast shadows (see RenderingManager's shadow cast mask).
+        , mInstancing(Settings::terrain().mObjectPagingInstancing
+              && !(Settings::shadows().mEnableShadows && Settings::shadows().mObjectShadows))
         , mRefTrackerLocked(false)
     {
+        if (mInstancing)
+        {
+            mInstancingStateset = new osg::StateSet;
+            mInstancingStateset->setAttribute(new osg::VertexAttribDivisor(6, 1));
+            mInstancingStateset->setAttribute(new osg::VertexAttribDivisor(7, 1));
+
+            mInstancingProgramTemplate = mSceneManager->getShaderManager().getProgramTemplate()
+                ? Shader::ShaderManager::cloneProgram(mSceneManager->getShaderManager().getProgramTemplate())
+                : osg::ref_ptr<osg::Program>(new osg::Program);
+            mInstancingProgramTemplate->addBindAttribLocation("aOffset", 6);
+            mInstancingProgramTemplate->addBindAttribLocation("aRotation", 7);
+        }
+    }
+
+    ObjectPaging::~ObjectPaging()
+    {
+        if (mCellRefsCacheDirty)
+            saveCellRefsCache();
     }
 
     namespace
     {
-        struct PagedCellRef
+        constexpr std::uint32_t sCellRefsCacheVersion = 1;
+        constexpr std::array<char, 4> sCellRefsCacheMagic{ 'O', 'M', 'W', 'P' };
+
+        void writeCacheString(std::ostream& stream, const std::string& value)
         {
-            ESM::RefId mRefId;
-            ESM::RefNum mRefNum;
-            osg::Vec3f mPosition;
-            osg::Vec3f mRotation;
-            float mScale;
-        };
+            const std::uint32_t length = static_cast<std::uint32_t>(value.size());
+            stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            stream.write(value.data(), length);
+        }
+
+        bool readCacheString(std::istream& stream, std::string& value)
+        {
+            std::uint32_t length = 0;
+            stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+            if (!stream || length > (1u << 20))
+                return false;
+            value.resize(length);
+            stream.read(value.data(), length);
+            return static_cast<bool>(stream);
+        }
+    }
+
+    void ObjectPaging::loadCellRefsCache(const MWWorld::ESMStore& store)
+    {
+        mCellRefsCacheLoaded = true;
+        mCellRefsCachePath = store.getCachePath("pagedrefs.cache");
+        mCellRefsCacheKey = store.getContentFilesKey();
+        if (mCellRefsCachePath.empty())
+            return;
+
+        std::ifstream stream(mCellRefsCachePath, std::ios::binary);
+        if (!stream)
+            return;
+
+        std::array<char, 4> magic;
+        std::uint32_t version = 0;
+        std::array<std::uint64_t, 2> key{ 0, 0 };
+        stream.read(magic.data(), magic.size());
+        stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+        stream.read(reinterpret_cast<char*>(key.data()), sizeof(key));
+        if (!stream || magic != sCellRefsCacheMagic || version != sCellRefsCacheVersion || key != mCellRefsCacheKey)
+            return;
+
+        CellRefsCache cache;
+        std::uint64_t cellsSize = 0;
+        stream.read(reinterpret_cast<char*>(&cellsSize), sizeof(cellsSize));
+        if (!stream)
+            return;
+        std::string id;
+        for (std::uint64_t i = 0; i < cellsSize; ++i)
+        {
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+            std::uint32_t refsCount = 0;
+            stream.read(reinterpret_cast<char*>(&x), sizeof(x));
+            stream.read(reinterpret_cast<char*>(&y), sizeof(y));
+            stream.read(reinterpret_cast<char*>(&refsCount), sizeof(refsCount));
+            if (!stream || refsCount > (1u << 24))
+                return;
+            std::vector<PagedCellRef>& refs = cache[std::make_pair(x, y)];
+            refs.resize(refsCount);
+            for (PagedCellRef& ref : refs)
+            {
+                if (!readCacheString(stream, id))
+                    return;
+                ref.mRefId = ESM::RefId::deserializeText(id);
+                stream.read(reinterpret_cast<char*>(&ref.mType), sizeof(ref.mType));
+                stream.read(reinterpret_cast<char*>(&ref.mRefNum.mIndex), sizeof(ref.mRefNum.mIndex));
+                stream.read(reinterpret_cast<char*>(&ref.mRefNum.mContentFile), sizeof(ref.mRefNum.mContentFile));
+                osg::Vec3f::value_type position[3];
+                stream.read(reinterpret_cast<char*>(position), sizeof(position));
+                ref.mPosition = osg::Vec3f(position[0], position[1], position[2]);
+                osg::Vec3f::value_type rotation[3];
+                stream.read(reinterpret_cast<char*>(rotation), sizeof(rotation));
+                ref.mRotation = osg::Vec3f(rotation[0], rotation[1], rotation[2]);
+                stream.read(reinterpret_cast<char*>(&ref.mScale), sizeof(ref.mScale));
+                if (!stream)
+                    return;
+            }
+        }
+
+        mCellRefsCache = std::move(cache);
+        Log(Debug::Info) << "Loaded paged references for " << mCellRefsCache.size() << " cells from cache";
+    }
 
-        PagedCellRef makePagedCellRef(const ESM::CellRef& value)
+    void ObjectPaging::saveCellRefsCache() const
+    {
+        if (mCellRefsCachePath.empty())
+            return;
+
+        std::ofstream stream(mCellRefsCachePath, std::ios::binary);
+        if (!stream)
+        {
+            Log(Debug::Warning) << "Failed to open paged references cache for writing: "
+                                << Files::pathToUnicodeString(mCellRefsCachePath);
+            return;
+        }
+
+        stream.write(sCellRefsCacheMagic.data(), sCellRefsCacheMagic.size());
+        stream.write(reinterpret_cast<const char*>(&sCellRefsCacheVersion), sizeof(sCellRefsCacheVersion));
+        stream.write(reinterpret_cast<const char*>(mCellRefsCacheKey.data()), sizeof(mCellRefsCacheKey));
+
+        const std::uint64_t cellsSize = mCellRefsCache.size();
+        stream.write(reinterpret_cast<const char*>(&cellsSize), sizeof(cellsSize));
+        for (const auto& [cellIndex, refs] : mCellRefsCache)
+        {
+            const std::int32_t x = cellIndex.first;
+            const std::int32_t y = cellIndex.second;
+            stream.write(reinterpret_cast<const char*>(&x), sizeof(x));
+            stream.write(reinterpret_cast<const char*>(&y), sizeof(y));
+            const std::uint32_t refsCount = static_cast<std::uint32_t>(refs.size());
+            stream.write(reinterpret_cast<const char*>(&refsCount), sizeof(refsCount));
+            for (const PagedCellRef& ref : refs)
+            {
+                writeCacheString(stream, ref.mRefId.serializeText());
+                stream.write(reinterpret_cast<const char*>(&ref.mType), sizeof(ref.mType));
+                stream.write(reinterpret_cast<const char*>(&ref.mRefNum.mIndex), sizeof(ref.mRefNum.mIndex));
+                stream.write(reinterpret_cast<const char*>(&ref.mRefNum.mContentFile), sizeof(ref.mRefNum.mContentFile));
+                const osg::Vec3f::value_type position[3]{ ref.mPosition.x(), ref.mPosition.y(), ref.mPosition.z() };
+                stream.write(reinterpret_cast<const char*>(position), sizeof(position));
+                const osg::Vec3f::value_type rotation[3]{ ref.mRotation.x(), ref.mRotation.y(), ref.mRotation.z() };
+                stream.write(reinterpret_cast<const char*>(rotation), sizeof(rotation));
+                stream.write(reinterpret_cast<const char*>(&ref.mScale), sizeof(ref.mScale));
+            }
+        }
+
+        if (!stream)
+            Log(Debug::Warning) << "Failed to write paged references cache: "
+                                << Files::pathToUnicodeString(mCellRefsCachePath);
+    }
+
+    namespace
+    {
+        PagedCellRef makePagedCellRef(const ESM::CellRef& value, int type)
         {
             return PagedCellRef{
                 .mRefId = value.mRefID,
+                .mType = type,
                 .mRefNum = value.mRefNum,
                 .mPosition = value.mPos.asVec3(),
                 .mRotation = value.mPos.asRotationVec3(),
@@ -485,73 +733,106 @@ namespace MWRender
             };
         }
 
-        std::map<ESM::RefNum, PagedCellRef> collectESM3References(
-            float size, const osg::Vec2i& startCell, const MWWorld::ESMStore& store)
+        // Collects the references of all pageable types from a cell with deletions applied.
+        // typeFilter(type, false) accepts a superset of typeFilter(type, true), so the result can
+        // be filtered down again for far chunks.
+        std::vector<PagedCellRef> parseCellRefs(const ESM::Cell& cell, const MWWorld::ESMStore& store)
         {
             std::map<ESM::RefNum, PagedCellRef> refs;
             ESM::ReadersCache readers;
-            for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
+            for (size_t i = 0; i < cell.mContextList.size(); ++i)
             {
-                for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
+                try
                 {
-                    const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
-                    if (!cell)
-                        continue;
-                    for (size_t i = 0; i < cell->mContextList.size(); ++i)
+                    const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                    const ESM::ReadersCache::BusyItem reader = readers.get(index);
+                    cell.restore(*reader, i);
+                    ESM::CellRef ref;
+                    ESM::MovedCellRef cMRef;
+                    bool deleted = false;
+                    bool moved = false;
+                    while (ESM::Cell::getNextRef(
+                        *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
                     {
-                        try
-                        {
-                            const std::size_t index = static_cast<std::size_t>(cell->mContextList[i].index);
-                            const ESM::ReadersCache::BusyItem reader = readers.get(index);
-                            cell->restore(*reader, i);
-                            ESM::CellRef ref;
-                            ESM::MovedCellRef cMRef;
-                            bool deleted = false;
-                            bool moved = false;
-                            while (ESM::Cell::getNextRef(
-                                *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                            {
-                                if (moved)
-                                    continue;
-
-                                if (std::find(cell->mMovedRefs.begin(), cell->mMovedRefs.end(), ref.mRefNum)
-                                    != cell->mMovedRefs.end())
-                                    continue;
-
-                                int type = store.findStatic(ref.mRefID);
-                                if (!typeFilter(type, size >= 2))
-                                    continue;
-                                if (deleted)
-                                {
-                                    refs.erase(ref.mRefNum);
-                                    continue;
-                                }
-                                refs.insert_or_assign(ref.mRefNum, makePagedCellRef(ref));
-                            }
-                        }
-                        catch (const std::exception& e)
-                        {
-                            Log(Debug::Warning) << "Failed to collect references from cell \"" << cell->getDescription()
-                                                << "\": " << e.what();
+                        if (moved)
+                            continue;
+
+                        if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum)
+                            != cell.mMovedRefs.end())
+                            continue;
+
+                        int type = store.findStatic(ref.mRefID);
+                        if (!typeFilter(type, false))
                             continue;
-                        }
-                    }
-                    for (const auto& [ref, deleted] : cell->mLeasedRefs)
-                    {
                         if (deleted)
                         {
                             refs.erase(ref.mRefNum);
                             continue;
                         }
-                        int type = store.findStatic(ref.mRefID);
-                        if (!typeFilter(type, size >= 2))
-                            continue;
-                        refs.insert_or_assign(ref.mRefNum, makePagedCellRef(ref));
+                        refs.insert_or_assign(ref.mRefNum, makePagedCellRef(ref, type));
                     }
                 }
+                catch (const std::exception& e)
+                {
+                    Log(Debug::Warning) << "Failed to collect references from cell \"" << cell.getDescription()
+                                        << "\": " << e.what();
+                    continue;
+                }
+            }
+            for (const auto& [ref, deleted] : cell.mLeasedRefs)
+            {
+                if (deleted)
+                {
+                    refs.erase(ref.mRefNum);
+                    continue;
+                }
+                int type = store.findStatic(ref.mRefID);
+                if (!typeFilter(type, false))
+                    continue;
+                refs.insert_or_assign(ref.mRefNum, makePagedCellRef(ref, type));
+            }
+            std::vector<PagedCellRef> result;
+            result.reserve(refs.size());
+            for (auto& [refNum, ref] : refs)
+                result.push_back(std::move(ref));
+            return result;
+        }
+    }
+
+    std::vector<PagedCellRef> ObjectPaging::getCellRefs(const osg::Vec2i& cellIndex, const MWWorld::ESMStore& store)
+    {
+        const std::pair<int, int> key(cellIndex.x(), cellIndex.y());
+        const std::lock_guard lock(mCellRefsCacheMutex);
+        if (!mCellRefsCacheLoaded)
+            loadCellRefsCache(store);
+        CellRefsCache::const_iterator found = mCellRefsCache.find(key);
+        if (found != mCellRefsCache.end())
+            return found->second;
+        std::vector<PagedCellRef>& refs = mCellRefsCache[key];
+        if (const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellIndex.x(), cellIndex.y()))
+            refs = parseCellRefs(*cell, store);
+        mCellRefsCacheDirty = true;
+        return refs;
+    }
+
+    std::map<ESM::RefNum, PagedCellRef> ObjectPaging::collectESM3References(
+        float size, const osg::Vec2i& startCell, const MWWorld::ESMStore& store)
+    {
+        std::map<ESM::RefNum, PagedCellRef> refs;
+        for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
+        {
+            for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
+            {
+                for (PagedCellRef& ref : getCellRefs(osg::Vec2i(cellX, cellY), store))
+                {
+                    if (!typeFilter(ref.mType, size >= 2))
+                        continue;
+                    const ESM::RefNum refNum = ref.mRefNum;
+                    refs.insert_or_assign(refNum, std::move(ref));
+                }
             }
-            return refs;
         }
+        return refs;
     }
 
     osg::ref_ptr<osg::Node> ObjectPaging::createChunk(float size, const osg::Vec2f& center, bool activeGrid,
@@ -638,7 +919,7 @@ namespace MWRender
             if (Misc::ResourceHelpers::isHiddenMarker(ref.mRefId))
                 continue;
 
-            const int type = store.findStatic(ref.mRefId);
+            const int type = ref.mType;
             std::string model = getModel(type, ref.mRefId, store);
             if (model.empty())
                 continue;
@@ -736,6 +1017,58 @@ namespace MWRender
             const float minSizeMergeFactor2 = (1 - factor2) * mMinSizeMergeFactor + factor2;
             const float minSizeMerged = minSizeMergeFactor2 > 0 ? mMinSize * minSizeMergeFactor2 : mMinSize;
 
+            if (mInstancing && !activeGrid)
+            {
+                std::vector<const PagedCellRef*> instances;
+                instances.reserve(pair.second.mInstances.size());
+                float minScale = std::numeric_limits<float>::max();
+                float maxScale = 0.f;
+                for (const PagedCellRef* refPtr : pair.second.mInstances)
+                {
+                    if (minSizeMerged != minSize
+                        && cnode->getBound().radius2() * refPtr->mScale * refPtr->mScale
+                            < (viewPoint - refPtr->mPosition).length2() * minSizeMerged * minSizeMerged)
+                        continue;
+                    minScale = std::min(minScale, refPtr->mScale);
+                    maxScale = std::max(maxScale, refPtr->mScale);
+                    instances.push_back(refPtr);
+                }
+                if (instances.size() >= sMinInstances)
+                {
+                    osg::ref_ptr<osg::Group> templateGroup = new osg::Group;
+                    // The instanced copy shares the template Arrays (see the comment below), but
+                    // primitive sets receive a per-chunk instance count and must not be shared.
+                    copyop.setCopyFlags(osg::CopyOp::DEEP_COPY_NODES | osg::CopyOp::DEEP_COPY_DRAWABLES
+                        | osg::CopyOp::DEEP_COPY_PRIMITIVES);
+                    copyop.mOptimizeBillboards = false;
+                    copyop.mDistances
+                        = LODRange{ smallestDistanceToChunk / maxScale, higherDistanceToChunk / minScale };
+                    copyop.mViewVector = (viewPoint - worldCenter);
+                    copyop.mNodePath.push_back(templateGroup);
+                    copyop.copy(cnode, templateGroup);
+                    copyop.mNodePath.pop_back();
+
+                    CanInstanceVisitor canInstance;
+                    templateGroup->accept(canInstance);
+                    if (canInstance.mEligible)
+                    {
+                        InstancingVisitor instancer(instances, worldCenter);
+                        templateGroup->accept(instancer);
+                        templateGroup->setStateSet(mInstancingStateset);
+                        mSceneManager->recreateShaders(templateGroup, "objects", true, mInstancingProgramTemplate);
+                        mSceneManager->shareState(templateGroup);
+                        group->addChild(templateGroup);
+                        templateRefs->addRef(cnode);
+                        if (pair.second.mNeedCompile)
+                        {
+                            stateToCompile._mode = osgUtil::GLObjectsVisitor::COMPILE_STATE_ATTRIBUTES;
+                            templateGroup->accept(stateToCompile);
+                        }
+                        continue;
+                    }
+                }
+            }
+
             unsigned int numinstances = 0;
             for (const PagedCellRef* refPtr : pair.second.mInstances)
             {
@@ -1,27 +1,51 @@
 #ifndef OPENMW_MWRENDER_OBJECTPAGING_H
 #define OPENMW_MWRENDER_OBJECTPAGING_H
 
+#include <osg/Program>
+#include <osg/StateSet>
+#include <osg/Vec3f>
+
+#include <components/esm/refid.hpp>
 #include <components/esm3/refnum.hpp>
 #include <components/resource/resourcemanager.hpp>
 #include <components/terrain/quadtreeworld.hpp>
 
+#include <array>
+#include <cstdint>
+#include <filesystem>
 #include <mutex>
+#include <vector>
 
 namespace Resource
 {
     class SceneManager;
 }
 
+namespace MWWorld
+{
+    class ESMStore;
+}
+
 namespace MWRender
 {
 
     typedef std::tuple<osg::Vec2f, float, bool> ChunkId; // Center, Size, ActiveGrid
 
+    struct PagedCellRef
+    {
+        ESM::RefId mRefId;
+        int mType = 0;
+        ESM::RefNum mRefNum;
+        osg::Vec3f mPosition;
+        osg::Vec3f mRotation;
+        float mScale = 1.f;
+    };
+
     class ObjectPaging : public Resource::GenericResourceManager<ChunkId>, public Terrain::QuadTreeWorld::ChunkManager
     {
     public:
         ObjectPaging(Resource::SceneManager* sceneManager, ESM::RefId worldspace);
-        ~ObjectPaging() = default;
+        ~ObjectPaging();
 
         osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags,
             bool activeGrid, const osg::Vec3f& viewPoint, bool compile) override;
@@ -55,6 +79,9 @@ namespace MWRender
         float mMinSize;
         float mMinSizeMergeFactor;
         float mMinSizeCostMultiplier;
+        bool mInstancing;
+        osg::ref_ptr<osg::StateSet> mInstancingStateset;
+        osg::ref_ptr<osg::Program> mInstancingProgramTemplate;
 
         std::mutex mRefTrackerMutex;
         struct RefTracker
@@ -81,6 +108,23 @@ namespace MWRender
         typedef std::pair<std::string, unsigned char> LODNameCacheKey; // Key: mesh name, lod level
         typedef std::map<LODNameCacheKey, std::string> LODNameCache; // Cache: key, mesh name to use
         LODNameCache mLODNameCache;
+
+        // Pageable references per cell, parsed from the content files on demand and persisted
+        // between sessions (keyed by the content files, see ESMStore::getContentFilesKey).
+        std::mutex mCellRefsCacheMutex;
+        typedef std::map<std::pair<int, int>, std::vector<PagedCellRef>> CellRefsCache;
+        CellRefsCache mCellRefsCache;
+        bool mCellRefsCacheLoaded = false;
+        bool mCellRefsCacheDirty = false;
+        std::filesystem::path mCellRefsCachePath;
+        std::array<std::uint64_t, 2> mCellRefsCacheKey{ 0, 0 };
+
+        std::vector<PagedCellRef> getCellRefs(const osg::Vec2i& cellIndex, const MWWorld::ESMStore& store);
+        void loadCellRefsCache(const MWWorld::ESMStore& store);
+        void saveCellRefsCache() const;
+
+        std::map<ESM::RefNum, PagedCellRef> collectESM3References(
+            float size, const osg::Vec2i& startCell, const MWWorld::ESMStore& store);
     };
 
     class RefnumMarker : public osg::Object
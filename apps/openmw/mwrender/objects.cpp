@@ -1,10 +1,16 @@
 #include "objects.hpp"
 
+#include <cstring>
+
 #include <osg/Group>
 #include <osg/UserDataContainer>
 
+#include <osgUtil/Optimizer>
+
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/strings/algorithm.hpp>
+#include <components/resource/resourcesystem.hpp>
+#include <components/resource/scenemanager.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/sceneutil/unrefqueue.hpp>
 
@@ -17,6 +23,23 @@
 #include "npcanimation.hpp"
 #include "vismask.hpp"
 
+namespace
+{
+    // The spatialize visitor only creates plain osg::Groups, so anything else is an
+    // object's own node and must not receive the callback.
+    void addCallbackToBlocks(osg::Group* group, osg::Callback* callback)
+    {
+        for (unsigned int i = 0; i < group->getNumChildren(); ++i)
+        {
+            osg::Group* child = group->getChild(i)->asGroup();
+            if (child == nullptr || std::strcmp(child->className(), "Group") != 0)
+                continue;
+            child->addCullCallback(callback);
+            addCallbackToBlocks(child, callback);
+        }
+    }
+}
+
 namespace MWRender
 {
 
@@ -32,12 +55,13 @@ namespace MWRender
     {
         mObjects.clear();
 
+        mCellStaticNodes.clear();
         for (CellMap::iterator iter = mCellSceneNodes.begin(); iter != mCellSceneNodes.end(); ++iter)
             iter->second->getParent(0)->removeChild(iter->second);
         mCellSceneNodes.clear();
     }
 
-    void Objects::insertBegin(const MWWorld::Ptr& ptr)
+    void Objects::insertBegin(const MWWorld::Ptr& ptr, bool isStatic)
     {
         assert(mObjects.find(ptr.mRef) == mObjects.end());
 
@@ -54,6 +78,21 @@ namespace MWRender
         else
             cellnode = found->second;
 
+        if (isStatic)
+        {
+            CellMap::iterator staticFound = mCellStaticNodes.find(ptr.getCell());
+            if (staticFound == mCellStaticNodes.end())
+            {
+                osg::ref_ptr<osg::Group> staticNode(new osg::Group);
+                staticNode->setName("Cell Static Root");
+                cellnode->addChild(staticNode);
+                cellnode = std::move(staticNode);
+                mCellStaticNodes[ptr.getCell()] = cellnode;
+            }
+            else
+                cellnode = staticFound->second;
+        }
+
         osg::ref_ptr<SceneUtil::PositionAttitudeTransform> insert(new SceneUtil::PositionAttitudeTransform);
         cellnode->addChild(insert);
 
@@ -73,8 +112,6 @@ namespace MWRender
 
     void Objects::insertModel(const MWWorld::Ptr& ptr, const std::string& mesh, bool allowLight)
     {
-        insertBegin(ptr);
-        ptr.getRefData().getBaseNode()->setNodeMask(Mask_Object);
         bool animated = ptr.getClass().useAnim();
         std::string animationMesh = mesh;
         if (animated && !mesh.empty())
@@ -84,6 +121,16 @@ namespace MWRender
                 animated = false;
         }
 
+        // Begin loading on the work queue while the scene node is set up; the animation's instancing
+        // below joins the load in flight.
+        if (!animationMesh.empty())
+            mResourceSystem->getSceneManager()->requestTemplate(animationMesh);
+
+        // Doors and animated objects change their transform or bounds after
+        // insertion, so only the rest goes into the spatialized static group.
+        insertBegin(ptr, !animated && !ptr.getClass().isDoor());
+        ptr.getRefData().getBaseNode()->setNodeMask(Mask_Object);
+
         osg::ref_ptr<ObjectAnimation> anim(
             new ObjectAnimation(ptr, animationMesh, mResourceSystem, animated, allowLight));
 
@@ -92,7 +139,7 @@ namespace MWRender
 
     void Objects::insertCreature(const MWWorld::Ptr& ptr, const std::string& mesh, bool weaponsShields)
     {
-        insertBegin(ptr);
+        insertBegin(ptr, false);
         ptr.getRefData().getBaseNode()->setNodeMask(Mask_Actor);
 
         bool animated = true;
@@ -114,7 +161,7 @@ namespace MWRender
 
     void Objects::insertNPC(const MWWorld::Ptr& ptr)
     {
-        insertBegin(ptr);
+        insertBegin(ptr, false);
         ptr.getRefData().getBaseNode()->setNodeMask(Mask_Actor);
 
         if (ptr.getType() == ESM::REC_NPC_4)
@@ -186,6 +233,7 @@ namespace MWRender
                 ++iter;
         }
 
+        mCellStaticNodes.erase(store);
         CellMap::iterator cell = mCellSceneNodes.find(store);
         if (cell != mCellSceneNodes.end())
         {
@@ -194,6 +242,32 @@ namespace MWRender
         }
     }
 
+    void Objects::spatializeCell(const MWWorld::CellStore* store, osg::Callback* occlusionCullCallback)
+    {
+        CellMap::iterator found = mCellStaticNodes.find(store);
+        if (found == mCellStaticNodes.end())
+            return;
+
+        // Recursively split the flat list of statics into a grid of child groups, so
+        // cull can reject a whole block on its combined bound. Calling divide() on the
+        // group directly (rather than accept()ing the visitor) keeps the subdivision
+        // from descending into the objects' own scene graphs. Objects moved later by
+        // scripts merely dirty their block's bound; correctness does not depend on the
+        // partition staying tight.
+        static const unsigned int maxObjectsPerBlock = 16;
+        osgUtil::Optimizer::SpatializeGroupsVisitor visitor;
+        visitor.divide(found->second.get(), maxObjectsPerBlock);
+
+        if (occlusionCullCallback != nullptr)
+            addCallbackToBlocks(found->second.get(), occlusionCullCallback);
+    }
+
+    osg::Group* Objects::getStaticRoot(const MWWorld::CellStore* store) const
+    {
+        CellMap::const_iterator found = mCellStaticNodes.find(store);
+        return found != mCellStaticNodes.end() ? found->second.get() : nullptr;
+    }
+
     void Objects::updatePtr(const MWWorld::Ptr& old, const MWWorld::Ptr& cur)
     {
         osg::ref_ptr<osg::Node> objectNode = cur.getRefData().getBaseNode();
@@ -11,6 +11,7 @@
 
 namespace osg
 {
+    class Callback;
     class Group;
 }
 
@@ -60,12 +61,16 @@ namespace MWRender
 
         typedef std::map<const MWWorld::CellStore*, osg::ref_ptr<osg::Group>> CellMap;
         CellMap mCellSceneNodes;
+        // Never-moving objects are parented under a separate subgroup per cell so
+        // spatializeCell can subdivide them into coarse cullable blocks without
+        // touching actors and doors.
+        CellMap mCellStaticNodes;
         PtrAnimationMap mObjects;
         osg::ref_ptr<osg::Group> mRootNode;
         Resource::ResourceSystem* mResourceSystem;
         SceneUtil::UnrefQueue& mUnrefQueue;
 
-        void insertBegin(const MWWorld::Ptr& ptr);
+        void insertBegin(const MWWorld::Ptr& ptr, bool isStatic);
 
     public:
         Objects(Resource::ResourceSystem* resourceSystem, const osg::ref_ptr<osg::Group>& rootNode,
@@ -86,6 +91,16 @@ namespace MWRender
 
         void removeCell(const MWWorld::CellStore* store);
 
+        /// Subdivides the cell's static objects into spatial blocks so cull traversal
+        /// can reject them in groups instead of testing each object's bound. Call once
+        /// the cell's objects have been inserted; objects added later stay unpartitioned.
+        /// If @a occlusionCullCallback is given, it is attached to every block as a cull
+        /// callback so occlusion culling can test block bounds.
+        void spatializeCell(const MWWorld::CellStore* store, osg::Callback* occlusionCullCallback = nullptr);
+
+        /// The subgroup holding the cell's never-moving objects, or null if there are none.
+        osg::Group* getStaticRoot(const MWWorld::CellStore* store) const;
+
         /// Updates containing cell for object rendering data
         void updatePtr(const MWWorld::Ptr& old, const MWWorld::Ptr& cur);
 
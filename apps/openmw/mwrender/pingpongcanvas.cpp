@@ -70,6 +70,14 @@ namespace MWRender
         fbo->setAttachment(component, Stereo::createMultiviewCompatibleAttachment(clone));
     }
 
+    static void setTextureAttributeIfChanged(osg::StateSet* stateset, int unit, osg::Texture* tex)
+    {
+        // The ping-pong sequence is deterministic, so after the first frame these assignments
+        // rarely change. Mutating statesets from the draw thread is not free, skip the no-ops.
+        if (stateset->getTextureAttribute(unit, osg::StateAttribute::TEXTURE) != tex)
+            stateset->setTextureAttribute(unit, tex);
+    }
+
     void PingPongCanvas::drawImplementation(osg::RenderInfo& renderInfo) const
     {
         osg::State& state = *renderInfo.getState();
@@ -235,18 +243,19 @@ namespace MWRender
         {
             const auto& node = mPasses[index];
 
-            node.mRootStateSet->setTextureAttribute(PostProcessor::Unit_Depth, mTextureDepth);
+            setTextureAttributeIfChanged(node.mRootStateSet, PostProcessor::Unit_Depth, mTextureDepth);
 
             if (mAvgLum)
-                node.mRootStateSet->setTextureAttribute(PostProcessor::TextureUnits::Unit_EyeAdaptation,
+                setTextureAttributeIfChanged(node.mRootStateSet, PostProcessor::TextureUnits::Unit_EyeAdaptation,
                     mLuminanceCalculator->getLuminanceTexture(frameId));
 
             if (mTextureNormals)
-                node.mRootStateSet->setTextureAttribute(PostProcessor::TextureUnits::Unit_Normals, mTextureNormals);
+                setTextureAttributeIfChanged(
+                    node.mRootStateSet, PostProcessor::TextureUnits::Unit_Normals, mTextureNormals);
 
             if (mTextureDistortion)
-                node.mRootStateSet->setTextureAttribute(
-                    PostProcessor::TextureUnits::Unit_Distortion, mTextureDistortion);
+                setTextureAttributeIfChanged(
+                    node.mRootStateSet, PostProcessor::TextureUnits::Unit_Distortion, mTextureDistortion);
 
             state.pushStateSet(node.mRootStateSet);
             state.apply();
@@ -261,17 +270,17 @@ namespace MWRender
 
                 // VR-TODO: This won't actually work for tex2darrays
                 if (lastShader == 0)
-                    pass.mStateSet->setTextureAttribute(PostProcessor::Unit_LastShader, mTextureScene);
+                    setTextureAttributeIfChanged(pass.mStateSet, PostProcessor::Unit_LastShader, mTextureScene);
                 else
-                    pass.mStateSet->setTextureAttribute(PostProcessor::Unit_LastShader,
+                    setTextureAttributeIfChanged(pass.mStateSet, PostProcessor::Unit_LastShader,
                         (osg::Texture*)mFbos[lastShader - GL_COLOR_ATTACHMENT0_EXT]
                             ->getAttachment(osg::Camera::COLOR_BUFFER0)
                             .getTexture());
 
                 if (lastDraw == 0)
-                    pass.mStateSet->setTextureAttribute(PostProcessor::Unit_LastPass, mTextureScene);
+                    setTextureAttributeIfChanged(pass.mStateSet, PostProcessor::Unit_LastPass, mTextureScene);
                 else
-                    pass.mStateSet->setTextureAttribute(PostProcessor::Unit_LastPass,
+                    setTextureAttributeIfChanged(pass.mStateSet, PostProcessor::Unit_LastPass,
                         (osg::Texture*)mFbos[lastDraw - GL_COLOR_ATTACHMENT0_EXT]
                             ->getAttachment(osg::Camera::COLOR_BUFFER0)
                             .getTexture());
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <chrono>
 #include <thread>
+#include <unordered_map>
 
 #include <osg/Texture1D>
 #include <osg/Texture2D>
@@ -35,6 +36,7 @@
 #include "renderbin.hpp"
 #include "renderingmanager.hpp"
 #include "sky.hpp"
+#include "depthprepass.hpp"
 #include "transparentpass.hpp"
 #include "vismask.hpp"
 
@@ -153,6 +155,16 @@ namespace MWRender
                 Settings::postProcessing().mTransparentPostpass);
         osgUtil::RenderBin::getRenderBinPrototype("DepthSortedBin")->setDrawCallback(mTransparentDepthPostPass);
 
+        if (Settings::shaders().mDepthPrepass)
+        {
+            // Draws the opaque scene depth-only before shading it with an equal
+            // depth test; RenderingManager routes the scene root into this bin.
+            mOpaquePrePass = new OpaqueDepthPrePassCallback(shaderManager);
+            osg::ref_ptr<osgUtil::RenderBin> opaqueBin = new osgUtil::RenderBin(osgUtil::RenderBin::SORT_BY_STATE);
+            opaqueBin->setDrawCallback(mOpaquePrePass);
+            osgUtil::RenderBin::addRenderBinPrototype("OpaqueBin", opaqueBin);
+        }
+
         osg::ref_ptr<osgUtil::RenderBin> distortionRenderBin
             = new osgUtil::RenderBin(osgUtil::RenderBin::SORT_BACK_TO_FRONT);
         // This is silly to have to do, but if nothing is drawn then the drawcallback is never called and the distortion
@@ -308,6 +320,12 @@ namespace MWRender
         mTransparentDepthPostPass->mMsaaFbo[frameId] = mFbos[frameId][FBO_Multisample];
         mTransparentDepthPostPass->mOpaqueFbo[frameId] = mFbos[frameId][FBO_OpaqueDepth];
 
+        if (mOpaquePrePass)
+        {
+            mOpaquePrePass->mFbo[frameId] = mFbos[frameId][FBO_Primary];
+            mOpaquePrePass->mMsaaFbo[frameId] = mFbos[frameId][FBO_Multisample];
+        }
+
         mDistortionCallback->setFBO(mFbos[frameId][FBO_Distortion], frameId);
         mDistortionCallback->setOriginalFBO(mFbos[frameId][FBO_Primary], frameId);
 
@@ -566,6 +584,10 @@ namespace MWRender
 
         std::vector<fx::Types::RenderTarget> attachmentsToDirty;
 
+        // Passes rendering to the same target can share one FBO instead of wrapping the texture anew
+        // for every pass, which keeps the number of GL framebuffers independent of the chain length.
+        std::unordered_map<osg::Texture2D*, osg::ref_ptr<osg::FrameBufferObject>> renderTargetFbos;
+
         for (const auto& technique : mTechniques)
         {
             if (!technique || !technique->isValid())
@@ -578,6 +600,11 @@ namespace MWRender
                 continue;
             }
 
+            // Pass sources are assembled on first use here, so techniques that are merely browsed
+            // in the HUD stay parse-only
+            if (!technique->compilePasses())
+                continue;
+
             fx::DispatchNode node;
 
             node.mFlags = technique->getFlags();
@@ -650,9 +677,14 @@ namespace MWRender
                     subPass.mRenderTexture = renderTarget.mTarget;
                     subPass.mMipMap = renderTarget.mMipMap;
 
-                    subPass.mRenderTarget = new osg::FrameBufferObject;
-                    subPass.mRenderTarget->setAttachment(osg::FrameBufferObject::BufferComponent::COLOR_BUFFER0,
-                        osg::FrameBufferAttachment(subPass.mRenderTexture));
+                    osg::ref_ptr<osg::FrameBufferObject>& fbo = renderTargetFbos[renderTarget.mTarget];
+                    if (!fbo)
+                    {
+                        fbo = new osg::FrameBufferObject;
+                        fbo->setAttachment(osg::FrameBufferObject::BufferComponent::COLOR_BUFFER0,
+                            osg::FrameBufferAttachment(subPass.mRenderTexture));
+                    }
+                    subPass.mRenderTarget = fbo;
 
                     const auto [w, h] = renderTarget.mSize.get(renderWidth(), renderHeight());
                     subPass.mStateSet->setAttributeAndModes(new osg::Viewport(0, 0, w, h));
@@ -49,6 +49,7 @@ namespace MWRender
     class RenderingManager;
     class PingPongCull;
     class PingPongCanvas;
+    class OpaqueDepthPrePassCallback;
     class TransparentDepthBinCallback;
     class DistortionCallback;
 
@@ -263,6 +264,7 @@ namespace MWRender
         osg::ref_ptr<PingPongCull> mPingPongCull;
         std::array<osg::ref_ptr<PingPongCanvas>, 2> mCanvases;
         osg::ref_ptr<TransparentDepthBinCallback> mTransparentDepthPostPass;
+        osg::ref_ptr<OpaqueDepthPrePassCallback> mOpaquePrePass;
         osg::ref_ptr<DistortionCallback> mDistortionCallback;
 
         fx::DispatchArray mTemplateData;
@@ -1,6 +1,7 @@
 #include "precipitationocclusion.hpp"
 
 #include <cassert>
+#include <cmath>
 
 #include <osgUtil/CullVisitor>
 
@@ -22,8 +23,9 @@ namespace
     class PrecipitationOcclusionUpdater : public SceneUtil::StateSetUpdater
     {
     public:
-        PrecipitationOcclusionUpdater(osg::ref_ptr<osg::Texture2D> depthTexture)
+        PrecipitationOcclusionUpdater(osg::ref_ptr<osg::Texture2D> depthTexture, osg::ref_ptr<osg::Camera> depthCamera)
             : mDepthTexture(std::move(depthTexture))
+            , mDepthCamera(std::move(depthCamera))
         {
         }
 
@@ -32,16 +34,18 @@ namespace
         {
             stateset->setTextureAttributeAndModes(3, mDepthTexture);
             stateset->addUniform(new osg::Uniform("orthoDepthMap", 3));
-            stateset->addUniform(new osg::Uniform("depthSpaceMatrix", mDepthSpaceMatrix));
+            stateset->addUniform(new osg::Uniform("depthSpaceMatrix", osg::Matrixf()));
         }
         void apply(osg::StateSet* stateset, osg::NodeVisitor* nv) override
         {
-            osg::Camera* camera = nv->asCullVisitor()->getCurrentCamera();
-            stateset->getUniform("depthSpaceMatrix")->set(camera->getViewMatrix() * camera->getProjectionMatrix());
+            // Sample with the matrices the map was rendered with, which may be several frames
+            // old if the depth camera is currently frozen.
+            stateset->getUniform("depthSpaceMatrix")
+                ->set(mDepthCamera->getViewMatrix() * mDepthCamera->getProjectionMatrix());
         }
 
-        osg::Matrixf mDepthSpaceMatrix;
         osg::ref_ptr<osg::Texture2D> mDepthTexture;
+        osg::ref_ptr<osg::Camera> mDepthCamera;
     };
 
     class DepthCameraUpdater : public SceneUtil::StateSetUpdater
@@ -125,16 +129,31 @@ namespace MWRender
         if (!mRange.has_value())
             return;
 
+        // The depth camera is snapped to a coarse grid and the ortho bounds are padded by the
+        // snap distance, so the map stays valid while the scene camera moves within a grid tile.
+        // The map is only re-rendered when the snapped position or the precipitation range
+        // changes, or when the scene itself changed (see sceneChanged()); the camera is frozen
+        // by clearing its node mask otherwise.
+        constexpr float snapSize = Constants::CellSizeInUnits / 16.f;
+
         const osg::Vec3 pos = mSceneCamera->getInverseViewMatrix().getTrans();
+        const osg::Vec3 center(std::round(pos.x() / snapSize) * snapSize, std::round(pos.y() / snapSize) * snapSize,
+            std::round(pos.z() / snapSize) * snapSize);
+
+        if (mRenderedCenter == center && mRenderedRange == mRange)
+        {
+            mCamera->setNodeMask(0);
+            return;
+        }
 
-        const float zmin = pos.z() - mRange->z() - Constants::CellSizeInUnits;
-        const float zmax = pos.z() + mRange->z() + Constants::CellSizeInUnits;
+        const float zmin = center.z() - mRange->z() - Constants::CellSizeInUnits;
+        const float zmax = center.z() + mRange->z() + Constants::CellSizeInUnits;
         const float near = 0;
         const float far = zmax - zmin;
 
-        const float left = -mRange->x() / 2;
+        const float left = -(mRange->x() + snapSize) / 2;
         const float right = -left;
-        const float top = mRange->y() / 2;
+        const float top = (mRange->y() + snapSize) / 2;
         const float bottom = -top;
 
         if (SceneUtil::AutoDepth::isReversed())
@@ -148,17 +167,22 @@ namespace MWRender
         }
 
         mCamera->setViewMatrixAsLookAt(
-            osg::Vec3(pos.x(), pos.y(), zmax), osg::Vec3(pos.x(), pos.y(), zmin), osg::Vec3(0, 1, 0));
+            osg::Vec3(center.x(), center.y(), zmax), osg::Vec3(center.x(), center.y(), zmin), osg::Vec3(0, 1, 0));
+        mCamera->setNodeMask(Mask_RenderToTexture);
+
+        mRenderedCenter = center;
+        mRenderedRange = mRange;
     }
 
     void PrecipitationOccluder::enable()
     {
-        mSkyCullCallback = new PrecipitationOcclusionUpdater(mDepthTexture);
+        mSkyCullCallback = new PrecipitationOcclusionUpdater(mDepthTexture, mCamera);
         mSkyNode->addCullCallback(mSkyCullCallback);
         mCamera->setCullCallback(new DepthCameraUpdater);
 
         mRootNode->removeChild(mCamera);
         mRootNode->addChild(mCamera);
+        mRenderedCenter = std::nullopt;
     }
 
     void PrecipitationOccluder::disable()
@@ -169,6 +193,7 @@ namespace MWRender
 
         mRootNode->removeChild(mCamera);
         mRange = std::nullopt;
+        mRenderedCenter = std::nullopt;
     }
 
     void PrecipitationOccluder::updateRange(const osg::Vec3f range)
@@ -179,4 +204,9 @@ namespace MWRender
         const osg::Vec3f margin = { -50, -50, 0 };
         mRange = range - margin;
     }
+
+    void PrecipitationOccluder::sceneChanged()
+    {
+        mRenderedCenter = std::nullopt;
+    }
 }
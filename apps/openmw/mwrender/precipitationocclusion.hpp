@@ -21,6 +21,10 @@ namespace MWRender
 
         void updateRange(const osg::Vec3f range);
 
+        /// Marks the occlusion depth map as stale so it is re-rendered on the next update(),
+        /// e.g. because cells were loaded or unloaded under the occlusion camera.
+        void sceneChanged();
+
     private:
         osg::Group* mSkyNode;
         osg::Group* mSceneNode;
@@ -30,6 +34,8 @@ namespace MWRender
         osg::ref_ptr<osg::Camera> mSceneCamera;
         osg::ref_ptr<osg::Texture2D> mDepthTexture;
         std::optional<osg::Vec3f> mRange;
+        std::optional<osg::Vec3f> mRenderedCenter;
+        std::optional<osg::Vec3f> mRenderedRange;
     };
 }
 
@@ -80,8 +80,10 @@
 #include "pathgrid.hpp"
 #include "postprocessor.hpp"
 #include "recastmesh.hpp"
+#include "renderbin.hpp"
 #include "screenshotmanager.hpp"
 #include "sky.hpp"
+#include "softwareocclusion.hpp"
 #include "terrainstorage.hpp"
 #include "util.hpp"
 #include "vismask.hpp"
@@ -89,6 +91,23 @@
 
 namespace MWRender
 {
+    class TerrainOcclusionTestCallback final : public Terrain::QuadTreeWorld::OcclusionTestCallback
+    {
+    public:
+        explicit TerrainOcclusionTestCallback(SoftwareOcclusion* occlusion)
+            : mOcclusion(occlusion)
+        {
+        }
+
+        bool isOccluded(osgUtil::CullVisitor* cv, const osg::BoundingSphere& bound) override
+        {
+            return mOcclusion->isOccluded(cv, bound);
+        }
+
+    private:
+        SoftwareOcclusion* mOcclusion;
+    };
+
     class PerViewUniformStateUpdater final : public SceneUtil::StateSetUpdater
     {
     public:
@@ -410,6 +429,13 @@ namespace MWRender
         sceneRoot->setNodeMask(Mask_Scene);
         sceneRoot->setName("Scene Root");
 
+        if (Settings::shaders().mDepthPrepass)
+        {
+            // Route everything that doesn't pick its own render bin into the named
+            // opaque bin the postprocessor registers a depth prepass callback for.
+            sceneRoot->getOrCreateStateSet()->setRenderBinDetails(RenderBin_Default, "OpaqueBin");
+        }
+
         int shadowCastingTraversalMask = Mask_Scene;
         if (Settings::shadows().mActorShadows)
             shadowCastingTraversalMask |= Mask_Actor;
@@ -470,6 +496,12 @@ namespace MWRender
 
         mObjects = std::make_unique<Objects>(mResourceSystem, sceneRoot, unrefQueue);
 
+        if (Settings::camera().mSoftwareOcclusionCulling)
+        {
+            mSoftwareOcclusion = std::make_unique<SoftwareOcclusion>(mViewer->getCamera());
+            mOcclusionCullCallback = new OcclusionCullCallback(mSoftwareOcclusion.get());
+        }
+
         if (getenv("OPENMW_DONT_PRECOMPILE") == nullptr)
         {
             mViewer->setIncrementalCompileOperation(new osgUtil::IncrementalCompileOperation);
@@ -774,6 +806,13 @@ namespace MWRender
     void RenderingManager::addCell(const MWWorld::CellStore* store)
     {
         mPathgrid->addCell(store);
+        mObjects->spatializeCell(store, mOcclusionCullCallback.get());
+        if (mSoftwareOcclusion)
+        {
+            if (osg::Group* staticRoot = mObjects->getStaticRoot(store))
+                mSoftwareOcclusion->addCellOccluders(store, staticRoot);
+        }
+        mSky->sceneChanged();
 
         mWater->changeCell(store);
 
@@ -788,6 +827,9 @@ namespace MWRender
         mPathgrid->removeCell(store);
         mActorsPaths->removeCell(store);
         mObjects->removeCell(store);
+        if (mSoftwareOcclusion)
+            mSoftwareOcclusion->removeCell(store);
+        mSky->sceneChanged();
 
         if (store->getCell()->isExterior())
         {
@@ -1490,6 +1532,9 @@ namespace MWRender
                 quadTreeWorld->addChunkManager(newChunkMgr.mGroundcover.get());
                 mResourceSystem->addResourceManager(newChunkMgr.mGroundcover.get());
             }
+            if (mSoftwareOcclusion)
+                quadTreeWorld->setOcclusionTestCallback(
+                    new TerrainOcclusionTestCallback(mSoftwareOcclusion.get()));
             newChunkMgr.mTerrain = std::move(quadTreeWorld);
         }
         else
@@ -1511,6 +1556,8 @@ namespace MWRender
         {
             mTerrain->reportStats(frameNumber, stats);
         }
+        if (mSoftwareOcclusion)
+            mSoftwareOcclusion->reportStats(frameNumber, stats);
     }
 
     void RenderingManager::processChangedSettings(const Settings::CategorySettingVector& changed)
@@ -106,6 +106,8 @@ namespace MWRender
     class ObjectPaging;
     class Groundcover;
     class PostProcessor;
+    class SoftwareOcclusion;
+    class OcclusionCullCallback;
 
     class RenderingManager : public MWRender::RenderingInterface
     {
@@ -321,6 +323,8 @@ namespace MWRender
         std::unique_ptr<RecastMesh> mRecastMesh;
         std::unique_ptr<Pathgrid> mPathgrid;
         std::unique_ptr<Objects> mObjects;
+        std::unique_ptr<SoftwareOcclusion> mSoftwareOcclusion;
+        osg::ref_ptr<OcclusionCullCallback> mOcclusionCullCallback;
         std::unique_ptr<Water> mWater;
         std::unordered_map<ESM::RefId, WorldspaceChunkMgr> mWorldspaceChunks;
         Terrain::World* mTerrain;
@@ -106,7 +106,12 @@ namespace MWRender
 
     RippleSimulation::RippleSimulation(osg::Group* parent, Resource::ResourceSystem* resourceSystem)
         : mParent(parent)
+        , mResourceSystem(resourceSystem)
         , mMaxNumberRipples(Fallback::Map::getInt("Water_MaxNumberRipples"))
+    {
+    }
+
+    void RippleSimulation::createParticleSystem()
     {
         mParticleSystem = new osgParticle::ParticleSystem;
 
@@ -126,20 +131,36 @@ namespace MWRender
 
         mParticleNode = new osg::PositionAttitudeTransform;
         mParticleNode->setName("Ripple Root");
+        mParticleNode->setPosition(osg::Vec3f(0, 0, mWaterHeight));
         mParticleNode->addChild(updater);
         mParticleNode->addChild(mParticleSystem);
         mParticleNode->setNodeMask(Mask_Water);
 
-        createWaterRippleStateSet(resourceSystem, mParticleNode);
+        createWaterRippleStateSet(mResourceSystem, mParticleNode);
 
-        resourceSystem->getSceneManager()->recreateShaders(mParticleNode);
+        mResourceSystem->getSceneManager()->recreateShaders(mParticleNode);
 
         mParent->addChild(mParticleNode);
     }
 
+    void RippleSimulation::destroyParticleSystem()
+    {
+        if (mParticleNode)
+            mParent->removeChild(mParticleNode);
+        mParticleNode = nullptr;
+        mParticleSystem = nullptr;
+    }
+
     RippleSimulation::~RippleSimulation()
     {
-        mParent->removeChild(mParticleNode);
+        destroyParticleSystem();
+    }
+
+    void RippleSimulation::setRipples(Ripples* ripples)
+    {
+        mRipples = ripples;
+        if (mRipples)
+            destroyParticleSystem();
     }
 
     void RippleSimulation::update(float dt)
@@ -169,7 +190,7 @@ namespace MWRender
             {
                 // Ripple simulation needs to continously apply impulses to keep simulation alive.
                 // Adding a timer delay will introduce many smaller ripples around actor instead of a smooth wake
-                currentPos.z() = mParticleNode->getPosition().z();
+                currentPos.z() = mWaterHeight;
                 emitRipple(currentPos);
             }
             else if (emitter.mTimer <= 0.f || (currentPos - emitter.mLastEmitPosition).length() > 10)
@@ -177,7 +198,7 @@ namespace MWRender
                 emitter.mLastEmitPosition = currentPos;
                 emitter.mTimer = 1.5f;
 
-                currentPos.z() = mParticleNode->getPosition().z();
+                currentPos.z() = mWaterHeight;
 
                 emitRipple(currentPos);
             }
@@ -234,7 +255,7 @@ namespace MWRender
 
     void RippleSimulation::emitRipple(const osg::Vec3f& pos)
     {
-        if (std::abs(pos.z() - mParticleNode->getPosition().z()) < 20)
+        if (std::abs(pos.z() - mWaterHeight) < 20)
         {
             if (mRipples)
             {
@@ -246,6 +267,9 @@ namespace MWRender
                 if (mMaxNumberRipples <= 0)
                     return;
 
+                if (!mParticleSystem)
+                    createParticleSystem();
+
                 osgParticle::ParticleSystem::ScopedWriteLock lock(*mParticleSystem->getReadWriteMutex());
                 if (mParticleSystem->numParticles() - mParticleSystem->numDeadParticles() > mMaxNumberRipples)
                 {
@@ -265,11 +289,16 @@ namespace MWRender
 
     void RippleSimulation::setWaterHeight(float height)
     {
-        mParticleNode->setPosition(osg::Vec3f(0, 0, height));
+        mWaterHeight = height;
+        if (mParticleNode)
+            mParticleNode->setPosition(osg::Vec3f(0, 0, height));
     }
 
     void RippleSimulation::clear()
     {
+        if (!mParticleSystem)
+            return;
+
         for (int i = 0; i < mParticleSystem->numParticles(); ++i)
             mParticleSystem->destroyParticle(i);
     }
@@ -63,11 +63,18 @@ namespace MWRender
         /// Remove all active ripples
         void clear();
 
-        void setRipples(Ripples* ripples) { mRipples = ripples; }
+        /// While a GPU simulation is set, all ripples are routed to it and the CPU particle
+        /// fallback is torn down so it doesn't get updated and drawn empty every frame.
+        void setRipples(Ripples* ripples);
 
     private:
+        void createParticleSystem();
+        void destroyParticleSystem();
+
         osg::ref_ptr<osg::Group> mParent;
 
+        Resource::ResourceSystem* mResourceSystem;
+
         osg::ref_ptr<osgParticle::ParticleSystem> mParticleSystem;
         osg::ref_ptr<osg::PositionAttitudeTransform> mParticleNode;
 
@@ -75,6 +82,8 @@ namespace MWRender
 
         Ripples* mRipples = nullptr;
 
+        float mWaterHeight = 0.f;
+
         int mMaxNumberRipples;
     };
 
@@ -1,5 +1,7 @@
 #include "sky.hpp"
 
+#include <cmath>
+
 #include <osg/Depth>
 #include <osg/PositionAttitudeTransform>
 
@@ -62,39 +64,42 @@ namespace
         {
             osg::Vec3 position = getCameraPosition();
             osg::Vec3 positionDifference = position - mPreviousCameraPosition;
+            mPreviousCameraPosition = position;
 
             osg::Matrix toWorld, toLocal;
+            bool identity = true;
 
             std::vector<osg::Matrix> worldMatrices = ps->getWorldMatrices();
 
             if (!worldMatrices.empty())
             {
                 toWorld = worldMatrices[0];
-                toLocal.invert(toWorld);
+                identity = toWorld.isIdentity();
+                if (!identity)
+                    toLocal.invert(toWorld);
             }
 
-            for (int i = 0; i < ps->numParticles(); ++i)
+            // This loop runs over every raindrop or snowflake each frame, keep it lean.
+            const int numParticles = ps->numParticles();
+            for (int i = 0; i < numParticles; ++i)
             {
                 osgParticle::Particle* p = ps->getParticle(i);
-                p->setPosition(toWorld.preMult(p->getPosition()));
-                p->setPosition(p->getPosition() - positionDifference);
+                if (!p->isAlive())
+                    continue;
+
+                osg::Vec3 pos = identity ? p->getPosition() : toWorld.preMult(p->getPosition());
+                pos -= positionDifference;
 
                 for (int j = 0; j < 3; ++j) // wrap-around in all 3 dimensions
                 {
-                    osg::Vec3 pos = p->getPosition();
-
                     if (pos[j] < -mHalfWrapRange[j])
-                        pos[j] = mHalfWrapRange[j] + fmod(pos[j] - mHalfWrapRange[j], mWrapRange[j]);
+                        pos[j] = mHalfWrapRange[j] + std::fmod(pos[j] - mHalfWrapRange[j], mWrapRange[j]);
                     else if (pos[j] > mHalfWrapRange[j])
-                        pos[j] = fmod(pos[j] + mHalfWrapRange[j], mWrapRange[j]) - mHalfWrapRange[j];
-
-                    p->setPosition(pos);
+                        pos[j] = std::fmod(pos[j] + mHalfWrapRange[j], mWrapRange[j]) - mHalfWrapRange[j];
                 }
 
-                p->setPosition(toLocal.preMult(p->getPosition()));
+                p->setPosition(identity ? pos : toLocal.preMult(pos));
             }
-
-            mPreviousCameraPosition = position;
         }
 
     protected:
@@ -592,6 +597,11 @@ namespace MWRender
         mPrecipitationOccluder->update();
     }
 
+    void SkyManager::sceneChanged()
+    {
+        mPrecipitationOccluder->sceneChanged();
+    }
+
     void SkyManager::setEnabled(bool enabled)
     {
         if (enabled && !mCreated)
@@ -50,6 +50,9 @@ namespace MWRender
 
         void update(float duration);
 
+        void sceneChanged();
+        ///< to be called when cells are loaded or unloaded, so weather particle occlusion can refresh
+
         void setEnabled(bool enabled);
 
         void setHour(double hour);
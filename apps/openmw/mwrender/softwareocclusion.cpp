@@ -0,0 +1,280 @@
+#include "softwareocclusion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <osg/Camera>
+#include <osg/Geometry>
+#include <osg/Stats>
+#include <osg/TriangleFunctor>
+
+#include <osgUtil/CullVisitor>
+
+namespace
+{
+    // Resolution of the occluder depth buffer. Low on purpose: the buffer only has to
+    // resolve wall-sized features, and both rasterization and the per-bound tests scale
+    // with the pixel count.
+    constexpr int sBufferWidth = 160;
+    constexpr int sBufferHeight = 90;
+
+    // Geometry with a smaller world bound than this does not pull its weight as an occluder.
+    constexpr float sMinOccluderRadius = 150.f;
+
+    // Bounds on the rasterization workload. Overly dense meshes are skipped entirely
+    // rather than partially collected, so the buffer never contains half an occluder.
+    constexpr std::size_t sMaxTrianglesPerGeometry = 2048;
+    constexpr std::size_t sMaxTrianglesPerCell = 16384;
+
+    // Triangles and bounds closer to the camera than this (in world units along the view
+    // axis) are treated as visible rather than near-clipped.
+    constexpr double sNearLimit = 1.0;
+
+    bool isTransparent(const osg::StateSet* stateset)
+    {
+        if (stateset == nullptr)
+            return false;
+        if (stateset->getRenderingHint() == osg::StateSet::TRANSPARENT_BIN)
+            return true;
+        return (stateset->getMode(GL_BLEND) & osg::StateAttribute::ON) != 0;
+    }
+
+    struct CollectTriangles
+    {
+        std::vector<MWRender::SoftwareOcclusion::Triangle>* mTriangles = nullptr;
+        osg::Matrixf mMatrix;
+
+        void operator()(const osg::Vec3& v1, const osg::Vec3& v2, const osg::Vec3& v3)
+        {
+            mTriangles->push_back({ v1 * mMatrix, v2 * mMatrix, v3 * mMatrix });
+        }
+    };
+
+    class CollectOccluderTrianglesVisitor : public osg::NodeVisitor
+    {
+    public:
+        explicit CollectOccluderTrianglesVisitor(std::vector<MWRender::SoftwareOcclusion::Triangle>& triangles)
+            : osg::NodeVisitor(TRAVERSE_ACTIVE_CHILDREN)
+            , mTriangles(triangles)
+        {
+        }
+
+        void apply(osg::Node& node) override
+        {
+            // Transparent subgraphs must not occlude what can be seen through them.
+            if (isTransparent(node.getStateSet()))
+                return;
+            traverse(node);
+        }
+
+        void apply(osg::Drawable& drawable) override
+        {
+            if (isTransparent(drawable.getStateSet()))
+                return;
+            osg::Geometry* geometry = drawable.asGeometry();
+            if (geometry == nullptr)
+                return;
+
+            const osg::Matrixf matrix = osg::computeLocalToWorld(getNodePath());
+            const osg::Vec3f scale = matrix.getScale();
+            const float worldRadius
+                = drawable.getBound().radius() * std::max({ scale.x(), scale.y(), scale.z() });
+            if (worldRadius < sMinOccluderRadius)
+                return;
+
+            std::vector<MWRender::SoftwareOcclusion::Triangle> triangles;
+            osg::TriangleFunctor<CollectTriangles> functor;
+            functor.mTriangles = &triangles;
+            functor.mMatrix = matrix;
+            geometry->accept(functor);
+            if (triangles.size() > sMaxTrianglesPerGeometry
+                || mTriangles.size() + triangles.size() > sMaxTrianglesPerCell)
+                return;
+            mTriangles.insert(mTriangles.end(), triangles.begin(), triangles.end());
+        }
+
+    private:
+        std::vector<MWRender::SoftwareOcclusion::Triangle>& mTriangles;
+    };
+}
+
+namespace MWRender
+{
+    SoftwareOcclusion::SoftwareOcclusion(osg::Camera* mainCamera)
+        : mMainCamera(mainCamera)
+        , mDepth(sBufferWidth * sBufferHeight, std::numeric_limits<float>::max())
+    {
+    }
+
+    void SoftwareOcclusion::addCellOccluders(const MWWorld::CellStore* store, osg::Node* staticRoot)
+    {
+        std::vector<Triangle>& triangles = mCellTriangles[store];
+        triangles.clear();
+        CollectOccluderTrianglesVisitor visitor(triangles);
+        staticRoot->accept(visitor);
+        if (triangles.empty())
+            mCellTriangles.erase(store);
+    }
+
+    void SoftwareOcclusion::removeCell(const MWWorld::CellStore* store)
+    {
+        mCellTriangles.erase(store);
+    }
+
+    void SoftwareOcclusion::rasterize(const osg::Camera* camera)
+    {
+        mTriangles = 0;
+        mTested = 0;
+        mCulled = 0;
+        mBufferValid = false;
+
+        if (mCellTriangles.empty())
+            return;
+
+        mViewProj = camera->getViewMatrix() * camera->getProjectionMatrix();
+        const osg::Matrixd& projection = camera->getProjectionMatrix();
+        mProjScale = osg::Vec2d(projection(0, 0), projection(1, 1));
+
+        std::fill(mDepth.begin(), mDepth.end(), std::numeric_limits<float>::max());
+
+        for (const auto& [store, triangles] : mCellTriangles)
+            for (const Triangle& triangle : triangles)
+                rasterizeTriangle(triangle);
+
+        mBufferValid = true;
+    }
+
+    void SoftwareOcclusion::rasterizeTriangle(const Triangle& triangle)
+    {
+        const osg::Vec4d clip[3] = {
+            osg::Vec4d(osg::Vec3d(triangle.mV0), 1.0) * mViewProj,
+            osg::Vec4d(osg::Vec3d(triangle.mV1), 1.0) * mViewProj,
+            osg::Vec4d(osg::Vec3d(triangle.mV2), 1.0) * mViewProj,
+        };
+
+        // Triangles crossing the near plane are dropped instead of clipped: weaker
+        // occlusion, but never wrong.
+        for (const osg::Vec4d& vertex : clip)
+            if (vertex.w() < sNearLimit)
+                return;
+
+        // For a perspective projection w is the view depth; writing the farthest vertex
+        // depth for the whole triangle keeps the buffer conservative without
+        // perspective-correct interpolation.
+        const float farDepth = static_cast<float>(std::max({ clip[0].w(), clip[1].w(), clip[2].w() }));
+
+        osg::Vec2d p[3];
+        for (int i = 0; i < 3; ++i)
+            p[i] = osg::Vec2d((clip[i].x() / clip[i].w() * 0.5 + 0.5) * sBufferWidth,
+                (clip[i].y() / clip[i].w() * 0.5 + 0.5) * sBufferHeight);
+
+        const double area
+            = (p[1].x() - p[0].x()) * (p[2].y() - p[0].y()) - (p[1].y() - p[0].y()) * (p[2].x() - p[0].x());
+        if (std::abs(area) < 1e-6)
+            return;
+        if (area < 0.0)
+            std::swap(p[1], p[2]);
+
+        const int x0 = std::max(0, static_cast<int>(std::floor(std::min({ p[0].x(), p[1].x(), p[2].x() }))));
+        const int x1
+            = std::min(sBufferWidth - 1, static_cast<int>(std::ceil(std::max({ p[0].x(), p[1].x(), p[2].x() }))));
+        const int y0 = std::max(0, static_cast<int>(std::floor(std::min({ p[0].y(), p[1].y(), p[2].y() }))));
+        const int y1
+            = std::min(sBufferHeight - 1, static_cast<int>(std::ceil(std::max({ p[0].y(), p[1].y(), p[2].y() }))));
+        if (x0 > x1 || y0 > y1)
+            return;
+
+        double edgeX[3], edgeY[3], bias[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const osg::Vec2d& a = p[i];
+            const osg::Vec2d& b = p[(i + 1) % 3];
+            edgeX[i] = b.x() - a.x();
+            edgeY[i] = b.y() - a.y();
+            // Only pixels fully inside the triangle may be written (inner-conservative
+            // rasterization), or a partially covered pixel could hide geometry that is
+            // visible past the triangle's edge.
+            bias[i] = 0.5 * (std::abs(edgeX[i]) + std::abs(edgeY[i]));
+        }
+
+        ++mTriangles;
+
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                const double cx = x + 0.5;
+                const double cy = y + 0.5;
+                bool covered = true;
+                for (int i = 0; i < 3 && covered; ++i)
+                    covered = edgeX[i] * (cy - p[i].y()) - edgeY[i] * (cx - p[i].x()) >= bias[i];
+                if (!covered)
+                    continue;
+                float& depth = mDepth[y * sBufferWidth + x];
+                depth = std::min(depth, farDepth);
+            }
+        }
+    }
+
+    bool SoftwareOcclusion::isOccluded(osgUtil::CullVisitor* cv, const osg::BoundingSphere& bound)
+    {
+        if (cv->getCurrentCamera() != mMainCamera)
+            return false;
+
+        const unsigned int frameNumber = cv->getFrameStamp()->getFrameNumber();
+        if (frameNumber != mLastFrameNumber)
+        {
+            mLastFrameNumber = frameNumber;
+            rasterize(cv->getCurrentCamera());
+        }
+
+        if (!mBufferValid || !bound.valid())
+            return false;
+
+        ++mTested;
+
+        const osg::Vec4d center = osg::Vec4d(osg::Vec3d(bound.center()), 1.0) * mViewProj;
+        const double nearDepth = center.w() - bound.radius();
+        if (nearDepth < sNearLimit)
+            return false;
+
+        // Conservative screen rectangle of the sphere, padded by a pixel so the test
+        // never trusts pixels the bound merely grazes.
+        const double cx = (center.x() / center.w() * 0.5 + 0.5) * sBufferWidth;
+        const double cy = (center.y() / center.w() * 0.5 + 0.5) * sBufferHeight;
+        const double rx = bound.radius() * mProjScale.x() / nearDepth * 0.5 * sBufferWidth;
+        const double ry = bound.radius() * mProjScale.y() / nearDepth * 0.5 * sBufferHeight;
+
+        const int x0 = std::max(0, static_cast<int>(std::floor(cx - rx)) - 1);
+        const int x1 = std::min(sBufferWidth - 1, static_cast<int>(std::ceil(cx + rx)) + 1);
+        const int y0 = std::max(0, static_cast<int>(std::floor(cy - ry)) - 1);
+        const int y1 = std::min(sBufferHeight - 1, static_cast<int>(std::ceil(cy + ry)) + 1);
+        if (x0 > x1 || y0 > y1)
+            return false;
+
+        for (int y = y0; y <= y1; ++y)
+            for (int x = x0; x <= x1; ++x)
+                if (mDepth[y * sBufferWidth + x] >= nearDepth)
+                    return false;
+
+        ++mCulled;
+        return true;
+    }
+
+    void SoftwareOcclusion::reportStats(unsigned int frameNumber, osg::Stats* stats) const
+    {
+        if (!stats->collectStats("engine"))
+            return;
+        stats->setAttribute(frameNumber, "Occlusion Triangles", mTriangles);
+        stats->setAttribute(frameNumber, "Occlusion Tested", mTested);
+        stats->setAttribute(frameNumber, "Occlusion Culled", mCulled);
+    }
+
+    void OcclusionCullCallback::operator()(osg::Node* node, osgUtil::CullVisitor* cv)
+    {
+        if (mOcclusion->isOccluded(cv, node->getBound()))
+            return;
+        traverse(node, cv);
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef OPENMW_MWRENDER_SOFTWAREOCCLUSION_H
+#define OPENMW_MWRENDER_SOFTWAREOCCLUSION_H
+
+#include <map>
+#include <vector>
+
+#include <osg/BoundingSphere>
+#include <osg/Matrixd>
+#include <osg/Vec2d>
+#include <osg/Vec3f>
+
+#include <components/sceneutil/nodecallback.hpp>
+
+namespace osg
+{
+    class Camera;
+    class Node;
+    class Stats;
+}
+
+namespace osgUtil
+{
+    class CullVisitor;
+}
+
+namespace MWWorld
+{
+    class CellStore;
+}
+
+namespace MWRender
+{
+    /// CPU occlusion culling stage. Large opaque statics are rasterized into a low
+    /// resolution depth buffer once per frame, and bounding spheres of terrain chunks and
+    /// object blocks are conservatively tested against it during cull, so geometry hidden
+    /// behind walls or buildings is never submitted to the GPU.
+    class SoftwareOcclusion
+    {
+    public:
+        struct Triangle
+        {
+            osg::Vec3f mV0;
+            osg::Vec3f mV1;
+            osg::Vec3f mV2;
+        };
+
+        explicit SoftwareOcclusion(osg::Camera* mainCamera);
+
+        /// Collect occluder triangles from the cell's static subgraph. Only large opaque
+        /// geometry is used; the triangles are stored in world space, so the subgraph must
+        /// not be moved afterwards.
+        void addCellOccluders(const MWWorld::CellStore* store, osg::Node* staticRoot);
+
+        void removeCell(const MWWorld::CellStore* store);
+
+        /// Conservative visibility test against the occluder depth buffer. The buffer is
+        /// rasterized on first use each frame with the matrices of the camera being culled.
+        /// Returns false (visible) for any camera other than the main camera.
+        bool isOccluded(osgUtil::CullVisitor* cv, const osg::BoundingSphere& bound);
+
+        void reportStats(unsigned int frameNumber, osg::Stats* stats) const;
+
+    private:
+        void rasterize(const osg::Camera* camera);
+        void rasterizeTriangle(const Triangle& triangle);
+
+        osg::Camera* mMainCamera;
+        std::map<const MWWorld::CellStore*, std::vector<Triangle>> mCellTriangles;
+        std::vector<float> mDepth;
+        osg::Matrixd mViewProj;
+        osg::Vec2d mProjScale;
+        unsigned int mLastFrameNumber = 0;
+        bool mBufferValid = false;
+        unsigned int mTriangles = 0;
+        unsigned int mTested = 0;
+        unsigned int mCulled = 0;
+    };
+
+    /// Skips cull traversal of subgraphs whose bounds the occlusion buffer proves hidden.
+    class OcclusionCullCallback
+        : public SceneUtil::NodeCallback<OcclusionCullCallback, osg::Node*, osgUtil::CullVisitor*>
+    {
+    public:
+        explicit OcclusionCullCallback(SoftwareOcclusion* occlusion)
+            : mOcclusion(occlusion)
+        {
+        }
+
+        void operator()(osg::Node* node, osgUtil::CullVisitor* cv);
+
+    private:
+        SoftwareOcclusion* mOcclusion;
+    };
+}
+
+#endif
@@ -454,7 +454,7 @@ namespace MWRender
     {
         mSimulation = std::make_unique<RippleSimulation>(mSceneRoot, resourceSystem);
 
-        mWaterGeom = SceneUtil::createWaterGeometry(Constants::CellSizeInUnits * 150, 40, 900);
+        mWaterGeom = SceneUtil::createGradedWaterGeometry(Constants::CellSizeInUnits * 150, 40, 2.f, 900);
         mWaterGeom->setDrawCallback(new DepthClampCallback);
         mWaterGeom->setNodeMask(Mask_Water);
         mWaterGeom->setDataVariance(osg::Object::STATIC);
@@ -112,6 +112,10 @@ namespace MWScript
     {
         MWWorld::Ptr ptr = std::visit(PtrResolvingVisitor{}, mTarget);
         mTarget = ptr;
+        // The resolved Ptr is cached here across frames, so the script keeps mutating the target
+        // without going through WorldModel again; re-flag the cell on every run.
+        if (!ptr.isEmpty() && ptr.isInCell())
+            ptr.getCell()->markExternalReference();
         return ptr;
     }
 
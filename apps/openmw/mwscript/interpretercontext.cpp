@@ -116,11 +116,13 @@ namespace MWScript
     InterpreterContext::InterpreterContext(MWScript::Locals* locals, const MWWorld::Ptr& reference)
         : mLocals(locals)
         , mReference(reference)
+        , mSecondsPassed(MWBase::Environment::get().getFrameDuration())
     {
     }
 
     InterpreterContext::InterpreterContext(std::shared_ptr<GlobalScriptDesc> globalScriptDesc)
         : mLocals(&(globalScriptDesc->mLocals))
+        , mSecondsPassed(MWBase::Environment::get().getFrameDuration())
     {
         const MWWorld::Ptr* ptr = globalScriptDesc->getPtrIfPresent();
         // A nullptr here signifies that the script's target has not yet been resolved after loading the game.
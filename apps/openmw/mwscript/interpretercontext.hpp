@@ -26,6 +26,7 @@ namespace MWScript
         Locals* mLocals;
         mutable MWWorld::Ptr mReference;
         std::shared_ptr<GlobalScriptDesc> mGlobalScriptDesc;
+        float mSecondsPassed;
 
         /// If \a id is empty, a reference the script is run from is returned or in case
         /// of a non-local script the reference derived from the target ID.
@@ -47,6 +48,12 @@ namespace MWScript
         InterpreterContext(MWScript::Locals* locals, const MWWorld::Ptr& reference);
         ///< The ownership of \a locals is not transferred. 0-pointer allowed.
 
+        /// Seconds reported by GetSecondsPassed. Defaults to the frame duration; the local
+        /// script scheduler raises it to the actually elapsed time when a script skipped frames.
+        void setSecondsPassed(float seconds) { mSecondsPassed = seconds; }
+
+        float getSecondsPassed() const { return mSecondsPassed; }
+
         ESM::RefId getTarget() const override;
 
         int getLocalShort(int index) const override;
@@ -9,7 +9,9 @@
 #include <components/compiler/locals.hpp>
 #include <components/compiler/opcodes.hpp>
 
+#include <components/debug/debugging.hpp>
 #include <components/debug/debuglog.hpp>
+#include <components/debug/trace.hpp>
 
 #include <components/interpreter/interpreter.hpp>
 #include <components/interpreter/opcodes.hpp>
@@ -233,7 +235,10 @@ namespace MWScript
         public:
             void execute(Interpreter::Runtime& runtime) override
             {
-                runtime.push(MWBase::Environment::get().getFrameDuration());
+                const MWScript::InterpreterContext& context
+                    = static_cast<MWScript::InterpreterContext&>(runtime.getContext());
+
+                runtime.push(context.getSecondsPassed());
             }
         };
 
@@ -1626,6 +1631,30 @@ namespace MWScript
             }
         };
 
+        class OpToggleTraceCapture : public Interpreter::Opcode0
+        {
+        public:
+            void execute(Interpreter::Runtime& runtime) override
+            {
+                Debug::TraceRecorder& recorder = Debug::TraceRecorder::instance();
+                if (!recorder.isEnabled())
+                {
+                    recorder.start();
+                    runtime.getContext().report("Trace Capture -> On");
+                }
+                else
+                {
+                    const std::filesystem::path filename = Debug::getLogDir() / "openmw_trace.json";
+                    if (recorder.stopAndWrite(filename))
+                        runtime.getContext().report("Trace Capture -> Off, wrote '"
+                            + Files::pathToUnicodeString(filename) + "' (open with chrome://tracing)");
+                    else
+                        runtime.getContext().report(
+                            "Trace Capture -> Off, failed to write '" + Files::pathToUnicodeString(filename) + "'");
+                }
+            }
+        };
+
         class OpToggleActorsPaths : public Interpreter::Opcode0
         {
         public:
@@ -1876,6 +1905,7 @@ namespace MWScript
             interpreter.installSegment3<OpShowSceneGraph<ExplicitRef>>(Compiler::Misc::opcodeShowSceneGraphExplicit);
             interpreter.installSegment5<OpToggleBorders>(Compiler::Misc::opcodeToggleBorders);
             interpreter.installSegment5<OpToggleNavMesh>(Compiler::Misc::opcodeToggleNavMesh);
+            interpreter.installSegment5<OpToggleTraceCapture>(Compiler::Misc::opcodeToggleTraceCapture);
             interpreter.installSegment5<OpToggleActorsPaths>(Compiler::Misc::opcodeToggleActorsPaths);
             interpreter.installSegment5<OpSetNavMeshNumberToRender>(Compiler::Misc::opcodeSetNavMeshNumberToRender);
             interpreter.installSegment5<OpRepairedOnMe<ImplicitRef>>(Compiler::Misc::opcodeRepairedOnMe);
@@ -3,9 +3,13 @@
 #include <algorithm>
 #include <cassert>
 #include <exception>
+#include <fstream>
 #include <sstream>
+#include <type_traits>
 
 #include <components/debug/debuglog.hpp>
+#include <components/files/conversion.hpp>
+#include <components/files/hash.hpp>
 
 #include <components/esm/refid.hpp>
 #include <components/esm3/loadscpt.hpp>
@@ -14,6 +18,7 @@
 
 #include <components/compiler/context.hpp>
 #include <components/compiler/exception.hpp>
+#include <components/compiler/opcodes.hpp>
 #include <components/compiler/quickfileparser.hpp>
 #include <components/compiler/scanner.hpp>
 
@@ -24,6 +29,113 @@
 
 namespace MWScript
 {
+    namespace
+    {
+        // Bump whenever the compiler output or the instruction set changes.
+        constexpr std::uint32_t sScriptCacheVersion = 1;
+        constexpr std::array<char, 4> sScriptCacheMagic{ 'O', 'M', 'W', 'S' };
+
+        void writeCacheString(std::ostream& stream, std::string_view value)
+        {
+            const std::uint32_t length = static_cast<std::uint32_t>(value.size());
+            stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            stream.write(value.data(), length);
+        }
+
+        bool readCacheString(std::istream& stream, std::string& value)
+        {
+            std::uint32_t length = 0;
+            stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+            if (!stream || length > (1u << 20))
+                return false;
+            value.resize(length);
+            stream.read(value.data(), length);
+            return static_cast<bool>(stream);
+        }
+
+        template <typename T>
+        void writeCacheVector(std::ostream& stream, const std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const std::uint32_t count = static_cast<std::uint32_t>(values.size());
+            stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            stream.write(reinterpret_cast<const char*>(values.data()), count * sizeof(T));
+        }
+
+        template <typename T>
+        bool readCacheVector(std::istream& stream, std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            std::uint32_t count = 0;
+            stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+            if (!stream || count > (1u << 24))
+                return false;
+            values.resize(count);
+            stream.read(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+            return static_cast<bool>(stream);
+        }
+
+        void writeCacheStrings(std::ostream& stream, const std::vector<std::string>& values)
+        {
+            const std::uint32_t count = static_cast<std::uint32_t>(values.size());
+            stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            for (const std::string& value : values)
+                writeCacheString(stream, value);
+        }
+
+        bool readCacheStrings(std::istream& stream, std::vector<std::string>& values)
+        {
+            std::uint32_t count = 0;
+            stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+            if (!stream || count > (1u << 24))
+                return false;
+            values.resize(count);
+            for (std::string& value : values)
+                if (!readCacheString(stream, value))
+                    return false;
+            return true;
+        }
+
+        constexpr std::array<char, 3> sLocalTypes{ 's', 'l', 'f' };
+
+        std::array<std::uint64_t, 2> computeSourceHash(const ESM::Script& script)
+        {
+            std::istringstream stream(script.mScriptText);
+            return Files::getHash(script.mId.getRefIdString(), stream);
+        }
+
+        // Scripts that reposition objects have to tick every frame to animate smoothly;
+        // everything else tolerates running at an interval as long as GetSecondsPassed
+        // reports the actually elapsed time.
+        bool computeIntervalTolerant(const Interpreter::Program& program)
+        {
+            for (const Interpreter::Type_Code code : program.mInstructions)
+            {
+                if ((code >> 26) != 0x32)
+                    continue;
+
+                switch (code & 0x3ffffff)
+                {
+                    case Compiler::Transformation::opcodeSetAngle:
+                    case Compiler::Transformation::opcodeSetAngleExplicit:
+                    case Compiler::Transformation::opcodeSetPos:
+                    case Compiler::Transformation::opcodeSetPosExplicit:
+                    case Compiler::Transformation::opcodeRotate:
+                    case Compiler::Transformation::opcodeRotateExplicit:
+                    case Compiler::Transformation::opcodeRotateWorld:
+                    case Compiler::Transformation::opcodeRotateWorldExplicit:
+                    case Compiler::Transformation::opcodeMove:
+                    case Compiler::Transformation::opcodeMoveExplicit:
+                    case Compiler::Transformation::opcodeMoveWorld:
+                    case Compiler::Transformation::opcodeMoveWorldExplicit:
+                        return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
     ScriptManager::ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
         const std::vector<ESM::RefId>& scriptBlacklist)
         : mErrorHandler()
@@ -39,6 +151,101 @@ namespace MWScript
         mScriptBlacklist.resize(scriptBlacklist.size());
 
         std::sort(mScriptBlacklist.begin(), mScriptBlacklist.end());
+
+        loadCache();
+    }
+
+    ScriptManager::~ScriptManager()
+    {
+        if (mCacheDirty)
+            saveCache();
+    }
+
+    void ScriptManager::loadCache()
+    {
+        mCachePath = mStore.getCachePath("compiledscripts.cache");
+        if (mCachePath.empty())
+            return;
+
+        std::ifstream stream(mCachePath, std::ios::binary);
+        if (!stream)
+            return;
+
+        std::array<char, 4> magic;
+        std::uint32_t version = 0;
+        stream.read(magic.data(), magic.size());
+        stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+        if (!stream || magic != sScriptCacheMagic || version != sScriptCacheVersion)
+            return;
+
+        // Unlike the paged references cache there is no load order key: each entry is
+        // validated against the hash of the current source text in compile(), so unchanged
+        // scripts are reused even when the load order changes.
+        std::unordered_map<ESM::RefId, CachedScript> cache;
+        std::uint32_t count = 0;
+        stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!stream || count > (1u << 24))
+            return;
+        std::string id;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            if (!readCacheString(stream, id))
+                return;
+            CachedScript script;
+            stream.read(reinterpret_cast<char*>(script.mSourceHash.data()), sizeof(script.mSourceHash));
+            if (!stream || !readCacheVector(stream, script.mProgram.mInstructions)
+                || !readCacheVector(stream, script.mProgram.mIntegers)
+                || !readCacheVector(stream, script.mProgram.mFloats)
+                || !readCacheStrings(stream, script.mProgram.mStrings))
+                return;
+            std::vector<std::string> names;
+            for (const char type : sLocalTypes)
+            {
+                if (!readCacheStrings(stream, names))
+                    return;
+                for (const std::string& name : names)
+                    script.mLocals.declare(type, name);
+            }
+            cache.emplace(ESM::RefId::deserializeText(id), std::move(script));
+        }
+
+        mProgramCache = std::move(cache);
+        Log(Debug::Info) << "Loaded " << mProgramCache.size() << " compiled scripts from cache";
+    }
+
+    void ScriptManager::saveCache() const
+    {
+        if (mCachePath.empty())
+            return;
+
+        std::ofstream stream(mCachePath, std::ios::binary);
+        if (!stream)
+        {
+            Log(Debug::Warning) << "Failed to open compiled script cache for writing: "
+                                << Files::pathToUnicodeString(mCachePath);
+            return;
+        }
+
+        stream.write(sScriptCacheMagic.data(), sScriptCacheMagic.size());
+        stream.write(reinterpret_cast<const char*>(&sScriptCacheVersion), sizeof(sScriptCacheVersion));
+
+        const std::uint32_t count = static_cast<std::uint32_t>(mProgramCache.size());
+        stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& [name, script] : mProgramCache)
+        {
+            writeCacheString(stream, name.serializeText());
+            stream.write(reinterpret_cast<const char*>(script.mSourceHash.data()), sizeof(script.mSourceHash));
+            writeCacheVector(stream, script.mProgram.mInstructions);
+            writeCacheVector(stream, script.mProgram.mIntegers);
+            writeCacheVector(stream, script.mProgram.mFloats);
+            writeCacheStrings(stream, script.mProgram.mStrings);
+            for (const char type : sLocalTypes)
+                writeCacheStrings(stream, script.mLocals.get(type));
+        }
+
+        if (!stream)
+            Log(Debug::Warning) << "Failed to write compiled script cache: "
+                                << Files::pathToUnicodeString(mCachePath);
     }
 
     bool ScriptManager::compile(const ESM::RefId& name)
@@ -48,6 +255,17 @@ namespace MWScript
 
         if (const ESM::Script* script = mStore.get<ESM::Script>().find(name))
         {
+            const std::array<std::uint64_t, 2> sourceHash = computeSourceHash(*script);
+
+            const auto cached = mProgramCache.find(name);
+            if (cached != mProgramCache.end() && cached->second.mSourceHash == sourceHash)
+            {
+                mScripts.emplace(name,
+                    CompiledScript(Interpreter::Program(cached->second.mProgram), cached->second.mLocals,
+                        computeIntervalTolerant(cached->second.mProgram)));
+                return true;
+            }
+
             mErrorHandler.setContext(script->mId.getRefIdString());
 
             bool Success = true;
@@ -80,7 +298,13 @@ namespace MWScript
 
             if (Success)
             {
-                mScripts.emplace(name, CompiledScript(mParser.getProgram(), mParser.getLocals()));
+                Interpreter::Program program = mParser.getProgram();
+
+                mProgramCache[name] = CachedScript{ sourceHash, program, mParser.getLocals() };
+                mCacheDirty = true;
+
+                const bool intervalTolerant = computeIntervalTolerant(program);
+                mScripts.emplace(name, CompiledScript(std::move(program), mParser.getLocals(), intervalTolerant));
 
                 return true;
             }
@@ -99,7 +323,7 @@ namespace MWScript
             if (!compile(name))
             {
                 // failed -> ignore script from now on.
-                mScripts.emplace(name, CompiledScript({}, Compiler::Locals()));
+                mScripts.emplace(name, CompiledScript({}, Compiler::Locals(), false));
                 return false;
             }
 
@@ -160,6 +384,12 @@ namespace MWScript
         return std::make_pair(count, success);
     }
 
+    bool ScriptManager::isIntervalTolerant(const ESM::RefId& name) const
+    {
+        const auto iter = mScripts.find(name);
+        return iter != mScripts.end() && iter->second.mIntervalTolerant;
+    }
+
     const Compiler::Locals& ScriptManager::getLocals(const ESM::RefId& name)
     {
         {
@@ -1,6 +1,9 @@
 #ifndef GAME_SCRIPT_SCRIPTMANAGER_H
 #define GAME_SCRIPT_SCRIPTMANAGER_H
 
+#include <array>
+#include <cstdint>
+#include <filesystem>
 #include <map>
 #include <set>
 #include <string>
@@ -48,23 +51,44 @@ namespace MWScript
             Interpreter::Program mProgram;
             Compiler::Locals mLocals;
             std::set<ESM::RefId> mInactive;
+            bool mIntervalTolerant;
 
-            explicit CompiledScript(Interpreter::Program&& program, const Compiler::Locals& locals)
+            explicit CompiledScript(
+                Interpreter::Program&& program, const Compiler::Locals& locals, bool intervalTolerant)
                 : mProgram(std::move(program))
                 , mLocals(locals)
+                , mIntervalTolerant(intervalTolerant)
             {
             }
         };
 
+        /// A compiled script retained for the on-disk cache. Entries are validated against
+        /// the current source text before reuse, so the cache survives load order changes.
+        struct CachedScript
+        {
+            std::array<std::uint64_t, 2> mSourceHash{ 0, 0 };
+            Interpreter::Program mProgram;
+            Compiler::Locals mLocals;
+        };
+
         std::unordered_map<ESM::RefId, CompiledScript> mScripts;
         GlobalScripts mGlobalScripts;
         std::unordered_map<ESM::RefId, Compiler::Locals> mOtherLocals;
         std::vector<ESM::RefId> mScriptBlacklist;
+        std::unordered_map<ESM::RefId, CachedScript> mProgramCache;
+        std::filesystem::path mCachePath;
+        bool mCacheDirty = false;
+
+        void loadCache();
+
+        void saveCache() const;
 
     public:
         ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
             const std::vector<ESM::RefId>& scriptBlacklist);
 
+        ~ScriptManager() override;
+
         void clear() override;
 
         bool run(const ESM::RefId& name, Interpreter::Context& interpreterContext) override;
@@ -81,6 +105,10 @@ namespace MWScript
         const Compiler::Locals& getLocals(const ESM::RefId& name) override;
         ///< Return locals for script \a name.
 
+        bool isIntervalTolerant(const ESM::RefId& name) const;
+        ///< Does the compiled script tolerate running at an interval instead of every frame?
+        /// False for scripts that reposition objects and for scripts that are not compiled yet.
+
         GlobalScripts& getGlobalScripts() override;
 
         const Compiler::Extensions& getExtensions() const override;
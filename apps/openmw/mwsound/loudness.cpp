@@ -7,50 +7,83 @@
 
 namespace MWSound
 {
+    namespace
+    {
+        // Sum of squares of the first channel's samples (scaled to [-1,1]) over
+        // count frames of the given stride, in elements. Split per sample type
+        // so the inner loops are plain strided reductions the compiler can
+        // vectorize instead of re-dispatching on the type per sample.
+        float sumSquares(const unsigned char* data, std::size_t count, std::size_t stride)
+        {
+            float sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const float value = static_cast<signed char>(data[i * stride] ^ 0x80) / 128.f;
+                sum += value * value;
+            }
+            return sum;
+        }
+
+        float sumSquares(const std::int16_t* data, std::size_t count, std::size_t stride)
+        {
+            float sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const float value = data[i * stride] / float(std::numeric_limits<std::int16_t>::max());
+                sum += value * value;
+            }
+            return sum;
+        }
+
+        float sumSquares(const float* data, std::size_t count, std::size_t stride)
+        {
+            float sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                // Float samples *should* be scaled to [-1,1] already.
+                const float value = std::clamp(data[i * stride], -1.f, 1.f);
+                sum += value * value;
+            }
+            return sum;
+        }
+    }
 
     void Sound_Loudness::analyzeLoudness(const std::vector<char>& data)
     {
         mQueue.insert(mQueue.end(), data.begin(), data.end());
-        if (!mQueue.size())
+        if (mQueue.empty())
             return;
 
-        int samplesPerSegment = static_cast<int>(mSampleRate / mSamplesPerSec);
-        std::size_t numSamples = bytesToFrames(mQueue.size(), mChannelConfig, mSampleType);
-        std::size_t advance = framesToBytes(1, mChannelConfig, mSampleType);
+        const std::size_t samplesPerSegment = static_cast<std::size_t>(mSampleRate / mSamplesPerSec);
+        if (samplesPerSegment == 0)
+            return;
+        const std::size_t numSamples = bytesToFrames(mQueue.size(), mChannelConfig, mSampleType);
+        const std::size_t advance = framesToBytes(1, mChannelConfig, mSampleType);
 
-        std::size_t segment = 0;
         std::size_t sample = 0;
-        while (segment < numSamples / samplesPerSegment)
+        while (sample + samplesPerSegment <= numSamples)
         {
+            const char* const segment = mQueue.data() + sample * advance;
+
             float sum = 0;
-            int samplesAdded = 0;
-            while (sample < numSamples && sample < (segment + 1) * samplesPerSegment)
+            switch (mSampleType)
             {
-                // get sample on a scale from -1 to 1
-                float value = 0;
-                if (mSampleType == SampleType_UInt8)
-                    value = ((char)(mQueue[sample * advance] ^ 0x80)) / 128.f;
-                else if (mSampleType == SampleType_Int16)
-                {
-                    value = *reinterpret_cast<const int16_t*>(&mQueue[sample * advance]);
-                    value /= float(std::numeric_limits<int16_t>::max());
-                }
-                else if (mSampleType == SampleType_Float32)
-                {
-                    value = *reinterpret_cast<const float*>(&mQueue[sample * advance]);
-                    value = std::clamp(value, -1.f, 1.f); // Float samples *should* be scaled to [-1,1] already.
-                }
-
-                sum += value * value;
-                ++samplesAdded;
-                ++sample;
+                case SampleType_UInt8:
+                    sum = sumSquares(reinterpret_cast<const unsigned char*>(segment), samplesPerSegment, advance);
+                    break;
+                case SampleType_Int16:
+                    sum = sumSquares(
+                        reinterpret_cast<const std::int16_t*>(segment), samplesPerSegment, advance / sizeof(int16_t));
+                    break;
+                case SampleType_Float32:
+                    sum = sumSquares(
+                        reinterpret_cast<const float*>(segment), samplesPerSegment, advance / sizeof(float));
+                    break;
             }
 
-            float rms = 0; // root mean square
-            if (samplesAdded > 0)
-                rms = std::sqrt(sum / samplesAdded);
-            mSamples.push_back(rms);
-            ++segment;
+            // root mean square
+            mSamples.push_back(std::sqrt(sum / samplesPerSegment));
+            sample += samplesPerSegment;
         }
 
         mQueue.erase(mQueue.begin(), mQueue.begin() + sample * advance);
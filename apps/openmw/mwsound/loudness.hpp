@@ -1,7 +1,6 @@
 #ifndef GAME_SOUND_LOUDNESS_H
 #define GAME_SOUND_LOUDNESS_H
 
-#include <deque>
 #include <vector>
 
 #include "sound_decoder.hpp"
@@ -19,7 +18,7 @@ namespace MWSound
         // Loudness sample info
         std::vector<float> mSamples;
 
-        std::deque<char> mQueue;
+        std::vector<char> mQueue;
 
     public:
         /**
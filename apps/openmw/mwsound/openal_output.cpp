@@ -5,6 +5,7 @@
 #include <condition_variable>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <thread>
 #include <vector>
@@ -292,6 +293,15 @@ namespace MWSound
         ALuint mFrameSize;
         ALint mSilence;
 
+        // Scratch space for decoded samples, reused across refills to avoid
+        // allocating on every streaming thread update.
+        std::vector<char> mDecodeBuffer;
+
+        // Guards the decoder and buffer queue state shared between the streaming
+        // thread and offset/loudness queries. Taken per stream, so a slow decode
+        // of one stream doesn't stall queries about another.
+        mutable std::mutex mMutex;
+
         DecoderPtr mDecoder;
 
         std::unique_ptr<Sound_Loudness> mLoudnessAnalyzer;
@@ -518,6 +528,7 @@ namespace MWSound
         mFrameSize = framesToBytes(1, chans, type);
         mBufferSize = static_cast<ALuint>(sBufferLength * mSampleRate);
         mBufferSize *= mFrameSize;
+        mDecodeBuffer.resize(mBufferSize);
 
         if (getLoudnessData)
             mLoudnessAnalyzer = std::make_unique<Sound_Loudness>(sLoudnessFPS, mSampleRate, chans, type);
@@ -595,6 +606,7 @@ namespace MWSound
 
     bool OpenAL_SoundStream::process()
     {
+        std::lock_guard<std::mutex> lock(mMutex);
         try
         {
             if (refillQueue() > 0)
@@ -633,22 +645,21 @@ namespace MWSound
         alGetSourcei(mSource, AL_BUFFERS_QUEUED, &queued);
         if (!mIsFinished && (ALuint)queued < mBuffers.size())
         {
-            std::vector<char> data(mBufferSize);
             for (; !mIsFinished && (ALuint)queued < mBuffers.size(); ++queued)
             {
-                size_t got = mDecoder->read(data.data(), data.size());
-                if (got < data.size())
+                size_t got = mDecoder->read(mDecodeBuffer.data(), mDecodeBuffer.size());
+                if (got < mDecodeBuffer.size())
                 {
                     mIsFinished = true;
-                    std::fill(data.begin() + got, data.end(), mSilence);
+                    std::fill(mDecodeBuffer.begin() + got, mDecodeBuffer.end(), mSilence);
                 }
                 if (got > 0)
                 {
                     if (mLoudnessAnalyzer.get())
-                        mLoudnessAnalyzer->analyzeLoudness(data);
+                        mLoudnessAnalyzer->analyzeLoudness(mDecodeBuffer);
 
                     ALuint bufid = mBuffers[mCurrentBufIdx];
-                    alBufferData(bufid, mFormat, data.data(), data.size(), mSampleRate);
+                    alBufferData(bufid, mFormat, mDecodeBuffer.data(), mDecodeBuffer.size(), mSampleRate);
                     alSourceQueueBuffers(mSource, 1, &bufid);
                     mCurrentBufIdx = (mCurrentBufIdx + 1) % mBuffers.size();
                 }
@@ -1421,7 +1432,7 @@ namespace MWSound
         if (!sound->mHandle)
             return 0.0;
         OpenAL_SoundStream* stream = reinterpret_cast<OpenAL_SoundStream*>(sound->mHandle);
-        std::lock_guard<std::mutex> lock(mStreamThread->mMutex);
+        std::lock_guard<std::mutex> lock(stream->mMutex);
         return stream->getStreamOffset();
     }
 
@@ -1430,7 +1441,7 @@ namespace MWSound
         if (!sound->mHandle)
             return 0.0;
         OpenAL_SoundStream* stream = reinterpret_cast<OpenAL_SoundStream*>(sound->mHandle);
-        std::lock_guard<std::mutex> lock(mStreamThread->mMutex);
+        std::lock_guard<std::mutex> lock(stream->mMutex);
         return stream->getCurrentLoudness();
     }
 
@@ -1439,7 +1450,7 @@ namespace MWSound
         if (!sound->mHandle)
             return false;
         OpenAL_SoundStream* stream = reinterpret_cast<OpenAL_SoundStream*>(sound->mHandle);
-        std::lock_guard<std::mutex> lock(mStreamThread->mMutex);
+        std::lock_guard<std::mutex> lock(stream->mMutex);
         return stream->isPlaying();
     }
 
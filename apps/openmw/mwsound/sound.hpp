@@ -11,6 +11,7 @@ namespace MWSound
     enum PlayModeEx
     {
         Play_2D = 0,
+        Play_Virtual = 1 << 27,
         Play_StopAtFadeEnd = 1 << 28,
         Play_FadeExponential = 1 << 29,
         Play_InFade = 1 << 30,
@@ -161,6 +162,18 @@ namespace MWSound
         bool getDistanceCull() const { return mParams.mFlags & MWSound::PlayMode::RemoveAtDistance; }
         bool getIs3D() const { return mParams.mFlags & Play_3D; }
         bool getInFade() const { return mParams.mFlags & Play_InFade; }
+        bool getIsVirtual() const { return mParams.mFlags & Play_Virtual; }
+
+        /// Marks the sound as tracked logically without an output instance attached.
+        /// Inaudible looping sounds are virtualized so they don't occupy one of the
+        /// limited hardware sources; see SoundManager::updateSounds.
+        void setIsVirtual(bool state)
+        {
+            if (state)
+                mParams.mFlags |= Play_Virtual;
+            else
+                mParams.mFlags &= ~Play_Virtual;
+        }
 
         void init(const SoundParams& params)
         {
@@ -8,6 +8,7 @@
 #include <osg/Matrixf>
 
 #include <components/debug/debuglog.hpp>
+#include <components/esm3/loadregn.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/rng.hpp>
 #include <components/settings/values.hpp>
@@ -638,8 +639,12 @@ namespace MWSound
 
     void SoundManager::stopSound(Sound* sound)
     {
-        if (sound)
-            mOutput->finishSound(sound);
+        if (!sound)
+            return;
+        // A virtualized sound has no output instance to stop; clearing the flag
+        // is enough for the next update to reap it.
+        sound->setIsVirtual(false);
+        mOutput->finishSound(sound);
     }
 
     void SoundManager::stopSound(Sound_Buffer* sfx, const MWWorld::ConstPtr& ptr)
@@ -650,7 +655,7 @@ namespace MWSound
             for (SoundBufferRefPair& snd : snditer->second.mList)
             {
                 if (snd.second == sfx)
-                    mOutput->finishSound(snd.first.get());
+                    stopSound(snd.first.get());
             }
         }
     }
@@ -686,7 +691,7 @@ namespace MWSound
         if (snditer != mActiveSounds.end())
         {
             for (SoundBufferRefPair& snd : snditer->second.mList)
-                mOutput->finishSound(snd.first.get());
+                stopSound(snd.first.get());
         }
         SaySoundMap::iterator sayiter = mSaySoundsQueue.find(ptr.mRef);
         if (sayiter != mSaySoundsQueue.end())
@@ -703,7 +708,7 @@ namespace MWSound
             if (ref != nullptr && ref != MWMechanics::getPlayer().mRef && sound.mCell == cell)
             {
                 for (SoundBufferRefPair& sndbuf : sound.mList)
-                    mOutput->finishSound(sndbuf.first.get());
+                    stopSound(sndbuf.first.get());
             }
         }
 
@@ -829,6 +834,29 @@ namespace MWSound
 
         if (!cell->isExterior())
             return;
+
+        // Queue the region's ambient sounds for preloading when the player first
+        // enters it, so their first playback doesn't pay decode latency. The
+        // buffers are loaded one per update to bound the per-frame cost; unused
+        // ones are evicted through the regular buffer cache.
+        if (cell->getRegion() != mPreloadedRegion)
+        {
+            mPreloadedRegion = cell->getRegion();
+            mRegionSoundPreloadQueue.clear();
+            const ESM::Region* region
+                = MWBase::Environment::get().getESMStore()->get<ESM::Region>().search(mPreloadedRegion);
+            if (region != nullptr)
+            {
+                for (const ESM::Region::SoundRef& sound : region->mSoundList)
+                    mRegionSoundPreloadQueue.push_back(sound.mSound);
+            }
+        }
+        if (!mRegionSoundPreloadQueue.empty())
+        {
+            mSoundBuffers.load(mRegionSoundPreloadQueue.front());
+            mRegionSoundPreloadQueue.pop_front();
+        }
+
         if (mCurrentRegionSound && mOutput->isSoundPlaying(mCurrentRegionSound))
             return;
 
@@ -907,7 +935,7 @@ namespace MWSound
         return { WaterSoundAction::DoNothing, nullptr };
     }
 
-    void SoundManager::cull3DSound(SoundBase* sound)
+    bool SoundManager::cull3DSound(SoundBase* sound)
     {
         // Hard-coded distance is from an original engine
         const float maxDist = sound->getDistanceCull() ? sSoundCullDistance : sound->getMaxDistance();
@@ -921,12 +949,12 @@ namespace MWSound
             // If getDistanceCull() is set, delete the sound after it has faded out
             sound->setFade(
                 sSfxFadeOutDuration, 0.0f, Play_FadeExponential | (sound->getDistanceCull() ? Play_StopAtFadeEnd : 0));
+            return false;
         }
-        else
-        {
-            // Fade sounds back in once they are in range
-            sound->setFade(sSfxFadeInDuration, 1.0f, Play_FadeExponential);
-        }
+
+        // Fade sounds back in once they are in range
+        sound->setFade(sSfxFadeInDuration, 1.0f, Play_FadeExponential);
+        return true;
     }
 
     void SoundManager::updateSounds(float duration)
@@ -974,15 +1002,29 @@ namespace MWSound
             {
                 Sound* sound = sndidx->first.get();
 
+                bool inRange = true;
                 if (sound->getIs3D())
                 {
                     if (!ptr.isEmpty())
                         sound->setPosition(ptr.getRefData().getPosition().asVec3());
 
-                    cull3DSound(sound);
+                    inRange = cull3DSound(sound);
                 }
 
-                if (!sound->updateFade(duration) || !mOutput->isSoundPlaying(sound))
+                if (sound->getIsVirtual())
+                {
+                    // Promote the sound once the listener is back in range. If no source
+                    // is free it stays virtual and is retried on the next update.
+                    if (inRange)
+                    {
+                        sound->setIsVirtual(false);
+                        if (!mOutput->playSound3D(sound, sndidx->second->getHandle(), 0.f))
+                            sound->setIsVirtual(true);
+                    }
+                    sound->updateFade(duration);
+                    ++sndidx;
+                }
+                else if (!sound->updateFade(duration) || !mOutput->isSoundPlaying(sound))
                 {
                     mOutput->finishSound(sound);
                     if (sound == mUnderwaterSound)
@@ -992,6 +1034,15 @@ namespace MWSound
                     mSoundBuffers.release(*sndidx->second);
                     sndidx = snditer->second.mList.erase(sndidx);
                 }
+                else if (!inRange && sound->getIsLooping() && !sound->getInFade())
+                {
+                    // An out-of-range looping sound has finished fading out and can't
+                    // become audible again on its own: release its source for sounds
+                    // that are in range and keep tracking it logically.
+                    mOutput->finishSound(sound);
+                    sound->setIsVirtual(true);
+                    ++sndidx;
+                }
                 else
                 {
                     mOutput->updateSound(sound);
@@ -1270,6 +1321,8 @@ namespace MWSound
         mActiveSounds.clear();
         mUnderwaterSound = nullptr;
         mNearWaterSound = nullptr;
+        mPreloadedRegion = ESM::RefId();
+        mRegionSoundPreloadQueue.clear();
 
         for (SaySoundMap::value_type& snd : mSaySoundsQueue)
             mOutput->finishStream(snd.second.mStream.get());
@@ -1,6 +1,7 @@
 #ifndef GAME_SOUND_SOUNDMANAGER_H
 #define GAME_SOUND_SOUNDMANAGER_H
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
@@ -103,6 +104,11 @@ namespace MWSound
 
         RegionSoundSelector mRegionSoundSelector;
 
+        // Region whose ambient sounds have been queued for preloading, and the
+        // buffers still waiting to be loaded (one per update, to bound the cost).
+        ESM::RefId mPreloadedRegion;
+        std::deque<ESM::RefId> mRegionSoundPreloadQueue;
+
         float mTimePassed;
 
         const MWWorld::Cell* mLastCell;
@@ -122,7 +128,9 @@ namespace MWSound
         void streamMusicFull(VFS::Path::NormalizedView filename);
         void advanceMusic(VFS::Path::NormalizedView filename, float fadeOut = 1.f);
 
-        void cull3DSound(SoundBase* sound);
+        /// Fades the sound in or out depending on the listener distance.
+        /// \return true if the listener is within the sound's audible range.
+        bool cull3DSound(SoundBase* sound);
 
         bool remove3DSoundAtDistance(PlayMode mode, const MWWorld::ConstPtr& ptr) const;
 
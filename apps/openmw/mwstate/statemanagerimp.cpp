@@ -1,11 +1,13 @@
 #include "statemanagerimp.hpp"
 
 #include <filesystem>
+#include <utility>
 
 #include <SDL_clipboard.h>
 
 #include <components/debug/debuglog.hpp>
 
+#include <components/esm3/compressedsave.hpp>
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/esmwriter.hpp>
 #include <components/esm3/loadcell.hpp>
@@ -107,6 +109,39 @@ MWState::StateManager::StateManager(const std::filesystem::path& saves, const st
 {
 }
 
+MWState::StateManager::~StateManager()
+{
+    if (mWriteThread.joinable())
+        mWriteThread.join();
+}
+
+void MWState::StateManager::finishBackgroundWrite()
+{
+    if (mWriteThread.joinable())
+        mWriteThread.join();
+
+    if (!mWriteError.empty())
+    {
+        const std::string error = std::exchange(mWriteError, {});
+
+        Log(Debug::Error) << error;
+
+        std::vector<std::string> buttons;
+        buttons.emplace_back("#{Interface:OK}");
+        MWBase::Environment::get().getWindowManager()->interactiveMessageBox(error, buttons);
+
+        // If no file was written, clean up the slot
+        if (mWriteCharacter && mWriteSlot && !std::filesystem::exists(mWriteSlot->mPath))
+        {
+            mWriteCharacter->deleteSlot(mWriteSlot);
+            mWriteCharacter->cleanup();
+        }
+    }
+
+    mWriteCharacter = nullptr;
+    mWriteSlot = nullptr;
+}
+
 void MWState::StateManager::requestQuit()
 {
     mQuitRequest = true;
@@ -215,6 +250,9 @@ void MWState::StateManager::saveGame(std::string_view description, const Slot* s
 {
     MWBase::Environment::get().getLuaManager()->applyDelayedActions();
 
+    // Wait for a previous save still being written out before touching the slots again.
+    finishBackgroundWrite();
+
     MWState::Character* character = getCurrentCharacter();
 
     try
@@ -334,19 +372,37 @@ void MWState::StateManager::saveGame(std::string_view description, const Slot* s
         if (stream.fail())
             throw std::runtime_error("Write operation failed (memory stream)");
 
-        // All good, write to file
-        std::ofstream filestream(slot->mPath, std::ios::binary);
-        filestream << stream.rdbuf();
-
-        if (filestream.fail())
-            throw std::runtime_error("Write operation failed (file stream)");
+        // All good. Compress and write out on a background thread; the serialized state is
+        // complete at this point, so the frame does not have to wait for slow storage.
+        const bool compress = Settings::saves().mCompressSaves;
+        mWriteCharacter = character;
+        mWriteSlot = slot;
+        mWriteThread = std::thread([this, path = slot->mPath, buffer = std::move(stream), compress]() mutable {
+            try
+            {
+                std::ofstream filestream(path, std::ios::binary);
+                if (compress)
+                    ESM::compressSave(buffer, filestream);
+                else
+                    filestream << buffer.rdbuf();
+
+                if (filestream.fail())
+                    throw std::runtime_error("Write operation failed (file stream)");
+            }
+            catch (const std::exception& e)
+            {
+                std::error_code ec;
+                std::filesystem::remove(path, ec);
+                mWriteError = "Failed to save game: " + std::string(e.what());
+            }
+        });
 
         Settings::saves().mCharacter.set(Files::pathToUnicodeString(slot->mPath.parent_path().filename()));
         mLastSavegame = slot->mPath;
 
         const auto finish = std::chrono::steady_clock::now();
 
-        Log(Debug::Info) << '\'' << description << "' is saved in "
+        Log(Debug::Info) << '\'' << description << "' is serialized in "
                          << std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(finish - start).count()
                          << "ms";
     }
@@ -452,6 +508,9 @@ struct SaveVersionTooNewError : SaveFormatVersionError
 
 void MWState::StateManager::loadGame(const Character* character, const std::filesystem::path& filepath)
 {
+    // The file to load could still be written out by a previous save.
+    finishBackgroundWrite();
+
     try
     {
         cleanup();
@@ -705,6 +764,8 @@ void MWState::StateManager::quickLoad()
 
 void MWState::StateManager::deleteGame(const MWState::Character* character, const MWState::Slot* slot)
 {
+    finishBackgroundWrite();
+
     const std::filesystem::path savePath = slot->mPath;
     mCharacterManager.deleteSlot(character, slot);
     if (mLastSavegame == savePath)
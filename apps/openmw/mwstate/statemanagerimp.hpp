@@ -3,6 +3,8 @@
 
 #include <filesystem>
 #include <map>
+#include <string>
+#include <thread>
 
 #include "../mwbase/statemanager.hpp"
 
@@ -21,7 +23,18 @@ namespace MWState
         double mTimePlayed;
         std::filesystem::path mLastSavegame;
 
+        // Once a save is serialized to memory, compressing and writing it out happens on
+        // this thread so the frame does not wait for slow storage. Joined before anything
+        // touches the save files again.
+        std::thread mWriteThread;
+        std::string mWriteError;
+        Character* mWriteCharacter = nullptr;
+        const Slot* mWriteSlot = nullptr;
+
     private:
+        void finishBackgroundWrite();
+
+
         void cleanup(bool force = false);
 
         void printSavegameFormatError(const std::string& exceptionText, const std::string& messageBoxText);
@@ -35,6 +48,8 @@ namespace MWState
     public:
         StateManager(const std::filesystem::path& saves, const std::vector<std::string>& contentFiles);
 
+        ~StateManager() override;
+
         void requestQuit() override;
 
         bool hasQuitRequest() const override;
@@ -6,6 +6,7 @@
 #include <span>
 
 #include <osg/Stats>
+#include <osg/Timer>
 
 #include <components/debug/debuglog.hpp>
 #include <components/esm3/loadcell.hpp>
@@ -66,12 +67,14 @@ namespace MWWorld
     {
     public:
         /// Constructor to be called from the main thread.
-        explicit PreloadItem(MWWorld::CellStore* cell, Resource::SceneManager* sceneManager,
-            Resource::BulletShapeManager* bulletShapeManager, Resource::KeyframeManager* keyframeManager,
-            Terrain::World* terrain, MWRender::LandManager* landManager, bool preloadInstances)
+        explicit PreloadItem(MWWorld::CellStore* cell, std::vector<std::string_view> meshes,
+            Resource::SceneManager* sceneManager, Resource::BulletShapeManager* bulletShapeManager,
+            Resource::KeyframeManager* keyframeManager, Terrain::World* terrain, MWRender::LandManager* landManager,
+            bool preloadInstances)
             : mIsExterior(cell->getCell()->isExterior())
             , mCellLocation(cell->getCell()->getExteriorCellLocation())
             , mCellId(cell->getCell()->getId())
+            , mMeshes(std::move(meshes))
             , mSceneManager(sceneManager)
             , mBulletShapeManager(bulletShapeManager)
             , mKeyframeManager(keyframeManager)
@@ -81,9 +84,6 @@ namespace MWWorld
             , mAbort(false)
         {
             mTerrainView = mTerrain->createView();
-
-            ListModelsVisitor visitor{ mMeshes };
-            cell->forEachConst(visitor);
         }
 
         void abort() override { mAbort = true; }
@@ -237,7 +237,14 @@ namespace MWWorld
         clearAllTasks();
     }
 
-    void CellPreloader::preload(CellStore& cell, double timestamp)
+    void CellPreloader::startFrame(double budget)
+    {
+        mFrameBudget = budget;
+        mFrameDispatchTime = 0.0;
+        mDispatchedThisFrame = 0;
+    }
+
+    void CellPreloader::preload(CellStore& cell, double timestamp, bool highPriority)
     {
         if (!mWorkQueue)
         {
@@ -258,6 +265,16 @@ namespace MWWorld
             return;
         }
 
+        // Dispatching a preload may scan the cell contents on the main thread, which adds up
+        // with many requests in one frame. Callers repeat their requests every frame, so cells
+        // deferred once the budget is spent are simply picked up again on a later frame.
+        if (mFrameBudget > 0 && !highPriority && mDispatchedThisFrame > 0
+            && mFrameDispatchTime + mDispatchBudget.get() > mFrameBudget)
+        {
+            ++mDeferred;
+            return;
+        }
+
         while (mPreloadCells.size() >= mMaxCacheSize)
         {
             // throw out oldest cell to make room
@@ -283,9 +300,27 @@ namespace MWWorld
                 return;
         }
 
-        osg::ref_ptr<PreloadItem> item(new PreloadItem(&cell, mResourceSystem->getSceneManager(), mBulletShapeManager,
-            mResourceSystem->getKeyframeManager(), mTerrain, mLandManager, mPreloadInstances));
-        mWorkQueue->addWorkItem(item);
+        const osg::Timer_t dispatchStart = osg::Timer::instance()->tick();
+
+        // The scan result is kept per cell so that cells drifting in and out of preload range
+        // don't get their refs walked again; only loading the cell invalidates it.
+        const auto [meshesIt, scan] = mMeshesCache.try_emplace(&cell);
+        if (scan)
+        {
+            ListModelsVisitor visitor{ meshesIt->second };
+            cell.forEachConst(visitor);
+        }
+
+        osg::ref_ptr<PreloadItem> item(new PreloadItem(&cell, meshesIt->second, mResourceSystem->getSceneManager(),
+            mBulletShapeManager, mResourceSystem->getKeyframeManager(), mTerrain, mLandManager, mPreloadInstances));
+        mWorkQueue->addWorkItem(
+            item, highPriority ? SceneUtil::WorkPriority::Normal : SceneUtil::WorkPriority::Background);
+
+        const double dispatchDuration
+            = osg::Timer::instance()->delta_s(dispatchStart, osg::Timer::instance()->tick());
+        mDispatchBudget.update(dispatchDuration, 1, mBudgetCursor++);
+        mFrameDispatchTime += dispatchDuration;
+        ++mDispatchedThisFrame;
 
         mPreloadCells.emplace(&cell, PreloadEntry(timestamp, item));
         ++mAdded;
@@ -305,6 +340,9 @@ namespace MWWorld
             mPreloadCells.erase(found);
             ++mLoaded;
         }
+
+        // Active cells change their contents, so the next preload has to scan again
+        mMeshesCache.erase(cell);
     }
 
     void CellPreloader::clear()
@@ -319,6 +357,8 @@ namespace MWWorld
 
             mPreloadCells.erase(it++);
         }
+
+        mMeshesCache.clear();
     }
 
     void CellPreloader::updateCache(double timestamp)
@@ -344,7 +384,7 @@ namespace MWWorld
             // the resource cache is cleared from the worker thread so that we're not holding up the main thread with
             // delete operations
             mUpdateCacheItem = new UpdateCacheItem(mResourceSystem, timestamp);
-            mWorkQueue->addWorkItem(mUpdateCacheItem, true);
+            mWorkQueue->addWorkItem(mUpdateCacheItem, SceneUtil::WorkPriority::Urgent);
             mLastResourceCacheUpdate = timestamp;
         }
 
@@ -373,7 +413,12 @@ namespace MWWorld
     void CellPreloader::syncTerrainLoad(Loading::Listener& listener)
     {
         if (mTerrainPreloadItem != nullptr && !mTerrainPreloadItem->isDone())
+        {
+            // The item was queued speculatively; now that we wait on it, stop cell preloads from
+            // running first.
+            mWorkQueue->prioritize(mTerrainPreloadItem, SceneUtil::WorkPriority::Urgent);
             mTerrainPreloadItem->wait(listener);
+        }
     }
 
     void CellPreloader::abortTerrainPreloadExcept(const PositionCellGrid* exceptPos)
@@ -413,7 +458,7 @@ namespace MWWorld
             if (!positions.empty())
             {
                 mTerrainPreloadItem = new TerrainPreloadItem(mTerrainViews, mTerrain, positions);
-                mWorkQueue->addWorkItem(mTerrainPreloadItem);
+                mWorkQueue->addWorkItem(mTerrainPreloadItem, SceneUtil::WorkPriority::Background);
             }
         }
     }
@@ -464,5 +509,6 @@ namespace MWWorld
         stats.setAttribute(frameNumber, "CellPreloader Evicted", mEvicted);
         stats.setAttribute(frameNumber, "CellPreloader Loaded", mLoaded);
         stats.setAttribute(frameNumber, "CellPreloader Expired", mExpired);
+        stats.setAttribute(frameNumber, "CellPreloader Deferred", mDeferred);
     }
 }
@@ -3,12 +3,15 @@
 
 #include "positioncellgrid.hpp"
 
+#include <components/misc/budgetmeasurement.hpp>
 #include <components/sceneutil/workqueue.hpp>
 
 #include <osg/ref_ptr>
 
 #include <map>
 #include <span>
+#include <string_view>
+#include <vector>
 
 namespace osg
 {
@@ -50,8 +53,15 @@ namespace MWWorld
         ~CellPreloader();
 
         /// Ask a background thread to preload rendering meshes and collision shapes for objects in this cell.
+        /// High priority requests are queued ahead of pending work items and ignore the
+        /// per-frame dispatch budget.
         /// @note The cell itself must be in State_Loaded or State_Preloaded.
-        void preload(MWWorld::CellStore& cell, double timestamp);
+        void preload(MWWorld::CellStore& cell, double timestamp, bool highPriority = false);
+
+        /// Begin a new frame: normal priority preload dispatches (which scan the cell contents
+        /// on the main thread) stop once \a budget seconds have been spent and resume next frame.
+        /// A budget of 0 disables the limit.
+        void startFrame(double budget);
 
         void notifyLoaded(MWWorld::CellStore* cell);
 
@@ -122,6 +132,12 @@ namespace MWWorld
         // Cells that are currently being preloaded, or have already finished preloading
         PreloadMap mPreloadCells;
 
+        // The model list scanned from each cell's contents, kept so that cells drifting in and
+        // out of preload range don't get their refs walked again. The views point into ESM store
+        // records, which live as long as the session. Invalidated when the cell gets loaded,
+        // since only active cells change their contents.
+        std::map<const MWWorld::CellStore*, std::vector<std::string_view>> mMeshesCache;
+
         std::vector<osg::ref_ptr<Terrain::View>> mTerrainViews;
         std::vector<PositionCellGrid> mTerrainPreloadPositions;
         osg::ref_ptr<TerrainPreloadItem> mTerrainPreloadItem;
@@ -133,6 +149,13 @@ namespace MWWorld
         std::size_t mAdded = 0;
         std::size_t mExpired = 0;
         std::size_t mLoaded = 0;
+        std::size_t mDeferred = 0;
+
+        Misc::BudgetMeasurement mDispatchBudget{ 0.00025f };
+        std::size_t mBudgetCursor = 0;
+        double mFrameBudget = 0.0;
+        double mFrameDispatchTime = 0.0;
+        std::size_t mDispatchedThisFrame = 0;
     };
 
 }
@@ -1,7 +1,7 @@
 #ifndef GAME_MWWORLD_CELLREFLIST_H
 #define GAME_MWWORLD_CELLREFLIST_H
 
-#include <list>
+#include <components/misc/stablechunkedlist.hpp>
 
 #include "livecellref.hpp"
 
@@ -16,7 +16,9 @@ namespace MWWorld
     struct CellRefList : public CellRefListBase
     {
         typedef LiveCellRef<X> LiveRef;
-        typedef std::list<LiveRef> List;
+        /// Chunked storage with stable addresses: Ptr instances keep pointers into the list and
+        /// visitors in cellvisitors.hpp walk it every frame.
+        typedef Misc::StableChunkedList<LiveRef> List;
         List mList;
 
         /// Search for the given reference in the given reclist from
@@ -43,7 +45,7 @@ namespace MWWorld
             for (typename List::iterator it = mList.begin(); it != mList.end();)
             {
                 if (*it == refNum)
-                    mList.erase(it++);
+                    it = mList.erase(it);
                 else
                     ++it;
             }
@@ -2,7 +2,9 @@
 #include "magiceffects.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <thread>
 
 #include <components/debug/debuglog.hpp>
 
@@ -71,6 +73,7 @@
 #include <components/files/openfile.hpp>
 #include <components/misc/tuplehelpers.hpp>
 #include <components/resource/resourcesystem.hpp>
+#include <components/settings/values.hpp>
 
 #include "../mwbase/environment.hpp"
 #include "../mwbase/mechanicsmanager.hpp"
@@ -233,48 +236,9 @@ namespace
     }
 
     template <typename T>
-    void readReferenceCollection(ESM::ESMReader& reader, MWWorld::CellRefList<T>& collection, const ESM::CellRef& cref,
-        const MWWorld::ESMStore& esmStore, MWWorld::CellStore* cellstore)
+    void applyReferenceState(typename RecordToState<T>::StateType&& state, const T* record, MWWorld::CellStore* cellstore)
     {
-        using StateType = typename RecordToState<T>::StateType;
-        StateType state;
-        state.mRef = cref;
-        state.load(reader);
-
-        // If the reference came from a content file, make sure this content file is loaded
-        if (!reader.applyContentFileMapping(state.mRef.mRefNum))
-            return; // content file has been removed -> skip
-
-        if (!MWWorld::LiveCellRef<T>::checkState(state))
-            return; // not valid anymore with current content files -> skip
-
-        const T* record = esmStore.get<T>().search(state.mRef.mRefID);
-
-        if (!record)
-            return;
-
-        if (state.mVersion <= ESM::MaxOldRestockingFormatVersion)
-            fixRestocking(record, state);
-        if (state.mVersion <= ESM::MaxClearModifiersFormatVersion)
-        {
-            if constexpr (std::is_same_v<T, ESM::Creature>)
-                MWWorld::convertMagicEffects(state.mCreatureStats, state.mInventory);
-            else if constexpr (std::is_same_v<T, ESM::NPC>)
-                MWWorld::convertMagicEffects(state.mCreatureStats, state.mInventory, &state.mNpcStats);
-        }
-        else if (state.mVersion <= ESM::MaxOldCreatureStatsFormatVersion)
-        {
-            if constexpr (std::is_same_v<T, ESM::Creature> || std::is_same_v<T, ESM::NPC>)
-            {
-                MWWorld::convertStats(state.mCreatureStats);
-                MWWorld::convertEnchantmentSlots(state.mCreatureStats, state.mInventory);
-            }
-        }
-        else if (state.mVersion <= ESM::MaxActiveSpellSlotIndexFormatVersion)
-        {
-            if constexpr (std::is_same_v<T, ESM::Creature> || std::is_same_v<T, ESM::NPC>)
-                MWWorld::convertEnchantmentSlots(state.mCreatureStats, state.mInventory);
-        }
+        MWWorld::CellRefList<T>& collection = cellstore->get<T>();
 
         if (state.mRef.mRefNum.hasContentFile())
         {
@@ -325,6 +289,58 @@ namespace
         MWBase::Environment::get().getWorldModel()->registerPtr(MWWorld::Ptr(base, cellstore));
     }
 
+    // Decode one serialized object state without touching the cell. The returned function applies
+    // the state and must run on the main thread; an empty function means the state is stale and
+    // should be dropped. The collection argument only selects the record type.
+    template <typename T>
+    std::function<void(MWWorld::CellStore&)> decodeReferenceState(ESM::ESMReader& reader,
+        MWWorld::CellRefList<T>& /*collection*/, const ESM::CellRef& cref, const MWWorld::ESMStore& esmStore)
+    {
+        using StateType = typename RecordToState<T>::StateType;
+        StateType state;
+        state.mRef = cref;
+        state.load(reader);
+
+        // If the reference came from a content file, make sure this content file is loaded
+        if (!reader.applyContentFileMapping(state.mRef.mRefNum))
+            return {}; // content file has been removed -> skip
+
+        if (!MWWorld::LiveCellRef<T>::checkState(state))
+            return {}; // not valid anymore with current content files -> skip
+
+        const T* record = esmStore.get<T>().search(state.mRef.mRefID);
+
+        if (!record)
+            return {};
+
+        if (state.mVersion <= ESM::MaxOldRestockingFormatVersion)
+            fixRestocking(record, state);
+        if (state.mVersion <= ESM::MaxClearModifiersFormatVersion)
+        {
+            if constexpr (std::is_same_v<T, ESM::Creature>)
+                MWWorld::convertMagicEffects(state.mCreatureStats, state.mInventory);
+            else if constexpr (std::is_same_v<T, ESM::NPC>)
+                MWWorld::convertMagicEffects(state.mCreatureStats, state.mInventory, &state.mNpcStats);
+        }
+        else if (state.mVersion <= ESM::MaxOldCreatureStatsFormatVersion)
+        {
+            if constexpr (std::is_same_v<T, ESM::Creature> || std::is_same_v<T, ESM::NPC>)
+            {
+                MWWorld::convertStats(state.mCreatureStats);
+                MWWorld::convertEnchantmentSlots(state.mCreatureStats, state.mInventory);
+            }
+        }
+        else if (state.mVersion <= ESM::MaxActiveSpellSlotIndexFormatVersion)
+        {
+            if constexpr (std::is_same_v<T, ESM::Creature> || std::is_same_v<T, ESM::NPC>)
+                MWWorld::convertEnchantmentSlots(state.mCreatureStats, state.mInventory);
+        }
+
+        return [state = std::move(state), record](MWWorld::CellStore& cellStore) mutable {
+            applyReferenceState(std::move(state), record, &cellStore);
+        };
+    }
+
     // this function allows us to link a CellRefList<T> to the associated recNameInt, and apply a function
     template <typename RecordType, typename Callable>
     static void recNameSwitcher(MWWorld::CellRefList<RecordType>& store, ESM::RecNameInts recnNameInt, Callable&& f)
@@ -490,7 +506,7 @@ namespace MWWorld
         if (mState != State_Loaded)
             load();
 
-        mHasState = true;
+        touchState();
         MovedRefTracker::iterator found = mMovedToAnotherCell.find(object.getBase());
         if (found != mMovedToAnotherCell.end())
         {
@@ -640,6 +656,26 @@ namespace MWWorld
         return mHasState;
     }
 
+    std::size_t CellStore::getStateRevision() const
+    {
+        return mStateRevision;
+    }
+
+    void CellStore::setActiveInScene(bool active)
+    {
+        mActiveInScene = active;
+        if (active)
+            mExternalReference.store(false, std::memory_order_relaxed);
+        else
+            ++mStateRevision;
+    }
+
+    void CellStore::markExternalReference()
+    {
+        if (!mActiveInScene)
+            mExternalReference.store(true, std::memory_order_relaxed);
+    }
+
     bool CellStore::hasId(const ESM::RefId& id) const
     {
         if (mState == State_Unloaded)
@@ -738,7 +774,7 @@ namespace MWWorld
     void CellStore::setWaterLevel(float level)
     {
         mWaterLevel = level;
-        mHasState = true;
+        touchState();
     }
 
     std::size_t CellStore::count() const
@@ -855,49 +891,102 @@ namespace MWWorld
         std::sort(mIds.begin(), mIds.end());
     }
 
-    void CellStore::loadRefs(const ESM::Cell& cell, std::map<ESM::RefNum, ESM::RefId>& refNumToID)
+    namespace
     {
-        if (cell.mContextList.empty())
-            return; // this is a dynamically generated cell -> skipping.
+        struct DecodedCellRef
+        {
+            ESM::CellRef mRef;
+            bool mDeleted;
+        };
+    }
 
-        // Load references from all plugins that do something with this cell.
-        for (size_t i = 0; i < cell.mContextList.size(); i++)
+    // Reads the references a single content file stores for the cell into a buffer without
+    // applying them, so the reference lists of several content files can be decoded concurrently.
+    static std::vector<DecodedCellRef> decodeCellRefs(
+        const ESM::Cell& cell, ESM::ReadersCache& readers, std::size_t contextIndex)
+    {
+        std::vector<DecodedCellRef> refs;
+
+        // Reopen the ESM reader and seek to the right position.
+        const std::size_t index = static_cast<std::size_t>(cell.mContextList[contextIndex].index);
+        const ESM::ReadersCache::BusyItem reader = readers.get(index);
+        cell.restore(*reader, contextIndex);
+
+        ESM::CellRef ref;
+        // Get each reference in turn
+        ESM::MovedCellRef cMRef;
+        bool deleted = false;
+        bool moved = false;
+        while (ESM::Cell::getNextRef(*reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
         {
-            try
+            if (moved)
+                continue;
+
+            // Don't load reference if it was moved to a different cell.
+            ESM::MovedCellRefTracker::const_iterator iter
+                = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum);
+            if (iter != cell.mMovedRefs.end())
             {
-                // Reopen the ESM reader and seek to the right position.
-                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-                const ESM::ReadersCache::BusyItem reader = mReaders.get(index);
-                cell.restore(*reader, i);
+                continue;
+            }
 
-                ESM::CellRef ref;
-                // Get each reference in turn
-                ESM::MovedCellRef cMRef;
-                bool deleted = false;
-                bool moved = false;
-                while (ESM::Cell::getNextRef(
-                    *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                {
-                    if (moved)
-                        continue;
+            refs.push_back({ std::move(ref), deleted });
+        }
 
-                    // Don't load reference if it was moved to a different cell.
-                    ESM::MovedCellRefTracker::const_iterator iter
-                        = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum);
-                    if (iter != cell.mMovedRefs.end())
-                    {
-                        continue;
-                    }
+        return refs;
+    }
 
-                    loadRef(ref, deleted, refNumToID);
-                }
+    void CellStore::loadRefs(const ESM::Cell& cell, std::map<ESM::RefNum, ESM::RefId>& refNumToID)
+    {
+        if (cell.mContextList.empty())
+            return; // this is a dynamically generated cell -> skipping.
+
+        // Decode references from all plugins that do something with this cell, optionally in
+        // parallel. Each worker claims whole content files so every ESM reader is only ever used
+        // by one thread at a time.
+        std::vector<std::vector<DecodedCellRef>> decodedRefs(cell.mContextList.size());
+
+        const auto decodeContext = [&](std::size_t i) {
+            try
+            {
+                decodedRefs[i] = decodeCellRefs(cell, mReaders, i);
             }
             catch (std::exception& e)
             {
                 Log(Debug::Error) << "An error occurred loading references for cell " << getCell()->getDescription()
                                   << ": " << e.what();
             }
+        };
+
+        const std::size_t numThreads = std::min(
+            std::max<std::size_t>(Settings::cells().mCellLoadNumThreads, 1), cell.mContextList.size());
+
+        if (numThreads > 1)
+        {
+            std::atomic_size_t nextContext{ 0 };
+            std::vector<std::thread> workers;
+            workers.reserve(numThreads);
+            for (std::size_t i = 0; i < numThreads; ++i)
+                workers.emplace_back([&] {
+                    for (std::size_t context = nextContext++; context < cell.mContextList.size();
+                         context = nextContext++)
+                        decodeContext(context);
+                });
+            for (std::thread& worker : workers)
+                worker.join();
         }
+        else
+        {
+            for (std::size_t i = 0; i < cell.mContextList.size(); i++)
+                decodeContext(i);
+        }
+
+        // Apply the buffered references in content file order so later plugins override earlier
+        // ones exactly as they do with serial loading.
+        for (std::vector<DecodedCellRef>& refs : decodedRefs)
+            for (DecodedCellRef& decoded : refs)
+                loadRef(decoded.mRef, decoded.mDeleted, refNumToID);
+
         // Load moved references, from separately tracked list.
         for (const auto& leasedRef : cell.mLeasedRefs)
         {
@@ -1023,7 +1112,7 @@ namespace MWWorld
 
     void CellStore::loadState(const ESM::CellState& state)
     {
-        mHasState = true;
+        touchState();
 
         if (!mCellVariant.isExterior() && mCellVariant.hasWater())
             mWaterLevel = state.mWaterLevel;
@@ -1075,7 +1164,12 @@ namespace MWWorld
 
     void CellStore::readReferences(ESM::ESMReader& reader, GetCellStoreCallback* callback)
     {
-        mHasState = true;
+        applyReferences(decodeReferences(reader), callback);
+    }
+
+    CellStore::DecodedReferences CellStore::decodeReferences(ESM::ESMReader& reader)
+    {
+        DecodedReferences result;
 
         while (reader.isNextSub("OBJE"))
         {
@@ -1103,11 +1197,13 @@ namespace MWWorld
             {
                 bool foundCorrespondingStore = false;
                 Misc::tupleForEach(
-                    this->mCellStoreImp->mRefLists, [&reader, this, &cref, &foundCorrespondingStore, type](auto&& x) {
+                    this->mCellStoreImp->mRefLists, [&reader, this, &cref, &foundCorrespondingStore, type, &result](
+                                                        auto&& x) {
                         recNameSwitcher(x, static_cast<ESM::RecNameInts>(type),
-                            [&reader, this, &cref, &foundCorrespondingStore](auto& store) {
+                            [&reader, this, &cref, &foundCorrespondingStore, &result](auto& store) {
                                 foundCorrespondingStore = true;
-                                readReferenceCollection(reader, store, cref, mStore, this);
+                                if (auto apply = decodeReferenceState(reader, store, cref, mStore))
+                                    result.mObjectStates.push_back(std::move(apply));
                             });
                     });
 
@@ -1128,6 +1224,24 @@ namespace MWWorld
                 continue;
             }
 
+            result.mMovedRefs.push_back({ refnum, movedToId });
+        }
+
+        return result;
+    }
+
+    void CellStore::applyReferences(DecodedReferences&& references, GetCellStoreCallback* callback)
+    {
+        touchState();
+
+        for (std::function<void(CellStore&)>& apply : references.mObjectStates)
+            apply(*this);
+
+        for (const DecodedReferences::MovedRef& moved : references.mMovedRefs)
+        {
+            const ESM::RefNum refnum = moved.mRefNum;
+            const ESM::RefId movedToId = moved.mMovedToId;
+
             // Search for the reference. It might no longer exist if its content file was changed.
             Ptr movedRef = MWBase::Environment::get().getWorldModel()->getPtr(refnum);
             if (movedRef.isEmpty())
@@ -2,6 +2,8 @@
 #define GAME_MWWORLD_CELLSTORE_H
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -137,7 +139,7 @@ namespace MWWorld
         template <typename T>
         LiveCellRefBase* insert(const LiveCellRef<T>* ref)
         {
-            mHasState = true;
+            touchState();
             CellRefList<T>& list = get<T>();
             LiveCellRefBase* ret = &list.insert(*ref);
             requestMergedRefsUpdate();
@@ -167,6 +169,32 @@ namespace MWWorld
         bool hasState() const;
         ///< Does this cell have state that needs to be stored in a saved game file?
 
+        std::size_t getStateRevision() const;
+        ///< Monotonic counter advanced whenever the cell is flagged as having state. Equal values
+        /// mean the state that would be written to a saved game file has not changed.
+
+        void setActiveInScene(bool active);
+        ///< Called by Scene when the cell joins or leaves the set of active cells. While active,
+        /// references are mutated through Ptrs held by mechanics, physics and scripts without any
+        /// CellStore call, so WorldModel::writeCell must never reuse a cached record for an active
+        /// cell; leaving the scene advances the state revision to drop whatever was cached while
+        /// the cell was active.
+
+        bool isActiveInScene() const { return mActiveInScene; }
+
+        void markExternalReference();
+        ///< Called when a Ptr into this cell is resolved through WorldModel or a global script
+        /// target while the cell is not active. The holder may mutate references at any later
+        /// point without another CellStore call, so cached save records stay untrusted until the
+        /// next activation resets the flag. Deactivating a cell bumps the PtrRegistry revision,
+        /// which forces revision-gated holders (SafePtr) to resolve again and re-trigger this.
+
+        bool hasExternalReference() const { return mExternalReference.load(std::memory_order_relaxed); }
+
+        bool hasMovedRefs() const { return !mMovedToAnotherCell.empty(); }
+        ///< Does this cell own references that are currently moved to another cell? Their data is
+        /// serialized with this cell but mutated through Ptrs into the other cell.
+
         bool hasId(const ESM::RefId& id) const;
         ///< May return true for deleted IDs when in preload state. Will return false, if cell is
         /// unloaded.
@@ -223,7 +251,7 @@ namespace MWWorld
             if (mMergedRefs.empty())
                 return true;
 
-            mHasState = true;
+            touchState();
 
             for (LiveCellRefBase* mergedRef : mMergedRefs)
             {
@@ -277,7 +305,7 @@ namespace MWWorld
             if (mMergedRefs.empty())
                 return true;
 
-            mHasState = true;
+            touchState();
 
             CellRefList<T>& list = get<T>();
 
@@ -336,6 +364,28 @@ namespace MWWorld
         /// references)
         void readReferences(ESM::ESMReader& reader, GetCellStoreCallback* callback);
 
+        /// Reference section of a saved game cell state record, decoded into staging structures
+        /// by decodeReferences() and applied to the world by applyReferences().
+        struct DecodedReferences
+        {
+            struct MovedRef
+            {
+                ESM::RefNum mRefNum;
+                ESM::RefId mMovedToId;
+            };
+
+            std::vector<std::function<void(CellStore&)>> mObjectStates;
+            std::vector<MovedRef> mMovedRefs;
+        };
+
+        /// Decode the reference section of a saved game cell state record without touching the
+        /// cell. May be called from any thread; only the content files and the reader are read.
+        DecodedReferences decodeReferences(ESM::ESMReader& reader);
+
+        /// Apply references previously decoded by decodeReferences(). Must be called on the main
+        /// thread and in the order the cell state records appear in the saved game.
+        void applyReferences(DecodedReferences&& references, GetCellStoreCallback* callback);
+
         void respawn();
         ///< Check mLastRespawn and respawn references if necessary. This is a no-op if the cell is not loaded.
 
@@ -357,11 +407,26 @@ namespace MWWorld
         MWWorld::Cell mCellVariant;
         State mState;
         bool mHasState;
+        std::size_t mStateRevision = 0;
+        // Written by the main thread only, while cells change; the Lua worker is parked then
+        // (same discipline as PtrRegistry).
+        bool mActiveInScene = false;
+        // Atomic because Ptr resolution, and with it markExternalReference(), also happens on the
+        // Lua worker thread while the main thread renders.
+        std::atomic<bool> mExternalReference{ false };
         std::vector<ESM::RefId> mIds;
         float mWaterLevel;
 
         MWWorld::TimeStamp mLastRespawn;
 
+        /// Flag the cell as having state to save and advance the revision used to invalidate
+        /// cached serialized cell records (see WorldModel::writeCell).
+        void touchState()
+        {
+            mHasState = true;
+            ++mStateRevision;
+        }
+
         template <typename T>
         static constexpr std::size_t getTypeIndex()
         {
@@ -375,7 +440,7 @@ namespace MWWorld
         template <class T>
         CellRefList<T>& get()
         {
-            mHasState = true;
+            touchState();
             return static_cast<CellRefList<T>&>(*mCellRefLists[getTypeIndex<T>()]);
         }
 
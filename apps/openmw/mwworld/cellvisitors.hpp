@@ -2,7 +2,8 @@
 #define GAME_MWWORLD_CELLVISITORS_H
 
 #include <string>
-#include <vector>
+
+#include <components/misc/framearena.hpp>
 
 #include "ptr.hpp"
 
@@ -10,7 +11,8 @@ namespace MWWorld
 {
     struct ListAndResetObjectsVisitor
     {
-        std::vector<MWWorld::Ptr> mObjects;
+        // Frame-scoped: the visitor is a local in the current frame's cell unload
+        Misc::FrameVector<MWWorld::Ptr> mObjects;
 
         bool operator()(const MWWorld::Ptr& ptr)
         {
@@ -0,0 +1,48 @@
+#include "commonids.hpp"
+
+namespace MWWorld
+{
+    namespace CommonIds
+    {
+        const ESM::RefId Player = ESM::RefId::stringRefId("Player");
+        const ESM::RefId WolfRun = ESM::RefId::stringRefId("WolfRun");
+
+        const ESM::RefId VFX_Hands = ESM::RefId::stringRefId("VFX_Hands");
+        const ESM::RefId VFX_Absorb = ESM::RefId::stringRefId("VFX_Absorb");
+        const ESM::RefId VFX_Reflect = ESM::RefId::stringRefId("VFX_Reflect");
+        const ESM::RefId VFX_SoulTrap = ESM::RefId::stringRefId("VFX_Soul_Trap");
+        const ESM::RefId VFX_SummonStart = ESM::RefId::stringRefId("VFX_Summon_Start");
+        const ESM::RefId VFX_SummonEnd = ESM::RefId::stringRefId("VFX_Summon_End");
+        const ESM::RefId VFX_DefaultCast = ESM::RefId::stringRefId("VFX_DefaultCast");
+        const ESM::RefId VFX_DefaultHit = ESM::RefId::stringRefId("VFX_DefaultHit");
+        const ESM::RefId VFX_DefaultArea = ESM::RefId::stringRefId("VFX_DefaultArea");
+        const ESM::RefId VFX_DefaultBolt = ESM::RefId::stringRefId("VFX_DefaultBolt");
+
+        const ESM::RefId HealthDamage = ESM::RefId::stringRefId("Health Damage");
+        const ESM::RefId HandToHandHit = ESM::RefId::stringRefId("Hand To Hand Hit");
+        const ESM::RefId CriticalDamage = ESM::RefId::stringRefId("critical damage");
+        const ESM::RefId LightArmorHit = ESM::RefId::stringRefId("Light Armor Hit");
+        const ESM::RefId MediumArmorHit = ESM::RefId::stringRefId("Medium Armor Hit");
+        const ESM::RefId HeavyArmorHit = ESM::RefId::stringRefId("Heavy Armor Hit");
+        const ESM::RefId WeaponSwish = ESM::RefId::stringRefId("Weapon Swish");
+        const ESM::RefId Drown = ESM::RefId::stringRefId("drown");
+        const ESM::RefId MagicSound = ESM::RefId::stringRefId("magic sound");
+
+        const ESM::RefId TopicAttack = ESM::RefId::stringRefId("attack");
+        const ESM::RefId TopicHit = ESM::RefId::stringRefId("hit");
+        const ESM::RefId TopicIdle = ESM::RefId::stringRefId("idle");
+        const ESM::RefId TopicHello = ESM::RefId::stringRefId("hello");
+        const ESM::RefId TopicFlee = ESM::RefId::stringRefId("flee");
+        const ESM::RefId TopicIntruder = ESM::RefId::stringRefId("intruder");
+        const ESM::RefId TopicThief = ESM::RefId::stringRefId("thief");
+
+        const ESM::RefId fAlarmRadius = ESM::RefId::stringRefId("fAlarmRadius");
+        const ESM::RefId fVoiceIdleOdds = ESM::RefId::stringRefId("fVoiceIdleOdds");
+        const ESM::RefId fSuffocationDamage = ESM::RefId::stringRefId("fSuffocationDamage");
+        const ESM::RefId fCombatDelayCreature = ESM::RefId::stringRefId("fCombatDelayCreature");
+        const ESM::RefId fCombatDelayNPC = ESM::RefId::stringRefId("fCombatDelayNPC");
+        const ESM::RefId iVoiceAttackOdds = ESM::RefId::stringRefId("iVoiceAttackOdds");
+        const ESM::RefId fCombatDistance = ESM::RefId::stringRefId("fCombatDistance");
+        const ESM::RefId iMaxActivateDist = ESM::RefId::stringRefId("iMaxActivateDist");
+    }
+}
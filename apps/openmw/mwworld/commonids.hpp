@@ -0,0 +1,63 @@
+#ifndef OPENMW_MWWORLD_COMMONIDS_H
+#define OPENMW_MWWORLD_COMMONIDS_H
+
+#include <components/esm/refid.hpp>
+
+namespace MWWorld
+{
+    /// Ids the engine refers to by hardcoded literal on hot code paths. Building them
+    /// with ESM::RefId::stringRefId at the call site pays a lock and a lookup in the
+    /// global string set on every call; the constants here are interned once at startup
+    /// instead, following the pattern of ESM::Skill's and ESM::Attribute's id constants.
+    /// Ids that are only looked up on rare events stay literals at their call sites.
+    namespace CommonIds
+    {
+        // Records
+        extern const ESM::RefId Player;
+        extern const ESM::RefId WolfRun;
+
+        // Magic VFX statics
+        extern const ESM::RefId VFX_Hands;
+        extern const ESM::RefId VFX_Absorb;
+        extern const ESM::RefId VFX_Reflect;
+        extern const ESM::RefId VFX_SoulTrap;
+        extern const ESM::RefId VFX_SummonStart;
+        extern const ESM::RefId VFX_SummonEnd;
+        extern const ESM::RefId VFX_DefaultCast;
+        extern const ESM::RefId VFX_DefaultHit;
+        extern const ESM::RefId VFX_DefaultArea;
+        extern const ESM::RefId VFX_DefaultBolt;
+
+        // Sounds
+        extern const ESM::RefId HealthDamage;
+        extern const ESM::RefId HandToHandHit;
+        extern const ESM::RefId CriticalDamage;
+        extern const ESM::RefId LightArmorHit;
+        extern const ESM::RefId MediumArmorHit;
+        extern const ESM::RefId HeavyArmorHit;
+        extern const ESM::RefId WeaponSwish;
+        extern const ESM::RefId Drown;
+        extern const ESM::RefId MagicSound;
+
+        // Voiced dialogue topics
+        extern const ESM::RefId TopicAttack;
+        extern const ESM::RefId TopicHit;
+        extern const ESM::RefId TopicIdle;
+        extern const ESM::RefId TopicHello;
+        extern const ESM::RefId TopicFlee;
+        extern const ESM::RefId TopicIntruder;
+        extern const ESM::RefId TopicThief;
+
+        // Game settings fetched during the per-frame updates
+        extern const ESM::RefId fAlarmRadius;
+        extern const ESM::RefId fVoiceIdleOdds;
+        extern const ESM::RefId fSuffocationDamage;
+        extern const ESM::RefId fCombatDelayCreature;
+        extern const ESM::RefId fCombatDelayNPC;
+        extern const ESM::RefId iVoiceAttackOdds;
+        extern const ESM::RefId fCombatDistance;
+        extern const ESM::RefId iMaxActivateDist;
+    }
+}
+
+#endif
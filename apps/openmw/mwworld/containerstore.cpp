@@ -58,23 +58,6 @@ namespace
         return sum;
     }
 
-    template <typename T>
-    MWWorld::Ptr searchId(MWWorld::CellRefList<T>& list, const ESM::RefId& id, MWWorld::ContainerStore* store)
-    {
-        store->resolve();
-
-        for (MWWorld::LiveCellRef<T>& liveCellRef : list.mList)
-        {
-            if ((liveCellRef.mBase->mId == id) && liveCellRef.mRef.getCount())
-            {
-                MWWorld::Ptr ptr(&liveCellRef, nullptr);
-                ptr.setContainerStore(store);
-                return ptr;
-            }
-        }
-
-        return MWWorld::Ptr();
-    }
 }
 
 MWWorld::ResolutionListener::~ResolutionListener()
@@ -106,6 +89,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::getState(
     collection.mList.push_back(ref);
     auto it = ContainerStoreIterator(this, --collection.mList.end());
     MWBase::Environment::get().getWorldModel()->registerPtr(*it);
+    indexNewStack(it);
 
     return it;
 }
@@ -189,13 +173,36 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::end()
 
 int MWWorld::ContainerStore::count(const ESM::RefId& id) const
 {
+    updateStackIndex();
+
+    const auto stacks = mStackIndex.mStacks.find(id);
+    if (stacks == mStackIndex.mStacks.end())
+        return 0;
+
     int total = 0;
-    for (const auto&& iter : *this)
-        if (iter.getCellRef().getRefId() == id)
-            total += iter.getCellRef().getCount();
+    for (const LiveCellRefBase* stack : stacks->second)
+        total += stack->mRef.getCount();
     return total;
 }
 
+void MWWorld::ContainerStore::updateStackIndex() const
+{
+    if (mStackIndex.mUpToDate)
+        return;
+
+    mStackIndex.mStacks.clear();
+    auto& self = const_cast<ContainerStore&>(*this);
+    for (auto it = self.begin(); it != self.end(); ++it)
+        mStackIndex.mStacks[it->getCellRef().getRefId()].push_back(it->getBase());
+    mStackIndex.mUpToDate = true;
+}
+
+void MWWorld::ContainerStore::indexNewStack(const ContainerStoreIterator& it)
+{
+    if (mStackIndex.mUpToDate)
+        mStackIndex.mStacks[it->getCellRef().getRefId()].push_back(it->getBase());
+}
+
 void MWWorld::ContainerStore::updateRefNums()
 {
     for (const auto& iter : *this)
@@ -484,6 +491,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addNewStack(const Const
 
     it->getCellRef().setCount(count);
 
+    indexNewStack(it);
     flagAsModified();
     return it;
 }
@@ -534,11 +542,26 @@ int MWWorld::ContainerStore::remove(const ESM::RefId& itemId, int count, bool eq
 {
     if (resolveFirst)
         resolve();
+    updateStackIndex();
     int toRemove = count;
 
-    for (ContainerStoreIterator iter(begin()); iter != end() && toRemove > 0; ++iter)
-        if (iter->getCellRef().getRefId() == itemId)
-            toRemove -= remove(*iter, toRemove, equipReplacement, resolveFirst);
+    const auto stacks = mStackIndex.mStacks.find(itemId);
+    if (stacks != mStackIndex.mStacks.end())
+    {
+        // remove(item) can reach back into the store (e.g. to equip a replacement for a
+        // removed equipped item), so iterate over a copy of the stack list
+        const std::vector<LiveCellRefBase*> candidates = stacks->second;
+        for (LiveCellRefBase* stack : candidates)
+        {
+            if (toRemove <= 0)
+                break;
+            if (!stack->mRef.getCount())
+                continue;
+            Ptr ptr(stack, nullptr);
+            ptr.setContainerStore(this);
+            toRemove -= remove(ptr, toRemove, equipReplacement, resolveFirst);
+        }
+    }
 
     flagAsModified();
 
@@ -679,6 +702,7 @@ void MWWorld::ContainerStore::flagAsModified()
 {
     mWeightUpToDate = false;
     mRechargingItemsUpToDate = false;
+    ++mRevision;
 }
 
 bool MWWorld::ContainerStore::isResolved() const
@@ -833,76 +857,20 @@ MWWorld::Ptr MWWorld::ContainerStore::findReplacement(const ESM::RefId& id)
 MWWorld::Ptr MWWorld::ContainerStore::search(const ESM::RefId& id)
 {
     resolve();
-    {
-        Ptr ptr = searchId(potions, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(appas, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
+    updateStackIndex();
 
+    const auto stacks = mStackIndex.mStacks.find(id);
+    if (stacks != mStackIndex.mStacks.end())
     {
-        Ptr ptr = searchId(armors, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(books, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(clothes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(ingreds, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(lights, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(lockpicks, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(miscItems, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(probes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(repairs, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(weapons, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
+        for (LiveCellRefBase* stack : stacks->second)
+        {
+            if (stack->mRef.getCount())
+            {
+                Ptr ptr(stack, nullptr);
+                ptr.setContainerStore(this);
+                return ptr;
+            }
+        }
     }
 
     return Ptr();
@@ -1,10 +1,13 @@
 #ifndef GAME_MWWORLD_CONTAINERSTORE_H
 #define GAME_MWWORLD_CONTAINERSTORE_H
 
+#include <cstddef>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <components/esm3/loadalch.hpp>
 #include <components/esm3/loadappa.hpp>
@@ -142,7 +145,28 @@ namespace MWWorld
         mutable float mCachedWeight;
         mutable bool mWeightUpToDate;
 
+        // All stacks of a given item id, in insertion order. Holds pointers into the
+        // CellRefLists above: list nodes are never erased (removing items only zeroes
+        // their count), so the pointers stay valid for the lifetime of the store.
+        // Copying a store (clone()) drops the index; it is rebuilt on the next lookup.
+        struct StackIndex
+        {
+            StackIndex() = default;
+            StackIndex(const StackIndex&) {}
+            StackIndex& operator=(const StackIndex&)
+            {
+                mStacks.clear();
+                mUpToDate = false;
+                return *this;
+            }
+
+            std::unordered_map<ESM::RefId, std::vector<LiveCellRefBase*>> mStacks;
+            bool mUpToDate = false;
+        };
+        mutable StackIndex mStackIndex;
+
         bool mModified;
+        std::size_t mRevision = 0;
         bool mResolved;
         unsigned int mSeed;
         MWWorld::SafePtr mPtr; // Container or actor that holds this store.
@@ -166,6 +190,9 @@ namespace MWWorld
 
         void updateRechargingItems();
 
+        void updateStackIndex() const;
+        void indexNewStack(const ContainerStoreIterator& it);
+
         virtual void storeEquipmentState(
             const MWWorld::LiveCellRefBase& ref, size_t index, ESM::InventoryState& inventory) const;
 
@@ -243,6 +270,10 @@ namespace MWWorld
         ContainerStoreListener* getContListener() const;
         void setContListener(ContainerStoreListener* listener);
 
+        /// Incremented whenever the contents or the equipped items change. Consumers can
+        /// compare it against a stored value to invalidate caches derived from the store.
+        std::size_t getRevision() const { return mRevision; }
+
     protected:
         ContainerStoreIterator addNewStack(const ConstPtr& ptr, int count);
         ///< Add the item to this container (do not try to stack it onto existing items)
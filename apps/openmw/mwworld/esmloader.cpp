@@ -64,12 +64,19 @@ namespace MWWorld
             }
             case ESM::Format::Tes4:
             {
-                ESM4::Reader reader(std::move(stream), filepath,
-                    MWBase::Environment::get().getResourceSystem()->getVFS(),
-                    mEncoder != nullptr ? &mEncoder->getStatelessEncoder() : nullptr);
+                const VFS::Manager* vfs = MWBase::Environment::get().getResourceSystem()->getVFS();
+                const ToUTF8::StatelessUtf8Encoder* encoder
+                    = mEncoder != nullptr ? &mEncoder->getStatelessEncoder() : nullptr;
+                ESM4::Reader reader(std::move(stream), filepath, vfs, encoder);
                 reader.setModIndex(index);
                 reader.updateModIndices(mNameToIndex);
-                mStore.loadESM4(reader);
+                mStore.loadESM4Parallel(reader, [&] {
+                    auto workerReader = std::make_unique<ESM4::Reader>(
+                        Files::openBinaryInputFileStream(filepath), filepath, vfs, encoder);
+                    workerReader->setModIndex(index);
+                    workerReader->updateModIndices(mNameToIndex);
+                    return workerReader;
+                });
                 break;
             }
         }
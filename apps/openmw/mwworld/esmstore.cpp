@@ -1,7 +1,12 @@
 #include "esmstore.hpp"
 
+#include "commonids.hpp"
+
 #include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <mutex>
+#include <thread>
 #include <tuple>
 
 #include <components/debug/debuglog.hpp>
@@ -14,6 +19,7 @@
 #include <components/esm4/reader.hpp>
 #include <components/esm4/readerutils.hpp>
 #include <components/esmloader/load.hpp>
+#include <components/files/conversion.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
 #include <components/lua/configuration.hpp>
 #include <components/misc/algorithm.hpp>
@@ -263,7 +269,7 @@ namespace MWWorld
         }
 
         template <typename T>
-        static bool typedReadRecordESM4(ESM4::Reader& reader, Store<T>& store)
+        static bool typedReadRecordESM4(ESM4::Reader& reader, Store<T>& store, std::mutex* storeMutex)
         {
             auto recordType = static_cast<ESM4::RecordTypes>(reader.hdr().record.typeId);
 
@@ -277,7 +283,13 @@ namespace MWWorld
                         reader.getRecordData();
                         T value;
                         value.load(reader);
-                        store.insertStatic(value);
+                        if (storeMutex != nullptr)
+                        {
+                            const std::lock_guard lock(*storeMutex);
+                            store.insertStatic(value);
+                        }
+                        else
+                            store.insertStatic(value);
                         return true;
                     }
                 }
@@ -285,10 +297,13 @@ namespace MWWorld
             return false;
         }
 
-        static bool readRecord(ESM4::Reader& reader, ESMStore& store)
+        /// When \a storeMutex is given, the cheap insertion into the store is serialized while the
+        /// expensive parsing of the record data stays on the calling thread.
+        static bool readRecord(ESM4::Reader& reader, ESMStore& store, std::mutex* storeMutex = nullptr)
         {
-            return std::apply(
-                [&reader](auto&... x) { return (typedReadRecordESM4(reader, x) || ...); }, store.mStoreImp->mStores);
+            return std::apply([&reader, storeMutex](
+                                  auto&... x) { return (typedReadRecordESM4(reader, x, storeMutex) || ...); },
+                store.mStoreImp->mStores);
         }
     };
 
@@ -474,6 +489,94 @@ namespace MWWorld
         ESM4::ReaderUtils::readAll(reader, visitorRec, [](ESM4::Reader&) {});
     }
 
+    void ESMStore::loadESM4Parallel(
+        ESM4::Reader& reader, const std::function<std::unique_ptr<ESM4::Reader>()>& makeReader)
+    {
+        const auto groupVisitor = [](ESM4::Reader&) {};
+
+        // Scan the top level: collect the context of every top-level group, reading the rare
+        // loose top-level records in place.
+        std::vector<ESM4::ReaderContext> groups;
+        while (reader.hasMoreRecs())
+        {
+            reader.exitGroupCheck();
+            if (!reader.getRecordHeader() || !reader.hasMoreRecs())
+                break;
+            if (reader.hdr().record.typeId == ESM4::REC_GRUP)
+            {
+                ESM4::ReaderContext ctx = reader.getContext();
+                // restoreContext() re-reads the group header, compensate the bytes-read accounting
+                ctx.fileRead -= ctx.recHeaderSize;
+                groups.push_back(std::move(ctx));
+                reader.skipGroup();
+            }
+            else
+                ESM4::ReaderUtils::readRecord(
+                    reader, [this](ESM4::Reader& r) { return ESMStoreImp::readRecord(r, *this); });
+        }
+
+        // Schedule the biggest groups first, the cell hierarchies dwarf everything else.
+        std::stable_sort(groups.begin(), groups.end(), [](const ESM4::ReaderContext& l, const ESM4::ReaderContext& r) {
+            return l.recordHeader.group.groupSize > r.recordHeader.group.groupSize;
+        });
+
+        // Read one top-level group whose context was saved above, mirroring the loop in
+        // ESM4::ReaderUtils::readAll but bounded by the end of the group.
+        const auto readGroup = [&](ESM4::Reader& groupReader, const ESM4::ReaderContext& ctx, std::mutex* storeMutex) {
+            if (!groupReader.restoreContext(ctx))
+                return;
+            if (groupReader.hdr().group.groupSize == ctx.recHeaderSize)
+                return; // empty group, e.g. HAIR in Skyrim
+            const auto recordVisitor
+                = [&](ESM4::Reader& r) { return ESMStoreImp::readRecord(r, *this, storeMutex); };
+            const std::streamoff end = static_cast<std::streamoff>(ctx.filePos) + groupReader.hdr().group.groupSize;
+            if (!ESM4::ReaderUtils::readGroup(groupReader, recordVisitor, groupVisitor))
+                return;
+            while (static_cast<std::streamoff>(groupReader.getFileOffset()) < end)
+            {
+                groupReader.exitGroupCheck();
+                if (!ESM4::ReaderUtils::readItem(groupReader, recordVisitor, groupVisitor))
+                    break;
+            }
+        };
+
+        const std::size_t threadsCount
+            = std::min<std::size_t>(std::max<std::size_t>(std::thread::hardware_concurrency(), 1), groups.size());
+        if (threadsCount <= 1)
+        {
+            for (const ESM4::ReaderContext& ctx : groups)
+                readGroup(reader, ctx, nullptr);
+            return;
+        }
+
+        std::mutex storeMutex;
+        std::atomic_size_t nextGroup = 0;
+        std::mutex exceptionMutex;
+        std::exception_ptr exception;
+        const auto worker = [&] {
+            try
+            {
+                const std::unique_ptr<ESM4::Reader> workerReader = makeReader();
+                for (std::size_t i = nextGroup.fetch_add(1); i < groups.size(); i = nextGroup.fetch_add(1))
+                    readGroup(*workerReader, groups[i], &storeMutex);
+            }
+            catch (...)
+            {
+                const std::lock_guard lock(exceptionMutex);
+                if (exception == nullptr)
+                    exception = std::current_exception();
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(threadsCount);
+        for (std::size_t i = 0; i < threadsCount; ++i)
+            threads.emplace_back(worker);
+        for (std::thread& thread : threads)
+            thread.join();
+        if (exception != nullptr)
+            std::rethrow_exception(exception);
+    }
+
     void ESMStore::setIdType(const ESM::RefId& id, ESM::RecNameInts type)
     {
         mStoreImp->mIds[id] = type;
@@ -514,8 +617,49 @@ namespace MWWorld
             throw std::logic_error("ESMStore::setUp() is called twice");
         mIsSetUpDone = true;
 
+        // Each store only touches its own records in setUp, so the independent per-store passes
+        // (resolving the ESM::Dialogue info chains in particular) can run concurrently.
+        std::vector<DynamicStore*> stores;
+        stores.reserve(mStoreImp->mRecNameToStore.size());
         for (const auto& [_, store] : mStoreImp->mRecNameToStore)
-            store->setUp();
+            stores.push_back(store);
+
+        const std::size_t threadsCount
+            = std::min<std::size_t>(std::max<std::size_t>(std::thread::hardware_concurrency(), 1), stores.size());
+        if (threadsCount <= 1)
+        {
+            for (DynamicStore* store : stores)
+                store->setUp();
+        }
+        else
+        {
+            std::atomic_size_t nextStore = 0;
+            std::mutex exceptionMutex;
+            std::exception_ptr exception;
+            const auto worker = [&] {
+                for (std::size_t i = nextStore.fetch_add(1); i < stores.size(); i = nextStore.fetch_add(1))
+                {
+                    try
+                    {
+                        stores[i]->setUp();
+                    }
+                    catch (...)
+                    {
+                        const std::lock_guard lock(exceptionMutex);
+                        if (exception == nullptr)
+                            exception = std::current_exception();
+                    }
+                }
+            };
+            std::vector<std::thread> threads;
+            threads.reserve(threadsCount);
+            for (std::size_t i = 0; i < threadsCount; ++i)
+                threads.emplace_back(worker);
+            for (std::thread& thread : threads)
+                thread.join();
+            if (exception != nullptr)
+                std::rethrow_exception(exception);
+        }
 
         getWritable<ESM::Skill>().setUp(get<ESM::GameSetting>());
         getWritable<ESM::MagicEffect>().setUp();
@@ -552,29 +696,33 @@ namespace MWWorld
 
     void ESMStore::countAllCellRefsAndMarkKeys(ESM::ReadersCache& readers)
     {
-        // TODO: We currently need to read entire files here again.
-        // We should consider consolidating or deferring this reading.
         if (!mRefCount.empty())
             return;
-        std::vector<Ref> refs;
         std::set<ESM::RefId> keyIDs;
-        std::vector<ESM::RefId> refIDs;
-        Store<ESM::Cell> Cells = get<ESM::Cell>();
-        for (auto it = Cells.intBegin(); it != Cells.intEnd(); ++it)
-            readRefs(*it, refs, refIDs, keyIDs, readers);
-        for (auto it = Cells.extBegin(); it != Cells.extEnd(); ++it)
-            readRefs(*it, refs, refIDs, keyIDs, readers);
-        const auto lessByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum < r.mRefNum; };
-        std::stable_sort(refs.begin(), refs.end(), lessByRefNum);
-        const auto equalByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum == r.mRefNum; };
-        const auto incrementRefCount = [&](const Ref& value) {
-            if (value.mRefID != deletedRefID)
-            {
-                ESM::RefId& refId = refIDs[value.mRefID];
-                ++mRefCount[std::move(refId)];
-            }
-        };
-        Misc::forEachUnique(refs.rbegin(), refs.rend(), equalByRefNum, incrementRefCount);
+        if (!loadCellRefIndexCache(keyIDs))
+        {
+            // No valid cache for the active content files: read the entire files again to build
+            // the index, then persist it for the next launch.
+            std::vector<Ref> refs;
+            std::vector<ESM::RefId> refIDs;
+            Store<ESM::Cell> Cells = get<ESM::Cell>();
+            for (auto it = Cells.intBegin(); it != Cells.intEnd(); ++it)
+                readRefs(*it, refs, refIDs, keyIDs, readers);
+            for (auto it = Cells.extBegin(); it != Cells.extEnd(); ++it)
+                readRefs(*it, refs, refIDs, keyIDs, readers);
+            const auto lessByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum < r.mRefNum; };
+            std::stable_sort(refs.begin(), refs.end(), lessByRefNum);
+            const auto equalByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum == r.mRefNum; };
+            const auto incrementRefCount = [&](const Ref& value) {
+                if (value.mRefID != deletedRefID)
+                {
+                    ESM::RefId& refId = refIDs[value.mRefID];
+                    ++mRefCount[std::move(refId)];
+                }
+            };
+            Misc::forEachUnique(refs.rbegin(), refs.rend(), equalByRefNum, incrementRefCount);
+            saveCellRefIndexCache(keyIDs);
+        }
         auto& store = getWritable<ESM::Miscellaneous>().mStatic;
         for (const auto& id : keyIDs)
         {
@@ -584,6 +732,122 @@ namespace MWWorld
         }
     }
 
+    namespace
+    {
+        constexpr std::uint32_t sCellRefIndexCacheVersion = 1;
+        constexpr std::array<char, 4> sCellRefIndexCacheMagic{ 'O', 'M', 'W', 'R' };
+
+        void writeCacheString(std::ostream& stream, const std::string& value)
+        {
+            const std::uint32_t length = static_cast<std::uint32_t>(value.size());
+            stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            stream.write(value.data(), length);
+        }
+
+        bool readCacheString(std::istream& stream, std::string& value)
+        {
+            std::uint32_t length = 0;
+            stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+            if (!stream || length > (1u << 20))
+                return false;
+            value.resize(length);
+            stream.read(value.data(), length);
+            return static_cast<bool>(stream);
+        }
+    }
+
+    bool ESMStore::loadCellRefIndexCache(std::set<ESM::RefId>& keyIDs)
+    {
+        if (mCellRefIndexCachePath.empty())
+            return false;
+
+        std::ifstream stream(mCellRefIndexCachePath, std::ios::binary);
+        if (!stream)
+            return false;
+
+        const auto invalidate = [&] {
+            mRefCount.clear();
+            keyIDs.clear();
+            return false;
+        };
+
+        std::array<char, 4> magic;
+        std::uint32_t version = 0;
+        std::array<std::uint64_t, 2> key{ 0, 0 };
+        stream.read(magic.data(), magic.size());
+        stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+        stream.read(reinterpret_cast<char*>(key.data()), sizeof(key));
+        if (!stream || magic != sCellRefIndexCacheMagic || version != sCellRefIndexCacheVersion
+            || key != mCellRefIndexCacheKey)
+            return invalidate();
+
+        std::uint64_t refCountSize = 0;
+        stream.read(reinterpret_cast<char*>(&refCountSize), sizeof(refCountSize));
+        if (!stream)
+            return invalidate();
+        std::string id;
+        for (std::uint64_t i = 0; i < refCountSize; ++i)
+        {
+            std::int32_t count = 0;
+            if (!readCacheString(stream, id))
+                return invalidate();
+            stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+            if (!stream)
+                return invalidate();
+            mRefCount.emplace(ESM::RefId::deserializeText(id), count);
+        }
+
+        std::uint64_t keyIDsSize = 0;
+        stream.read(reinterpret_cast<char*>(&keyIDsSize), sizeof(keyIDsSize));
+        if (!stream)
+            return invalidate();
+        for (std::uint64_t i = 0; i < keyIDsSize; ++i)
+        {
+            if (!readCacheString(stream, id))
+                return invalidate();
+            keyIDs.insert(ESM::RefId::deserializeText(id));
+        }
+
+        Log(Debug::Info) << "Loaded cell ref index for " << mRefCount.size() << " records from cache";
+        return true;
+    }
+
+    void ESMStore::saveCellRefIndexCache(const std::set<ESM::RefId>& keyIDs) const
+    {
+        if (mCellRefIndexCachePath.empty())
+            return;
+
+        std::ofstream stream(mCellRefIndexCachePath, std::ios::binary);
+        if (!stream)
+        {
+            Log(Debug::Warning) << "Failed to open cell ref index cache for writing: "
+                                << Files::pathToUnicodeString(mCellRefIndexCachePath);
+            return;
+        }
+
+        stream.write(sCellRefIndexCacheMagic.data(), sCellRefIndexCacheMagic.size());
+        stream.write(reinterpret_cast<const char*>(&sCellRefIndexCacheVersion), sizeof(sCellRefIndexCacheVersion));
+        stream.write(reinterpret_cast<const char*>(mCellRefIndexCacheKey.data()), sizeof(mCellRefIndexCacheKey));
+
+        const std::uint64_t refCountSize = mRefCount.size();
+        stream.write(reinterpret_cast<const char*>(&refCountSize), sizeof(refCountSize));
+        for (const auto& [id, count] : mRefCount)
+        {
+            writeCacheString(stream, id.serializeText());
+            const std::int32_t value = count;
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        const std::uint64_t keyIDsSize = keyIDs.size();
+        stream.write(reinterpret_cast<const char*>(&keyIDsSize), sizeof(keyIDsSize));
+        for (const ESM::RefId& id : keyIDs)
+            writeCacheString(stream, id.serializeText());
+
+        if (!stream)
+            Log(Debug::Warning) << "Failed to write cell ref index cache: "
+                                << Files::pathToUnicodeString(mCellRefIndexCachePath);
+    }
+
     int ESMStore::getRefCount(const ESM::RefId& id) const
     {
         auto it = mRefCount.find(id);
@@ -629,7 +893,7 @@ namespace MWWorld
     void ESMStore::movePlayerRecord()
     {
         auto& npcs = getWritable<ESM::NPC>();
-        auto player = npcs.find(ESM::RefId::stringRefId("Player"));
+        auto player = npcs.find(CommonIds::Player);
         npcs.insert(*player);
     }
 
@@ -761,7 +1025,7 @@ namespace MWWorld
 
     void ESMStore::checkPlayer()
     {
-        const ESM::NPC* player = get<ESM::NPC>().find(ESM::RefId::stringRefId("Player"));
+        const ESM::NPC* player = get<ESM::NPC>().find(CommonIds::Player);
 
         if (!get<ESM::Race>().find(player->mRace) || !get<ESM::Class>().find(player->mClass))
             throw std::runtime_error("Invalid player record (race or class unavailable");
@@ -1,9 +1,14 @@
 #ifndef OPENMW_MWWORLD_ESMSTORE_H
 #define OPENMW_MWWORLD_ESMSTORE_H
 
+#include <array>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <set>
 #include <stdexcept>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 
@@ -161,6 +166,9 @@ namespace MWWorld
 
         std::unordered_map<ESM::RefId, int> mRefCount;
 
+        std::filesystem::path mCellRefIndexCachePath;
+        std::array<std::uint64_t, 2> mCellRefIndexCacheKey{ 0, 0 };
+
         std::vector<StoreBase*> mStores;
         std::vector<DynamicStore*> mDynamicStores;
 
@@ -179,6 +187,10 @@ namespace MWWorld
 
         void countAllCellRefsAndMarkKeys(ESM::ReadersCache& readers);
 
+        bool loadCellRefIndexCache(std::set<ESM::RefId>& keyIDs);
+
+        void saveCellRefIndexCache(const std::set<ESM::RefId>& keyIDs) const;
+
         template <class T>
         void removeMissingObjects(Store<T>& store);
 
@@ -192,6 +204,27 @@ namespace MWWorld
 
     public:
         void addOMWScripts(std::filesystem::path filePath) { mLuaContent.push_back(std::move(filePath)); }
+
+        /// Enable the on-disk cache of the cell ref count index built by validateRecords().
+        ///  contentFilesHash identifies the active content files; the cache is rebuilt when it changes.
+        void setCellRefIndexCache(std::filesystem::path path, std::array<std::uint64_t, 2> contentFilesHash)
+        {
+            mCellRefIndexCachePath = std::move(path);
+            mCellRefIndexCacheKey = contentFilesHash;
+        }
+
+        /// Location for an on-disk cache derived from the active content files, next to the cell
+        /// ref index cache. Empty if no cache location has been configured.
+        std::filesystem::path getCachePath(std::string_view name) const
+        {
+            if (mCellRefIndexCachePath.empty())
+                return {};
+            return mCellRefIndexCachePath.parent_path() / name;
+        }
+
+        /// Identifies the active content files; on-disk caches keyed by this value are rebuilt
+        /// when the load order or a content file changes.
+        const std::array<std::uint64_t, 2>& getContentFilesKey() const { return mCellRefIndexCacheKey; }
         ESM::LuaScriptsCfg getLuaScriptsCfg() const;
 
         /// \todo replace with SharedIterator<StoreBase>
@@ -221,6 +254,11 @@ namespace MWWorld
         void load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue);
         void loadESM4(ESM4::Reader& esm);
 
+        /// Load an ESM4 content file reading its independent top-level groups concurrently.
+        /// \a makeReader must produce a fresh reader over the same file on every call; it is
+        /// invoked once per worker thread. Falls back to loadESM4() on single-core machines.
+        void loadESM4Parallel(ESM4::Reader& esm, const std::function<std::unique_ptr<ESM4::Reader>()>& makeReader);
+
         template <class T>
         const Store<T>& get() const
         {
@@ -1,10 +1,14 @@
 #include "groundcoverstore.hpp"
 
+#include <fstream>
+
+#include <components/debug/debuglog.hpp>
 #include <components/esm3/loadcell.hpp>
 #include <components/esm3/loadstat.hpp>
 #include <components/esm3/readerscache.hpp>
 #include <components/esmloader/esmdata.hpp>
 #include <components/esmloader/load.hpp>
+#include <components/files/conversion.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/strings/lower.hpp>
 #include <components/resource/resourcesystem.hpp>
@@ -13,17 +17,96 @@
 
 namespace MWWorld
 {
-    void GroundcoverStore::init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
-        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+    namespace
     {
-        ::EsmLoader::Query query;
-        query.mLoadStatics = true;
-        query.mLoadCells = true;
+        constexpr std::uint32_t sGroundcoverCacheVersion = 1;
+        constexpr std::array<char, 4> sGroundcoverCacheMagic{ 'O', 'M', 'W', 'G' };
 
-        ESM::ReadersCache readers;
-        const ::EsmLoader::EsmData content
-            = ::EsmLoader::loadEsmData(query, groundcoverFiles, fileCollections, readers, encoder, listener);
+        void writeCacheString(std::ostream& stream, const std::string& value)
+        {
+            const std::uint32_t length = static_cast<std::uint32_t>(value.size());
+            stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            stream.write(value.data(), length);
+        }
+
+        bool readCacheString(std::istream& stream, std::string& value)
+        {
+            std::uint32_t length = 0;
+            stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+            if (!stream || length > (1u << 20))
+                return false;
+            value.resize(length);
+            stream.read(value.data(), length);
+            return static_cast<bool>(stream);
+        }
 
+        void writeContext(std::ostream& stream, const ESM::ESM_Context& context)
+        {
+            writeCacheString(stream, Files::pathToUnicodeString(context.filename));
+            const std::int64_t leftRec = context.leftRec;
+            stream.write(reinterpret_cast<const char*>(&leftRec), sizeof(leftRec));
+            stream.write(reinterpret_cast<const char*>(&context.leftSub), sizeof(context.leftSub));
+            const std::int64_t leftFile = context.leftFile;
+            stream.write(reinterpret_cast<const char*>(&leftFile), sizeof(leftFile));
+            stream.write(context.recName.mData, ESM::NAME::sCapacity);
+            stream.write(context.subName.mData, ESM::NAME::sCapacity);
+            const std::int32_t index = context.index;
+            stream.write(reinterpret_cast<const char*>(&index), sizeof(index));
+            const std::uint32_t parentsCount = static_cast<std::uint32_t>(context.parentFileIndices.size());
+            stream.write(reinterpret_cast<const char*>(&parentsCount), sizeof(parentsCount));
+            for (const int parent : context.parentFileIndices)
+            {
+                const std::int32_t value = parent;
+                stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+            const std::uint8_t subCached = context.subCached ? 1 : 0;
+            stream.write(reinterpret_cast<const char*>(&subCached), sizeof(subCached));
+            const std::uint64_t filePos = context.filePos;
+            stream.write(reinterpret_cast<const char*>(&filePos), sizeof(filePos));
+        }
+
+        bool readContext(std::istream& stream, ESM::ESM_Context& context)
+        {
+            std::string filename;
+            if (!readCacheString(stream, filename))
+                return false;
+            context.filename = Files::pathFromUnicodeString(filename);
+            std::int64_t leftRec = 0;
+            stream.read(reinterpret_cast<char*>(&leftRec), sizeof(leftRec));
+            context.leftRec = static_cast<std::streamsize>(leftRec);
+            stream.read(reinterpret_cast<char*>(&context.leftSub), sizeof(context.leftSub));
+            std::int64_t leftFile = 0;
+            stream.read(reinterpret_cast<char*>(&leftFile), sizeof(leftFile));
+            context.leftFile = static_cast<std::streamsize>(leftFile);
+            stream.read(context.recName.mData, ESM::NAME::sCapacity);
+            stream.read(context.subName.mData, ESM::NAME::sCapacity);
+            std::int32_t index = 0;
+            stream.read(reinterpret_cast<char*>(&index), sizeof(index));
+            context.index = index;
+            std::uint32_t parentsCount = 0;
+            stream.read(reinterpret_cast<char*>(&parentsCount), sizeof(parentsCount));
+            if (!stream || parentsCount > (1u << 16))
+                return false;
+            context.parentFileIndices.resize(parentsCount);
+            for (int& parent : context.parentFileIndices)
+            {
+                std::int32_t value = 0;
+                stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+                parent = value;
+            }
+            std::uint8_t subCached = 0;
+            stream.read(reinterpret_cast<char*>(&subCached), sizeof(subCached));
+            context.subCached = subCached != 0;
+            std::uint64_t filePos = 0;
+            stream.read(reinterpret_cast<char*>(&filePos), sizeof(filePos));
+            context.filePos = static_cast<size_t>(filePos);
+            return static_cast<bool>(stream);
+        }
+    }
+
+    void GroundcoverStore::init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
+        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+    {
         static constexpr std::string_view prefix = "grass\\";
         for (const ESM::Static& stat : statics)
         {
@@ -34,14 +117,30 @@ namespace MWWorld
             mMeshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model);
         }
 
+        if (loadCache())
+            return;
+
+        // No valid cache for the active groundcover files: parse them again and persist the
+        // result for the next launch.
+        ::EsmLoader::Query query;
+        query.mLoadStatics = true;
+        query.mLoadCells = true;
+
+        ESM::ReadersCache readers;
+        const ::EsmLoader::EsmData content
+            = ::EsmLoader::loadEsmData(query, groundcoverFiles, fileCollections, readers, encoder, listener);
+
+        std::map<ESM::RefId, std::string> groundcoverMeshes;
         for (const ESM::Static& stat : content.mStatics)
         {
             std::string model = Misc::StringUtils::lowerCase(stat.mModel);
             std::replace(model.begin(), model.end(), '/', '\\');
             if (!model.starts_with(prefix))
                 continue;
-            mMeshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model);
+            groundcoverMeshes[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model);
         }
+        for (const auto& [id, model] : groundcoverMeshes)
+            mMeshCache[id] = model;
 
         for (const ESM::Cell& cell : content.mCells)
         {
@@ -50,6 +149,113 @@ namespace MWWorld
             auto cellIndex = std::make_pair(cell.getGridX(), cell.getGridY());
             mCellContexts[cellIndex] = std::move(cell.mContextList);
         }
+
+        saveCache(groundcoverMeshes);
+    }
+
+    bool GroundcoverStore::loadCache()
+    {
+        if (mCachePath.empty())
+            return false;
+
+        std::ifstream stream(mCachePath, std::ios::binary);
+        if (!stream)
+            return false;
+
+        std::array<char, 4> magic;
+        std::uint32_t version = 0;
+        std::array<std::uint64_t, 2> key{ 0, 0 };
+        stream.read(magic.data(), magic.size());
+        stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+        stream.read(reinterpret_cast<char*>(key.data()), sizeof(key));
+        if (!stream || magic != sGroundcoverCacheMagic || version != sGroundcoverCacheVersion || key != mCacheKey)
+            return false;
+
+        std::map<ESM::RefId, std::string> groundcoverMeshes;
+        std::uint64_t meshesSize = 0;
+        stream.read(reinterpret_cast<char*>(&meshesSize), sizeof(meshesSize));
+        if (!stream)
+            return false;
+        std::string id;
+        std::string model;
+        for (std::uint64_t i = 0; i < meshesSize; ++i)
+        {
+            if (!readCacheString(stream, id) || !readCacheString(stream, model))
+                return false;
+            groundcoverMeshes.emplace(ESM::RefId::deserializeText(id), std::move(model));
+        }
+
+        std::map<std::pair<int, int>, std::vector<ESM::ESM_Context>> cellContexts;
+        std::uint64_t cellsSize = 0;
+        stream.read(reinterpret_cast<char*>(&cellsSize), sizeof(cellsSize));
+        if (!stream)
+            return false;
+        for (std::uint64_t i = 0; i < cellsSize; ++i)
+        {
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+            std::uint32_t contextsCount = 0;
+            stream.read(reinterpret_cast<char*>(&x), sizeof(x));
+            stream.read(reinterpret_cast<char*>(&y), sizeof(y));
+            stream.read(reinterpret_cast<char*>(&contextsCount), sizeof(contextsCount));
+            if (!stream || contextsCount > (1u << 16))
+                return false;
+            std::vector<ESM::ESM_Context>& contexts = cellContexts[std::make_pair(x, y)];
+            contexts.resize(contextsCount);
+            for (ESM::ESM_Context& context : contexts)
+                if (!readContext(stream, context))
+                    return false;
+        }
+
+        for (auto& [meshId, meshModel] : groundcoverMeshes)
+            mMeshCache[meshId] = std::move(meshModel);
+        mCellContexts = std::move(cellContexts);
+
+        Log(Debug::Info) << "Loaded groundcover contexts for " << mCellContexts.size() << " cells from cache";
+        return true;
+    }
+
+    void GroundcoverStore::saveCache(const std::map<ESM::RefId, std::string>& groundcoverMeshes) const
+    {
+        if (mCachePath.empty())
+            return;
+
+        std::ofstream stream(mCachePath, std::ios::binary);
+        if (!stream)
+        {
+            Log(Debug::Warning) << "Failed to open groundcover cache for writing: "
+                                << Files::pathToUnicodeString(mCachePath);
+            return;
+        }
+
+        stream.write(sGroundcoverCacheMagic.data(), sGroundcoverCacheMagic.size());
+        stream.write(reinterpret_cast<const char*>(&sGroundcoverCacheVersion), sizeof(sGroundcoverCacheVersion));
+        stream.write(reinterpret_cast<const char*>(mCacheKey.data()), sizeof(mCacheKey));
+
+        const std::uint64_t meshesSize = groundcoverMeshes.size();
+        stream.write(reinterpret_cast<const char*>(&meshesSize), sizeof(meshesSize));
+        for (const auto& [id, model] : groundcoverMeshes)
+        {
+            writeCacheString(stream, id.serializeText());
+            writeCacheString(stream, model);
+        }
+
+        const std::uint64_t cellsSize = mCellContexts.size();
+        stream.write(reinterpret_cast<const char*>(&cellsSize), sizeof(cellsSize));
+        for (const auto& [cellIndex, contexts] : mCellContexts)
+        {
+            const std::int32_t x = cellIndex.first;
+            const std::int32_t y = cellIndex.second;
+            stream.write(reinterpret_cast<const char*>(&x), sizeof(x));
+            stream.write(reinterpret_cast<const char*>(&y), sizeof(y));
+            const std::uint32_t contextsCount = static_cast<std::uint32_t>(contexts.size());
+            stream.write(reinterpret_cast<const char*>(&contextsCount), sizeof(contextsCount));
+            for (const ESM::ESM_Context& context : contexts)
+                writeContext(stream, context);
+        }
+
+        if (!stream)
+            Log(Debug::Warning) << "Failed to write groundcover cache: " << Files::pathToUnicodeString(mCachePath);
     }
 
     std::string GroundcoverStore::getGroundcoverModel(const ESM::RefId& id) const
@@ -2,8 +2,13 @@
 #define GAME_MWWORLD_GROUNDCOVER_STORE_H
 
 #include <components/esm/refid.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ESM
@@ -38,8 +43,21 @@ namespace MWWorld
     private:
         std::map<ESM::RefId, std::string> mMeshCache;
         std::map<std::pair<int, int>, std::vector<ESM::ESM_Context>> mCellContexts;
+        std::filesystem::path mCachePath;
+        std::array<std::uint64_t, 2> mCacheKey{ 0, 0 };
+
+        bool loadCache();
+        void saveCache(const std::map<ESM::RefId, std::string>& groundcoverMeshes) const;
 
     public:
+        /// Set the location and content files key for the compiled groundcover cache. When a
+        /// cache with a matching key exists, init skips parsing the groundcover content files.
+        void setCache(std::filesystem::path path, std::array<std::uint64_t, 2> key)
+        {
+            mCachePath = std::move(path);
+            mCacheKey = key;
+        }
+
         void init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
             const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
             Loading::Listener* listener);
@@ -139,7 +139,7 @@ MWWorld::ContainerStoreIterator MWWorld::InventoryStore::add(
     {
         auto type = itemPtr.getType();
         if (type == ESM::Armor::sRecordId || type == ESM::Clothing::sRecordId)
-            autoEquip();
+            autoEquipForItem(*retVal);
     }
 
     if (mListener)
@@ -376,7 +376,7 @@ void MWWorld::InventoryStore::autoEquipWeapon(TSlots& slots_)
     }
 }
 
-void MWWorld::InventoryStore::autoEquipArmor(TSlots& slots_)
+void MWWorld::InventoryStore::autoEquipArmor(TSlots& slots_, const std::vector<int>* restrictToSlots)
 {
     // Only NPCs can wear armor for now.
     // For creatures we equip only shields.
@@ -400,6 +400,15 @@ void MWWorld::InventoryStore::autoEquipArmor(TSlots& slots_)
     {
         Ptr test = *iter;
 
+        std::pair<std::vector<int>, bool> itemsSlots = iter->getClass().getEquipmentSlots(*iter);
+
+        if (restrictToSlots
+            && std::none_of(itemsSlots.first.begin(), itemsSlots.first.end(), [&](int slot) {
+                   return std::find(restrictToSlots->begin(), restrictToSlots->end(), slot)
+                       != restrictToSlots->end();
+               }))
+            continue;
+
         switch (test.getClass().canBeEquipped(test, actor).first)
         {
             case 0:
@@ -414,8 +423,6 @@ void MWWorld::InventoryStore::autoEquipArmor(TSlots& slots_)
             continue;
         }
 
-        std::pair<std::vector<int>, bool> itemsSlots = iter->getClass().getEquipmentSlots(*iter);
-
         // checking if current item pointed by iter can be equipped
         for (int slot : itemsSlots.first)
         {
@@ -527,6 +534,29 @@ void MWWorld::InventoryStore::autoEquip()
     autoEquipWeapon(slots_);
     autoEquipArmor(slots_);
 
+    commitAutoEquip(slots_);
+}
+
+void MWWorld::InventoryStore::autoEquipForItem(const Ptr& item)
+{
+    const std::vector<int> candidateSlots = item.getClass().getEquipmentSlots(item).first;
+    if (candidateSlots.empty())
+        return;
+
+    // Start from the current equipment: items that can not occupy the changed slots keep
+    // their slot, so only candidates for those slots have to be rated again.
+    TSlots slots_ = mSlots;
+
+    // Disable model update during auto-equip
+    mUpdatesEnabled = false;
+
+    autoEquipArmor(slots_, &candidateSlots);
+
+    commitAutoEquip(slots_);
+}
+
+void MWWorld::InventoryStore::commitAutoEquip(TSlots& slots_)
+{
     bool changed = false;
 
     for (std::size_t i = 0; i < slots_.size(); ++i)
@@ -615,7 +645,7 @@ int MWWorld::InventoryStore::remove(const Ptr& item, int count, bool equipReplac
     {
         auto type = item.getType();
         if (type == ESM::Armor::sRecordId || type == ESM::Clothing::sRecordId)
-            autoEquip();
+            autoEquipForItem(item);
     }
 
     if (item.getCellRef().getCount() == 0 && mSelectedEnchantItem != end() && *mSelectedEnchantItem == item)
@@ -68,9 +68,16 @@ namespace MWWorld
         TSlots mSlots;
 
         void autoEquipWeapon(TSlots& slots_);
-        void autoEquipArmor(TSlots& slots_);
+        void autoEquipArmor(TSlots& slots_, const std::vector<int>* restrictToSlots = nullptr);
         void autoEquipShield(TSlots& slots_);
 
+        void autoEquipForItem(const Ptr& item);
+        ///< Re-evaluate auto-equip only for the slots \a item can occupy, against the
+        /// current equipment. Used when a single armor/clothing item was added or removed,
+        /// where re-rating the whole outfit (including weapons and ammo) is wasted work.
+
+        void commitAutoEquip(TSlots& slots_);
+
         // selected magic item (for using enchantments of type "Cast once" or "Cast when used")
         ContainerStoreIterator mSelectedEnchantItem;
 
@@ -79,15 +79,14 @@ void MWWorld::LocalScripts::startIteration()
     mIter = mScripts.begin();
 }
 
-bool MWWorld::LocalScripts::getNext(std::pair<ESM::RefId, Ptr>& script)
+MWWorld::LocalScripts::Script* MWWorld::LocalScripts::getNext()
 {
     if (mIter != mScripts.end())
     {
         auto iter = mIter++;
-        script = *iter;
-        return true;
+        return &*iter;
     }
-    return false;
+    return nullptr;
 }
 
 void MWWorld::LocalScripts::add(const ESM::RefId& scriptName, const Ptr& ptr)
@@ -99,14 +98,14 @@ void MWWorld::LocalScripts::add(const ESM::RefId& scriptName, const Ptr& ptr)
             ptr.getRefData().setLocals(*script);
 
             for (auto iter = mScripts.begin(); iter != mScripts.end(); ++iter)
-                if (iter->second == ptr)
+                if (iter->mPtr == ptr)
                 {
                     Log(Debug::Warning) << "Error: tried to add local script twice for " << ptr.getCellRef().getRefId();
                     remove(ptr);
                     break;
                 }
 
-            mScripts.emplace_back(scriptName, ptr);
+            mScripts.push_back(Script{ scriptName, ptr, 0.f, mNextPhase++ });
         }
         catch (const std::exception& exception)
         {
@@ -140,7 +139,7 @@ void MWWorld::LocalScripts::clearCell(CellStore* cell)
 
     while (iter != mScripts.end())
     {
-        if (iter->second.mCell == cell)
+        if (iter->mPtr.mCell == cell)
         {
             if (iter == mIter)
                 ++mIter;
@@ -155,7 +154,7 @@ void MWWorld::LocalScripts::clearCell(CellStore* cell)
 void MWWorld::LocalScripts::remove(const MWWorld::CellRef* ref)
 {
     for (auto iter = mScripts.begin(); iter != mScripts.end(); ++iter)
-        if (&(iter->second.getCellRef()) == ref)
+        if (&(iter->mPtr.getCellRef()) == ref)
         {
             if (iter == mIter)
                 ++mIter;
@@ -168,7 +167,7 @@ void MWWorld::LocalScripts::remove(const MWWorld::CellRef* ref)
 void MWWorld::LocalScripts::remove(const Ptr& ptr)
 {
     for (auto iter = mScripts.begin(); iter != mScripts.end(); ++iter)
-        if (iter->second == ptr)
+        if (iter->mPtr == ptr)
         {
             if (iter == mIter)
                 ++mIter;
@@ -180,5 +179,8 @@ void MWWorld::LocalScripts::remove(const Ptr& ptr)
 
 bool MWWorld::LocalScripts::isRunning(const ESM::RefId& scriptName, const Ptr& ptr) const
 {
-    return std::ranges::find(mScripts, std::pair(scriptName, ptr)) != mScripts.end();
+    return std::ranges::find_if(mScripts, [&](const Script& script) {
+               return script.mId == scriptName && script.mPtr == ptr;
+           })
+        != mScripts.end();
 }
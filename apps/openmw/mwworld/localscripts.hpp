@@ -15,8 +15,19 @@ namespace MWWorld
     /// \brief List of active local scripts
     class LocalScripts
     {
-        std::list<std::pair<ESM::RefId, Ptr>> mScripts;
-        std::list<std::pair<ESM::RefId, Ptr>>::iterator mIter;
+    public:
+        struct Script
+        {
+            ESM::RefId mId;
+            Ptr mPtr;
+            float mElapsed = 0.f; // seconds since the script last ran
+            unsigned int mPhase = 0; // spreads reduced rate scripts across frames
+        };
+
+    private:
+        std::list<Script> mScripts;
+        std::list<Script>::iterator mIter;
+        unsigned int mNextPhase = 0;
         const MWWorld::ESMStore& mStore;
 
     public:
@@ -25,9 +36,9 @@ namespace MWWorld
         void startIteration();
         ///< Set the iterator to the begin of the script list.
 
-        bool getNext(std::pair<ESM::RefId, Ptr>& script);
+        Script* getNext();
         ///< Get next local script
-        /// @return Did we get a script?
+        /// @return nullptr once the end of the list is reached
 
         void add(const ESM::RefId& scriptName, const Ptr& ptr);
         ///< Add script to collection of active local scripts.
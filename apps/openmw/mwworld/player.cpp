@@ -32,6 +32,7 @@
 
 #include "cellstore.hpp"
 #include "class.hpp"
+#include "commonids.hpp"
 #include "ptr.hpp"
 
 namespace MWWorld
@@ -48,7 +49,7 @@ namespace MWWorld
     {
         ESM::CellRef cellRef;
         cellRef.blank();
-        cellRef.mRefID = ESM::RefId::stringRefId("Player");
+        cellRef.mRefID = CommonIds::Player;
         mPlayer = LiveCellRef<ESM::NPC>(cellRef, player);
 
         ESM::Position playerPos = mPlayer.mData.getPosition();
@@ -244,7 +245,7 @@ namespace MWWorld
     {
         ESM::CellRef cellRef;
         cellRef.blank();
-        cellRef.mRefID = ESM::RefId::stringRefId("Player");
+        cellRef.mRefID = CommonIds::Player;
         cellRef.mRefNum = mPlayer.mRef.getRefNum();
         mPlayer = LiveCellRef<ESM::NPC>(cellRef, mPlayer.mBase);
         mCellStore = nullptr;
@@ -1,9 +1,12 @@
 #include "projectilemanager.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <iomanip>
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <tuple>
 
 #include <osg/PositionAttitudeTransform>
 
@@ -33,6 +36,7 @@
 #include <components/settings/values.hpp>
 
 #include "../mwworld/class.hpp"
+#include "../mwworld/commonids.hpp"
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/inventorystore.hpp"
 #include "../mwworld/manualref.hpp"
@@ -96,7 +100,7 @@ namespace
                 continue;
 
             if (magicEffect->mBolt.empty())
-                projectileIDs.emplace_back(ESM::RefId::stringRefId("VFX_DefaultBolt"));
+                projectileIDs.emplace_back(CommonIds::VFX_DefaultBolt);
             else
                 projectileIDs.push_back(magicEffect->mBolt);
 
@@ -154,6 +158,12 @@ namespace
 namespace MWWorld
 {
 
+    bool ProjectileManager::NodePoolKey::operator<(const NodePoolKey& other) const
+    {
+        return std::tie(mModel, mTexture, mRotate, mCreateLight)
+            < std::tie(other.mModel, other.mTexture, other.mRotate, other.mCreateLight);
+    }
+
     ProjectileManager::ProjectileManager(osg::Group* parent, Resource::ResourceSystem* resourceSystem,
         MWRender::RenderingManager* rendering, MWPhysics::PhysicsSystem* physics)
         : mParent(parent)
@@ -192,6 +202,38 @@ namespace MWWorld
     void ProjectileManager::createModel(State& state, const std::string& model, const osg::Vec3f& pos,
         const osg::Quat& orient, bool rotate, bool createLight, osg::Vec4 lightDiffuseColor, const std::string& texture)
     {
+        state.mPoolKey = NodePoolKey{ model, texture, rotate, createLight };
+        // Multi-effect bolts attach extra models below; their nodes would not match other
+        // projectiles with the same key, so they bypass the pool.
+        state.mPoolable = state.mIdMagic.size() <= 1;
+
+        if (state.mPoolable)
+        {
+            const auto pooled = mNodePool.find(state.mPoolKey);
+            if (pooled != mNodePool.end() && !pooled->second.empty())
+            {
+                PooledNode entry = std::move(pooled->second.back());
+                pooled->second.pop_back();
+
+                state.mNode = std::move(entry.mNode);
+                state.mLight = std::move(entry.mLight);
+                state.mNode->setPosition(pos);
+                state.mNode->setAttitude(orient);
+                if (state.mLight != nullptr)
+                {
+                    state.mLight->setDiffuse(lightDiffuseColor);
+                    state.mLight->setPosition(osg::Vec4(pos, 1.0));
+                }
+
+                mParent->addChild(state.mNode);
+
+                state.mEffectAnimationTime = std::make_shared<MWRender::EffectAnimationTime>();
+                SceneUtil::AssignControllerSourcesVisitor assignVisitor(state.mEffectAnimationTime);
+                state.mNode->accept(assignVisitor);
+                return;
+            }
+        }
+
         state.mNode = new osg::PositionAttitudeTransform;
         state.mNode->setNodeMask(MWRender::Mask_Effect);
         state.mNode->setPosition(pos);
@@ -243,6 +285,7 @@ namespace MWWorld
 
             state.mNode->addChild(projectileLightSource);
             projectileLightSource->setLight(projectileLight);
+            state.mLight = projectileLight;
         }
 
         state.mNode->addCullCallback(new SceneUtil::LightListCallback);
@@ -356,7 +399,10 @@ namespace MWWorld
         const auto model = ptr.getClass().getCorrectedModel(ptr);
         createModel(state, model, pos, orient, false, false, osg::Vec4(0, 0, 0, 0));
         if (!ptr.getClass().getEnchantment(ptr).empty())
+        {
             SceneUtil::addEnchantedGlow(state.mNode, mResourceSystem, ptr.getClass().getEnchantmentColor(ptr));
+            state.mPoolable = false;
+        }
 
         state.mProjectileId = mPhysics->addProjectile(actor, pos, model, false);
         state.mToDelete = false;
@@ -409,13 +455,13 @@ namespace MWWorld
 
             for (auto& projectileState : mProjectiles)
             {
-                if (isCleanable(projectileState))
+                if (!projectileState.mToDelete && isCleanable(projectileState))
                     cleanupProjectile(projectileState);
             }
 
             for (auto& magicBoltState : mMagicBolts)
             {
-                if (isCleanable(magicBoltState))
+                if (!magicBoltState.mToDelete && isCleanable(magicBoltState))
                     cleanupMagicBolt(magicBoltState);
             }
         }
@@ -592,13 +638,13 @@ namespace MWWorld
 
         for (auto& projectileState : mProjectiles)
         {
-            if (projectileState.mToDelete)
+            if (projectileState.mToDelete && projectileState.mNode != nullptr)
                 cleanupProjectile(projectileState);
         }
 
         for (auto& magicBoltState : mMagicBolts)
         {
-            if (magicBoltState.mToDelete)
+            if (magicBoltState.mToDelete && magicBoltState.mNode != nullptr)
                 cleanupMagicBolt(magicBoltState);
         }
         mProjectiles.erase(std::remove_if(mProjectiles.begin(), mProjectiles.end(),
@@ -614,6 +660,7 @@ namespace MWWorld
         mParent->removeChild(state.mNode);
         mPhysics->removeProjectile(state.mProjectileId);
         state.mToDelete = true;
+        returnNodeToPool(state);
     }
 
     void ProjectileManager::cleanupMagicBolt(ProjectileManager::MagicBoltState& state)
@@ -625,23 +672,48 @@ namespace MWWorld
         {
             MWBase::Environment::get().getSoundManager()->stopSound(state.mSounds.at(soundIter));
         }
+        returnNodeToPool(state);
+    }
+
+    void ProjectileManager::returnNodeToPool(State& state)
+    {
+        // The node was already detached from the scene; either keep it for the next projectile
+        // with the same model or let it go. Either way the state no longer owns a node.
+        constexpr std::size_t maxPooledNodesPerModel = 8;
+        std::vector<PooledNode>& pool = mNodePool[state.mPoolKey];
+        if (state.mPoolable && pool.size() < maxPooledNodesPerModel)
+            pool.push_back(PooledNode{ std::move(state.mNode), std::move(state.mLight) });
+        state.mNode = nullptr;
+        state.mLight = nullptr;
     }
 
     void ProjectileManager::clear()
     {
         for (auto& mProjectile : mProjectiles)
-            cleanupProjectile(mProjectile);
+        {
+            if (mProjectile.mNode != nullptr)
+                cleanupProjectile(mProjectile);
+        }
         mProjectiles.clear();
 
         for (auto& mMagicBolt : mMagicBolts)
-            cleanupMagicBolt(mMagicBolt);
+        {
+            if (mMagicBolt.mNode != nullptr)
+                cleanupMagicBolt(mMagicBolt);
+        }
         mMagicBolts.clear();
+
+        // Pooled nodes may reference worldspace-specific resources; drop them on a switch.
+        mNodePool.clear();
     }
 
     void ProjectileManager::write(ESM::ESMWriter& writer, Loading::Listener& progress) const
     {
         for (std::vector<ProjectileState>::const_iterator it = mProjectiles.begin(); it != mProjectiles.end(); ++it)
         {
+            if (it->mToDelete)
+                continue;
+
             writer.startRecord(ESM::REC_PROJ);
 
             ESM::ProjectileState state;
@@ -661,6 +733,9 @@ namespace MWWorld
 
         for (std::vector<MagicBoltState>::const_iterator it = mMagicBolts.begin(); it != mMagicBolts.end(); ++it)
         {
+            if (it->mToDelete)
+                continue;
+
             writer.startRecord(ESM::REC_MPRJ);
 
             ESM::MagicBoltState state;
@@ -785,7 +860,9 @@ namespace MWWorld
 
     int ProjectileManager::countSavedGameRecords() const
     {
-        return mMagicBolts.size() + mProjectiles.size();
+        const auto isAlive = [](const State& state) { return !state.mToDelete; };
+        return std::count_if(mMagicBolts.begin(), mMagicBolts.end(), isAlive)
+            + std::count_if(mProjectiles.begin(), mProjectiles.end(), isAlive);
     }
 
     MWWorld::Ptr ProjectileManager::State::getCaster()
@@ -1,8 +1,11 @@
 #ifndef OPENMW_MWWORLD_PROJECTILEMANAGER_H
 #define OPENMW_MWWORLD_PROJECTILEMANAGER_H
 
+#include <map>
 #include <string>
+#include <vector>
 
+#include <osg/Light>
 #include <osg/PositionAttitudeTransform>
 #include <osg/ref_ptr>
 
@@ -75,11 +78,39 @@ namespace MWWorld
         MWPhysics::PhysicsSystem* mPhysics;
         float mCleanupTimer;
 
+        // Scene nodes of expired projectiles are kept for reuse by later projectiles with the same
+        // model, so that arrow spam and magic crossfire don't pay for a fresh scene graph instance
+        // (and its allocations) per shot.
+        struct NodePoolKey
+        {
+            std::string mModel;
+            std::string mTexture;
+            bool mRotate;
+            bool mCreateLight;
+
+            bool operator<(const NodePoolKey& other) const;
+        };
+
+        struct PooledNode
+        {
+            osg::ref_ptr<osg::PositionAttitudeTransform> mNode;
+            osg::ref_ptr<osg::Light> mLight;
+        };
+
         struct State
         {
             osg::ref_ptr<osg::PositionAttitudeTransform> mNode;
             std::shared_ptr<MWRender::EffectAnimationTime> mEffectAnimationTime;
 
+            // Light created for this projectile, if any; recolored when the node is reused.
+            osg::ref_ptr<osg::Light> mLight;
+
+            NodePoolKey mPoolKey;
+
+            // Nodes customised after creation (enchantment glow, extra bolt models) can't be
+            // safely reused for a different projectile.
+            bool mPoolable = false;
+
             int mActorId;
             int mProjectileId;
 
@@ -127,9 +158,11 @@ namespace MWWorld
 
         std::vector<MagicBoltState> mMagicBolts;
         std::vector<ProjectileState> mProjectiles;
+        std::map<NodePoolKey, std::vector<PooledNode>> mNodePool;
 
         void cleanupProjectile(ProjectileState& state);
         void cleanupMagicBolt(MagicBoltState& state);
+        void returnNodeToPool(State& state);
         void periodicCleanup(float dt);
 
         void moveProjectiles(float dt);
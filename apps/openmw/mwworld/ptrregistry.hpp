@@ -5,14 +5,23 @@
 
 #include "components/esm3/cellref.hpp"
 
+#include <atomic>
+#include <cstddef>
 #include <unordered_map>
 
 namespace MWWorld
 {
+    // Maps RefNums to Ptrs for the id lookups behind WorldModel::getPtr.
+    //
+    // Reads are lock-free by design: the Lua worker thread resolves object handles against the index while the main
+    // thread renders, and all mutations happen in the main thread update phase while the worker is parked, so the two
+    // never run concurrently (the worker handoff is the synchronization point). The revision counter lets SafePtr skip
+    // lookups entirely while nothing changed; it is atomic because it is the one member also read from the worker
+    // thread while the main thread may still be mutating on behalf of engine handlers.
     class PtrRegistry
     {
     public:
-        std::size_t getRevision() const { return mRevision; }
+        std::size_t getRevision() const { return mRevision.load(std::memory_order_relaxed); }
 
         ESM::RefNum getLastGenerated() const { return mLastGenerated; }
 
@@ -30,17 +39,22 @@ namespace MWWorld
 
         void setLastGenerated(ESM::RefNum v) { mLastGenerated = v; }
 
+        // Force revision-gated Ptr caches (SafePtr) to resolve again even though the index itself
+        // did not change. Used when a cell leaves the active grid, so that the next resolution
+        // into it goes through getOrEmpty and is seen by CellStore::markExternalReference.
+        void bumpRevision() { mRevision.fetch_add(1, std::memory_order_relaxed); }
+
         void clear()
         {
             mIndex.clear();
             mLastGenerated = ESM::RefNum{};
-            ++mRevision;
+            mRevision.fetch_add(1, std::memory_order_relaxed);
         }
 
         void insert(const Ptr& ptr)
         {
             mIndex[ptr.getCellRef().getOrAssignRefNum(mLastGenerated)] = ptr;
-            ++mRevision;
+            mRevision.fetch_add(1, std::memory_order_relaxed);
         }
 
         void remove(const LiveCellRefBase& ref) noexcept
@@ -52,7 +66,7 @@ namespace MWWorld
             if (it != mIndex.end() && it->second.mRef == &ref)
             {
                 mIndex.erase(it);
-                ++mRevision;
+                mRevision.fetch_add(1, std::memory_order_relaxed);
             }
         }
 
@@ -68,7 +82,7 @@ namespace MWWorld
         }
 
     private:
-        std::size_t mRevision = 0;
+        std::atomic<std::size_t> mRevision{ 0 };
         std::unordered_map<ESM::RefNum, Ptr> mIndex;
         ESM::RefNum mLastGenerated;
     };
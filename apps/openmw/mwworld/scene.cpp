@@ -1,5 +1,6 @@
 #include "scene.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <limits>
@@ -354,6 +355,8 @@ namespace MWWorld
             mChangeCellGridRequest.reset();
         }
 
+        processDeferredCellLoads();
+
         mPreloader->updateCache(mRendering.getReferenceTime());
         preloadCells(duration);
     }
@@ -415,6 +418,10 @@ namespace MWWorld
 
         MWBase::Environment::get().getSoundManager()->stopSound(cell);
         mActiveCells.erase(cell);
+        cell->setActiveInScene(false);
+        // Revision-gated Ptr caches must resolve again before touching the now inactive cell so
+        // that WorldModel sees the hand-out (see CellStore::markExternalReference).
+        mWorld.getWorldModel().invalidatePtrCaches();
         // Clean up any effects that may have been spawned while unloading all cells
         if (mActiveCells.empty())
             mRendering.notifyWorldSpaceChanged();
@@ -427,6 +434,7 @@ namespace MWWorld
 
         assert(mActiveCells.find(&cell) == mActiveCells.end());
         mActiveCells.insert(&cell);
+        cell.setActiveInScene(true);
 
         Log(Debug::Info) << "Loading cell " << cell.getCell()->getDescription();
 
@@ -541,6 +549,7 @@ namespace MWWorld
         assert(mActiveCells.empty());
         mCurrentCell = nullptr;
         mLowestPoint = std::numeric_limits<float>::max();
+        mDeferredCellLoads.clear();
 
         mPreloader->clear();
     }
@@ -620,6 +629,8 @@ namespace MWWorld
         const int playerCellX = playerCellIndex.mX;
         const int playerCellY = playerCellIndex.mY;
 
+        mDeferredCellLoads.clear();
+
         for (auto iter = mActiveCells.begin(); iter != mActiveCells.end();)
         {
             auto* cell = *iter++;
@@ -656,12 +667,22 @@ namespace MWWorld
 
         addPostponedPhysicsObjects();
 
+        // With a positive 'exterior cell load budget' only the player's cell and its direct
+        // neighbours are loaded before the transition finishes; the outer grid cells are loaded
+        // over the following frames in processDeferredCellLoads().
+        const bool deferOuterCells = Settings::cells().mExteriorCellLoadBudget > 0;
+
         std::size_t refsToLoad = 0;
         std::vector<std::pair<int, int>> cellsPositionsToLoad;
         iterateOverCellsAround(playerCellX, playerCellY, mHalfGridSize, [&](int x, int y) {
             const ESM::ExteriorCellLocation location(x, y, playerCellIndex.mWorldspace);
             if (isCellInCollection(location, mActiveCells))
                 return;
+            if (deferOuterCells && (std::abs(x - playerCellX) > 1 || std::abs(y - playerCellY) > 1))
+            {
+                mDeferredCellLoads.push_back(location);
+                return;
+            }
             refsToLoad += mWorld.getWorldModel().getExterior(location).count();
             cellsPositionsToLoad.emplace_back(x, y);
         });
@@ -683,6 +704,16 @@ namespace MWWorld
             }
         }
 
+        std::sort(mDeferredCellLoads.begin(), mDeferredCellLoads.end(),
+            [&](const ESM::ExteriorCellLocation& lhs, const ESM::ExteriorCellLocation& rhs) {
+                const auto distance = [&](const ESM::ExteriorCellLocation& location) {
+                    return std::abs(location.mX - playerCellX) + std::abs(location.mY - playerCellY);
+                };
+                return distance(lhs) < distance(rhs);
+            });
+        mDeferredCellLoadPos = pos;
+        mDeferredCellLoadRespawn = changeEvent;
+
         mNavigator.update(pos, navigatorUpdateGuard.get());
 
         navigatorUpdateGuard.reset();
@@ -696,6 +727,40 @@ namespace MWWorld
         mCellLoaded = true;
     }
 
+    void Scene::processDeferredCellLoads()
+    {
+        if (mDeferredCellLoads.empty())
+            return;
+
+        const float budget = Settings::cells().mExteriorCellLoadBudget;
+        const auto started = std::chrono::steady_clock::now();
+
+        auto navigatorUpdateGuard = mNavigator.makeUpdateGuard();
+        bool loadedAny = false;
+
+        while (!mDeferredCellLoads.empty())
+        {
+            const ESM::ExteriorCellLocation location = mDeferredCellLoads.front();
+            mDeferredCellLoads.erase(mDeferredCellLoads.begin());
+
+            if (!isCellInCollection(location, mActiveCells))
+            {
+                CellStore& cell = mWorld.getWorldModel().getExterior(location);
+                loadCell(cell, nullptr, mDeferredCellLoadRespawn, mDeferredCellLoadPos, navigatorUpdateGuard.get());
+                loadedAny = true;
+            }
+
+            const float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - started).count();
+            if (elapsed >= budget)
+                break;
+        }
+
+        if (loadedAny)
+            mNavigator.update(mDeferredCellLoadPos, navigatorUpdateGuard.get());
+
+        navigatorUpdateGuard.reset();
+    }
+
     void Scene::addPostponedPhysicsObjects()
     {
         for (const auto& cell : mActiveCells)
@@ -951,6 +1016,8 @@ namespace MWWorld
 
         auto navigatorUpdateGuard = mNavigator.makeUpdateGuard();
 
+        mDeferredCellLoads.clear();
+
         // unload
         for (auto iter = mActiveCells.begin(); iter != mActiveCells.end();)
         {
@@ -1028,6 +1095,23 @@ namespace MWWorld
         const bool isInterior = !cell.isExterior();
         InsertVisitor insertVisitor(cell, loadingListener);
         cell.forEach(insertVisitor);
+
+        // Begin loading the models on the work queue so the loads overlap with the scene and physics
+        // insertion below; insertObjectRendering() joins whichever load is still in flight when it gets
+        // to the object.
+        Resource::SceneManager* sceneManager = mRendering.getResourceSystem()->getSceneManager();
+        for (const MWWorld::Ptr& ptr : insertVisitor.mToInsert)
+        {
+            if (ptr.mRef->isDeleted() || !ptr.getRefData().isEnabled())
+                continue;
+            const ESM::RefNum refnum = ptr.getCellRef().getRefNum();
+            if (refnum.hasContentFile() && std::binary_search(mPagedRefs.begin(), mPagedRefs.end(), refnum))
+                continue;
+            const std::string model = getModel(ptr);
+            if (!model.empty())
+                sceneManager->requestTemplate(model);
+        }
+
         insertVisitor.insert(
             [&](const MWWorld::Ptr& ptr) { addObject(ptr, mWorld, mPagedRefs, *mPhysics, mRendering); });
         insertVisitor.insert([&](const MWWorld::Ptr& ptr) {
@@ -1133,17 +1217,37 @@ namespace MWWorld
         {
             osg::ref_ptr<PreloadMeshItem> item(
                 new PreloadMeshItem(mesh_, mRendering.getResourceSystem()->getSceneManager()));
-            mRendering.getWorkQueue()->addWorkItem(item);
+            mRendering.getWorkQueue()->addWorkItem(item, SceneUtil::WorkPriority::Background);
             const auto isDone = [](const osg::ref_ptr<SceneUtil::WorkItem>& v) { return v->isDone(); };
             mWorkItems.erase(std::remove_if(mWorkItems.begin(), mWorkItems.end(), isDone), mWorkItems.end());
             mWorkItems.emplace_back(std::move(item));
         }
     }
 
+    void Scene::updatePreloadBudget(float dt)
+    {
+        const float targetFrameTime = 1.f / Settings::cells().mTargetFramerate;
+        mSmoothedFrameTime
+            = mSmoothedFrameTime <= 0.f ? dt : mSmoothedFrameTime + (dt - mSmoothedFrameTime) * 0.05f;
+
+        // Shrink quickly when the frame rate drops below the target and recover gradually once
+        // there is headroom again, so one config adapts from handhelds to fast desktops.
+        if (mSmoothedFrameTime > targetFrameTime * 1.05f)
+            mPreloadBudgetScale *= 0.98f;
+        else if (mSmoothedFrameTime < targetFrameTime * 0.9f)
+            mPreloadBudgetScale += 0.002f;
+        mPreloadBudgetScale = std::clamp(mPreloadBudgetScale, 0.25f, 1.f);
+
+        // The configured distance acts as the upper bound; scale it more gently than the dispatch
+        // budget since preloading less far ahead only pays off over seconds.
+        mPreloadDistance = Settings::cells().mPreloadDistance * (0.5f + 0.5f * mPreloadBudgetScale);
+    }
+
     void Scene::preloadCells(float dt)
     {
         if (dt <= 1e-06)
             return;
+        updatePreloadBudget(dt);
         std::vector<PositionCellGrid> exteriorPositions;
 
         const MWWorld::ConstPtr player = mWorld.getPlayerPtr();
@@ -1159,6 +1263,10 @@ namespace MWWorld
 
         if (mPreloadEnabled)
         {
+            // Dispatching preloads scans cell contents on the main thread; cap that work at a
+            // fraction of the target frame time. Cells the player moves towards bypass the cap.
+            mPreloader->startFrame(0.1 * mPreloadBudgetScale / Settings::cells().mTargetFramerate);
+
             if (mPreloadDoors)
                 preloadTeleportDoorDestinations(playerPos, predictedPos);
             if (mPreloadExteriorGrid)
@@ -1195,9 +1303,12 @@ namespace MWWorld
 
             if (sqrDistToPlayer < mPreloadDistance * mPreloadDistance)
             {
+                // The closer the door, the more likely it is to be activated soon.
+                const bool likelyActivated = sqrDistToPlayer < mPreloadDistance * mPreloadDistance * 0.25f;
                 try
                 {
-                    preloadCellWithSurroundings(mWorld.getWorldModel().getCell(door.getCellRef().getDestCell()));
+                    preloadCellWithSurroundings(
+                        mWorld.getWorldModel().getCell(door.getCellRef().getDestCell()), likelyActivated);
                 }
                 catch (const std::exception& e)
                 {
@@ -1222,6 +1333,9 @@ namespace MWWorld
 
         float cellSize = ESM::getCellSize(extWorldspace);
 
+        osg::Vec2f movementDir(predictedPos.x() - playerPos.x(), predictedPos.y() - playerPos.y());
+        const bool moving = movementDir.normalize() > 1.f;
+
         for (int dx = -halfGridSizePlusOne; dx <= halfGridSizePlusOne; ++dx)
         {
             for (int dy = -halfGridSizePlusOne; dy <= halfGridSizePlusOne; ++dy)
@@ -1240,16 +1354,26 @@ namespace MWWorld
                 float loadDist = cellSize / 2 + cellSize - mCellLoadingThreshold + mPreloadDistance;
 
                 if (dist < loadDist)
-                    preloadCell(mWorld.getWorldModel().getExterior(cellIndex));
+                {
+                    // Prioritize the cells the player is heading for over the rest of the ring.
+                    bool towardsCell = false;
+                    if (moving)
+                    {
+                        osg::Vec2f toCell = thisCellCenter - osg::Vec2f(playerPos.x(), playerPos.y());
+                        toCell.normalize();
+                        towardsCell = movementDir * toCell > 0.5f;
+                    }
+                    preloadCell(mWorld.getWorldModel().getExterior(cellIndex), towardsCell);
+                }
             }
         }
     }
 
-    void Scene::preloadCellWithSurroundings(CellStore& cell)
+    void Scene::preloadCellWithSurroundings(CellStore& cell, bool highPriority)
     {
         if (!cell.isExterior())
         {
-            mPreloader->preload(cell, mRendering.getReferenceTime());
+            mPreloader->preload(cell, mRendering.getReferenceTime(), highPriority);
             return;
         }
 
@@ -1278,14 +1402,16 @@ namespace MWWorld
         }
 
         const ESM::RefId worldspace = cell.getCell()->getWorldSpace();
+        const int centerX = cell.getCell()->getGridX();
+        const int centerY = cell.getCell()->getGridY();
         for (const auto& [x, y] : cells)
             mPreloader->preload(mWorld.getWorldModel().getExterior(ESM::ExteriorCellLocation(x, y, worldspace)),
-                mRendering.getReferenceTime());
+                mRendering.getReferenceTime(), highPriority && x == centerX && y == centerY);
     }
 
-    void Scene::preloadCell(CellStore& cell)
+    void Scene::preloadCell(CellStore& cell, bool highPriority)
     {
-        mPreloader->preload(cell, mRendering.getReferenceTime());
+        mPreloader->preload(cell, mRendering.getReferenceTime(), highPriority);
     }
 
     void Scene::preloadTerrain(const osg::Vec3f& pos, ESM::RefId worldspace, bool sync)
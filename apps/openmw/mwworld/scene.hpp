@@ -96,6 +96,10 @@ namespace MWWorld
         std::unique_ptr<CellPreloader> mPreloader;
         float mCellLoadingThreshold;
         float mPreloadDistance;
+        // Closed-loop scale applied to the preload distance and per-frame dispatch budget,
+        // derived from measured frame headroom. 1 while the target frame rate is met.
+        float mPreloadBudgetScale = 1.f;
+        float mSmoothedFrameTime = 0.f;
         bool mPreloadEnabled;
 
         bool mPreloadExteriorGrid;
@@ -114,9 +118,17 @@ namespace MWWorld
 
         std::optional<ChangeCellGridRequest> mChangeCellGridRequest;
 
+        // Outer grid cells whose loading was deferred by changeCellGrid, highest priority first.
+        // Drained in update() under the 'exterior cell load budget' per-frame time budget.
+        std::vector<ESM::ExteriorCellLocation> mDeferredCellLoads;
+        osg::Vec3f mDeferredCellLoadPos;
+        bool mDeferredCellLoadRespawn = false;
+
         void insertCell(CellStore& cell, Loading::Listener* loadingListener,
             const DetourNavigator::UpdateGuard* navigatorUpdateGuard);
 
+        void processDeferredCellLoads();
+
         osg::Vec2i mCurrentGridCenter;
 
         // Load and unload cells as necessary to create a cell grid with "X" and "Y" in the center
@@ -125,6 +137,7 @@ namespace MWWorld
         void requestChangeCellGrid(const osg::Vec3f& position, const osg::Vec2i& cell, bool changeEvent = true);
 
         void preloadCells(float dt);
+        void updatePreloadBudget(float dt);
         void preloadTeleportDoorDestinations(const osg::Vec3f& playerPos, const osg::Vec3f& predictedPos);
         void preloadExteriorGrid(const osg::Vec3f& playerPos, const osg::Vec3f& predictedPos);
         void preloadFastTravelDestinations(
@@ -143,8 +156,8 @@ namespace MWWorld
 
         ~Scene();
 
-        void preloadCellWithSurroundings(MWWorld::CellStore& cell);
-        void preloadCell(MWWorld::CellStore& cell);
+        void preloadCellWithSurroundings(MWWorld::CellStore& cell, bool highPriority = false);
+        void preloadCell(MWWorld::CellStore& cell, bool highPriority = false);
         void preloadTerrain(const osg::Vec3f& pos, ESM::RefId worldspace, bool sync = false);
         void reloadTerrain();
 
@@ -978,6 +978,11 @@ namespace MWWorld
         return TypedDynamicStore::search(id);
     }
 
+    const ESM::GameSetting* Store<ESM::GameSetting>::find(const ESM::RefId& id) const
+    {
+        return TypedDynamicStore::find(id);
+    }
+
     const ESM::GameSetting* Store<ESM::GameSetting>::find(std::string_view id) const
     {
         return TypedDynamicStore::find(ESM::RefId::stringRefId(id));
@@ -277,7 +277,10 @@ namespace MWWorld
     {
     public:
         const ESM::GameSetting* search(const ESM::RefId& id) const;
+        const ESM::GameSetting* find(const ESM::RefId& id) const;
 
+        // Interns the given string; prefer the RefId overloads with a prebuilt id
+        // (e.g. from MWWorld::CommonIds) in frequently executed code.
         const ESM::GameSetting* find(const std::string_view id) const;
         const ESM::GameSetting* search(const std::string_view id) const;
 
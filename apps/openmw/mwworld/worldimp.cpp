@@ -1,6 +1,7 @@
 #include "worldimp.hpp"
 
 #include <charconv>
+#include <sstream>
 #include <vector>
 
 #include <osg/ComputeBoundsVisitor>
@@ -52,6 +53,7 @@
 #include <components/detournavigator/updateguard.hpp>
 
 #include <components/files/conversion.hpp>
+#include <components/files/hash.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
 
 #include <components/settings/values.hpp>
@@ -94,6 +96,7 @@
 
 #include "actionteleport.hpp"
 #include "cellstore.hpp"
+#include "commonids.hpp"
 #include "containerstore.hpp"
 #include "datetimemanager.hpp"
 #include "inventorystore.hpp"
@@ -237,6 +240,22 @@ namespace MWWorld
         }
     };
 
+    // Identifies the active content files for the cell ref index cache. Hashing the file
+    // contents would cost a large share of what the cache saves, so the fingerprint is built
+    // from the resolved paths, sizes and modification times instead.
+    static std::array<std::uint64_t, 2> computeContentFilesHash(const std::vector<std::filesystem::path>& paths)
+    {
+        std::ostringstream fingerprint;
+        for (const std::filesystem::path& path : paths)
+        {
+            std::error_code ignored;
+            fingerprint << Files::pathToUnicodeString(path) << '\0' << std::filesystem::file_size(path, ignored)
+                        << '\0' << std::filesystem::last_write_time(path, ignored).time_since_epoch().count() << '\n';
+        }
+        std::istringstream stream(fingerprint.str());
+        return Files::getHash("content files", stream);
+    }
+
     void World::adjustSky()
     {
         if (mSky && (isCellExterior() || isCellQuasiExterior()))
@@ -279,12 +298,14 @@ namespace MWWorld
         mContentFiles = contentFiles;
         mESMVersions.resize(mContentFiles.size(), -1);
 
-        loadContentFiles(fileCollections, contentFiles, encoder, listener);
+        const std::vector<std::filesystem::path> contentPaths
+            = loadContentFiles(fileCollections, contentFiles, encoder, listener);
         loadGroundcoverFiles(fileCollections, groundcoverFiles, encoder, listener);
 
         fillGlobalVariables();
 
         mStore.setUp();
+        mStore.setCellRefIndexCache(mUserDataPath / "cellrefindex.cache", computeContentFilesHash(contentPaths));
         mStore.validateRecords(mReaders);
         mStore.movePlayerRecord();
 
@@ -426,7 +447,7 @@ namespace MWWorld
         if (mPlayer)
         {
             mPlayer->clear();
-            mPlayer->set(mStore.get<ESM::NPC>().find(ESM::RefId::stringRefId("Player")));
+            mPlayer->set(mStore.get<ESM::NPC>().find(CommonIds::Player));
         }
 
         mDoorStates.clear();
@@ -1008,7 +1029,7 @@ namespace MWWorld
             return static_cast<float>(mActivationDistanceOverride);
 
         static const int iMaxActivateDist
-            = mStore.get<ESM::GameSetting>().find("iMaxActivateDist")->mValue.getInteger();
+            = mStore.get<ESM::GameSetting>().find(CommonIds::iMaxActivateDist)->mValue.getInteger();
         return static_cast<float>(iMaxActivateDist);
     }
 
@@ -2293,7 +2314,7 @@ namespace MWWorld
 
     void World::setupPlayer()
     {
-        const ESM::NPC* player = mStore.get<ESM::NPC>().find(ESM::RefId::stringRefId("Player"));
+        const ESM::NPC* player = mStore.get<ESM::NPC>().find(CommonIds::Player);
         if (!mPlayer)
             mPlayer = std::make_unique<MWWorld::Player>(player);
         else
@@ -2482,7 +2503,7 @@ namespace MWWorld
                 if (actor == getPlayerPtr())
                     MWBase::Environment::get().getWindowManager()->activateHitOverlay(false);
 
-                auto healthDamage = ESM::RefId::stringRefId("Health Damage");
+                const ESM::RefId& healthDamage = CommonIds::HealthDamage;
                 if (!MWBase::Environment::get().getSoundManager()->getSoundPlaying(actor, healthDamage))
                     MWBase::Environment::get().getSoundManager()->playSound3D(actor, healthDamage, 1.0f, 1.0f);
             }
@@ -2516,7 +2537,7 @@ namespace MWWorld
                 if (actor == getPlayerPtr())
                     MWBase::Environment::get().getWindowManager()->activateHitOverlay(false);
 
-                auto healthDamage = ESM::RefId::stringRefId("Health Damage");
+                const ESM::RefId& healthDamage = CommonIds::HealthDamage;
                 if (!MWBase::Environment::get().getSoundManager()->getSoundPlaying(actor, healthDamage))
                     MWBase::Environment::get().getSoundManager()->playSound3D(actor, healthDamage, 1.0f, 1.0f);
             }
@@ -2844,9 +2865,12 @@ namespace MWWorld
         return mScriptsEnabled;
     }
 
-    void World::loadContentFiles(const Files::Collections& fileCollections, const std::vector<std::string>& content,
-        ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+    std::vector<std::filesystem::path> World::loadContentFiles(const Files::Collections& fileCollections,
+        const std::vector<std::string>& content, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
     {
+        std::vector<std::filesystem::path> resolvedPaths;
+        resolvedPaths.reserve(content.size());
+
         GameContentLoader gameContentLoader;
         EsmLoader esmLoader(mStore, mReaders, encoder, mESMVersions);
 
@@ -2867,7 +2891,9 @@ namespace MWWorld
                 = fileCollections.getCollection(Files::pathToUnicodeString(filename.extension()));
             if (col.doesExist(file))
             {
-                gameContentLoader.load(col.getPath(file), idx, listener);
+                const std::filesystem::path& path = col.getPath(file);
+                gameContentLoader.load(path, idx, listener);
+                resolvedPaths.push_back(path);
             }
             else
             {
@@ -2879,6 +2905,8 @@ namespace MWWorld
 
         if (const auto v = esmLoader.getMasterFileFormat(); v.has_value() && *v == 0)
             ensureNeededRecords(); // Insert records that may not be present in all versions of master files.
+
+        return resolvedPaths;
     }
 
     void World::loadGroundcoverFiles(const Files::Collections& fileCollections,
@@ -2889,6 +2917,18 @@ namespace MWWorld
 
         Log(Debug::Info) << "Loading groundcover:";
 
+        std::vector<std::filesystem::path> resolvedPaths;
+        resolvedPaths.reserve(groundcoverFiles.size());
+        for (const std::string& file : groundcoverFiles)
+        {
+            const auto filename = Files::pathFromUnicodeString(file);
+            const Files::MultiDirCollection& col
+                = fileCollections.getCollection(Files::pathToUnicodeString(filename.extension()));
+            if (col.doesExist(file))
+                resolvedPaths.push_back(col.getPath(file));
+        }
+        mGroundcoverStore.setCache(mUserDataPath / "groundcover.cache", computeContentFilesHash(resolvedPaths));
+
         mGroundcoverStore.init(mStore.get<ESM::Static>(), fileCollections, groundcoverFiles, encoder, listener);
     }
 
@@ -2984,7 +3024,7 @@ namespace MWWorld
                 // For object targets, we want the detailed shapes (rendering raycast).
                 // If we used the bounding boxes for static objects, then we would not be able to target e.g.
                 // objects lying on a shelf.
-                const float fCombatDistance = mStore.get<ESM::GameSetting>().find("fCombatDistance")->mValue.getFloat();
+                const float fCombatDistance = mStore.get<ESM::GameSetting>().find(CommonIds::fCombatDistance)->mValue.getFloat();
                 target = MWMechanics::getHitContact(actor, fCombatDistance).first;
 
                 if (target.isEmpty())
@@ -3724,7 +3764,7 @@ namespace MWWorld
 
             if (MWMechanics::isSummoningEffect(effectInfo.mData.mEffectID))
             {
-                preload(mWorldScene.get(), mStore, ESM::RefId::stringRefId("VFX_Summon_Start"));
+                preload(mWorldScene.get(), mStore, CommonIds::VFX_SummonStart);
                 preload(mWorldScene.get(), mStore, MWMechanics::getSummonedCreature(effectInfo.mData.mEffectID));
             }
 
@@ -173,8 +173,9 @@ namespace MWWorld
 
         void updateSkyDate();
 
-        void loadContentFiles(const Files::Collections& fileCollections, const std::vector<std::string>& content,
-            ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener);
+        /// \return the resolved path of every loaded content file, in load order.
+        std::vector<std::filesystem::path> loadContentFiles(const Files::Collections& fileCollections,
+            const std::vector<std::string>& content, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener);
 
         void loadGroundcoverFiles(const Files::Collections& fileCollections,
             const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
@@ -1,8 +1,13 @@
 #include "worldmodel.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <mutex>
 #include <optional>
+#include <sstream>
+#include <thread>
 
 #include <components/debug/debuglog.hpp>
 #include <components/esm/defs.hpp>
@@ -103,7 +108,7 @@ namespace MWWorld
         }
 
         CellStore* getOrCreateExterior(const ESM::ExteriorCellLocation& location,
-            std::map<ESM::ExteriorCellLocation, MWWorld::CellStore*>& exteriors, ESMStore& store,
+            std::unordered_map<ESM::ExteriorCellLocation, MWWorld::CellStore*>& exteriors, ESMStore& store,
             ESM::ReadersCache& readers, std::unordered_map<ESM::RefId, CellStore>& cells, bool triggerEvent)
         {
             if (const auto it = exteriors.find(location); it != exteriors.end())
@@ -146,7 +151,9 @@ void MWWorld::WorldModel::clear()
     mPtrRegistry.clear();
     mInteriors.clear();
     mExteriors.clear();
+    mLastExterior = nullptr;
     mCells.clear();
+    mSerializedCellRecords.clear();
     std::fill(mIdCache.begin(), mIdCache.end(), std::make_pair(ESM::RefId(), (MWWorld::CellStore*)nullptr));
     mIdCacheIndex = 0;
 }
@@ -157,6 +164,9 @@ MWWorld::Ptr MWWorld::WorldModel::getPtrAndCache(const ESM::RefId& name, CellSto
 
     if (!ptr.isEmpty() && ptr.isInCell())
     {
+        // The caller may keep the Ptr and mutate through it without further CellStore calls
+        // (targeted scripts, AI targets), so the cached save record can no longer be trusted.
+        ptr.getCell()->markExternalReference();
         mIdCache[mIdCacheIndex].first = name;
         mIdCache[mIdCacheIndex].second = &cellStore;
         if (++mIdCacheIndex >= mIdCache.size())
@@ -168,20 +178,36 @@ MWWorld::Ptr MWWorld::WorldModel::getPtrAndCache(const ESM::RefId& name, CellSto
 
 void MWWorld::WorldModel::writeCell(ESM::ESMWriter& writer, CellStore& cell) const
 {
-    if (cell.getState() != CellStore::State_Loaded)
-        cell.load();
+    SerializedCellRecord& cached = mSerializedCellRecords[cell.getCell()->getId()];
+    const bool reusable = !cached.mData.empty() && cached.mStateRevision == cell.getStateRevision()
+        && !cell.isActiveInScene() && !cell.hasExternalReference() && !cell.hasMovedRefs();
+    if (!reusable)
+    {
+        if (cell.getState() != CellStore::State_Loaded)
+            cell.load();
+
+        ESM::CellState cellState;
+
+        cell.saveState(cellState);
 
-    ESM::CellState cellState;
+        std::ostringstream stream;
+        ESM::ESMWriter cellWriter;
+        cellWriter.setFormatVersion(writer.getFormatVersion());
+        cellWriter.saveRecords(stream);
 
-    cell.saveState(cellState);
+        cellWriter.startRecord(ESM::REC_CSTA);
 
-    writer.startRecord(ESM::REC_CSTA);
+        cellWriter.writeCellId(cellState.mId);
+        cellState.save(cellWriter);
+        cell.writeFog(cellWriter);
+        cell.writeReferences(cellWriter);
+        cellWriter.endRecord(ESM::REC_CSTA);
+
+        cached.mStateRevision = cell.getStateRevision();
+        cached.mData = std::move(stream).str();
+    }
 
-    writer.writeCellId(cellState.mId);
-    cellState.save(writer);
-    cell.writeFog(writer);
-    cell.writeReferences(writer);
-    writer.endRecord(ESM::REC_CSTA);
+    writer.writeSerializedRecord(cached.mData);
 }
 
 MWWorld::WorldModel::WorldModel(MWWorld::ESMStore& store, ESM::ReadersCache& readers)
@@ -196,7 +222,13 @@ namespace MWWorld
 {
     CellStore& WorldModel::getExterior(ESM::ExteriorCellLocation location, bool forceLoad) const
     {
-        CellStore* cellStore = getOrCreateExterior(location, mExteriors, mStore, mReaders, mCells, true);
+        CellStore* cellStore = mLastExterior;
+        if (cellStore == nullptr || location != mLastExteriorLocation)
+        {
+            cellStore = getOrCreateExterior(location, mExteriors, mStore, mReaders, mCells, true);
+            mLastExteriorLocation = location;
+            mLastExterior = cellStore;
+        }
 
         if (forceLoad && cellStore->getState() != CellStore::State_Loaded)
             cellStore->load();
@@ -353,11 +385,13 @@ MWWorld::Ptr MWWorld::WorldModel::getPtrByRefId(const ESM::RefId& name)
     }
 
     // Then check cells that are already listed
-    // Search in reverse, this is a workaround for an ambiguous chargen_plank reference in the vanilla game.
-    // there is one at -22,16 and one at -2,-9, the latter should be used.
-    for (auto iter = mExteriors.rbegin(); iter != mExteriors.rend(); ++iter)
+    // Search in descending location order, this is a workaround for an ambiguous chargen_plank
+    // reference in the vanilla game. there is one at -22,16 and one at -2,-9, the latter should be used.
+    std::vector<std::pair<ESM::ExteriorCellLocation, CellStore*>> exteriors(mExteriors.begin(), mExteriors.end());
+    std::sort(exteriors.begin(), exteriors.end(), [](const auto& lhs, const auto& rhs) { return rhs.first < lhs.first; });
+    for (const auto& [_, cellStore] : exteriors)
     {
-        Ptr ptr = getPtrAndCache(name, *iter->second);
+        Ptr ptr = getPtrAndCache(name, *cellStore);
         if (!ptr.isEmpty())
             return ptr;
     }
@@ -473,35 +507,125 @@ public:
 
 bool MWWorld::WorldModel::readRecord(ESM::ESMReader& reader, uint32_t type)
 {
-    if (type == ESM::REC_CSTA)
-    {
-        ESM::CellState state;
-        state.mId = reader.getCellId();
+    if (type != ESM::REC_CSTA)
+        return false;
 
-        GetCellStoreCallback callback(*this);
+    GetCellStoreCallback callback(*this);
 
-        CellStore* const cellStore = callback.getCellStore(state.mId);
+    // Cell state records are written as one contiguous block, so gather the whole block and
+    // decode the per-cell states on worker threads into staging structures. Everything that
+    // touches the world is applied on this thread afterwards, in record order.
+    struct PendingCellState
+    {
+        CellStore* mCellStore = nullptr;
+        ESM::RefId mId;
+        ESM::ESM_Context mContext;
+        ESM::CellState mState;
+        std::unique_ptr<ESM::FogState> mFog;
+        CellStore::DecodedReferences mReferences;
+    };
+    std::vector<PendingCellState> pending;
+
+    while (true)
+    {
+        const ESM::RefId id = reader.getCellId();
+
+        CellStore* const cellStore = callback.getCellStore(id);
 
         if (cellStore == nullptr)
         {
-            Log(Debug::Warning) << "Dropping state for cell " << state.mId << " (cell no longer exists)";
+            Log(Debug::Warning) << "Dropping state for cell " << id << " (cell no longer exists)";
             reader.skipRecord();
-            return true;
+        }
+        else
+        {
+            PendingCellState state;
+            state.mCellStore = cellStore;
+            state.mId = id;
+            state.mContext = reader.getContext();
+            reader.skipRecord();
+            pending.push_back(std::move(state));
         }
 
-        state.load(reader);
-        cellStore->loadState(state);
+        if (!reader.hasMoreRecs())
+            break;
+        const ESM::ESM_Context next = reader.getContext();
+        if (reader.getRecName().toInt() != ESM::REC_CSTA)
+        {
+            // Not ours: put the record name back for the caller.
+            reader.restoreContext(next);
+            break;
+        }
+        reader.getRecHeader();
+    }
+
+    const auto decode = [](PendingCellState& state, ESM::ESMReader& stateReader) {
+        stateReader.restoreContext(state.mContext);
+        state.mState.mId = state.mId;
+        state.mState.load(stateReader);
+        if (state.mState.mHasFogOfWar)
+        {
+            state.mFog = std::make_unique<ESM::FogState>();
+            state.mFog->load(stateReader);
+        }
+        state.mReferences = state.mCellStore->decodeReferences(stateReader);
+    };
+
+    const std::size_t threadsCount
+        = std::min<std::size_t>(std::max<std::size_t>(std::thread::hardware_concurrency(), 1), pending.size());
+    if (threadsCount <= 1)
+    {
+        const ESM::ESM_Context resume = reader.getContext();
+        for (PendingCellState& state : pending)
+            decode(state, reader);
+        reader.restoreContext(resume);
+    }
+    else
+    {
+        std::atomic_size_t nextState = 0;
+        std::mutex exceptionMutex;
+        std::exception_ptr exception;
+        const auto worker = [&] {
+            try
+            {
+                ESM::ESMReader stateReader;
+                stateReader.setEncoder(reader.getEncoder());
+                stateReader.setContentFileMapping(reader.getContentFileMapping());
+                stateReader.open(reader.getName());
+                for (std::size_t i = nextState.fetch_add(1); i < pending.size(); i = nextState.fetch_add(1))
+                    decode(pending[i], stateReader);
+            }
+            catch (...)
+            {
+                const std::lock_guard lock(exceptionMutex);
+                if (exception == nullptr)
+                    exception = std::current_exception();
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(threadsCount);
+        for (std::size_t i = 0; i < threadsCount; ++i)
+            threads.emplace_back(worker);
+        for (std::thread& thread : threads)
+            thread.join();
+        if (exception != nullptr)
+            std::rethrow_exception(exception);
+    }
 
-        if (state.mHasFogOfWar)
-            cellStore->readFog(reader);
+    for (PendingCellState& state : pending)
+    {
+        CellStore* const cellStore = state.mCellStore;
+
+        cellStore->loadState(state.mState);
+
+        if (state.mFog != nullptr)
+            cellStore->setFog(std::move(state.mFog));
 
         if (cellStore->getState() != CellStore::State_Loaded)
             cellStore->load();
 
-        cellStore->readReferences(reader, &callback);
-
-        return true;
+        cellStore->applyReferences(std::move(state.mReferences), &callback);
     }
 
-    return false;
+    return true;
 }
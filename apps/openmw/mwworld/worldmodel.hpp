@@ -67,7 +67,13 @@ namespace MWWorld
 
         Ptr getPtrByRefId(const ESM::RefId& name);
 
-        Ptr getPtr(ESM::RefNum refNum) const { return mPtrRegistry.getOrEmpty(refNum); }
+        Ptr getPtr(ESM::RefNum refNum) const
+        {
+            Ptr ptr = mPtrRegistry.getOrEmpty(refNum);
+            if (!ptr.isEmpty() && ptr.isInCell())
+                ptr.getCell()->markExternalReference();
+            return ptr;
+        }
 
         PtrRegistryView getPtrRegistryView() const { return PtrRegistryView(mPtrRegistry); }
 
@@ -77,6 +83,8 @@ namespace MWWorld
 
         std::size_t getPtrRegistryRevision() const { return mPtrRegistry.getRevision(); }
 
+        void invalidatePtrCaches() { mPtrRegistry.bumpRevision(); }
+
         void registerPtr(const Ptr& ptr) { mPtrRegistry.insert(ptr); }
 
         void deregisterLiveCellRef(const LiveCellRefBase& ref) noexcept { mPtrRegistry.remove(ref); }
@@ -112,11 +120,30 @@ namespace MWWorld
         ESM::ReadersCache& mReaders;
         mutable std::unordered_map<ESM::RefId, CellStore> mCells;
         mutable std::map<std::string, CellStore*, Misc::StringUtils::CiComp> mInteriors;
-        mutable std::map<ESM::ExteriorCellLocation, CellStore*> mExteriors;
+        mutable std::unordered_map<ESM::ExteriorCellLocation, CellStore*> mExteriors;
+        // One-entry cache for the common case of many successive lookups of the same cell
+        // (physics, AI and Lua nearby queries all resolve positions per frame).
+        mutable ESM::ExteriorCellLocation mLastExteriorLocation;
+        mutable CellStore* mLastExterior = nullptr;
         ESM::Cell mDraftCell;
         std::vector<std::pair<ESM::RefId, CellStore*>> mIdCache;
         std::size_t mIdCacheIndex = 0;
 
+        struct SerializedCellRecord
+        {
+            std::size_t mStateRevision = 0;
+            std::string mData;
+        };
+
+        // Cell records serialized for the previous saved game. writeCell reuses them verbatim,
+        // but only for cells that are verifiably untouched since: inactive, not resolved into
+        // from outside while inactive, without references moved to other cells, and with an
+        // unchanged state revision. Active cells are always re-serialized because gameplay
+        // mutates their references through Ptrs that never pass through CellStore. Keeps the
+        // cost of saving proportional to what changed instead of the total number of visited
+        // cells.
+        mutable std::unordered_map<ESM::RefId, SerializedCellRecord> mSerializedCellRecords;
+
         CellStore& getOrInsertCellStore(const ESM::Cell& cell);
 
         CellStore& insertCellStore(const ESM::Cell& cell);
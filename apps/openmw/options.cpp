@@ -71,6 +71,10 @@ namespace OpenMW
         addOption("script-blacklist-use", bpo::value<bool>()->implicit_value(true)->default_value(true),
             "enable script blacklisting");
 
+        addOption("script-full-rate",
+            bpo::value<StringsVector>()->default_value(StringsVector(), "")->multitoken()->composing(),
+            "always run the specified local script every frame, exempting it from reduced rate scheduling");
+
         addOption("load-savegame", bpo::value<Files::MaybeQuotedPath>()->default_value(Files::MaybeQuotedPath(), ""),
             "load a save game file on game startup (specify an absolute filename or a filename relative to the current "
             "working directory)");
@@ -102,6 +106,16 @@ namespace OpenMW
         addOption("random-seed", bpo::value<unsigned int>()->default_value(Misc::Rng::generateDefaultSeed()),
             "seed value for random number generator");
 
+        addOption("benchmark", bpo::value<Files::MaybeQuotedPath>()->default_value(Files::MaybeQuotedPath(), ""),
+            "run the given console script in benchmark mode: the main menu is skipped, the simulation advances with a "
+            "fixed timestep, the frame rate is not limited and frame time percentiles together with collected "
+            "statistics are written as JSON on exit (random-seed defaults to 0 in this mode)");
+
+        addOption("benchmark-output",
+            bpo::value<Files::MaybeQuotedPath>()->default_value(
+                Files::MaybeQuotedPath("openmw-benchmark.json"), "openmw-benchmark.json"),
+            "file the benchmark summary is written to");
+
         return desc;
     }
 }
@@ -4,6 +4,8 @@
 #include <osg/Stats>
 #include <osg/Timer>
 
+#include <components/debug/trace.hpp>
+
 #include <cstddef>
 #include <string>
 
@@ -37,6 +39,7 @@ namespace OMW
         PhysicsWorker,
         World,
         Gui,
+        Hud,
         WindowManager,
         Lua,
         Number,
@@ -75,6 +78,9 @@ namespace OMW
     template <>
     inline const UserStats UserStatsValue<UserStatsType::Gui>::sValue{ "Gui", "gui" };
 
+    template <>
+    inline const UserStats UserStatsValue<UserStatsType::Hud>::sValue{ " -Hud", "hud" };
+
     template <>
     inline const UserStats UserStatsValue<UserStatsType::Lua>::sValue{ "Lua", "lua" };
 
@@ -147,6 +153,7 @@ namespace OMW
         const unsigned int mFrameNumber;
         const osg::Timer& mTimer;
         osg::Stats& mStats;
+        const Debug::TraceZone mTraceZone{ UserStatsValue<type>::sValue.mLabel.c_str() };
     };
 }
 
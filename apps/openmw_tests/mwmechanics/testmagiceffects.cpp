@@ -0,0 +1,54 @@
+#include "apps/openmw/mwmechanics/magiceffects.hpp"
+
+#include <components/esm3/loadmgef.hpp>
+
+#include <gtest/gtest.h>
+
+namespace MWMechanics
+{
+    namespace
+    {
+        EffectParam makeParam(int base, float modifier)
+        {
+            EffectParam param;
+            param.setBase(base);
+            param.setModifier(modifier);
+            return param;
+        }
+
+        TEST(MWMechanicsMagicEffectsTest, addShouldBumpRevisionOnlyForNonZeroParams)
+        {
+            MagicEffects effects;
+            const std::size_t initial = effects.getRevision();
+            effects.add(EffectKey(ESM::MagicEffect::Shield), makeParam(0, 0.f));
+            EXPECT_EQ(effects.getRevision(), initial);
+            effects.add(EffectKey(ESM::MagicEffect::Shield), makeParam(0, 10.f));
+            EXPECT_GT(effects.getRevision(), initial);
+        }
+
+        TEST(MWMechanicsMagicEffectsTest, removeShouldBumpRevisionOnlyForPresentKeys)
+        {
+            MagicEffects effects;
+            effects.add(EffectKey(ESM::MagicEffect::Shield), makeParam(0, 10.f));
+            const std::size_t revision = effects.getRevision();
+            effects.remove(EffectKey(ESM::MagicEffect::Light));
+            EXPECT_EQ(effects.getRevision(), revision);
+            effects.remove(EffectKey(ESM::MagicEffect::Shield));
+            EXPECT_GT(effects.getRevision(), revision);
+        }
+
+        TEST(MWMechanicsMagicEffectsTest, setModifiersShouldBumpRevisionOnlyOnChange)
+        {
+            MagicEffects effects;
+            effects.add(EffectKey(ESM::MagicEffect::Shield), makeParam(0, 10.f));
+            MagicEffects modifiers;
+            modifiers.add(EffectKey(ESM::MagicEffect::Shield), makeParam(0, 10.f));
+            const std::size_t revision = effects.getRevision();
+            effects.setModifiers(modifiers);
+            EXPECT_EQ(effects.getRevision(), revision);
+            modifiers.add(EffectKey(ESM::MagicEffect::Shield), makeParam(0, 5.f));
+            effects.setModifiers(modifiers);
+            EXPECT_GT(effects.getRevision(), revision);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#include "apps/openmw/mwmechanics/pathgrid.hpp"
+
+#include <gtest/gtest.h>
+
+namespace MWMechanics
+{
+    namespace
+    {
+        void addEdge(ESM::Pathgrid& pathgrid, size_t v0, size_t v1)
+        {
+            pathgrid.mEdges.push_back({ v0, v1 });
+            pathgrid.mEdges.push_back({ v1, v0 });
+        }
+
+        // 0 - 1 - 2   4 (disconnected)
+        //     |
+        //     3
+        ESM::Pathgrid makePathgrid()
+        {
+            ESM::Pathgrid pathgrid;
+            pathgrid.mPoints.emplace_back(0, 0, 0);
+            pathgrid.mPoints.emplace_back(100, 0, 0);
+            pathgrid.mPoints.emplace_back(200, 0, 0);
+            pathgrid.mPoints.emplace_back(100, 100, 0);
+            pathgrid.mPoints.emplace_back(500, 500, 0);
+            addEdge(pathgrid, 0, 1);
+            addEdge(pathgrid, 1, 2);
+            addEdge(pathgrid, 1, 3);
+            return pathgrid;
+        }
+
+        TEST(MWMechanicsPathgridGraphTest, aStarSearchShouldFollowShortestRoute)
+        {
+            const ESM::Pathgrid pathgrid = makePathgrid();
+            const PathgridGraph graph(pathgrid);
+            const auto path = graph.aStarSearch(0, 2);
+            ASSERT_EQ(path.size(), 3);
+            EXPECT_EQ(path[0].mX, 0);
+            EXPECT_EQ(path[1].mX, 100);
+            EXPECT_EQ(path[1].mY, 0);
+            EXPECT_EQ(path[2].mX, 200);
+        }
+
+        TEST(MWMechanicsPathgridGraphTest, aStarSearchWithEqualStartAndGoalShouldReturnSinglePoint)
+        {
+            const ESM::Pathgrid pathgrid = makePathgrid();
+            const PathgridGraph graph(pathgrid);
+            const auto path = graph.aStarSearch(3, 3);
+            ASSERT_EQ(path.size(), 1);
+            EXPECT_EQ(path[0].mY, 100);
+        }
+
+        TEST(MWMechanicsPathgridGraphTest, aStarSearchToDisconnectedPointShouldReturnEmptyPath)
+        {
+            const ESM::Pathgrid pathgrid = makePathgrid();
+            const PathgridGraph graph(pathgrid);
+            EXPECT_FALSE(graph.isPointConnected(0, 4));
+            EXPECT_TRUE(graph.aStarSearch(0, 4).empty());
+        }
+    }
+}
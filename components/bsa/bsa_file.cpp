@@ -25,6 +25,7 @@
 
 #include <components/esm/fourcc.hpp>
 #include <components/files/constrainedfilestream.hpp>
+#include <components/files/memorymappedstream.hpp>
 
 #include <algorithm>
 #include <cassert>
@@ -193,6 +194,11 @@ void BSAFile::readHeader()
     std::sort(mFiles.begin(), mFiles.end(),
         [](const FileStruct& left, const FileStruct& right) { return left.offset < right.offset; });
 
+    // Map the archive so getFile() can serve entries as zero-copy views into the page cache
+    // instead of copying them through buffered reads. Entry offsets were validated against the
+    // archive size above, so every view lies within the mapping.
+    mMapping = Files::tryMapFile(mFilepath);
+
     mIsLoaded = true;
 }
 
@@ -260,11 +266,14 @@ void Bsa::BSAFile::close()
 
     mFiles.clear();
     mStringBuf.clear();
+    mMapping.reset();
     mIsLoaded = false;
 }
 
 Files::IStreamPtr Bsa::BSAFile::getFile(const FileStruct* file)
 {
+    if (mMapping != nullptr)
+        return Files::openMemoryMappedView(mMapping, file->offset, file->fileSize);
     return Files::openConstrainedFileStream(mFilepath, file->offset, file->fileSize);
 }
 
@@ -273,6 +282,9 @@ void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
     if (!mIsLoaded)
         fail("Unable to add file " + filename + " the archive is not opened");
 
+    // The archive is about to be rewritten; an existing mapping would go stale.
+    mMapping.reset();
+
     auto newStartOfDataBuffer = 12 + (12 + 8) * (mFiles.size() + 1) + mStringBuf.size() + filename.size() + 1;
     if (mFiles.empty())
         std::filesystem::resize_file(mFilepath, newStartOfDataBuffer);
@@ -26,12 +26,18 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <components/files/conversion.hpp>
 #include <components/files/istreamptr.hpp>
 
+namespace Files
+{
+    class MemoryMappedFile;
+}
+
 namespace Bsa
 {
 
@@ -90,6 +96,10 @@ namespace Bsa
         /// Filename string buffer
         std::vector<char> mStringBuf;
 
+        /// Read-only mapping of the whole archive, shared with the streams returned by getFile().
+        /// Null when the archive could not be mapped; getFile() then falls back to buffered streams.
+        std::shared_ptr<const Files::MemoryMappedFile> mMapping;
+
         /// True when an archive has been loaded
         bool mIsLoaded;
 
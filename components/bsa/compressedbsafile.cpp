@@ -268,6 +268,48 @@ namespace Bsa
     }
 
     Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
+    {
+        {
+            std::lock_guard lock(mCacheMutex);
+            ++mCacheStats.mGet;
+            const auto it = mCache.find(fileRecord.mOffset);
+            if (it != mCache.end())
+            {
+                ++mCacheStats.mHit;
+                mLru.splice(mLru.begin(), mLru, it->second.mLruIt);
+                return std::make_unique<Files::StreamWithBuffer<MemoryInputStreamView>>(
+                    std::make_unique<MemoryInputStreamView>(it->second.mData));
+            }
+        }
+
+        // Decompress outside the lock so concurrent misses on different entries do not serialize.
+        // Concurrent misses on the same entry may decompress it twice; the extra copy is dropped.
+        std::shared_ptr<const std::vector<char>> data = decompress(fileRecord);
+
+        {
+            std::lock_guard lock(mCacheMutex);
+            const auto [it, inserted] = mCache.emplace(fileRecord.mOffset, CacheEntry{ data, {} });
+            if (inserted)
+            {
+                mLru.push_front(fileRecord.mOffset);
+                it->second.mLruIt = mLru.begin();
+                mCacheBytes += data->size();
+                while (mCacheBytes > sCacheBudget && mCache.size() > 1)
+                {
+                    const auto evicted = mCache.find(mLru.back());
+                    mCacheBytes -= evicted->second.mData->size();
+                    mCache.erase(evicted);
+                    mLru.pop_back();
+                    ++mCacheStats.mExpired;
+                }
+            }
+        }
+
+        return std::make_unique<Files::StreamWithBuffer<MemoryInputStreamView>>(
+            std::make_unique<MemoryInputStreamView>(std::move(data)));
+    }
+
+    std::shared_ptr<const std::vector<char>> CompressedBSAFile::decompress(const FileRecord& fileRecord)
     {
         size_t size = fileRecord.mSize & (~FileSizeFlag_Compression);
         size_t resultSize = size;
@@ -286,7 +328,7 @@ namespace Bsa
             streamPtr->read(reinterpret_cast<char*>(&resultSize), sizeof(uint32_t));
             size -= sizeof(uint32_t);
         }
-        auto memoryStreamPtr = std::make_unique<MemoryInputStream>(resultSize);
+        auto result = std::make_shared<std::vector<char>>(resultSize);
 
         if (compressed)
         {
@@ -296,7 +338,7 @@ namespace Bsa
                 inputStreamBuf.push(boost::iostreams::zlib_decompressor());
                 inputStreamBuf.push(*streamPtr);
 
-                boost::iostreams::basic_array_sink<char> sr(memoryStreamPtr->getRawData(), resultSize);
+                boost::iostreams::basic_array_sink<char> sr(result->data(), resultSize);
                 boost::iostreams::copy(inputStreamBuf, sr);
             }
             else
@@ -306,8 +348,8 @@ namespace Bsa
                 LZ4F_decompressionContext_t context = nullptr;
                 LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
                 LZ4F_decompressOptions_t options = {};
-                LZ4F_errorCode_t errorCode = LZ4F_decompress(
-                    context, memoryStreamPtr->getRawData(), &resultSize, buffer.data(), &size, &options);
+                LZ4F_errorCode_t errorCode
+                    = LZ4F_decompress(context, result->data(), &resultSize, buffer.data(), &size, &options);
                 if (LZ4F_isError(errorCode))
                     fail("LZ4 decompression error (file " + Files::pathToUnicodeString(mFilepath)
                         + "): " + LZ4F_getErrorName(errorCode));
@@ -319,10 +361,19 @@ namespace Bsa
         }
         else
         {
-            streamPtr->read(memoryStreamPtr->getRawData(), size);
+            streamPtr->read(result->data(), size);
         }
 
-        return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
+        return result;
+    }
+
+    void CompressedBSAFile::getCacheStats(Resource::CacheStats& out) const
+    {
+        std::lock_guard lock(mCacheMutex);
+        out.mSize += mCache.size();
+        out.mGet += mCacheStats.mGet;
+        out.mHit += mCacheStats.mHit;
+        out.mExpired += mCacheStats.mExpired;
     }
 
     std::uint64_t CompressedBSAFile::generateHash(const std::filesystem::path& stem, std::string extension)
@@ -27,9 +27,13 @@
 #define BSA_COMPRESSED_BSA_FILE_H
 
 #include <limits>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include <components/bsa/bsa_file.hpp>
+#include <components/resource/cachestats.hpp>
 #include <filesystem>
 
 namespace Bsa
@@ -108,12 +112,33 @@ namespace Bsa
 
         std::map<std::uint64_t, FolderRecord> mFolders;
 
+        // Decompressed entries are cached so that assets shared between objects (e.g. common
+        // textures) are inflated once even when several loader threads request them. The cache
+        // is capped by a byte budget and evicts the least recently used entries. Streams
+        // returned by getFile() share the cached buffers, so hits do not copy.
+        static constexpr std::size_t sCacheBudget = 64 * 1024 * 1024;
+
+        struct CacheEntry
+        {
+            std::shared_ptr<const std::vector<char>> mData;
+            std::list<std::uint32_t>::iterator mLruIt;
+        };
+
+        mutable std::mutex mCacheMutex;
+        std::list<std::uint32_t> mLru; // entry offsets, most recently used first
+        std::map<std::uint32_t, CacheEntry> mCache; // keyed by entry offset
+        std::size_t mCacheBytes = 0;
+        Resource::CacheStats mCacheStats;
+
         FileRecord getFileRecord(const std::string& str) const;
 
         /// \brief Normalizes given filename or folder and generates format-compatible hash.
         static std::uint64_t generateHash(const std::filesystem::path& stem, std::string extension);
         Files::IStreamPtr getFile(const FileRecord& fileRecord);
 
+        /// Read and decompress the given entry, bypassing the cache.
+        std::shared_ptr<const std::vector<char>> decompress(const FileRecord& fileRecord);
+
     public:
         using BSAFile::getFilename;
         using BSAFile::getList;
@@ -128,6 +153,10 @@ namespace Bsa
         Files::IStreamPtr getFile(const char* filePath);
         Files::IStreamPtr getFile(const FileStruct* fileStruct);
         void addFile(const std::string& filename, std::istream& file);
+
+        /// Add this archive's decompression cache statistics to the given counters.
+        /// @note Thread safe.
+        void getCacheStats(Resource::CacheStats& out) const;
     };
 }
 
@@ -28,6 +28,7 @@
 
 #include <components/files/memorystream.hpp>
 #include <istream>
+#include <memory>
 #include <vector>
 
 namespace Bsa
@@ -53,5 +54,24 @@ namespace Bsa
         char* getRawData() { return this->data(); }
     };
 
+    /**
+        Read-only stream buffer over a shared memory buffer.
+
+        Keeps the buffer alive, so several streams can serve the same decompressed
+        data without copying it.
+     */
+    class MemoryInputStreamView : public Files::MemBuf
+    {
+    public:
+        explicit MemoryInputStreamView(std::shared_ptr<const std::vector<char>> data)
+            : Files::MemBuf(data->data(), data->size())
+            , mData(std::move(data))
+        {
+        }
+
+    private:
+        std::shared_ptr<const std::vector<char>> mData;
+    };
+
 }
 #endif
@@ -326,6 +326,7 @@ namespace Compiler
             extensions.registerInstruction("help", "", opcodeHelp);
             extensions.registerInstruction("reloadlua", "", opcodeReloadLua);
             extensions.registerInstruction("testmodels", "", opcodeTestModels);
+            extensions.registerInstruction("toggletracecapture", "", opcodeToggleTraceCapture);
             extensions.registerInstruction("t3d", "", opcodeTestModels);
         }
     }
@@ -2,16 +2,22 @@
 #include "esmfile.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <fstream>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include <QDataStream>
 #include <QDebug>
 #include <QDir>
 #include <QFont>
 #include <QIODevice>
+#include <QSaveFile>
+#include <QStandardPaths>
 
 #include <components/esm/format.hpp>
 #include <components/esm3/esmreader.hpp>
@@ -19,6 +25,20 @@
 #include <components/files/openfile.hpp>
 #include <components/files/qtconversion.hpp>
 
+namespace
+{
+    constexpr quint32 metadataCacheMagic = 0x4f4d574d; // "OMWM"
+    constexpr quint32 metadataCacheVersion = 1;
+
+    QString metadataCachePath()
+    {
+        const QString dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+        if (dir.isEmpty())
+            return {};
+        return dir + QLatin1String("/contentmodel-metadata.cache");
+    }
+}
+
 ContentSelectorModel::ContentModel::ContentModel(QObject* parent, QIcon& warningIcon, bool showOMWScripts)
     : QAbstractTableModel(parent)
     , mWarningIcon(warningIcon)
@@ -447,6 +467,25 @@ void ContentSelectorModel::ContentModel::addFiles(const QString& path, bool newf
     dir.setNameFilters(filters);
     dir.setSorting(QDir::Name);
 
+    if (!mMetadataCacheLoaded)
+        loadMetadataCache();
+
+    struct ScanJob
+    {
+        EsmFile* mFile = nullptr;
+        std::unique_ptr<EsmFile> mNewFile; // owns mFile while it is not in the model yet
+        QString mFilePath;
+        QString mFileName;
+        qint64 mSize = 0;
+        qint64 mModified = 0;
+        FileMetadata mMetadata;
+        QString mError;
+        bool mNeedsScan = false;
+        bool mApplyMetadata = false;
+        bool mSuccess = true;
+    };
+    std::vector<ScanJob> jobs;
+
     for (const QString& path2 : dir.entryList())
     {
         QFileInfo info(dir.absoluteFilePath(path2));
@@ -471,76 +510,233 @@ void ContentSelectorModel::ContentModel::addFiles(const QString& path, bool newf
 
         file->setFromAnotherConfigFile(mNonUserContent.contains(info.fileName().toLower()));
 
-        if (info.fileName().endsWith(".omwscripts", Qt::CaseInsensitive))
+        file->setDate(info.lastModified());
+        file->setFilePath(info.absoluteFilePath());
+
+        ScanJob job;
+        job.mFile = file;
+        job.mNewFile = std::move(newFile);
+        job.mFilePath = info.absoluteFilePath();
+        job.mFileName = info.fileName();
+
+        if (!info.fileName().endsWith(".omwscripts", Qt::CaseInsensitive))
+        {
+            job.mApplyMetadata = true;
+            if (const CachedMetadata* cached = findCachedMetadata(info))
+                job.mMetadata = cached->mMetadata;
+            else
+            {
+                job.mNeedsScan = true;
+                job.mSize = info.size();
+                job.mModified = info.lastModified().toMSecsSinceEpoch();
+            }
+        }
+
+        jobs.push_back(std::move(job));
+    }
+
+    // The file headers are independent of each other; read the ones the cache can not serve in
+    // parallel, then apply the results in directory order on this thread.
+    const std::size_t scanCount
+        = static_cast<std::size_t>(std::count_if(jobs.begin(), jobs.end(), [](const ScanJob& v) {
+              return v.mNeedsScan;
+          }));
+    if (scanCount > 0)
+    {
+        std::atomic_size_t nextJob{ 0 };
+        const auto worker = [&] {
+            for (std::size_t i = nextJob.fetch_add(1); i < jobs.size(); i = nextJob.fetch_add(1))
+            {
+                ScanJob& job = jobs[i];
+                if (job.mNeedsScan)
+                    job.mSuccess = readFileMetadata(job.mFilePath, job.mMetadata, job.mError);
+            }
+        };
+        const std::size_t threadCount
+            = std::min(scanCount, std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+        if (threadCount == 1)
+            worker();
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount);
+            for (std::size_t i = 0; i < threadCount; ++i)
+                threads.emplace_back(worker);
+            for (std::thread& thread : threads)
+                thread.join();
+        }
+    }
+
+    for (ScanJob& job : jobs)
+    {
+        if (!job.mSuccess)
         {
-            file->setDate(info.lastModified());
-            file->setFilePath(info.absoluteFilePath());
-            if (add)
-                addFile(newFile.release());
-            setNew(file->fileName(), newfiles);
+            qWarning() << "Error reading addon file " << job.mFileName << ": " << job.mError;
             continue;
         }
 
-        try
+        if (job.mApplyMetadata)
         {
-            file->setDate(info.lastModified());
-            file->setFilePath(info.absoluteFilePath());
-            std::filesystem::path filepath = Files::pathFromQString(info.absoluteFilePath());
+            job.mFile->setAuthor(job.mMetadata.mAuthor);
+            job.mFile->setFormat(job.mMetadata.mFormat);
+            job.mFile->setDescription(job.mMetadata.mDescription);
+            job.mFile->setGameFiles(job.mMetadata.mGameFiles);
 
-            auto stream = Files::openBinaryInputFileStream(filepath);
-            if (!stream->is_open())
+            if (job.mNeedsScan)
             {
-                qWarning() << "Failed to open addon file " << info.fileName() << ": "
-                           << std::generic_category().message(errno).c_str();
-                continue;
+                mMetadataCache.insert(job.mFilePath, { job.mSize, job.mModified, mEncoding, job.mMetadata });
+                mMetadataCacheDirty = true;
             }
-            const ESM::Format format = ESM::readFormat(*stream);
-            stream->seekg(0);
-            switch (format)
+        }
+
+        // Put the file in the table
+        if (job.mNewFile != nullptr)
+            addFile(job.mNewFile.release());
+        setNew(job.mFile->fileName(), newfiles);
+    }
+
+    saveMetadataCache();
+}
+
+bool ContentSelectorModel::ContentModel::readFileMetadata(
+    const QString& filePath, FileMetadata& metadata, QString& error) const
+{
+    try
+    {
+        std::filesystem::path esmPath = Files::pathFromQString(filePath);
+
+        auto stream = Files::openBinaryInputFileStream(esmPath);
+        if (!stream->is_open())
+        {
+            error = QString::fromStdString(std::generic_category().message(errno));
+            return false;
+        }
+        const ESM::Format format = ESM::readFormat(*stream);
+        stream->seekg(0);
+        switch (format)
+        {
+            case ESM::Format::Tes3:
             {
-                case ESM::Format::Tes3:
-                {
-                    ToUTF8::Utf8Encoder encoder(ToUTF8::calculateEncoding(mEncoding.toStdString()));
-                    ESM::ESMReader fileReader;
-                    fileReader.setEncoder(&encoder);
-                    fileReader.open(std::move(stream), filepath);
-                    file->setAuthor(QString::fromUtf8(fileReader.getAuthor().c_str()));
-                    file->setFormat(QString::number(fileReader.esmVersionF()));
-                    file->setDescription(QString::fromUtf8(fileReader.getDesc().c_str()));
-                    for (const auto& master : fileReader.getGameFiles())
-                        file->addGameFile(QString::fromUtf8(master.name.c_str()));
-                    break;
-                }
-                case ESM::Format::Tes4:
-                {
-                    ToUTF8::StatelessUtf8Encoder encoder(ToUTF8::calculateEncoding(mEncoding.toStdString()));
-                    ESM4::Reader fileReader(std::move(stream), filepath, nullptr, &encoder, true);
-                    file->setAuthor(QString::fromUtf8(fileReader.getAuthor().c_str()));
-                    file->setFormat(QString::number(fileReader.esmVersionF()));
-                    file->setDescription(QString::fromUtf8(fileReader.getDesc().c_str()));
-                    for (const auto& master : fileReader.getGameFiles())
-                        file->addGameFile(QString::fromUtf8(master.name.c_str()));
-                    break;
-                }
-                default:
-                {
-                    qWarning() << "Error reading addon file " << info.fileName() << ": unsupported ESM format "
-                               << ESM::NAME(format).toString().c_str();
-                    continue;
-                }
+                ToUTF8::Utf8Encoder encoder(ToUTF8::calculateEncoding(mEncoding.toStdString()));
+                ESM::ESMReader fileReader;
+                fileReader.setEncoder(&encoder);
+                fileReader.open(std::move(stream), esmPath);
+                metadata.mAuthor = QString::fromUtf8(fileReader.getAuthor().c_str());
+                metadata.mFormat = QString::number(fileReader.esmVersionF());
+                metadata.mDescription = QString::fromUtf8(fileReader.getDesc().c_str());
+                for (const auto& master : fileReader.getGameFiles())
+                    metadata.mGameFiles.append(QString::fromUtf8(master.name.c_str()));
+                return true;
+            }
+            case ESM::Format::Tes4:
+            {
+                ToUTF8::StatelessUtf8Encoder encoder(ToUTF8::calculateEncoding(mEncoding.toStdString()));
+                ESM4::Reader fileReader(std::move(stream), esmPath, nullptr, &encoder, true);
+                metadata.mAuthor = QString::fromUtf8(fileReader.getAuthor().c_str());
+                metadata.mFormat = QString::number(fileReader.esmVersionF());
+                metadata.mDescription = QString::fromUtf8(fileReader.getDesc().c_str());
+                for (const auto& master : fileReader.getGameFiles())
+                    metadata.mGameFiles.append(QString::fromUtf8(master.name.c_str()));
+                return true;
+            }
+            default:
+            {
+                error = QLatin1String("unsupported ESM format ") + QString::fromStdString(ESM::NAME(format).toString());
+                return false;
             }
-
-            // Put the file in the table
-            if (add)
-                addFile(newFile.release());
-            setNew(file->fileName(), newfiles);
         }
-        catch (std::runtime_error& e)
+    }
+    catch (std::runtime_error& e)
+    {
+        // An error occurred while reading the .esp
+        error = QString::fromUtf8(e.what());
+        return false;
+    }
+}
+
+const ContentSelectorModel::ContentModel::CachedMetadata* ContentSelectorModel::ContentModel::findCachedMetadata(
+    const QFileInfo& info) const
+{
+    const auto it = mMetadataCache.constFind(info.absoluteFilePath());
+    if (it == mMetadataCache.constEnd())
+        return nullptr;
+    if (it->mSize != info.size() || it->mModified != info.lastModified().toMSecsSinceEpoch()
+        || it->mEncoding != mEncoding)
+        return nullptr;
+    return &it.value();
+}
+
+void ContentSelectorModel::ContentModel::loadMetadataCache()
+{
+    mMetadataCacheLoaded = true;
+
+    const QString path = metadataCachePath();
+    if (path.isEmpty())
+        return;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_15);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != metadataCacheMagic || version != metadataCacheVersion)
+        return;
+
+    qint32 count = 0;
+    stream >> count;
+    for (qint32 i = 0; i < count; ++i)
+    {
+        QString filePath;
+        CachedMetadata cached;
+        stream >> filePath >> cached.mSize >> cached.mModified >> cached.mEncoding >> cached.mMetadata.mAuthor
+            >> cached.mMetadata.mFormat >> cached.mMetadata.mDescription >> cached.mMetadata.mGameFiles;
+        if (stream.status() != QDataStream::Ok)
         {
-            // An error occurred while reading the .esp
-            qWarning() << "Error reading addon file: " << e.what();
+            mMetadataCache.clear();
+            return;
         }
+        mMetadataCache.insert(filePath, std::move(cached));
+    }
+}
+
+void ContentSelectorModel::ContentModel::saveMetadataCache()
+{
+    if (!mMetadataCacheDirty)
+        return;
+
+    const QString path = metadataCachePath();
+    if (path.isEmpty())
+        return;
+
+    // Drop entries for files that no longer exist so the cache does not grow without bound.
+    for (auto it = mMetadataCache.begin(); it != mMetadataCache.end();)
+    {
+        if (!QFile::exists(it.key()))
+            it = mMetadataCache.erase(it);
+        else
+            ++it;
     }
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << metadataCacheMagic << metadataCacheVersion;
+    stream << static_cast<qint32>(mMetadataCache.size());
+    for (auto it = mMetadataCache.constBegin(); it != mMetadataCache.constEnd(); ++it)
+        stream << it.key() << it->mSize << it->mModified << it->mEncoding << it->mMetadata.mAuthor
+            << it->mMetadata.mFormat << it->mMetadata.mDescription << it->mMetadata.mGameFiles;
+
+    if (file.commit())
+        mMetadataCacheDirty = false;
 }
 
 bool ContentSelectorModel::ContentModel::containsDataFiles(const QString& path)
@@ -3,6 +3,8 @@
 
 #include "loadordererror.hpp"
 #include <QAbstractTableModel>
+#include <QFileInfo>
+#include <QHash>
 #include <QIcon>
 #include <QSet>
 #include <QStringList>
@@ -73,8 +75,37 @@ namespace ContentSelectorModel
         void checkForLoadOrderErrors();
 
     private:
+        /// Header metadata of a single content file.
+        struct FileMetadata
+        {
+            QString mAuthor;
+            QString mFormat;
+            QString mDescription;
+            QStringList mGameFiles;
+        };
+
+        /// Cached header metadata, valid while the file's size and timestamp are unchanged.
+        struct CachedMetadata
+        {
+            qint64 mSize = 0;
+            qint64 mModified = 0;
+            QString mEncoding;
+            FileMetadata mMetadata;
+        };
+
         void addFile(EsmFile* file);
 
+        /// Read the header metadata of a content file. Safe to call from multiple threads at
+        /// once. \return false and set \a error if the file can not be read.
+        bool readFileMetadata(const QString& filePath, FileMetadata& metadata, QString& error) const;
+
+        /// \return the cached metadata for the given file, or nullptr if the cache entry is
+        /// missing or stale.
+        const CachedMetadata* findCachedMetadata(const QFileInfo& info) const;
+
+        void loadMetadataCache();
+        void saveMetadataCache();
+
         /// Checks a specific plug-in for load order errors
         /// \return all errors found for specific plug-in
         QList<LoadOrderError> checkForLoadOrderErrors(const EsmFile* file, int row) const;
@@ -93,6 +124,9 @@ namespace ContentSelectorModel
         QString mEncoding;
         QIcon mWarningIcon;
         bool mShowOMWScripts;
+        QHash<QString, CachedMetadata> mMetadataCache;
+        bool mMetadataCacheLoaded = false;
+        bool mMetadataCacheDirty = false;
 
         QString mErrorToolTips[ContentSelectorModel::LoadOrderError::ErrorCode_LoadOrder]
             = { tr("Unable to find dependent file: %1"), tr("Dependent file needs to be active: %1"),
@@ -1,6 +1,7 @@
 #include "debugdraw.hpp"
 #include <components/sceneutil/nodecallback.hpp>
 #include <components/shader/shadermanager.hpp>
+#include <components/stereo/stereomanager.hpp>
 
 #include <osg/Array>
 #include <osg/Drawable>
@@ -316,7 +317,11 @@ Debug::DebugDrawer::DebugDrawer(const DebugDrawer& copy, const osg::CopyOp& copy
 
 Debug::DebugDrawer::DebugDrawer(Shader::ShaderManager& shaderManager)
 {
-    auto program = shaderManager.getProgram("debug");
+    // The debug primitives are drawn as part of the scene pass, so the program has to
+    // declare the right number of views when single-pass stereo rendering is active.
+    Shader::ShaderManager::DefineMap defines;
+    Stereo::shaderStereoDefines(defines);
+    auto program = shaderManager.getProgram("debug", defines);
 
     setCullingActive(false);
     osg::StateSet* stateset = getOrCreateStateSet();
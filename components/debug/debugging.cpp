@@ -1,10 +1,14 @@
 #include "debugging.hpp"
 
 #include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #ifdef _MSC_VER
 // TODO: why is this necessary? this has /external:I
@@ -106,6 +110,12 @@ namespace Debug
         logListener = std::move(listener);
     }
 
+    class DebugOutputBase;
+
+    // Hands a finished message over to the asynchronous writer thread. Returns false when the
+    // writer is not running, in which case the caller processes the message synchronously.
+    static bool asyncEnqueue(DebugOutputBase& sink, std::string message, std::chrono::system_clock::time_point time);
+
     class DebugOutputBase : public boost::iostreams::sink
     {
     public:
@@ -113,7 +123,18 @@ namespace Debug
         {
             if (size <= 0)
                 return size;
-            std::string_view msg{ str, static_cast<size_t>(size) };
+            const auto now = std::chrono::system_clock::now();
+            if (!asyncEnqueue(*this, std::string(str, static_cast<size_t>(size)), now))
+                processMessage(std::string_view(str, static_cast<size_t>(size)), now);
+            return size;
+        }
+
+        // Formats and writes a message. Runs on the writer thread once it has been started, with
+        // the timestamp captured when the message was logged.
+        void processMessage(std::string_view msg, std::chrono::system_clock::time_point time)
+        {
+            if (msg.empty())
+                return;
 
             // Skip debug level marker
             Level level = All;
@@ -127,17 +148,16 @@ namespace Debug
             std::size_t prefixSize;
             {
                 prefix[0] = '[';
-                const auto now = std::chrono::system_clock::now();
-                const auto time = std::chrono::system_clock::to_time_t(now);
+                const auto timeT = std::chrono::system_clock::to_time_t(time);
                 tm time_info{};
 #ifdef _WIN32
-                (void)localtime_s(&time_info, &time);
+                (void)localtime_s(&time_info, &timeT);
 #else
-                (void)localtime_r(&time, &time_info);
+                (void)localtime_r(&timeT, &time_info);
 #endif
                 prefixSize = std::strftime(prefix + 1, sizeof(prefix) - 1, "%T", &time_info) + 1;
                 char levelLetter = " EWIVD*"[int(level)];
-                const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+                const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
                 prefixSize += snprintf(prefix + prefixSize, sizeof(prefix) - prefixSize, ".%03u %c] ",
                     static_cast<unsigned>(ms % 1000), levelLetter);
             }
@@ -149,14 +169,11 @@ namespace Debug
                 size_t lineSize = 1;
                 while (lineSize < msg.size() && msg[lineSize - 1] != '\n')
                     lineSize++;
-                writeImpl(prefix, prefixSize, level);
-                writeImpl(msg.data(), lineSize, level);
+                writeLine(time, level, std::string_view(prefix, prefixSize), msg.substr(0, lineSize));
                 if (logListener)
-                    logListener(level, std::string_view(prefix, prefixSize), std::string_view(msg.data(), lineSize));
+                    logListener(level, std::string_view(prefix, prefixSize), msg.substr(0, lineSize));
                 msg = msg.substr(lineSize);
             }
-
-            return size;
         }
 
         virtual ~DebugOutputBase() = default;
@@ -169,23 +186,112 @@ namespace Debug
             return All;
         }
 
-        virtual std::streamsize writeImpl(const char* str, std::streamsize size, Level debugLevel)
+        virtual void writeLine(std::chrono::system_clock::time_point time, Level debugLevel, std::string_view prefix,
+            std::string_view line)
         {
-            return size;
         }
     };
 
+    // Drains logged messages on a dedicated thread so logging threads never wait on the log file
+    // or the terminal. Messages only contend on a short queue append; formatting and I/O happen
+    // on the writer thread. Until start() the queue is bypassed and sinks write synchronously.
+    class AsyncLogWriter
+    {
+    public:
+        bool enqueue(DebugOutputBase& sink, std::string message, std::chrono::system_clock::time_point time)
+        {
+            {
+                std::lock_guard lock(mMutex);
+                if (!mRunning)
+                    return false;
+                mQueue.push_back({ &sink, std::move(message), time });
+            }
+            mHasWork.notify_one();
+            return true;
+        }
+
+        void start()
+        {
+            std::lock_guard lock(mMutex);
+            if (mRunning)
+                return;
+            mRunning = true;
+            mThread = std::thread([this] { run(); });
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard lock(mMutex);
+                if (!mRunning)
+                    return;
+                mRunning = false;
+            }
+            mHasWork.notify_one();
+            if (mThread.joinable())
+                mThread.join();
+        }
+
+    private:
+        struct QueuedMessage
+        {
+            DebugOutputBase* mSink;
+            std::string mText;
+            std::chrono::system_clock::time_point mTime;
+        };
+
+        void run()
+        {
+            std::unique_lock lock(mMutex);
+            while (true)
+            {
+                mHasWork.wait(lock, [this] { return !mQueue.empty() || !mRunning; });
+                if (mQueue.empty())
+                {
+                    if (!mRunning)
+                        return;
+                    continue;
+                }
+                std::deque<QueuedMessage> batch;
+                batch.swap(mQueue);
+                lock.unlock();
+                for (const QueuedMessage& message : batch)
+                    message.mSink->processMessage(message.mText, message.mTime);
+                lock.lock();
+            }
+        }
+
+        std::mutex mMutex;
+        std::condition_variable mHasWork;
+        std::deque<QueuedMessage> mQueue;
+        std::thread mThread;
+        bool mRunning = false;
+    };
+
+    static AsyncLogWriter& getAsyncLogWriter()
+    {
+        static AsyncLogWriter writer;
+        return writer;
+    }
+
+    static bool asyncEnqueue(DebugOutputBase& sink, std::string message, std::chrono::system_clock::time_point time)
+    {
+        return getAsyncLogWriter().enqueue(sink, std::move(message), time);
+    }
+
 #if defined _WIN32 && defined _DEBUG
     class DebugOutput : public DebugOutputBase
     {
     public:
-        std::streamsize writeImpl(const char* str, std::streamsize size, Level debugLevel)
+        void writeLine(std::chrono::system_clock::time_point time, Level debugLevel, std::string_view prefix,
+            std::string_view line) override
         {
             // Make a copy for null termination
-            std::string tmp(str, static_cast<unsigned int>(size));
+            std::string tmp;
+            tmp.reserve(prefix.size() + line.size());
+            tmp.append(prefix).append(line);
             // Write string to Visual Studio Debug output
             OutputDebugString(tmp.c_str());
-            return size;
         }
 
         virtual ~DebugOutput() = default;
@@ -196,8 +302,10 @@ namespace Debug
     {
         struct Record
         {
-            std::string mValue;
+            std::chrono::system_clock::time_point mTime;
             Level mLevel;
+            std::string mPrefix;
+            std::string mLine;
         };
 
         std::deque<Record> globalBuffer;
@@ -239,22 +347,104 @@ namespace Debug
 #endif
         }
 
-        class Identity
+        std::string_view getLevelName(Level level)
+        {
+            switch (level)
+            {
+                case Error:
+                    return "error";
+                case Warning:
+                    return "warning";
+                case Info:
+                    return "info";
+                case Verbose:
+                    return "verbose";
+                case Debug:
+                    return "debug";
+                case All:
+                    return "all";
+            }
+            return "all";
+        }
+
+        void writeJsonString(std::ostream& stream, std::string_view value)
+        {
+            stream << '"';
+            for (const char c : value)
+            {
+                switch (c)
+                {
+                    case '"':
+                        stream << "\\\"";
+                        break;
+                    case '\\':
+                        stream << "\\\\";
+                        break;
+                    case '\n':
+                        stream << "\\n";
+                        break;
+                    case '\r':
+                        stream << "\\r";
+                        break;
+                    case '\t':
+                        stream << "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                                   << std::dec << std::setfill(' ');
+                        else
+                            stream << c;
+                        break;
+                }
+            }
+            stream << '"';
+        }
+
+        class File
         {
         public:
-            explicit Identity(std::ostream& stream)
+            explicit File(std::ostream& stream, bool json)
                 : mStream(stream)
+                , mJson(json)
             {
             }
 
-            void write(const char* str, std::streamsize size, Level /*level*/)
+            void write(std::chrono::system_clock::time_point time, Level level, std::string_view prefix,
+                std::string_view line)
             {
-                mStream.write(str, size);
+                if (mJson)
+                {
+                    const auto timeT = std::chrono::system_clock::to_time_t(time);
+                    tm time_info{};
+#ifdef _WIN32
+                    (void)localtime_s(&time_info, &timeT);
+#else
+                    (void)localtime_r(&timeT, &time_info);
+#endif
+                    char timestamp[32];
+                    std::strftime(timestamp, sizeof(timestamp), "%FT%T", &time_info);
+                    const auto ms
+                        = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+                    mStream << "{\"time\":\"" << timestamp << '.' << std::setw(3) << std::setfill('0') << (ms % 1000)
+                            << std::setfill(' ') << "\",\"level\":\"" << getLevelName(level) << "\",\"message\":";
+                    std::string_view message = line;
+                    if (!message.empty() && message.back() == '\n')
+                        message.remove_suffix(1);
+                    writeJsonString(mStream, message);
+                    mStream << "}\n";
+                }
+                else
+                {
+                    mStream.write(prefix.data(), prefix.size());
+                    mStream.write(line.data(), line.size());
+                }
                 mStream.flush();
             }
 
         private:
             std::ostream& mStream;
+            bool mJson;
         };
 
         class Coloured
@@ -267,11 +457,13 @@ namespace Debug
             {
             }
 
-            void write(const char* str, std::streamsize size, Level level)
+            void write(std::chrono::system_clock::time_point /*time*/, Level level, std::string_view prefix,
+                std::string_view line)
             {
                 if (mUseColor)
                     mStream << "\033[0;" << getColor(level) << 'm';
-                mStream.write(str, size);
+                mStream.write(prefix.data(), prefix.size());
+                mStream.write(line.data(), line.size());
                 if (mUseColor)
                     mStream << "\033[0;" << Reset << 'm';
                 mStream.flush();
@@ -291,11 +483,12 @@ namespace Debug
             {
             }
 
-            void write(const char* str, std::streamsize size, Level debugLevel)
+            void write(
+                std::chrono::system_clock::time_point time, Level level, std::string_view prefix, std::string_view line)
             {
                 while (mBuffer.size() >= mCapacity)
                     mBuffer.pop_front();
-                mBuffer.push_back(Record{ std::string(str, size), debugLevel });
+                mBuffer.push_back(Record{ time, level, std::string(prefix), std::string(line) });
             }
 
         private:
@@ -313,11 +506,11 @@ namespace Debug
             {
             }
 
-            std::streamsize writeImpl(const char* str, std::streamsize size, Level debugLevel) override
+            void writeLine(std::chrono::system_clock::time_point time, Level debugLevel, std::string_view prefix,
+                std::string_view line) override
             {
-                mFirst.write(str, size, debugLevel);
-                mSecond.write(str, size, debugLevel);
-                return size;
+                mFirst.write(time, debugLevel, prefix, line);
+                mSecond.write(time, debugLevel, prefix, line);
             }
 
         private:
@@ -335,8 +528,8 @@ namespace Debug
 #if defined(_WIN32) && defined(_DEBUG)
     static boost::iostreams::stream_buffer<DebugOutput> sb;
 #else
-    static boost::iostreams::stream_buffer<Tee<Identity, Coloured>> standardOut;
-    static boost::iostreams::stream_buffer<Tee<Identity, Coloured>> standardErr;
+    static boost::iostreams::stream_buffer<Tee<File, Coloured>> standardOut;
+    static boost::iostreams::stream_buffer<Tee<File, Coloured>> standardErr;
     static boost::iostreams::stream_buffer<Tee<Buffer, Coloured>> bufferedOut;
     static boost::iostreams::stream_buffer<Tee<Buffer, Coloured>> bufferedErr;
 #endif
@@ -376,8 +569,19 @@ namespace Debug
         return Verbose;
     }
 
+    namespace
+    {
+        std::filesystem::path sLogDir;
+    }
+
+    const std::filesystem::path& getLogDir()
+    {
+        return sLogDir;
+    }
+
     void setupLogging(const std::filesystem::path& logDir, std::string_view appName)
     {
+        sLogDir = logDir;
         Log::sMinDebugLevel = getDebugLevel();
         Log::sWriteLevel = true;
 
@@ -385,10 +589,15 @@ namespace Debug
         const std::string logName = Misc::StringUtils::lowerCase(appName) + ".log";
         logfile.open(logDir / logName, std::ios::out);
 
-        Identity log(logfile);
+        // OPENMW_LOG_FORMAT=jsonl switches the log file to structured JSON-lines output; the
+        // terminal keeps the human-readable format either way.
+        const char* logFormat = getenv("OPENMW_LOG_FORMAT");
+        const bool json = logFormat != nullptr && std::string_view(logFormat) == "jsonl";
+
+        File log(logfile, json);
 
         for (const Record& v : globalBuffer)
-            log.write(v.mValue.data(), v.mValue.size(), v.mLevel);
+            log.write(v.mTime, v.mLevel, v.mPrefix, v.mLine);
 
         globalBuffer.clear();
 
@@ -397,6 +606,10 @@ namespace Debug
 
         std::cout.rdbuf(&standardOut);
         std::cerr.rdbuf(&standardErr);
+
+        // From now on logging threads only append to a queue; the writer thread does the
+        // formatting, file and terminal writes.
+        getAsyncLogWriter().start();
 #endif
 
 #ifdef _WIN32
@@ -471,6 +684,9 @@ namespace Debug
             ret = 1;
         }
 
+        // Drain pending messages and stop the writer thread while the sinks still exist
+        getAsyncLogWriter().stop();
+
         // Restore cout and cerr
         std::cout.rdbuf(rawStdout->rdbuf());
         std::cerr.rdbuf(rawStderr->rdbuf());
@@ -39,6 +39,10 @@ namespace Debug
     // Redirect cout and cerr to the log file
     void setupLogging(const std::filesystem::path& logDir, std::string_view appName);
 
+    // The directory passed to setupLogging, or an empty path before it runs. Debug dumps
+    // (e.g. trace captures) are placed next to the log.
+    const std::filesystem::path& getLogDir();
+
     int wrapApplication(
         int (*innerApplication)(int argc, char* argv[]), int argc, char* argv[], std::string_view appName);
 }
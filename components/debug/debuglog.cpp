@@ -1,29 +1,39 @@
 #include "debuglog.hpp"
 
 #include <mutex>
+#include <sstream>
 
 #include <components/files/conversion.hpp>
 #include <components/misc/strings/conversion.hpp>
 
 static std::mutex sLock;
 
+namespace
+{
+    std::ostringstream& getThreadBuffer()
+    {
+        thread_local std::ostringstream buffer;
+        return buffer;
+    }
+}
+
 Debug::Level Log::sMinDebugLevel = Debug::All;
 bool Log::sWriteLevel = false;
 
 Log::Log(Debug::Level level)
     : mShouldLog(level <= sMinDebugLevel)
 {
-    // No need to hold the lock if there will be no logging anyway
     if (!mShouldLog)
         return;
 
-    // Locks a global lock while the object is alive
-    sLock.lock();
+    // Compose the message in a per-thread buffer so concurrent statements only contend on the
+    // global lock for the final hand-off to the sink, not while formatting.
+    mBuffer = &getThreadBuffer();
 
     if (!sWriteLevel)
         return;
 
-    std::cout << static_cast<unsigned char>(level);
+    *mBuffer << static_cast<unsigned char>(level);
 }
 
 Log::~Log()
@@ -31,14 +41,21 @@ Log::~Log()
     if (!mShouldLog)
         return;
 
-    std::cout << std::endl;
-    sLock.unlock();
+    std::ostringstream& buffer = getThreadBuffer();
+    buffer << '\n';
+    const std::string message = std::move(buffer).str();
+    buffer.str(std::string());
+    buffer.clear();
+
+    std::lock_guard lock(sLock);
+    std::cout.write(message.data(), static_cast<std::streamsize>(message.size()));
+    std::cout.flush();
 }
 
 Log& Log::operator<<(const std::filesystem::path& rhs)
 {
     if (mShouldLog)
-        std::cout << Files::pathToUnicodeString(rhs);
+        *mBuffer << Files::pathToUnicodeString(rhs);
 
     return *this;
 }
@@ -46,7 +63,7 @@ Log& Log::operator<<(const std::filesystem::path& rhs)
 Log& Log::operator<<(const std::u8string& rhs)
 {
     if (mShouldLog)
-        std::cout << Misc::StringUtils::u8StringToString(rhs);
+        *mBuffer << Misc::StringUtils::u8StringToString(rhs);
 
     return *this;
 }
@@ -54,7 +71,7 @@ Log& Log::operator<<(const std::u8string& rhs)
 Log& Log::operator<<(const std::u8string_view rhs)
 {
     if (mShouldLog)
-        std::cout << Misc::StringUtils::u8StringToString(rhs);
+        *mBuffer << Misc::StringUtils::u8StringToString(rhs);
 
     return *this;
 }
@@ -62,7 +79,7 @@ Log& Log::operator<<(const std::u8string_view rhs)
 Log& Log::operator<<(const char8_t* rhs)
 {
     if (mShouldLog)
-        std::cout << Misc::StringUtils::u8StringToString(rhs);
+        *mBuffer << Misc::StringUtils::u8StringToString(rhs);
 
     return *this;
 }
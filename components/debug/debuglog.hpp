@@ -30,7 +30,7 @@ public:
     Log& operator<<(const T& rhs)
     {
         if (mShouldLog)
-            std::cout << rhs;
+            *mBuffer << rhs;
 
         return *this;
     }
@@ -45,6 +45,9 @@ public:
 
 private:
     const bool mShouldLog;
+    // Per-thread buffer the whole statement is composed into; the finished message is handed
+    // to the sink in the destructor. Null when the statement is filtered out.
+    std::ostream* mBuffer = nullptr;
 };
 
 #endif
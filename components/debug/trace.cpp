@@ -0,0 +1,101 @@
+#include "trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include "debuglog.hpp"
+
+namespace Debug
+{
+    namespace
+    {
+        std::uint32_t currentThreadId()
+        {
+            static thread_local const std::uint32_t id
+                = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            return id;
+        }
+
+        void writeJsonString(const char* value, std::ostream& out)
+        {
+            out << '"';
+            for (; *value != '\0'; ++value)
+            {
+                const char c = *value;
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) >= 0x20)
+                    out << c;
+            }
+            out << '"';
+        }
+    }
+
+    TraceRecorder& TraceRecorder::instance()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    void TraceRecorder::start()
+    {
+        if (mEvents == nullptr)
+            mEvents = std::make_unique<Event[]>(sCapacity);
+        mNext.store(0, std::memory_order_relaxed);
+        mEnabled.store(true, std::memory_order_release);
+    }
+
+    bool TraceRecorder::stopAndWrite(const std::filesystem::path& path)
+    {
+        mEnabled.store(false, std::memory_order_release);
+        if (mEvents == nullptr)
+            return false;
+
+        std::ofstream stream(path, std::ios_base::out);
+        if (!stream.is_open())
+        {
+            Log(Debug::Error) << "Failed to open file to write trace \"" << path << '"';
+            return false;
+        }
+
+        const std::uint64_t next = mNext.load(std::memory_order_acquire);
+        const std::uint64_t count = std::min<std::uint64_t>(next, sCapacity);
+
+        stream << "{\"traceEvents\":[";
+        for (std::uint64_t i = next - count; i < next; ++i)
+        {
+            const Event& event = mEvents[i & (sCapacity - 1)];
+            if (i != next - count)
+                stream << ',';
+            stream << "{\"name\":";
+            writeJsonString(event.mName, stream);
+            stream << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.mThread << ",\"ts\":" << event.mBegin
+                   << ",\"dur\":" << event.mDuration << '}';
+        }
+        stream << "]}\n";
+
+        Log(Debug::Info) << "Trace with " << count << " events written to: " << path;
+        return true;
+    }
+
+    void TraceRecorder::record(const char* name, std::uint64_t beginUs, std::uint64_t endUs)
+    {
+        const std::uint64_t index = mNext.fetch_add(1, std::memory_order_relaxed);
+        Event& event = mEvents[index & (sCapacity - 1)];
+        std::strncpy(event.mName, name, sizeof(event.mName) - 1);
+        event.mName[sizeof(event.mName) - 1] = '\0';
+        event.mBegin = beginUs;
+        event.mDuration = endUs - beginUs;
+        event.mThread = currentThreadId();
+    }
+
+    std::uint64_t TraceRecorder::now()
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+}
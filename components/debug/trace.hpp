@@ -0,0 +1,81 @@
+#ifndef DEBUG_TRACE_H
+#define DEBUG_TRACE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace Debug
+{
+    /// Flight-recorder style trace capture. While recording is enabled, scoped zones on any
+    /// thread are written into a fixed-size ring buffer, so only the most recent window is kept.
+    /// The captured window can be dumped as a chrome://tracing JSON file and inspected with
+    /// chrome://tracing or https://ui.perfetto.dev. When disabled, the per-zone overhead is a
+    /// single relaxed atomic load.
+    class TraceRecorder
+    {
+    public:
+        static TraceRecorder& instance();
+
+        bool isEnabled() const { return mEnabled.load(std::memory_order_acquire); }
+
+        /// Begin recording into the ring buffer, discarding any earlier capture.
+        void start();
+
+        /// Stop recording and write the captured window to the given file.
+        /// @return whether the file was written.
+        bool stopAndWrite(const std::filesystem::path& path);
+
+        /// Record a completed zone on the calling thread. Must only be called while enabled.
+        /// @param name Zone label; truncated to the event name capacity.
+        void record(const char* name, std::uint64_t beginUs, std::uint64_t endUs);
+
+        /// Microseconds since an arbitrary fixed point, suitable for record().
+        static std::uint64_t now();
+
+    private:
+        struct Event
+        {
+            char mName[56];
+            std::uint64_t mBegin;
+            std::uint64_t mDuration;
+            std::uint32_t mThread;
+        };
+
+        // Must be a power of two. 64k events cover several seconds of a busy frame loop.
+        static constexpr std::size_t sCapacity = std::size_t(1) << 16;
+
+        std::atomic_bool mEnabled{ false };
+        std::atomic<std::uint64_t> mNext{ 0 };
+        std::unique_ptr<Event[]> mEvents;
+    };
+
+    /// Records the enclosing scope as a zone into the TraceRecorder, if a capture is running.
+    /// @note The name must outlive the zone, e.g. a string literal or typeid name.
+    class TraceZone
+    {
+    public:
+        explicit TraceZone(const char* name)
+            : mName(TraceRecorder::instance().isEnabled() ? name : nullptr)
+            , mBegin(mName != nullptr ? TraceRecorder::now() : 0)
+        {
+        }
+
+        TraceZone(const TraceZone&) = delete;
+        TraceZone& operator=(const TraceZone&) = delete;
+
+        ~TraceZone()
+        {
+            if (mName != nullptr)
+                TraceRecorder::instance().record(mName, mBegin, TraceRecorder::now());
+        }
+
+    private:
+        const char* mName;
+        std::uint64_t mBegin;
+    };
+}
+
+#endif
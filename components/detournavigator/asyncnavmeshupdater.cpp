@@ -8,17 +8,21 @@
 #include "version.hpp"
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/trace.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
+#include <components/misc/compression.hpp>
 #include <components/misc/strings/conversion.hpp>
 #include <components/misc/thread.hpp>
 
 #include <DetourNavMesh.h>
 
+#include <osg/Math>
 #include <osg/io_utils>
 
 #include <boost/geometry.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <optional>
 #include <set>
 #include <tuple>
@@ -34,7 +38,7 @@ namespace DetourNavigator
         }
 
         bool isAbsentTileTooClose(const TilePosition& position, int distance,
-            const std::set<std::tuple<AgentBounds, TilePosition>>& pushedTiles,
+            const std::map<std::tuple<AgentBounds, TilePosition>, JobIt>& pushedTiles,
             const std::set<std::tuple<AgentBounds, TilePosition>>& presentTiles,
             const Misc::ScopeGuarded<std::set<std::tuple<AgentBounds, TilePosition>>>& processingTiles)
         {
@@ -42,7 +46,8 @@ namespace DetourNavigator
                 return presentTiles.find(v) == presentTiles.end()
                     && getManhattanDistance(position, std::get<1>(v)) < distance;
             };
-            if (std::any_of(pushedTiles.begin(), pushedTiles.end(), isAbsentAndCloserThan))
+            if (std::any_of(pushedTiles.begin(), pushedTiles.end(),
+                    [&](const auto& v) { return isAbsentAndCloserThan(v.first); }))
                 return true;
             if (const auto locked = processingTiles.lockConst();
                 std::any_of(locked->begin(), locked->end(), isAbsentAndCloserThan))
@@ -60,8 +65,12 @@ namespace DetourNavigator
         {
             if (db == nullptr)
                 return nullptr;
+            // mirrors getMaxRadius in navmeshmanager.cpp: tiles up to this far from the player
+            // may be requested, so one scan over this range covers the whole starting grid
+            const int preloadRadius = static_cast<int>(
+                std::ceil(std::sqrt(static_cast<float>(settings.mMaxTilesNumber) / osg::PIf) + 1));
             return std::make_unique<DbWorker>(updater, std::move(db), TileVersion(navMeshFormatVersion),
-                settings.mRecast, settings.mWriteToNavMeshDb);
+                settings.mRecast, settings.mWriteToNavMeshDb, preloadRadius);
         }
 
         std::size_t getNextJobId()
@@ -70,6 +79,13 @@ namespace DetourNavigator
             return nextJobId.fetch_add(1);
         }
 
+        // number of tile writes batched into one db transaction before it is committed
+        constexpr std::size_t maxBatchedDbWrites = 64;
+
+        // write jobs queued past this limit are dropped so persistence never backpressures
+        // tile generation; the tiles stay in the memory cache and can be written next time
+        constexpr std::size_t maxQueuedDbWriteJobs = 1024;
+
         bool isWritingDbJob(const Job& job)
         {
             return job.mGeneratedNavMeshData != nullptr;
@@ -262,6 +278,13 @@ namespace DetourNavigator
 
     void AsyncNavMeshUpdater::post(const AgentBounds& agentBounds, const SharedNavMeshCacheItem& navMeshCacheItem,
         const TilePosition& playerTile, ESM::RefId worldspace, const std::map<TilePosition, ChangeType>& changedTiles)
+    {
+        post(agentBounds, navMeshCacheItem, playerTile, playerTile, worldspace, changedTiles);
+    }
+
+    void AsyncNavMeshUpdater::post(const AgentBounds& agentBounds, const SharedNavMeshCacheItem& navMeshCacheItem,
+        const TilePosition& playerTile, const TilePosition& priorityTile, ESM::RefId worldspace,
+        const std::map<TilePosition, ChangeType>& changedTiles)
     {
         bool playerTileChanged = false;
         {
@@ -270,7 +293,14 @@ namespace DetourNavigator
             *locked = playerTile;
         }
 
-        if (!playerTileChanged && changedTiles.empty())
+        bool priorityTileChanged = false;
+        {
+            auto locked = mPriorityTile.lock();
+            priorityTileChanged = *locked != priorityTile;
+            *locked = priorityTile;
+        }
+
+        if (!playerTileChanged && !priorityTileChanged && changedTiles.empty())
             return;
 
         std::unique_lock lock(mMutex);
@@ -283,7 +313,8 @@ namespace DetourNavigator
 
         for (const auto& [changedTile, changeType] : changedTiles)
         {
-            if (mPushed.emplace(agentBounds, changedTile).second)
+            const auto [pushed, inserted] = mPushed.emplace(std::make_tuple(agentBounds, changedTile), JobIt());
+            if (inserted)
             {
                 const auto processTime = [&, changedTile = changedTile, changeType = changeType] {
                     if (changeType != ChangeType::update)
@@ -296,6 +327,7 @@ namespace DetourNavigator
 
                 const JobIt it = mJobs.emplace(
                     mJobs.end(), agentBounds, navMeshCacheItem, worldspace, changedTile, changeType, processTime);
+                pushed->second = it;
 
                 Log(Debug::Debug) << "Post job " << it->mId << " for agent=(" << it->mAgentBounds << ")"
                                   << " changedTile=(" << it->mChangedTile << ")"
@@ -303,6 +335,26 @@ namespace DetourNavigator
 
                 mWaiting.push(it);
             }
+            else
+            {
+                // A job for this tile is already waiting and will pick up the latest recast mesh
+                // when it runs, so there is nothing to rebuild twice. Only merge the change into
+                // the pending job: remove wins like in addChangedTile, and any non-update change
+                // lifts the update throttling delay. A delayed job keeps its place in the queue
+                // and is picked up once it reaches the front.
+                const JobIt job = pushed->second;
+                if (changeType == ChangeType::remove)
+                    job->mChangeType = ChangeType::remove;
+                else if (job->mChangeType == ChangeType::update && changeType != ChangeType::update)
+                    job->mChangeType = changeType;
+                if (changeType != ChangeType::update)
+                    job->mProcessTime = std::chrono::steady_clock::time_point();
+
+                Log(Debug::Debug) << "Merged change changeType=" << changeType << " into pending job " << job->mId
+                                  << " for agent=(" << job->mAgentBounds << ")"
+                                  << " changedTile=(" << job->mChangedTile << ")"
+                                  << " changeType=" << job->mChangeType;
+            }
         }
 
         Log(Debug::Debug) << "Posted " << mJobs.size() << " navigator jobs";
@@ -312,8 +364,8 @@ namespace DetourNavigator
 
         lock.unlock();
 
-        if (playerTileChanged && mDbWorker != nullptr)
-            mDbWorker->update(playerTile);
+        if ((playerTileChanged || priorityTileChanged) && mDbWorker != nullptr)
+            mDbWorker->update(priorityTile);
     }
 
     void AsyncNavMeshUpdater::wait(WaitConditionType waitConditionType, Loading::Listener* listener)
@@ -341,6 +393,7 @@ namespace DetourNavigator
         for (auto& thread : mThreads)
             if (thread.joinable())
                 thread.join();
+        Log(Debug::Debug) << "Navmesh tile generation timings: " << mTimings.getStats();
     }
 
     void AsyncNavMeshUpdater::waitUntilJobsDoneForNotPresentTiles(Loading::Listener* listener)
@@ -413,6 +466,7 @@ namespace DetourNavigator
             result.mDb = mDbWorker->getStats();
         result.mCache = mNavMeshTilesCache.getStats();
         result.mDbGetTileHits = mDbGetTileHits.load(std::memory_order_relaxed);
+        result.mTiming = mTimings.getStats();
         return result;
     }
 
@@ -426,6 +480,7 @@ namespace DetourNavigator
             {
                 if (JobIt job = getNextJob(); job != mJobs.end())
                 {
+                    const Debug::TraceZone zone("NavMeshJob");
                     const JobStatus status = processJob(*job);
                     Log(Debug::Debug) << "Processed job " << job->mId << " with status=" << status
                                       << " changeType=" << job->mChangeType;
@@ -530,7 +585,7 @@ namespace DetourNavigator
             }
 
             preparedNavMeshData = prepareNavMeshTileData(
-                *recastMesh, job.mWorldspace, job.mChangedTile, job.mAgentBounds, mSettings.get().mRecast);
+                *recastMesh, job.mWorldspace, job.mChangedTile, job.mAgentBounds, mSettings.get().mRecast, &mTimings);
 
             if (preparedNavMeshData == nullptr)
             {
@@ -558,7 +613,7 @@ namespace DetourNavigator
         const UpdateNavMeshStatus status
             = navMeshCacheItem.lock()->updateTile(job.mChangedTile, std::move(cachedNavMeshData),
                 makeNavMeshTileData(*preparedNavMeshDataPtr, offMeshConnections, job.mAgentBounds, job.mChangedTile,
-                    mSettings.get().mRecast));
+                    mSettings.get().mRecast, &mTimings));
 
         return handleUpdateNavMeshStatus(status, job, navMeshCacheItem, *recastMesh);
     }
@@ -581,8 +636,8 @@ namespace DetourNavigator
 
         if (preparedNavMeshData == nullptr)
         {
-            preparedNavMeshData = prepareNavMeshTileData(
-                *job.mRecastMesh, job.mWorldspace, job.mChangedTile, job.mAgentBounds, mSettings.get().mRecast);
+            preparedNavMeshData = prepareNavMeshTileData(*job.mRecastMesh, job.mWorldspace, job.mChangedTile,
+                job.mAgentBounds, mSettings.get().mRecast, &mTimings);
             generatedNavMeshData = true;
         }
 
@@ -605,7 +660,7 @@ namespace DetourNavigator
         const UpdateNavMeshStatus status
             = navMeshCacheItem.lock()->updateTile(job.mChangedTile, std::move(cachedNavMeshData),
                 makeNavMeshTileData(*preparedNavMeshDataPtr, offMeshConnections, job.mAgentBounds, job.mChangedTile,
-                    mSettings.get().mRecast));
+                    mSettings.get().mRecast, &mTimings));
 
         const JobStatus result = handleUpdateNavMeshStatus(status, job, navMeshCacheItem, *job.mRecastMesh);
 
@@ -658,11 +713,11 @@ namespace DetourNavigator
         if (shouldStop)
             return mJobs.end();
 
-        const TilePosition playerTile = *mPlayerTile.lockConst();
+        const TilePosition priorityTile = *mPriorityTile.lockConst();
 
         JobIt job = mJobs.end();
 
-        if (const std::optional<JobIt> nextJob = mWaiting.pop(playerTile))
+        if (const std::optional<JobIt> nextJob = mWaiting.pop(priorityTile))
             job = *nextJob;
 
         if (job == mJobs.end())
@@ -826,7 +881,7 @@ namespace DetourNavigator
     }
 
     DbWorker::DbWorker(AsyncNavMeshUpdater& updater, std::unique_ptr<NavMeshDb>&& db, TileVersion version,
-        const RecastSettings& recastSettings, bool writeToDb)
+        const RecastSettings& recastSettings, bool writeToDb, int preloadRadius)
         : mUpdater(updater)
         , mRecastSettings(recastSettings)
         , mDb(std::move(db))
@@ -834,6 +889,7 @@ namespace DetourNavigator
         , mWriteToDb(writeToDb)
         , mNextTileId(mDb->getMaxTileId() + 1)
         , mNextShapeId(mDb->getMaxShapeId() + 1)
+        , mPreloadRadius(preloadRadius)
         , mThread([this] { run(); })
     {
     }
@@ -845,6 +901,12 @@ namespace DetourNavigator
 
     void DbWorker::enqueueJob(JobIt job)
     {
+        if (isWritingDbJob(*job) && mQueue.getStats().mWritingJobs >= maxQueuedDbWriteJobs)
+        {
+            Log(Debug::Debug) << "Dropped db write job " << job->mId << ": write queue is full";
+            mUpdater.removeJob(job);
+            return;
+        }
         Log(Debug::Debug) << "Enqueueing db job " << job->mId << " by thread=" << std::this_thread::get_id();
         mQueue.push(job);
     }
@@ -871,6 +933,8 @@ namespace DetourNavigator
         {
             try
             {
+                if (mWriteTransaction.has_value() && mQueue.getStats().mWritingJobs == 0)
+                    commitWrites();
                 if (const auto job = mQueue.pop())
                     processJob(*job);
             }
@@ -879,6 +943,26 @@ namespace DetourNavigator
                 Log(Debug::Error) << "DbWorker exception: " << e.what();
             }
         }
+        try
+        {
+            commitWrites();
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "DbWorker failed to commit pending navmeshdb writes: " << e.what();
+        }
+    }
+
+    void DbWorker::commitWrites()
+    {
+        if (!mWriteTransaction.has_value())
+            return;
+        Log(Debug::Debug) << "Committing " << mPendingWrites << " batched db writes by thread="
+                          << std::this_thread::get_id();
+        mPendingWrites = 0;
+        Sqlite3::Transaction transaction = std::move(*mWriteTransaction);
+        mWriteTransaction.reset();
+        transaction.commit();
     }
 
     void DbWorker::processJob(JobIt job)
@@ -891,6 +975,13 @@ namespace DetourNavigator
             catch (const std::exception& e)
             {
                 Log(Debug::Error) << "DbWorker exception while processing job " << job->mId << ": " << e.what();
+                if (isWritingDbJob(*job) && mWriteTransaction.has_value())
+                {
+                    // a failed statement leaves the current batch in an unknown state, drop the
+                    // transaction so the destructor rolls it back before any recovery queries run
+                    mWriteTransaction.reset();
+                    mPendingWrites = 0;
+                }
                 if (mWriteToDb)
                 {
                     const std::string_view message(e.what());
@@ -939,12 +1030,44 @@ namespace DetourNavigator
         mUpdater.enqueueJob(job);
     }
 
+    void DbWorker::preloadTiles(const Job& job)
+    {
+        mPreloadDone = true;
+        mPreloadedWorldspace = job.mWorldspace;
+        mPreloadedRange = TilesPositionsRange{
+            .mBegin = job.mChangedTile - TilePosition(mPreloadRadius, mPreloadRadius),
+            .mEnd = job.mChangedTile + TilePosition(mPreloadRadius + 1, mPreloadRadius + 1),
+        };
+        std::vector<StoredTileData> tiles = mDb->getTilesDataInRange(job.mWorldspace, mPreloadedRange);
+        Log(Debug::Debug) << "Preloaded " << tiles.size() << " navmeshdb tiles around tile " << job.mChangedTile
+                          << " by thread=" << std::this_thread::get_id();
+        for (StoredTileData& tile : tiles)
+            mPreloadedTiles[tile.mTilePosition].push_back(std::move(tile));
+    }
+
+    std::optional<TileData> DbWorker::findPreloadedTile(
+        const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput) const
+    {
+        const auto it = mPreloadedTiles.find(tilePosition);
+        if (it == mPreloadedTiles.end())
+            return std::nullopt;
+        // rows with an outdated format version are treated as absent so the tile is
+        // regenerated and updated in the db instead of being deserialized and rejected
+        for (const StoredTileData& tile : it->second)
+            if (tile.mVersion == mVersion && tile.mInput == compressedInput)
+                return TileData{ tile.mTileId, tile.mVersion, Misc::decompress(tile.mData) };
+        return std::nullopt;
+    }
+
     void DbWorker::processReadingJob(JobIt job)
     {
         ++mGetTileCount;
 
         Log(Debug::Debug) << "Processing db read job " << job->mId;
 
+        if (!mPreloadDone)
+            preloadTiles(*job);
+
         if (job->mInput.empty())
         {
             Log(Debug::Debug) << "Serializing input for job " << job->mId;
@@ -952,7 +1075,7 @@ namespace DetourNavigator
             {
                 const auto objects = makeDbRefGeometryObjects(job->mRecastMesh->getMeshSources(),
                     [&](const MeshSource& v) { return resolveMeshSource(*mDb, v, mNextShapeId); });
-                job->mInput = serialize(mRecastSettings, job->mAgentBounds, *job->mRecastMesh, objects);
+                job->mInput = Misc::compress(serialize(mRecastSettings, job->mAgentBounds, *job->mRecastMesh, objects));
             }
             else
             {
@@ -963,7 +1086,8 @@ namespace DetourNavigator
 
                     bool operator()(const std::vector<DbRefGeometryObject>& objects) const
                     {
-                        mJob.mInput = serialize(mRecastSettings, mJob.mAgentBounds, *mJob.mRecastMesh, objects);
+                        mJob.mInput
+                            = Misc::compress(serialize(mRecastSettings, mJob.mAgentBounds, *mJob.mRecastMesh, objects));
                         return true;
                     }
 
@@ -984,6 +1108,14 @@ namespace DetourNavigator
             }
         }
 
+        if (job->mWorldspace == mPreloadedWorldspace && isInTilesPositionsRange(mPreloadedRange, job->mChangedTile))
+        {
+            // the preload scanned every row for this tile, so a miss here means the db has no
+            // matching tile and the per-tile query can be skipped
+            job->mCachedTileData = findPreloadedTile(job->mChangedTile, job->mInput);
+            return;
+        }
+
         job->mCachedTileData = mDb->getTileData(job->mWorldspace, job->mChangedTile, job->mInput);
     }
 
@@ -997,13 +1129,16 @@ namespace DetourNavigator
 
         Log(Debug::Debug) << "Processing db write job " << job->mId;
 
+        if (!mWriteTransaction.has_value())
+            mWriteTransaction = mDb->startTransaction(Sqlite3::TransactionMode::Immediate);
+
         if (job->mInput.empty())
         {
             Log(Debug::Debug) << "Serializing input for job " << job->mId;
             const std::vector<DbRefGeometryObject> objects
                 = makeDbRefGeometryObjects(job->mRecastMesh->getMeshSources(),
                     [&](const MeshSource& v) { return resolveMeshSource(*mDb, v, mNextShapeId); });
-            job->mInput = serialize(mRecastSettings, job->mAgentBounds, *job->mRecastMesh, objects);
+            job->mInput = Misc::compress(serialize(mRecastSettings, job->mAgentBounds, *job->mRecastMesh, objects));
         }
 
         if (const auto& cachedTileData = job->mCachedTileData)
@@ -1011,6 +1146,8 @@ namespace DetourNavigator
             Log(Debug::Debug) << "Update db tile by job " << job->mId;
             job->mGeneratedNavMeshData->mUserId = cachedTileData->mTileId;
             mDb->updateTile(cachedTileData->mTileId, mVersion, serialize(*job->mGeneratedNavMeshData));
+            if (++mPendingWrites >= maxBatchedDbWrites)
+                commitWrites();
             return;
         }
 
@@ -1026,5 +1163,7 @@ namespace DetourNavigator
         mDb->insertTile(mNextTileId, job->mWorldspace, job->mChangedTile, mVersion, job->mInput,
             serialize(*job->mGeneratedNavMeshData));
         ++mNextTileId;
+        if (++mPendingWrites >= maxBatchedDbWrites)
+            commitWrites();
     }
 }
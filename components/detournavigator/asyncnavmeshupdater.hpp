@@ -11,6 +11,7 @@
 #include "sharednavmeshcacheitem.hpp"
 #include "stats.hpp"
 #include "tilecachedrecastmeshmanager.hpp"
+#include "tilegenerationtimings.hpp"
 #include "tileposition.hpp"
 #include "waitconditiontype.hpp"
 
@@ -23,6 +24,7 @@
 #include <deque>
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -55,6 +57,7 @@ namespace DetourNavigator
         std::chrono::steady_clock::time_point mProcessTime;
         ChangeType mChangeType;
         JobState mState = JobState::Initial;
+        // serialized tile input compressed with Misc::compress, i.e. as stored in the navmeshdb
         std::vector<std::byte> mInput;
         std::shared_ptr<RecastMesh> mRecastMesh;
         std::optional<TileData> mCachedTileData;
@@ -157,7 +160,7 @@ namespace DetourNavigator
     {
     public:
         DbWorker(AsyncNavMeshUpdater& updater, std::unique_ptr<NavMeshDb>&& db, TileVersion version,
-            const RecastSettings& recastSettings, bool writeToDb);
+            const RecastSettings& recastSettings, bool writeToDb, int preloadRadius);
 
         ~DbWorker();
 
@@ -177,6 +180,18 @@ namespace DetourNavigator
         bool mWriteToDb;
         TileId mNextTileId;
         ShapeId mNextShapeId;
+        const int mPreloadRadius;
+        // tiles streamed from the db in one scan around the first requested tile, consulted
+        // instead of per-tile queries while requests stay within the preloaded range
+        bool mPreloadDone = false;
+        ESM::RefId mPreloadedWorldspace;
+        TilesPositionsRange mPreloadedRange;
+        std::map<TilePosition, std::vector<StoredTileData>> mPreloadedTiles;
+        // tile writes are batched into one transaction committed after a fixed number of tiles
+        // or once the write queue drains so a burst of generated tiles does not pay per tile
+        // durable commit cost
+        std::optional<Sqlite3::Transaction> mWriteTransaction;
+        std::size_t mPendingWrites = 0;
         DbJobQueue mQueue;
         std::atomic_bool mShouldStop{ false };
         std::atomic_size_t mGetTileCount{ 0 };
@@ -189,6 +204,13 @@ namespace DetourNavigator
         inline void processReadingJob(JobIt job);
 
         inline void processWritingJob(JobIt job);
+
+        inline void preloadTiles(const Job& job);
+
+        inline void commitWrites();
+
+        inline std::optional<TileData> findPreloadedTile(
+            const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput) const;
     };
 
     class AsyncNavMeshUpdater
@@ -202,6 +224,13 @@ namespace DetourNavigator
             const TilePosition& playerTile, ESM::RefId worldspace,
             const std::map<TilePosition, ChangeType>& changedTiles);
 
+        /// Same as post but jobs are processed in the order of distance to priorityTile which
+        /// may be shifted ahead of the player along the movement direction, while playerTile
+        /// still decides which tiles are in range.
+        void post(const AgentBounds& agentBounds, const SharedNavMeshCacheItem& navMeshCacheItem,
+            const TilePosition& playerTile, const TilePosition& priorityTile, ESM::RefId worldspace,
+            const std::map<TilePosition, ChangeType>& changedTiles);
+
         void wait(WaitConditionType waitConditionType, Loading::Listener* listener);
 
         void stop();
@@ -223,8 +252,9 @@ namespace DetourNavigator
         std::condition_variable mProcessed;
         std::list<Job> mJobs;
         JobQueue mWaiting;
-        std::set<std::tuple<AgentBounds, TilePosition>> mPushed;
+        std::map<std::tuple<AgentBounds, TilePosition>, JobIt> mPushed;
         Misc::ScopeGuarded<TilePosition> mPlayerTile;
+        Misc::ScopeGuarded<TilePosition> mPriorityTile;
         NavMeshTilesCache mNavMeshTilesCache;
         Misc::ScopeGuarded<std::set<std::tuple<AgentBounds, TilePosition>>> mProcessingTiles;
         std::map<std::tuple<AgentBounds, TilePosition>, std::chrono::steady_clock::time_point> mLastUpdates;
@@ -232,6 +262,7 @@ namespace DetourNavigator
         std::vector<std::thread> mThreads;
         std::unique_ptr<DbWorker> mDbWorker;
         std::atomic_size_t mDbGetTileHits{ 0 };
+        TileGenerationTimings mTimings;
 
         void process() noexcept;
 
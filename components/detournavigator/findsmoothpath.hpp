@@ -64,6 +64,17 @@ namespace DetourNavigator
         std::reference_wrapper<const RecastSettings> mSettings;
     };
 
+    inline dtQueryFilter makeQueryFilter(const Flags includeFlags, const AreaCosts& areaCosts)
+    {
+        dtQueryFilter queryFilter;
+        queryFilter.setIncludeFlags(includeFlags);
+        queryFilter.setAreaCost(AreaType_water, areaCosts.mWater);
+        queryFilter.setAreaCost(AreaType_door, areaCosts.mDoor);
+        queryFilter.setAreaCost(AreaType_pathgrid, areaCosts.mPathgrid);
+        queryFilter.setAreaCost(AreaType_ground, areaCosts.mGround);
+        return queryFilter;
+    }
+
     inline std::optional<std::size_t> findPolygonPath(const dtNavMeshQuery& navMeshQuery, const dtPolyRef startRef,
         const dtPolyRef endRef, const osg::Vec3f& startPos, const osg::Vec3f& endPos, const dtQueryFilter& queryFilter,
         std::span<dtPolyRef> pathBuffer)
@@ -105,12 +116,7 @@ namespace DetourNavigator
         const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts, const DetourSettings& settings,
         float endTolerance, std::output_iterator<osg::Vec3f> auto out)
     {
-        dtQueryFilter queryFilter;
-        queryFilter.setIncludeFlags(includeFlags);
-        queryFilter.setAreaCost(AreaType_water, areaCosts.mWater);
-        queryFilter.setAreaCost(AreaType_door, areaCosts.mDoor);
-        queryFilter.setAreaCost(AreaType_pathgrid, areaCosts.mPathgrid);
-        queryFilter.setAreaCost(AreaType_ground, areaCosts.mGround);
+        const dtQueryFilter queryFilter = makeQueryFilter(includeFlags, areaCosts);
 
         constexpr float polyDistanceFactor = 4;
         const osg::Vec3f polyHalfExtents = halfExtents * polyDistanceFactor;
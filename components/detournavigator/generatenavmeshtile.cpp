@@ -7,6 +7,7 @@
 #include "settings.hpp"
 
 #include <components/debug/debuglog.hpp>
+#include <components/misc/compression.hpp>
 
 #include <osg/io_utils>
 
@@ -69,8 +70,11 @@ namespace DetourNavigator
 
             const std::vector<DbRefGeometryObject> objects = makeDbRefGeometryObjects(
                 recastMesh->getMeshSources(), [&](const MeshSource& v) { return consumer->resolveMeshSource(v); });
-            std::vector<std::byte> input = serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects);
-            const std::optional<NavMeshTileInfo> info = consumer->find(mWorldspace, mTilePosition, input);
+            // Compress the input fingerprint here, on the work queue thread, so the consumer can
+            // match and store it without compressing under its own lock.
+            const std::vector<std::byte> compressedInput
+                = Misc::compress(serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects));
+            const std::optional<NavMeshTileInfo> info = consumer->find(mWorldspace, mTilePosition, compressedInput);
 
             if (info.has_value() && info->mVersion == navMeshFormatVersion)
             {
@@ -88,7 +92,7 @@ namespace DetourNavigator
             if (info.has_value())
                 consumer->update(mWorldspace, mTilePosition, info->mTileId, navMeshFormatVersion, *data);
             else
-                consumer->insert(mWorldspace, mTilePosition, navMeshFormatVersion, input, *data);
+                consumer->insert(mWorldspace, mTilePosition, navMeshFormatVersion, compressedInput, *data);
 
             ignore.mConsumer = nullptr;
         }
@@ -34,8 +34,9 @@ namespace DetourNavigator
 
         virtual std::int64_t resolveMeshSource(const MeshSource& source) = 0;
 
+        /// \a compressedInput is the serialized tile input compressed with Misc::compress.
         virtual std::optional<NavMeshTileInfo> find(
-            ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input)
+            ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput)
             = 0;
 
         virtual void ignore(ESM::RefId worldspace, const TilePosition& tilePosition) = 0;
@@ -43,7 +44,7 @@ namespace DetourNavigator
         virtual void identity(ESM::RefId worldspace, const TilePosition& tilePosition, std::int64_t tileId) = 0;
 
         virtual void insert(ESM::RefId worldspace, const TilePosition& tilePosition, std::int64_t version,
-            const std::vector<std::byte>& input, PreparedNavMeshData& data)
+            const std::vector<std::byte>& compressedInput, PreparedNavMeshData& data)
             = 0;
 
         virtual void update(ESM::RefId worldspace, const TilePosition& tilePosition, std::int64_t tileId,
@@ -13,6 +13,7 @@
 #include "recastparams.hpp"
 #include "settings.hpp"
 #include "settingsutils.hpp"
+#include "tilegenerationtimings.hpp"
 
 #include "components/debug/debuglog.hpp"
 
@@ -22,6 +23,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <iomanip>
 #include <limits>
 
@@ -521,10 +523,20 @@ namespace DetourNavigator
     }
 
     std::unique_ptr<PreparedNavMeshData> prepareNavMeshTileData(const RecastMesh& recastMesh, ESM::RefId worldspace,
-        const TilePosition& tilePosition, const AgentBounds& agentBounds, const RecastSettings& settings)
+        const TilePosition& tilePosition, const AgentBounds& agentBounds, const RecastSettings& settings,
+        TileGenerationTimings* timings)
     {
         RecastContext context(worldspace, tilePosition, agentBounds);
 
+        auto phaseStart = timings != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        const auto finishPhase = [&](TileGenerationPhase phase) {
+            if (timings == nullptr)
+                return;
+            const auto now = std::chrono::steady_clock::now();
+            timings->add(phase, now - phaseStart);
+            phaseStart = now;
+        };
+
         const auto [minZ, maxZ] = getBoundsByZ(recastMesh, agentBounds.mHalfExtents.z(), settings);
 
         rcHeightfield solid;
@@ -538,15 +550,21 @@ namespace DetourNavigator
                 context, tilePosition, agentBounds.mHalfExtents.z(), recastMesh, settings, params, solid))
             return nullptr;
 
+        finishPhase(TileGenerationPhase::Rasterization);
+
         rcFilterLowHangingWalkableObstacles(&context, params.mWalkableClimb, solid);
         rcFilterLedgeSpans(&context, params.mWalkableHeight, params.mWalkableClimb, solid);
         rcFilterWalkableLowHeightSpans(&context, params.mWalkableHeight, solid);
 
+        finishPhase(TileGenerationPhase::Filtering);
+
         std::unique_ptr<PreparedNavMeshData> result = std::make_unique<PreparedNavMeshData>();
 
         if (!fillPolyMesh(context, settings, params, solid, result->mPolyMesh, result->mPolyMeshDetail))
             return nullptr;
 
+        finishPhase(TileGenerationPhase::Polygonization);
+
         result->mCellSize = settings.mCellSize;
         result->mCellHeight = settings.mCellHeight;
 
@@ -555,8 +573,11 @@ namespace DetourNavigator
 
     NavMeshData makeNavMeshTileData(const PreparedNavMeshData& data,
         const std::vector<OffMeshConnection>& offMeshConnections, const AgentBounds& agentBounds,
-        const TilePosition& tile, const RecastSettings& settings)
+        const TilePosition& tile, const RecastSettings& settings, TileGenerationTimings* timings)
     {
+        const auto startedAt
+            = timings != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
         const auto offMeshConVerts = getOffMeshVerts(offMeshConnections);
         const std::vector<float> offMeshConRad(offMeshConnections.size(), getRadius(settings, agentBounds));
         const std::vector<unsigned char> offMeshConDir(offMeshConnections.size(), 0);
@@ -603,6 +624,9 @@ namespace DetourNavigator
         if (!navMeshDataCreated)
             throw NavigatorException("Failed to create navmesh tile data");
 
+        if (timings != nullptr)
+            timings->add(TileGenerationPhase::Serialization, std::chrono::steady_clock::now() - startedAt);
+
         return NavMeshData(navMeshData, navMeshDataSize);
     }
 
@@ -20,6 +20,7 @@ namespace DetourNavigator
     struct OffMeshConnection;
     struct AgentBounds;
     struct RecastSettings;
+    class TileGenerationTimings;
 
     inline float getLength(const osg::Vec2i& value)
     {
@@ -44,11 +45,12 @@ namespace DetourNavigator
     }
 
     std::unique_ptr<PreparedNavMeshData> prepareNavMeshTileData(const RecastMesh& recastMesh, ESM::RefId worldspace,
-        const TilePosition& tilePosition, const AgentBounds& agentBounds, const RecastSettings& settings);
+        const TilePosition& tilePosition, const AgentBounds& agentBounds, const RecastSettings& settings,
+        TileGenerationTimings* timings = nullptr);
 
     NavMeshData makeNavMeshTileData(const PreparedNavMeshData& data,
         const std::vector<OffMeshConnection>& offMeshConnections, const AgentBounds& agentBounds,
-        const TilePosition& tile, const RecastSettings& settings);
+        const TilePosition& tile, const RecastSettings& settings, TileGenerationTimings* timings = nullptr);
 
     void initEmptyNavMesh(const Settings& settings, dtNavMesh& navMesh);
 
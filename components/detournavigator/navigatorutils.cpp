@@ -6,6 +6,8 @@
 
 #include <components/debug/debuglog.hpp>
 
+#include <chrono>
+
 namespace DetourNavigator
 {
     std::optional<osg::Vec3f> findRandomPointAroundCircle(const Navigator& navigator, const AgentBounds& agentBounds,
@@ -41,6 +43,27 @@ namespace DetourNavigator
         return fromNavMeshCoordinates(settings.mRecast, *result);
     }
 
+    std::optional<osg::Vec3f> raycast(const Navigator& navigator, const AgentBounds& agentBounds, RaycastCache& cache,
+        const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags)
+    {
+        const auto navMesh = navigator.getNavMesh(agentBounds);
+        if (navMesh == nullptr)
+            return std::nullopt;
+        const Settings& settings = navigator.getSettings();
+        const auto now = std::chrono::steady_clock::now();
+        const auto locked = navMesh->lock();
+        if (const auto cached = cache.find(locked->getVersion(), agentBounds, start, end, includeFlags, now))
+            return *cached;
+        const auto result = DetourNavigator::raycast(locked->getQuery(),
+            toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
+            toNavMeshCoordinates(settings.mRecast, start), toNavMeshCoordinates(settings.mRecast, end), includeFlags);
+        std::optional<osg::Vec3f> hit;
+        if (result.has_value())
+            hit = fromNavMeshCoordinates(settings.mRecast, *result);
+        cache.insert(locked->getVersion(), agentBounds, start, end, includeFlags, now, hit);
+        return hit;
+    }
+
     std::optional<osg::Vec3f> findNearestNavMeshPosition(const Navigator& navigator, const AgentBounds& agentBounds,
         const osg::Vec3f& position, const osg::Vec3f& searchAreaHalfExtents, const Flags includeFlags)
     {
@@ -5,6 +5,8 @@
 #include "flags.hpp"
 #include "navigator.hpp"
 #include "navmeshcacheitem.hpp"
+#include "pathcorridor.hpp"
+#include "raycastcache.hpp"
 #include "settings.hpp"
 
 #include <components/misc/guarded.hpp>
@@ -40,6 +42,37 @@ namespace DetourNavigator
             areaCosts, settings.mDetour, endTolerance, outTransform);
     }
 
+    /**
+     * @brief findPath overload keeping the polygon path in the given corridor between calls.
+     * Repeated searches for the same actor chasing a moving target repair the corridor instead of
+     * running full A* each time. Any navmesh, flags or agent bounds change falls back to a full search.
+     * @param corridor holds the state from the previous search for the same actor.
+     * Other parameters and the result are the same as for findPath without a corridor.
+     */
+    inline Status findPath(const Navigator& navigator, const AgentBounds& agentBounds, PathCorridor& corridor,
+        const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts,
+        float endTolerance, std::output_iterator<osg::Vec3f> auto out)
+    {
+        const auto navMesh = navigator.getNavMesh(agentBounds);
+        if (navMesh == nullptr)
+        {
+            corridor.clear();
+            return Status::NavMeshNotFound;
+        }
+        if (corridor.mAgentBounds != agentBounds)
+        {
+            corridor.clear();
+            corridor.mAgentBounds = agentBounds;
+        }
+        const Settings& settings = navigator.getSettings();
+        FromNavMeshCoordinatesIterator outTransform(out, settings.mRecast);
+        const auto locked = navMesh->lock();
+        return findCorridorPath(locked->getQuery(), locked->getVersion(), corridor,
+            toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
+            toNavMeshCoordinates(settings.mRecast, start), toNavMeshCoordinates(settings.mRecast, end), includeFlags,
+            areaCosts, settings.mDetour, endTolerance, outTransform);
+    }
+
     /**
      * @brief findRandomPointAroundCircle returns random location on navmesh within the reach of specified location.
      * @param agentBounds defines which navmesh to use.
@@ -62,6 +95,13 @@ namespace DetourNavigator
     std::optional<osg::Vec3f> raycast(const Navigator& navigator, const AgentBounds& agentBounds,
         const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags);
 
+    /**
+     * @brief raycast overload storing the result in a caller owned cache so a query repeated
+     * with the same parameters against an unchanged navmesh skips the Detour call.
+     */
+    std::optional<osg::Vec3f> raycast(const Navigator& navigator, const AgentBounds& agentBounds, RaycastCache& cache,
+        const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags);
+
     /**
      * @brief findNearestNavMeshPosition finds nearest position on navmesh within given area having given flags.
      * @param agentBounds defines which navmesh to use.
@@ -1,6 +1,5 @@
 #include "navmeshdb.hpp"
 
-#include <components/debug/debuglog.hpp>
 #include <components/misc/compression.hpp>
 #include <components/misc/strings/format.hpp>
 #include <components/sqlite3/db.hpp>
@@ -11,7 +10,9 @@
 #include <sqlite3.h>
 
 #include <cstddef>
+#include <limits>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 namespace DetourNavigator
@@ -73,6 +74,17 @@ namespace DetourNavigator
                AND input = :input
         )";
 
+        constexpr std::string_view getTilesDataInRangeQuery = R"(
+            SELECT tile_position_x, tile_position_y, tile_id, version, input, data
+              FROM tiles
+             WHERE worldspace = :worldspace
+               AND tile_position_x >= :begin_tile_position_x
+               AND tile_position_y >= :begin_tile_position_y
+               AND tile_position_x < :end_tile_position_x
+               AND tile_position_y < :end_tile_position_y
+             ORDER BY tile_position_x, tile_position_y
+        )";
+
         constexpr std::string_view insertTileQuery = R"(
             INSERT INTO tiles ( tile_id,  worldspace,  version,  tile_position_x,  tile_position_y,  input,  data)
                    VALUES     (:tile_id, :worldspace, :version, :tile_position_x, :tile_position_y, :input, :data)
@@ -152,6 +164,7 @@ namespace DetourNavigator
             if (const int ec = sqlite3_exec(&db, query.c_str(), nullptr, nullptr, nullptr); ec != SQLITE_OK)
                 throw std::runtime_error("Failed set max page count: " + std::string(sqlite3_errmsg(&db)));
         }
+
     }
 
     std::ostream& operator<<(std::ostream& stream, ShapeType value)
@@ -171,6 +184,7 @@ namespace DetourNavigator
         , mGetMaxTileId(*mDb, DbQueries::GetMaxTileId{})
         , mFindTile(*mDb, DbQueries::FindTile{})
         , mGetTileData(*mDb, DbQueries::GetTileData{})
+        , mGetTilesDataInRange(*mDb, DbQueries::GetTilesDataInRange{})
         , mInsertTile(*mDb, DbQueries::InsertTile{})
         , mUpdateTile(*mDb, DbQueries::UpdateTile{})
         , mDeleteTilesAt(*mDb, DbQueries::DeleteTilesAt{})
@@ -200,32 +214,41 @@ namespace DetourNavigator
     }
 
     std::optional<Tile> NavMeshDb::findTile(
-        ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input)
+        ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput)
     {
         Tile result;
         auto row = std::tie(result.mTileId, result.mVersion);
-        const std::vector<std::byte> compressedInput = Misc::compress(input);
         if (&row == request(*mDb, mFindTile, &row, 1, worldspace.serializeText(), tilePosition, compressedInput))
             return {};
         return result;
     }
 
     std::optional<TileData> NavMeshDb::getTileData(
-        ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input)
+        ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput)
     {
         TileData result;
         auto row = std::tie(result.mTileId, result.mVersion, result.mData);
-        const std::vector<std::byte> compressedInput = Misc::compress(input);
         if (&row == request(*mDb, mGetTileData, &row, 1, worldspace.serializeText(), tilePosition, compressedInput))
             return {};
         result.mData = Misc::decompress(result.mData);
         return result;
     }
 
+    std::vector<StoredTileData> NavMeshDb::getTilesDataInRange(ESM::RefId worldspace, const TilesPositionsRange& range)
+    {
+        std::vector<std::tuple<int, int, TileId, TileVersion, std::vector<std::byte>, std::vector<std::byte>>> rows;
+        request(*mDb, mGetTilesDataInRange, std::back_inserter(rows), std::numeric_limits<std::size_t>::max(),
+            worldspace.serializeText(), range);
+        std::vector<StoredTileData> result;
+        result.reserve(rows.size());
+        for (auto& [x, y, tileId, version, input, data] : rows)
+            result.push_back(StoredTileData{ TilePosition(x, y), tileId, version, std::move(input), std::move(data) });
+        return result;
+    }
+
     int NavMeshDb::insertTile(TileId tileId, ESM::RefId worldspace, const TilePosition& tilePosition,
-        TileVersion version, const std::vector<std::byte>& input, const std::vector<std::byte>& data)
+        TileVersion version, const std::vector<std::byte>& compressedInput, const std::vector<std::byte>& data)
     {
-        const std::vector<std::byte> compressedInput = Misc::compress(input);
         const std::vector<std::byte> compressedData = Misc::compress(data);
         return execute(*mDb, mInsertTile, tileId, worldspace.serializeText(), tilePosition, version, compressedInput,
             compressedData);
@@ -312,6 +335,21 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":input", input);
         }
 
+        std::string_view GetTilesDataInRange::text() noexcept
+        {
+            return getTilesDataInRangeQuery;
+        }
+
+        void GetTilesDataInRange::bind(
+            sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const TilesPositionsRange& range)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+            Sqlite3::bindParameter(db, statement, ":begin_tile_position_x", range.mBegin.x());
+            Sqlite3::bindParameter(db, statement, ":begin_tile_position_y", range.mBegin.y());
+            Sqlite3::bindParameter(db, statement, ":end_tile_position_x", range.mEnd.x());
+            Sqlite3::bindParameter(db, statement, ":end_tile_position_y", range.mEnd.y());
+        }
+
         std::string_view InsertTile::text() noexcept
         {
             return insertTileQuery;
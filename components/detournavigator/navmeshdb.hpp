@@ -40,6 +40,16 @@ namespace DetourNavigator
         std::vector<std::byte> mData;
     };
 
+    struct StoredTileData
+    {
+        TilePosition mTilePosition;
+        TileId mTileId;
+        TileVersion mVersion;
+        // kept as stored in the database, i.e. compressed
+        std::vector<std::byte> mInput;
+        std::vector<std::byte> mData;
+    };
+
     enum class ShapeType
     {
         Collision = 1,
@@ -70,6 +80,13 @@ namespace DetourNavigator
                 const TilePosition& tilePosition, const std::vector<std::byte>& input);
         };
 
+        struct GetTilesDataInRange
+        {
+            static std::string_view text() noexcept;
+            static void bind(
+                sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const TilesPositionsRange& range);
+        };
+
         struct InsertTile
         {
             static std::string_view text() noexcept;
@@ -142,14 +159,19 @@ namespace DetourNavigator
 
         TileId getMaxTileId();
 
+        /// \a compressedInput is the serialized tile input compressed with Misc::compress, i.e. as
+        /// stored in the input column. Callers compress it once instead of this happening per query.
         std::optional<Tile> findTile(
-            ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input);
+            ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput);
 
         std::optional<TileData> getTileData(
-            ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input);
+            ESM::RefId worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& compressedInput);
+
+        /// Fetch all tiles within the given range in a single ordered scan.
+        std::vector<StoredTileData> getTilesDataInRange(ESM::RefId worldspace, const TilesPositionsRange& range);
 
         int insertTile(TileId tileId, ESM::RefId worldspace, const TilePosition& tilePosition, TileVersion version,
-            const std::vector<std::byte>& input, const std::vector<std::byte>& data);
+            const std::vector<std::byte>& compressedInput, const std::vector<std::byte>& data);
 
         int updateTile(TileId tileId, TileVersion version, const std::vector<std::byte>& data);
 
@@ -172,6 +194,7 @@ namespace DetourNavigator
         Sqlite3::Statement<DbQueries::GetMaxTileId> mGetMaxTileId;
         Sqlite3::Statement<DbQueries::FindTile> mFindTile;
         Sqlite3::Statement<DbQueries::GetTileData> mGetTileData;
+        Sqlite3::Statement<DbQueries::GetTilesDataInRange> mGetTilesDataInRange;
         Sqlite3::Statement<DbQueries::InsertTile> mInsertTile;
         Sqlite3::Statement<DbQueries::UpdateTile> mUpdateTile;
         Sqlite3::Statement<DbQueries::DeleteTilesAt> mDeleteTilesAt;
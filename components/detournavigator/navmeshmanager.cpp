@@ -198,15 +198,40 @@ namespace DetourNavigator
             return;
         mLastRecastMeshManagerRevision = mRecastMeshManager.getRevision();
         mPlayerTile = playerTile;
+        const TilePosition priorityTile = predictPriorityTile(playerPosition);
         mRecastMeshManager.setRange(makeRange(mSettings, mWorldspace, mCellGridBounds, mMaxRadius, playerTile), guard);
         const auto changedTiles = mRecastMeshManager.takeChangedTiles(guard);
         const TilesPositionsRange range = mRecastMeshManager.getLimitedObjectsRange();
         for (const auto& [agentBounds, cached] : mCache)
-            update(agentBounds, playerTile, range, cached, changedTiles);
+            update(agentBounds, playerTile, priorityTile, range, cached, changedTiles);
+    }
+
+    TilePosition NavMeshManager::predictPriorityTile(const osg::Vec3f& playerPosition)
+    {
+        // prioritize tiles around the position the player will reach in this time at the
+        // current speed so fast movement does not outrun navmesh coverage
+        constexpr float predictionSeconds = 1;
+        const auto now = std::chrono::steady_clock::now();
+        osg::Vec3f offset(0, 0, 0);
+        if (mLastPlayerPosition.has_value())
+        {
+            const float duration = std::chrono::duration<float>(now - mLastPlayerPosition->first).count();
+            if (duration > 0)
+                offset = (playerPosition - mLastPlayerPosition->second) * (predictionSeconds / duration);
+        }
+        mLastPlayerPosition = std::pair(now, playerPosition);
+        // tiles are laid out in x, y so vertical movement does not shift the anchor
+        offset.z() = 0;
+        // limit the prediction so teleports and cell transitions between two updates cannot
+        // move the anchor away from the player further than a couple of tiles
+        const float maxDistance = 2 * getTileSize(mSettings.mRecast) / mSettings.mRecast.mRecastScaleFactor;
+        if (offset.length2() > maxDistance * maxDistance)
+            offset *= maxDistance / offset.length();
+        return toNavMeshTilePosition(mSettings.mRecast, playerPosition + offset);
     }
 
     void NavMeshManager::update(const AgentBounds& agentBounds, const TilePosition& playerTile,
-        const TilesPositionsRange& range, const SharedNavMeshCacheItem& cached,
+        const TilePosition& priorityTile, const TilesPositionsRange& range, const SharedNavMeshCacheItem& cached,
         const std::map<osg::Vec2i, ChangeType>& changedTiles)
     {
         std::map<osg::Vec2i, ChangeType> tilesToPost = changedTiles;
@@ -229,8 +254,9 @@ namespace DetourNavigator
                     tilesToPost.emplace(tile, ChangeType::remove);
             });
         }
-        mAsyncNavMeshUpdater.post(agentBounds, cached, playerTile, mWorldspace, tilesToPost);
+        mAsyncNavMeshUpdater.post(agentBounds, cached, playerTile, priorityTile, mWorldspace, tilesToPost);
         Log(Debug::Debug) << "Cache update posted for agent=" << agentBounds << " playerTile=" << playerTile
+                          << " priorityTile=" << priorityTile
                           << " recastMeshManagerRevision=" << mLastRecastMeshManagerRevision;
     }
 
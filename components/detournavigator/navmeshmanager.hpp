@@ -11,8 +11,11 @@
 
 #include <osg/Vec3f>
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
+#include <utility>
 
 class dtNavMesh;
 
@@ -77,12 +80,17 @@ namespace DetourNavigator
         std::size_t mGenerationCounter = 0;
         std::optional<TilePosition> mPlayerTile;
         std::size_t mLastRecastMeshManagerRevision = 0;
+        // last player position passed to update, used to derive the velocity for the predicted
+        // job priority tile
+        std::optional<std::pair<std::chrono::steady_clock::time_point, osg::Vec3f>> mLastPlayerPosition;
 
         inline SharedNavMeshCacheItem getCached(const AgentBounds& agentBounds) const;
 
         inline void update(const AgentBounds& agentBounds, const TilePosition& playerTile,
-            const TilesPositionsRange& range, const SharedNavMeshCacheItem& cached,
+            const TilePosition& priorityTile, const TilesPositionsRange& range, const SharedNavMeshCacheItem& cached,
             const std::map<osg::Vec2i, ChangeType>& changedTiles);
+
+        inline TilePosition predictPriorityTile(const osg::Vec3f& playerPosition);
     };
 }
 
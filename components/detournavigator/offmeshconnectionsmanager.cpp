@@ -25,10 +25,10 @@ namespace DetourNavigator
         const auto startTilePosition = getTilePosition(mSettings, value.mStart);
         const auto endTilePosition = getTilePosition(mSettings, value.mEnd);
 
-        values->mByTilePosition[startTilePosition].insert(id);
+        values->mByTilePosition[startTilePosition].emplace_back(id, value);
 
         if (startTilePosition != endTilePosition)
-            values->mByTilePosition[endTilePosition].insert(id);
+            values->mByTilePosition[endTilePosition].emplace_back(id, value);
     }
 
     std::set<TilePosition> OffMeshConnectionsManager::remove(const ObjectId id)
@@ -56,7 +56,7 @@ namespace DetourNavigator
             const auto it = values->mByTilePosition.find(tilePosition);
             if (it == values->mByTilePosition.end())
                 continue;
-            it->second.erase(id);
+            std::erase_if(it->second, [&](const auto& v) { return v.first == id; });
             if (it->second.empty())
                 values->mByTilePosition.erase(it);
         }
@@ -77,14 +77,9 @@ namespace DetourNavigator
         if (itByTilePosition == values->mByTilePosition.end())
             return result;
 
-        std::for_each(itByTilePosition->second.begin(), itByTilePosition->second.end(), [&](const ObjectId v) {
-            const auto byId = values->mById.equal_range(v);
-            std::for_each(byId.first, byId.second, [&](const auto& v) {
-                if (getTilePosition(mSettings, v.second.mStart) == tilePosition
-                    || getTilePosition(mSettings, v.second.mEnd) == tilePosition)
-                    result.push_back(v.second);
-            });
-        });
+        result.reserve(itByTilePosition->second.size());
+        for (const auto& [id, connection] : itByTilePosition->second)
+            result.push_back(connection);
 
         std::sort(result.begin(), result.end());
 
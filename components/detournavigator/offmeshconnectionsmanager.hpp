@@ -10,7 +10,7 @@
 
 #include <map>
 #include <set>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace DetourNavigator
@@ -30,7 +30,9 @@ namespace DetourNavigator
         struct Values
         {
             std::multimap<ObjectId, OffMeshConnection> mById;
-            std::map<TilePosition, std::unordered_set<ObjectId>> mByTilePosition;
+            // Connections are stored per tile they start or end in so tile builds get them
+            // with a single lookup.
+            std::map<TilePosition, std::vector<std::pair<ObjectId, OffMeshConnection>>> mByTilePosition;
         };
 
         const RecastSettings& mSettings;
@@ -0,0 +1,163 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHCORRIDOR_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHCORRIDOR_H
+
+#include "agentbounds.hpp"
+#include "findsmoothpath.hpp"
+#include "flags.hpp"
+#include "settings.hpp"
+#include "status.hpp"
+#include "version.hpp"
+
+#include <DetourNavMesh.h>
+#include <DetourNavMeshQuery.h>
+
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <vector>
+
+namespace DetourNavigator
+{
+    /// Polygon path from the previous search kept between searches to be incrementally repaired
+    /// when the actor advances along it or the target moves instead of running full A* each time.
+    struct PathCorridor
+    {
+        std::vector<dtPolyRef> mPolygonPath;
+        dtPolyRef mEndRef = 0;
+        Version mNavMeshVersion;
+        Flags mFlags = Flag_none;
+        AgentBounds mAgentBounds;
+
+        void clear()
+        {
+            mPolygonPath.clear();
+            mEndRef = 0;
+        }
+    };
+
+    /// Like findSmoothPath but reuses the given corridor when possible: polygons behind the actor
+    /// are pruned, a moved target trims the tail or extends it by a search from the corridor end.
+    /// Any navmesh or filter change and any repair failure falls back to a full polygon path search.
+    Status findCorridorPath(const dtNavMeshQuery& navMeshQuery, const Version& navMeshVersion, PathCorridor& corridor,
+        const osg::Vec3f& halfExtents, const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags,
+        const AreaCosts& areaCosts, const DetourSettings& settings, float endTolerance,
+        std::output_iterator<osg::Vec3f> auto out)
+    {
+        const dtQueryFilter queryFilter = makeQueryFilter(includeFlags, areaCosts);
+
+        if (corridor.mNavMeshVersion != navMeshVersion || corridor.mFlags != includeFlags)
+            corridor.clear();
+
+        constexpr float polyDistanceFactor = 4;
+        const osg::Vec3f polyHalfExtents = halfExtents * polyDistanceFactor;
+
+        osg::Vec3f startNavMeshPos;
+        dtPolyRef startRef = 0;
+        if (const dtStatus status = navMeshQuery.findNearestPoly(
+                start.ptr(), polyHalfExtents.ptr(), &queryFilter, &startRef, startNavMeshPos.ptr());
+            dtStatusFailed(status) || startRef == 0)
+        {
+            corridor.clear();
+            return Status::StartPolygonNotFound;
+        }
+
+        osg::Vec3f endNavMeshPos;
+        const osg::Vec3f endPolyHalfExtents = polyHalfExtents + osg::Vec3f(endTolerance, endTolerance, endTolerance);
+        dtPolyRef endRef = 0;
+        if (const dtStatus status = navMeshQuery.findNearestPoly(
+                end.ptr(), endPolyHalfExtents.ptr(), &queryFilter, &endRef, endNavMeshPos.ptr());
+            dtStatusFailed(status) || endRef == 0)
+        {
+            corridor.clear();
+            return Status::EndPolygonNotFound;
+        }
+
+        std::vector<dtPolyRef>& polygonPath = corridor.mPolygonPath;
+
+        if (!polygonPath.empty())
+        {
+            const auto startIt = std::find(polygonPath.begin(), polygonPath.end(), startRef);
+            if (startIt == polygonPath.end())
+                corridor.clear();
+            else
+                polygonPath.erase(polygonPath.begin(), startIt);
+        }
+
+        if (!polygonPath.empty() && endRef != corridor.mEndRef)
+        {
+            const auto endIt = std::find(polygonPath.begin(), polygonPath.end(), endRef);
+            if (endIt != polygonPath.end())
+            {
+                polygonPath.erase(endIt + 1, polygonPath.end());
+                corridor.mEndRef = endRef;
+            }
+            else
+            {
+                osg::Vec3f repairStart;
+                if (const dtStatus status
+                    = navMeshQuery.closestPointOnPoly(polygonPath.back(), end.ptr(), repairStart.ptr(), nullptr);
+                    dtStatusFailed(status))
+                    corridor.clear();
+                else
+                {
+                    std::vector<dtPolyRef> extension(settings.mMaxPolygonPathSize);
+                    const auto extensionSize = findPolygonPath(
+                        navMeshQuery, polygonPath.back(), endRef, repairStart, endNavMeshPos, queryFilter, extension);
+                    if (!extensionSize.has_value() || *extensionSize == 0
+                        || extension[*extensionSize - 1] != endRef
+                        || polygonPath.size() - 1 + *extensionSize > settings.mMaxPolygonPathSize)
+                        corridor.clear();
+                    else
+                    {
+                        assert(extension.front() == polygonPath.back());
+                        polygonPath.insert(
+                            polygonPath.end(), extension.begin() + 1, extension.begin() + *extensionSize);
+                        corridor.mEndRef = endRef;
+                    }
+                }
+            }
+        }
+
+        if (polygonPath.empty())
+        {
+            polygonPath.resize(settings.mMaxPolygonPathSize);
+            const auto polygonPathSize = findPolygonPath(
+                navMeshQuery, startRef, endRef, startNavMeshPos, endNavMeshPos, queryFilter, polygonPath);
+            if (!polygonPathSize.has_value())
+            {
+                corridor.clear();
+                return Status::FindPathOverPolygonsFailed;
+            }
+            polygonPath.resize(*polygonPathSize);
+            corridor.mEndRef = endRef;
+        }
+
+        corridor.mNavMeshVersion = navMeshVersion;
+        corridor.mFlags = includeFlags;
+
+        if (polygonPath.empty())
+            return Status::Success;
+
+        osg::Vec3f targetNavMeshPos;
+        if (const dtStatus status
+            = navMeshQuery.closestPointOnPoly(polygonPath.back(), end.ptr(), targetNavMeshPos.ptr(), nullptr);
+            dtStatusFailed(status))
+        {
+            corridor.clear();
+            return Status::TargetPolygonNotFound;
+        }
+
+        const bool partialPath = polygonPath.back() != endRef;
+        const Status smoothStatus = makeSmoothPath(navMeshQuery, startNavMeshPos, targetNavMeshPos, polygonPath,
+            polygonPath.size(), settings.mMaxSmoothPathSize, out);
+
+        if (smoothStatus != Status::Success)
+            return smoothStatus;
+
+        return partialPath ? Status::PartialPath : Status::Success;
+    }
+}
+
+#endif
@@ -0,0 +1,70 @@
+#include "raycastcache.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+namespace DetourNavigator
+{
+    namespace
+    {
+        // bucket size for start and end positions in world units, exact positions are matched
+        // within a bucket so this only bounds how many distinct queries share one entry
+        constexpr float quantizationSize = 8;
+
+        // long enough to cover several AI reaction intervals of a stationary actor, short
+        // enough for object movement not reflected in the navmesh version to become visible
+        constexpr std::chrono::milliseconds timeToLive{ 500 };
+
+        constexpr std::size_t maxSize = 256;
+
+        int quantize(float value)
+        {
+            return static_cast<int>(std::floor(value / quantizationSize));
+        }
+    }
+
+    RaycastCache::Key RaycastCache::makeKey(const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags)
+    {
+        return Key{ quantize(start.x()), quantize(start.y()), quantize(start.z()), quantize(end.x()),
+            quantize(end.y()), quantize(end.z()), includeFlags };
+    }
+
+    bool RaycastCache::reset(const Version& navMeshVersion, const AgentBounds& agentBounds)
+    {
+        if (navMeshVersion == mNavMeshVersion && agentBounds == mAgentBounds)
+            return false;
+        mValues.clear();
+        mNavMeshVersion = navMeshVersion;
+        mAgentBounds = agentBounds;
+        return true;
+    }
+
+    std::optional<std::optional<osg::Vec3f>> RaycastCache::find(const Version& navMeshVersion,
+        const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags,
+        std::chrono::steady_clock::time_point now)
+    {
+        if (reset(navMeshVersion, agentBounds))
+            return std::nullopt;
+        const auto it = mValues.find(makeKey(start, end, includeFlags));
+        if (it == mValues.end())
+            return std::nullopt;
+        if (now - it->second.mTime > timeToLive)
+        {
+            mValues.erase(it);
+            return std::nullopt;
+        }
+        if (it->second.mStart != start || it->second.mEnd != end)
+            return std::nullopt;
+        return it->second.mResult;
+    }
+
+    void RaycastCache::insert(const Version& navMeshVersion, const AgentBounds& agentBounds, const osg::Vec3f& start,
+        const osg::Vec3f& end, const Flags includeFlags, std::chrono::steady_clock::time_point now,
+        const std::optional<osg::Vec3f>& result)
+    {
+        reset(navMeshVersion, agentBounds);
+        if (mValues.size() >= maxSize)
+            mValues.clear();
+        mValues.insert_or_assign(makeKey(start, end, includeFlags), Entry{ start, end, result, now });
+    }
+}
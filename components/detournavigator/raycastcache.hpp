@@ -0,0 +1,55 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_RAYCASTCACHE_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_RAYCASTCACHE_H
+
+#include "agentbounds.hpp"
+#include "flags.hpp"
+#include "version.hpp"
+
+#include <osg/Vec3f>
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <tuple>
+
+namespace DetourNavigator
+{
+    /// Caches results of recent navmesh raycasts. AI repeats visibility and shortcut checks
+    /// with the same parameters every decision tick, so entries are reused until a short time
+    /// passes or the navmesh or agent bounds change. Queries are bucketed by quantized start
+    /// and end positions but a cached result is returned only for exactly matching positions
+    /// since callers compare hit distances against sub-unit tolerances.
+    class RaycastCache
+    {
+    public:
+        /// @return outcome of an equivalent recent raycast or an empty optional when absent.
+        std::optional<std::optional<osg::Vec3f>> find(const Version& navMeshVersion, const AgentBounds& agentBounds,
+            const osg::Vec3f& start, const osg::Vec3f& end, Flags includeFlags,
+            std::chrono::steady_clock::time_point now);
+
+        void insert(const Version& navMeshVersion, const AgentBounds& agentBounds, const osg::Vec3f& start,
+            const osg::Vec3f& end, Flags includeFlags, std::chrono::steady_clock::time_point now,
+            const std::optional<osg::Vec3f>& result);
+
+    private:
+        using Key = std::tuple<int, int, int, int, int, int, Flags>;
+
+        struct Entry
+        {
+            osg::Vec3f mStart;
+            osg::Vec3f mEnd;
+            std::optional<osg::Vec3f> mResult;
+            std::chrono::steady_clock::time_point mTime;
+        };
+
+        Version mNavMeshVersion;
+        AgentBounds mAgentBounds;
+        std::map<Key, Entry> mValues;
+
+        static Key makeKey(const osg::Vec3f& start, const osg::Vec3f& end, Flags includeFlags);
+
+        inline bool reset(const Version& navMeshVersion, const AgentBounds& agentBounds);
+    };
+}
+
+#endif
@@ -137,6 +137,17 @@ namespace DetourNavigator
     {
     }
 
+    std::vector<RecastMeshTriangle> RecastMeshBuilder::makeObjectTriangles(
+        const btCollisionShape& shape, const btTransform& transform, const AreaType areaType)
+    {
+        // The bounds have to stay finite because the heightfield path transforms them back into
+        // the shape local space but they have to cover any possible object position.
+        constexpr float bound = 1e9f;
+        RecastMeshBuilder builder(TileBounds{ osg::Vec2f(-bound, -bound), osg::Vec2f(bound, bound) });
+        builder.addObject(shape, transform, areaType);
+        return std::move(builder.mTriangles);
+    }
+
     void RecastMeshBuilder::addObject(const btCollisionShape& shape, const btTransform& transform,
         const AreaType areaType, osg::ref_ptr<const Resource::BulletShape> source,
         const ObjectTransform& objectTransform)
@@ -216,6 +227,26 @@ namespace DetourNavigator
         }
     }
 
+    void RecastMeshBuilder::addObject(const std::vector<RecastMeshTriangle>& triangles, const AreaType areaType,
+        osg::ref_ptr<const Resource::BulletShape> source, const ObjectTransform& objectTransform)
+    {
+        const btVector3 boundsMin(mBounds.mMin.x(), mBounds.mMin.y(),
+            -std::numeric_limits<btScalar>::max() * std::numeric_limits<btScalar>::epsilon());
+        const btVector3 boundsMax(mBounds.mMax.x(), mBounds.mMax.y(),
+            std::numeric_limits<btScalar>::max() * std::numeric_limits<btScalar>::epsilon());
+
+        for (const RecastMeshTriangle& triangle : triangles)
+        {
+            std::array<btVector3, 3> vertices;
+            for (std::size_t i = 0; i < 3; ++i)
+                vertices[i] = Misc::Convert::toBullet(triangle.mVertices[i]);
+            if (TestTriangleAgainstAabb2(vertices.data(), boundsMin, boundsMax))
+                mTriangles.push_back(triangle);
+        }
+
+        mSources.push_back(MeshSource{ std::move(source), objectTransform, areaType });
+    }
+
     void RecastMeshBuilder::addWater(const osg::Vec2i& cellPosition, const Water& water)
     {
         mWater.push_back(CellWater{ cellPosition, water });
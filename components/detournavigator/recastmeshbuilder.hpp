@@ -40,9 +40,17 @@ namespace DetourNavigator
     public:
         explicit RecastMeshBuilder(const TileBounds& bounds) noexcept;
 
+        /// Extract world-space triangles of the whole object, not limited to any tile.
+        static std::vector<RecastMeshTriangle> makeObjectTriangles(
+            const btCollisionShape& shape, const btTransform& transform, AreaType areaType);
+
         void addObject(const btCollisionShape& shape, const btTransform& transform, const AreaType areaType,
             osg::ref_ptr<const Resource::BulletShape> source, const ObjectTransform& objectTransform);
 
+        /// Add already extracted world-space triangles keeping only those intersecting the tile bounds.
+        void addObject(const std::vector<RecastMeshTriangle>& triangles, AreaType areaType,
+            osg::ref_ptr<const Resource::BulletShape> source, const ObjectTransform& objectTransform);
+
         void addObject(const btCompoundShape& shape, const btTransform& transform, const AreaType areaType);
 
         void addObject(const btConcaveShape& shape, const btTransform& transform, const AreaType areaType);
@@ -3,6 +3,7 @@
 
 #include "areatype.hpp"
 #include "objecttransform.hpp"
+#include "recastmeshbuilder.hpp"
 
 #include <components/resource/bulletshape.hpp>
 
@@ -11,6 +12,7 @@
 #include <osg/ref_ptr>
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 class btCollisionShape;
@@ -65,7 +67,13 @@ namespace DetourNavigator
     public:
         RecastMeshObject(const CollisionShape& shape, const btTransform& transform, const AreaType areaType);
 
-        bool update(const btTransform& transform, const AreaType areaType) { return mImpl.update(transform, areaType); }
+        bool update(const btTransform& transform, const AreaType areaType)
+        {
+            const bool result = mImpl.update(transform, areaType);
+            if (result)
+                mTriangles.reset();
+            return result;
+        }
 
         const osg::ref_ptr<const Resource::BulletShapeInstance>& getInstance() const { return mInstance; }
 
@@ -77,10 +85,20 @@ namespace DetourNavigator
 
         const ObjectTransform& getObjectTransform() const { return mObjectTransform; }
 
+        /// World-space triangles contributed by this object or nullptr when not extracted yet.
+        /// Reset by each update changing the object geometry.
+        const std::shared_ptr<const std::vector<RecastMeshTriangle>>& getTriangles() const { return mTriangles; }
+
+        void setTriangles(std::shared_ptr<const std::vector<RecastMeshTriangle>> triangles)
+        {
+            mTriangles = std::move(triangles);
+        }
+
     private:
         osg::ref_ptr<const Resource::BulletShapeInstance> mInstance;
         ObjectTransform mObjectTransform;
         ChildRecastMeshObject mImpl;
+        std::shared_ptr<const std::vector<RecastMeshTriangle>> mTriangles;
     };
 }
 
@@ -2,10 +2,60 @@
 
 #include <osg/Stats>
 
+#include <ostream>
+#include <string>
+#include <string_view>
+
 namespace DetourNavigator
 {
     namespace
     {
+        std::string_view getName(TileGenerationPhase phase)
+        {
+            switch (phase)
+            {
+                case TileGenerationPhase::Rasterization:
+                    return "rasterization";
+                case TileGenerationPhase::Filtering:
+                    return "filtering";
+                case TileGenerationPhase::Polygonization:
+                    return "polygonization";
+                case TileGenerationPhase::Serialization:
+                    return "serialization";
+                case TileGenerationPhase::Count:
+                    break;
+            }
+            return "unknown";
+        }
+
+        std::string_view getTitle(TileGenerationPhase phase)
+        {
+            switch (phase)
+            {
+                case TileGenerationPhase::Rasterization:
+                    return "NavMesh Rasterization";
+                case TileGenerationPhase::Filtering:
+                    return "NavMesh Filtering";
+                case TileGenerationPhase::Polygonization:
+                    return "NavMesh Polygonization";
+                case TileGenerationPhase::Serialization:
+                    return "NavMesh Serialization";
+                case TileGenerationPhase::Count:
+                    break;
+            }
+            return "NavMesh Unknown";
+        }
+
+        void reportStats(const TileGenerationTimingsStats& stats, unsigned int frameNumber, osg::Stats& out)
+        {
+            for (std::size_t i = 0; i < tileGenerationPhasesCount; ++i)
+            {
+                const TileGenerationPhaseStats& phase = stats.mPhases[i];
+                const std::string title(getTitle(static_cast<TileGenerationPhase>(i)));
+                out.setAttribute(frameNumber, title + " Count", static_cast<double>(phase.mCount));
+                out.setAttribute(frameNumber, title + " Ms", static_cast<double>(phase.mTotalMicroseconds) / 1000.0);
+            }
+        }
         void reportStats(const AsyncNavMeshUpdaterStats& stats, unsigned int frameNumber, osg::Stats& out)
         {
             out.setAttribute(frameNumber, "NavMesh Jobs", static_cast<double>(stats.mJobs));
@@ -31,6 +81,8 @@ namespace DetourNavigator
             out.setAttribute(frameNumber, "NavMesh CachedTiles", static_cast<double>(stats.mCache.mCachedNavMeshTiles));
             out.setAttribute(frameNumber, "NavMesh Cache Get", static_cast<double>(stats.mCache.mGetCount));
             out.setAttribute(frameNumber, "NavMesh Cache Hit", static_cast<double>(stats.mCache.mHitCount));
+
+            reportStats(stats.mTiming, frameNumber, out);
         }
 
         void reportStats(const TileCachedRecastMeshManagerStats& stats, unsigned int frameNumber, osg::Stats& out)
@@ -47,4 +99,25 @@ namespace DetourNavigator
         reportStats(stats.mUpdater, frameNumber, out);
         reportStats(stats.mRecast, frameNumber, out);
     }
+
+    std::ostream& operator<<(std::ostream& stream, const TileGenerationTimingsStats& stats)
+    {
+        stream << '{';
+        for (std::size_t i = 0; i < tileGenerationPhasesCount; ++i)
+        {
+            const TileGenerationPhaseStats& phase = stats.mPhases[i];
+            if (i != 0)
+                stream << ',';
+            stream << '"' << getName(static_cast<TileGenerationPhase>(i)) << "\":{\"count\":" << phase.mCount
+                   << ",\"totalUs\":" << phase.mTotalMicroseconds << ",\"histogramUs\":[";
+            for (std::size_t bucket = 0; bucket < tileGenerationTimingsBuckets; ++bucket)
+            {
+                if (bucket != 0)
+                    stream << ',';
+                stream << phase.mHistogram[bucket];
+            }
+            stream << "]}";
+        }
+        return stream << '}';
+    }
 }
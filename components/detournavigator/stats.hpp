@@ -1,7 +1,10 @@
 #ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_STATS_H
 #define OPENMW_COMPONENTS_DETOURNAVIGATOR_STATS_H
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <iosfwd>
 #include <optional>
 
 namespace osg
@@ -39,6 +42,36 @@ namespace DetourNavigator
         std::size_t mGetCount = 0;
     };
 
+    enum class TileGenerationPhase : std::size_t
+    {
+        Rasterization = 0,
+        Filtering = 1,
+        Polygonization = 2,
+        Serialization = 3,
+        Count = 4,
+    };
+
+    constexpr std::size_t tileGenerationPhasesCount = static_cast<std::size_t>(TileGenerationPhase::Count);
+
+    // log2 spaced buckets: bucket i counts phase durations in [2^i, 2^(i + 1)) microseconds,
+    // the last bucket is open ended to also catch multi-second outliers
+    constexpr std::size_t tileGenerationTimingsBuckets = 20;
+
+    struct TileGenerationPhaseStats
+    {
+        std::uint64_t mCount = 0;
+        std::uint64_t mTotalMicroseconds = 0;
+        std::array<std::uint64_t, tileGenerationTimingsBuckets> mHistogram{};
+    };
+
+    struct TileGenerationTimingsStats
+    {
+        std::array<TileGenerationPhaseStats, tileGenerationPhasesCount> mPhases;
+    };
+
+    /// Writes the timings as a single line of JSON so the log can be processed by scripts.
+    std::ostream& operator<<(std::ostream& stream, const TileGenerationTimingsStats& stats);
+
     struct AsyncNavMeshUpdaterStats
     {
         std::size_t mJobs = 0;
@@ -48,6 +81,7 @@ namespace DetourNavigator
         std::size_t mDbGetTileHits = 0;
         std::optional<DbWorkerStats> mDb;
         NavMeshTilesCacheStats mCache;
+        TileGenerationTimingsStats mTiming;
     };
 
     struct TileCachedRecastMeshManagerStats
@@ -170,6 +170,7 @@ namespace DetourNavigator
                 = mObjects
                       .emplace_hint(it, id,
                           std::unique_ptr<ObjectData>(new ObjectData{
+                              .mId = id,
                               .mObject = RecastMeshObject(shape, transform, areaType),
                               .mRange = range,
                               .mAabb = CommulativeAabb(revision, BulletHelpers::getAabb(shape.getShape(), transform)),
@@ -489,8 +490,17 @@ namespace DetourNavigator
     std::shared_ptr<RecastMesh> TileCachedRecastMeshManager::makeMesh(const TilePosition& tilePosition) const
     {
         RecastMeshBuilder builder(makeRealTileBoundsWithBorder(mSettings, tilePosition));
-        using Object = std::tuple<osg::ref_ptr<const Resource::BulletShapeInstance>, ObjectTransform,
-            std::reference_wrapper<const btCollisionShape>, btTransform, AreaType>;
+        struct Object
+        {
+            ObjectId mId;
+            std::size_t mRevision;
+            osg::ref_ptr<const Resource::BulletShapeInstance> mInstance;
+            ObjectTransform mObjectTransform;
+            std::reference_wrapper<const btCollisionShape> mShape;
+            btTransform mTransform;
+            AreaType mAreaType;
+            std::shared_ptr<const std::vector<RecastMeshTriangle>> mTriangles;
+        };
         std::vector<Object> objects;
         Version version;
         bool hasInput = false;
@@ -511,9 +521,18 @@ namespace DetourNavigator
             objects.reserve(mObjects.size());
             for (auto it = mObjectIndex.qbegin(makeIndexQuery(tilePosition)); it != mObjectIndex.qend(); ++it)
             {
-                const auto& object = it->second->mObject;
-                objects.emplace_back(object.getInstance(), object.getObjectTransform(), object.getShape(),
-                    object.getTransform(), object.getAreaType());
+                const ObjectData& data = *it->second;
+                const RecastMeshObject& object = data.mObject;
+                objects.push_back(Object{
+                    .mId = data.mId,
+                    .mRevision = data.mRevision,
+                    .mInstance = object.getInstance(),
+                    .mObjectTransform = object.getObjectTransform(),
+                    .mShape = object.getShape(),
+                    .mTransform = object.getTransform(),
+                    .mAreaType = object.getAreaType(),
+                    .mTriangles = object.getTriangles(),
+                });
                 hasInput = true;
             }
             if (hasInput)
@@ -530,8 +549,30 @@ namespace DetourNavigator
         }
         if (!hasInput)
             return nullptr;
-        for (const auto& [instance, objectTransform, shape, transform, areaType] : objects)
-            builder.addObject(shape, transform, areaType, instance->getSource(), objectTransform);
+        bool extracted = false;
+        for (Object& object : objects)
+        {
+            if (object.mTriangles == nullptr)
+            {
+                object.mTriangles = std::make_shared<const std::vector<RecastMeshTriangle>>(
+                    RecastMeshBuilder::makeObjectTriangles(object.mShape, object.mTransform, object.mAreaType));
+                extracted = true;
+            }
+            builder.addObject(
+                *object.mTriangles, object.mAreaType, object.mInstance->getSource(), object.mObjectTransform);
+        }
+        if (extracted)
+        {
+            const std::lock_guard lock(mMutex);
+            for (const Object& object : objects)
+            {
+                const auto it = mObjects.find(object.mId);
+                if (it == mObjects.end() || it->second->mRevision != object.mRevision
+                    || it->second->mObject.getTriangles() != nullptr)
+                    continue;
+                it->second->mObject.setTriangles(object.mTriangles);
+            }
+        }
         return std::move(builder).create(version);
     }
 
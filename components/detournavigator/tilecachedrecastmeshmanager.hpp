@@ -90,6 +90,7 @@ namespace DetourNavigator
 
         struct ObjectData
         {
+            ObjectId mId;
             RecastMeshObject mObject;
             TilesPositionsRange mRange;
             CommulativeAabb mAabb;
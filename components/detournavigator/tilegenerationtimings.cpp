@@ -0,0 +1,36 @@
+#include "tilegenerationtimings.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+namespace DetourNavigator
+{
+    void TileGenerationTimings::add(TileGenerationPhase phase, std::chrono::steady_clock::duration value)
+    {
+        const auto count = std::chrono::duration_cast<std::chrono::microseconds>(value).count();
+        const std::uint64_t microseconds = count > 0 ? static_cast<std::uint64_t>(count) : 0;
+        const std::size_t bucket = microseconds == 0
+            ? 0
+            : std::min<std::size_t>(tileGenerationTimingsBuckets - 1, std::bit_width(microseconds) - 1);
+        Phase& values = mPhases[static_cast<std::size_t>(phase)];
+        values.mCount.fetch_add(1, std::memory_order_relaxed);
+        values.mTotalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+        values.mHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    TileGenerationTimingsStats TileGenerationTimings::getStats() const
+    {
+        TileGenerationTimingsStats result;
+        for (std::size_t phase = 0; phase < tileGenerationPhasesCount; ++phase)
+        {
+            const Phase& values = mPhases[phase];
+            TileGenerationPhaseStats& out = result.mPhases[phase];
+            out.mCount = values.mCount.load(std::memory_order_relaxed);
+            out.mTotalMicroseconds = values.mTotalMicroseconds.load(std::memory_order_relaxed);
+            for (std::size_t bucket = 0; bucket < tileGenerationTimingsBuckets; ++bucket)
+                out.mHistogram[bucket] = values.mHistogram[bucket].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+}
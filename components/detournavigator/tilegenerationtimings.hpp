@@ -0,0 +1,34 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_TILEGENERATIONTIMINGS_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_TILEGENERATIONTIMINGS_H
+
+#include "stats.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace DetourNavigator
+{
+    /// Accumulates durations of navmesh tile generation phases into log2 spaced histograms.
+    /// Updated concurrently by all generator threads, hence the atomic counters.
+    class TileGenerationTimings
+    {
+    public:
+        void add(TileGenerationPhase phase, std::chrono::steady_clock::duration value);
+
+        TileGenerationTimingsStats getStats() const;
+
+    private:
+        struct Phase
+        {
+            std::atomic_uint64_t mCount{ 0 };
+            std::atomic_uint64_t mTotalMicroseconds{ 0 };
+            std::array<std::atomic_uint64_t, tileGenerationTimingsBuckets> mHistogram{};
+        };
+
+        std::array<Phase, tileGenerationPhasesCount> mPhases;
+    };
+}
+
+#endif
@@ -36,6 +36,12 @@ namespace ESM
         int getLoadFlags() const { return mLoadFlags; }
         int getPlugin() const { return mPlugin; }
 
+        /// Size of the loaded terrain arrays in bytes.
+        std::size_t getByteSize() const
+        {
+            return mHeights.size_bytes() + mNormals.size_bytes() + mColors.size_bytes() + mTextures.size_bytes();
+        }
+
     private:
         std::unique_ptr<const ESM::LandRecordData> mData;
         int mLoadFlags = 0;
@@ -0,0 +1,80 @@
+#include "compressedsave.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <components/misc/compression.hpp>
+
+namespace ESM
+{
+    namespace
+    {
+        constexpr char sMagic[8] = { 'O', 'M', 'W', 'C', 'S', 'A', 'V', '0' };
+
+        // Compression ratio barely improves beyond this chunk size, while peak memory
+        // use during the write and the granularity of the write-through grow with it.
+        constexpr std::size_t sFrameSize = 1024 * 1024;
+    }
+
+    bool isCompressedSave(std::istream& stream)
+    {
+        char magic[sizeof(sMagic)];
+        const std::streampos restore = stream.tellg();
+        stream.read(magic, sizeof(magic));
+        const bool result = stream.gcount() == sizeof(magic) && std::memcmp(magic, sMagic, sizeof(magic)) == 0;
+        stream.clear();
+        stream.seekg(restore);
+        return result;
+    }
+
+    void compressSave(std::istream& plain, std::ostream& out)
+    {
+        out.write(sMagic, sizeof(sMagic));
+
+        std::vector<std::byte> chunk(sFrameSize);
+        while (plain)
+        {
+            plain.read(reinterpret_cast<char*>(chunk.data()), chunk.size());
+            const std::size_t read = static_cast<std::size_t>(plain.gcount());
+            if (read == 0)
+                break;
+            chunk.resize(read);
+            const std::vector<std::byte> frame = Misc::compress(chunk);
+            const std::uint32_t frameSize = static_cast<std::uint32_t>(frame.size());
+            out.write(reinterpret_cast<const char*>(&frameSize), sizeof(frameSize));
+            out.write(reinterpret_cast<const char*>(frame.data()), frame.size());
+            chunk.resize(sFrameSize);
+        }
+    }
+
+    std::unique_ptr<std::istream> decompressSave(std::istream& compressed)
+    {
+        char magic[sizeof(sMagic)];
+        compressed.read(magic, sizeof(magic));
+        if (compressed.gcount() != sizeof(magic) || std::memcmp(magic, sMagic, sizeof(magic)) != 0)
+            throw std::runtime_error("Not a compressed save file");
+
+        std::string plain;
+        while (true)
+        {
+            std::uint32_t frameSize = 0;
+            compressed.read(reinterpret_cast<char*>(&frameSize), sizeof(frameSize));
+            if (compressed.gcount() == 0)
+                break;
+            if (compressed.gcount() != sizeof(frameSize))
+                throw std::runtime_error("Truncated compressed save frame header");
+            std::vector<std::byte> frame(frameSize);
+            compressed.read(reinterpret_cast<char*>(frame.data()), frame.size());
+            if (compressed.gcount() != static_cast<std::streamsize>(frame.size()))
+                throw std::runtime_error("Truncated compressed save frame");
+            const std::vector<std::byte> chunk = Misc::decompress(frame);
+            plain.append(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+        }
+
+        return std::make_unique<std::istringstream>(std::move(plain), std::ios::binary);
+    }
+}
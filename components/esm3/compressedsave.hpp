@@ -0,0 +1,25 @@
+#ifndef OPENMW_COMPONENTS_ESM3_COMPRESSEDSAVE_H
+#define OPENMW_COMPONENTS_ESM3_COMPRESSEDSAVE_H
+
+#include <istream>
+#include <memory>
+
+namespace ESM
+{
+    // Saved games can be wrapped in a compressed container: a magic tag followed by
+    // independent frames, each holding a Misc::compress()ed chunk of the plain ESM
+    // stream. Frames are written through one at a time, so only a single chunk is held
+    // in memory during the disk write. ESMReader detects the container transparently,
+    // so both plain and compressed saves load through the same code path.
+
+    bool isCompressedSave(std::istream& stream);
+    ///< Check for the container magic, leaving the stream position unchanged.
+
+    void compressSave(std::istream& plain, std::ostream& out);
+    ///< Wrap the given plain ESM stream into the compressed container.
+
+    std::unique_ptr<std::istream> decompressSave(std::istream& compressed);
+    ///< Unpack a compressed container into a seekable memory stream.
+}
+
+#endif
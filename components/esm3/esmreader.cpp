@@ -1,10 +1,12 @@
 #include "esmreader.hpp"
 
+#include "compressedsave.hpp"
 #include "readerscache.hpp"
 
 #include <components/esm3/cellid.hpp>
 #include <components/esm3/loadcell.hpp>
 #include <components/files/conversion.hpp>
+#include <components/files/memorymappedstream.hpp>
 #include <components/files/openfile.hpp>
 #include <components/misc/strings/algorithm.hpp>
 
@@ -15,6 +17,17 @@
 
 namespace ESM
 {
+    namespace
+    {
+        // Prefer a memory mapped view of the file so sub-record reads are served straight from
+        // the page cache; fall back to a buffered stream when mapping is not possible.
+        Files::IStreamPtr openStream(const std::filesystem::path& filename)
+        {
+            if (Files::IStreamPtr stream = Files::tryOpenMemoryMappedStream(filename))
+                return stream;
+            return Files::openBinaryInputFileStream(filename);
+        }
+    }
 
     ESM_Context ESMReader::getContext()
     {
@@ -87,6 +100,28 @@ namespace ESM
         }
     }
 
+    void ESMReader::resolveParentFileIndices(const std::vector<std::string>& contentFileNames)
+    {
+        mCtx.parentFileIndices.clear();
+        for (const Header::MasterData& mast : getGameFiles())
+        {
+            const std::string& fname = mast.name;
+            int index = getIndex();
+            for (int i = 0; i < getIndex() && i < static_cast<int>(contentFileNames.size()); i++)
+            {
+                const std::string& candidate = contentFileNames[static_cast<std::size_t>(i)];
+                if (candidate.empty())
+                    continue; // Content file in non-ESM format
+                if (Misc::StringUtils::ciEqual(fname, candidate))
+                {
+                    index = i;
+                    break;
+                }
+            }
+            mCtx.parentFileIndices.push_back(index);
+        }
+    }
+
     bool ESMReader::applyContentFileMapping(FormId& id)
     {
         if (mContentFileMapping && id.hasContentFile())
@@ -120,6 +155,8 @@ namespace ESM
     void ESMReader::openRaw(std::unique_ptr<std::istream>&& stream, const std::filesystem::path& name)
     {
         close();
+        if (isCompressedSave(*stream))
+            stream = decompressSave(*stream);
         mEsm = std::move(stream);
         mCtx.filename = name;
         mEsm->seekg(0, mEsm->end);
@@ -129,7 +166,7 @@ namespace ESM
 
     void ESMReader::openRaw(const std::filesystem::path& filename)
     {
-        openRaw(Files::openBinaryInputFileStream(filename), filename);
+        openRaw(openStream(filename), filename);
     }
 
     void ESMReader::open(std::unique_ptr<std::istream>&& stream, const std::filesystem::path& name)
@@ -146,7 +183,7 @@ namespace ESM
 
     void ESMReader::open(const std::filesystem::path& file)
     {
-        open(Files::openBinaryInputFileStream(file), file);
+        open(openStream(file), file);
     }
 
     std::string ESMReader::getHNOString(NAME name)
@@ -114,6 +114,13 @@ namespace ESM
         // as required for handling moved, deleted and edited CellRefs.
         /// @note Does not validate.
         void resolveParentFileIndices(ReadersCache& readers);
+
+        /// Resolve the parent file indices from the content file names in load order instead of
+        /// the readers cache. An empty name marks a file that is not read by the caller (e.g. a
+        /// non-ESM format file). Unlike the ReadersCache overload this does not touch any other
+        /// reader and may therefore be used while they are busy on other threads.
+        void resolveParentFileIndices(const std::vector<std::string>& contentFileNames);
+
         const std::vector<int>& getParentFileIndices() const { return mCtx.parentFileIndices; }
 
         // Used only when loading saves to adjust FormIds if load order was changes.
@@ -353,6 +360,8 @@ namespace ESM
         /// Sets font encoder for ESM strings
         void setEncoder(ToUTF8::Utf8Encoder* encoder) { mEncoder = encoder; }
 
+        ToUTF8::Utf8Encoder* getEncoder() const { return mEncoder; }
+
         /// Get record flags of last record
         uint32_t getRecordFlags() { return mRecordFlags; }
 
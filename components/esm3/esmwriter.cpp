@@ -144,6 +144,21 @@ namespace ESM
         endRecord("TES3");
     }
 
+    void ESMWriter::saveRecords(std::ostream& file)
+    {
+        mRecordCount = 0;
+        mRecords.clear();
+        mCounting = true;
+        mStream = &file;
+    }
+
+    void ESMWriter::writeSerializedRecord(std::string_view data)
+    {
+        assert(mRecords.empty());
+        mStream->write(data.data(), data.size());
+        ++mRecordCount;
+    }
+
     void ESMWriter::close()
     {
         if (!mRecords.empty())
@@ -59,6 +59,13 @@ namespace ESM
         void save(std::ostream& file);
         ///< Start saving a file by writing the TES3 header.
 
+        void saveRecords(std::ostream& file);
+        ///< Start saving records to a stream without writing a TES3 header. Use together with
+        /// writeSerializedRecord to pre-serialize records for splicing into another file.
+
+        void writeSerializedRecord(std::string_view data);
+        ///< Append a record previously produced by a writer with the same format version verbatim.
+
         void close();
         ///< \note Does not close the stream.
 
@@ -38,6 +38,35 @@ namespace ESM
                             out[(y1 * 4 + y2) * 16 + (x1 * 4 + x2)] = in[readPos++];
         }
 
+        void decompressHeights(const VHGT& vhgt, LandRecordData& data)
+        {
+            data.mMinHeight = std::numeric_limits<float>::max();
+            data.mMaxHeight = -std::numeric_limits<float>::max();
+            float rowOffset = vhgt.mHeightOffset;
+            for (unsigned y = 0; y < LandRecordData::sLandSize; y++)
+            {
+                rowOffset += vhgt.mHeightData[y * LandRecordData::sLandSize];
+
+                data.mHeights[y * LandRecordData::sLandSize] = rowOffset * Land::sHeightScale;
+                if (rowOffset * Land::sHeightScale > data.mMaxHeight)
+                    data.mMaxHeight = rowOffset * Land::sHeightScale;
+                if (rowOffset * Land::sHeightScale < data.mMinHeight)
+                    data.mMinHeight = rowOffset * Land::sHeightScale;
+
+                float colOffset = rowOffset;
+                for (unsigned x = 1; x < LandRecordData::sLandSize; x++)
+                {
+                    colOffset += vhgt.mHeightData[y * LandRecordData::sLandSize + x];
+                    data.mHeights[x + y * LandRecordData::sLandSize] = colOffset * Land::sHeightScale;
+
+                    if (colOffset * Land::sHeightScale > data.mMaxHeight)
+                        data.mMaxHeight = colOffset * Land::sHeightScale;
+                    if (colOffset * Land::sHeightScale < data.mMinHeight)
+                        data.mMinHeight = colOffset * Land::sHeightScale;
+                }
+            }
+        }
+
         // Loads data and marks it as loaded. Return true if data is actually loaded from reader, false otherwise
         // including the case when data is already loaded.
         bool condLoad(ESMReader& reader, int dataTypes, int& targetDataTypes, int dataFlag, auto& in)
@@ -92,19 +121,27 @@ namespace ESM
 
         mLandData = nullptr;
         std::fill(std::begin(mWnam), std::end(mWnam), 0);
-
-        // Skip the land data here. Load it when the cell is loaded.
+        mSubRecordOffsets.fill(0);
+
+        // Skip the land data here. Load it when the cell is loaded. While skimming, note where
+        // each sub-record starts so loadData() can seek to it directly. The stored context points
+        // just past the name of the first data sub-record, hence the name read for the current
+        // sub-record ends getSubNameOffset() bytes after the start of the first one.
+        const auto getSubNameOffset
+            = [&] { return static_cast<std::uint32_t>(esm.getFileOffset() - mContext.filePos); };
         while (esm.hasMoreSubs())
         {
             esm.getSubName();
             switch (esm.retSubName().toInt())
             {
                 case fourCC("VNML"):
+                    mSubRecordOffsets[SubRecord_VNML] = getSubNameOffset();
                     esm.skipHSub();
                     if (mFlags & Flag_HeightsNormals)
                         mDataTypes |= DATA_VNML;
                     break;
                 case fourCC("VHGT"):
+                    mSubRecordOffsets[SubRecord_VHGT] = getSubNameOffset();
                     esm.skipHSub();
                     if (mFlags & Flag_HeightsNormals)
                         mDataTypes |= DATA_VHGT;
@@ -115,11 +152,13 @@ namespace ESM
                         mDataTypes |= DATA_WNAM;
                     break;
                 case fourCC("VCLR"):
+                    mSubRecordOffsets[SubRecord_VCLR] = getSubNameOffset();
                     esm.skipHSub();
                     if (mFlags & Flag_Colors)
                         mDataTypes |= DATA_VCLR;
                     break;
                 case fourCC("VTEX"):
+                    mSubRecordOffsets[SubRecord_VTEX] = getSubNameOffset();
                     esm.skipHSub();
                     if (mFlags & Flag_Textures)
                         mDataTypes |= DATA_VTEX;
@@ -256,9 +295,52 @@ namespace ESM
         }
 
         ESMReader reader;
-        reader.restoreContext(mContext);
 
-        loadLandRecordData(dataTypes, reader, data);
+        // Seek straight to the sub-records that are requested and not loaded yet, using the
+        // offsets captured in load(). The stored context points just past the name of the first
+        // data sub-record, so position and remaining record size are adjusted to make the reader
+        // behave as if it had scanned ahead to the sub-record in question.
+        ESM_Context context = mContext;
+        context.subCached = false;
+        const auto seekToSubRecord = [&](SubRecord subRecord) {
+            const std::uint32_t offset = mSubRecordOffsets[subRecord];
+            context.filePos = mContext.filePos - 4 + offset;
+            context.leftRec = mContext.leftRec + 4 - offset;
+            reader.restoreContext(context);
+        };
+
+        if ((dataTypes & DATA_VNML) != 0 && (data.mDataLoaded & DATA_VNML) == 0)
+        {
+            seekToSubRecord(SubRecord_VNML);
+            reader.getHNT("VNML", data.mNormals);
+            data.mDataLoaded |= DATA_VNML;
+        }
+
+        if ((dataTypes & DATA_VHGT) != 0 && (data.mDataLoaded & DATA_VHGT) == 0)
+        {
+            seekToSubRecord(SubRecord_VHGT);
+            VHGT vhgt;
+            reader.getSubNameIs("VHGT");
+            reader.getSubComposite(vhgt);
+            decompressHeights(vhgt, data);
+            data.mDataLoaded |= DATA_VHGT;
+        }
+
+        if ((dataTypes & DATA_VCLR) != 0 && (data.mDataLoaded & DATA_VCLR) == 0)
+        {
+            seekToSubRecord(SubRecord_VCLR);
+            reader.getHNT("VCLR", data.mColours);
+            data.mDataLoaded |= DATA_VCLR;
+        }
+
+        if ((dataTypes & DATA_VTEX) != 0 && (data.mDataLoaded & DATA_VTEX) == 0)
+        {
+            seekToSubRecord(SubRecord_VTEX);
+            std::uint16_t vtex[LandRecordData::sLandNumTextures];
+            reader.getHNT("VTEX", vtex);
+            transposeTextureData(vtex, data.mTextures.data());
+            data.mDataLoaded |= DATA_VTEX;
+        }
     }
 
     void Land::unloadData()
@@ -276,6 +358,7 @@ namespace ESM
         , mX(land.mX)
         , mY(land.mY)
         , mContext(land.mContext)
+        , mSubRecordOffsets(land.mSubRecordOffsets)
         , mDataTypes(land.mDataTypes)
         , mWnam(land.mWnam)
         , mLandData(land.mLandData != nullptr ? std::make_unique<LandData>(*land.mLandData) : nullptr)
@@ -316,33 +399,7 @@ namespace ESM
         {
             VHGT vhgt;
             if (condLoad(reader, dataTypes, data.mDataLoaded, Land::DATA_VHGT, vhgt))
-            {
-                data.mMinHeight = std::numeric_limits<float>::max();
-                data.mMaxHeight = -std::numeric_limits<float>::max();
-                float rowOffset = vhgt.mHeightOffset;
-                for (unsigned y = 0; y < LandRecordData::sLandSize; y++)
-                {
-                    rowOffset += vhgt.mHeightData[y * LandRecordData::sLandSize];
-
-                    data.mHeights[y * LandRecordData::sLandSize] = rowOffset * Land::sHeightScale;
-                    if (rowOffset * Land::sHeightScale > data.mMaxHeight)
-                        data.mMaxHeight = rowOffset * Land::sHeightScale;
-                    if (rowOffset * Land::sHeightScale < data.mMinHeight)
-                        data.mMinHeight = rowOffset * Land::sHeightScale;
-
-                    float colOffset = rowOffset;
-                    for (unsigned x = 1; x < LandRecordData::sLandSize; x++)
-                    {
-                        colOffset += vhgt.mHeightData[y * LandRecordData::sLandSize + x];
-                        data.mHeights[x + y * LandRecordData::sLandSize] = colOffset * Land::sHeightScale;
-
-                        if (colOffset * Land::sHeightScale > data.mMaxHeight)
-                            data.mMaxHeight = colOffset * Land::sHeightScale;
-                        if (colOffset * Land::sHeightScale < data.mMinHeight)
-                            data.mMinHeight = colOffset * Land::sHeightScale;
-                    }
-                }
-            }
+                decompressHeights(vhgt, data);
         }
 
         if (reader.isNextSub("WNAM"))
@@ -55,6 +55,22 @@ namespace ESM
         // in which case the filename will be empty.
         ESM_Context mContext;
 
+        enum SubRecord
+        {
+            SubRecord_VNML = 0,
+            SubRecord_VHGT = 1,
+            SubRecord_VCLR = 2,
+            SubRecord_VTEX = 3,
+            SubRecord_Count = 4
+        };
+
+        // Offsets of the lazily loaded sub-records, captured while the record is skimmed in
+        // load() and measured in bytes from the start of the first data sub-record. They allow
+        // loadData() to seek straight to the sub-records it was asked for instead of re-scanning
+        // the record headers on every call. An entry is only valid when the matching mDataTypes
+        // bit is set.
+        std::array<std::uint32_t, SubRecord_Count> mSubRecordOffsets{ { 0, 0, 0, 0 } };
+
         int mDataTypes = 0;
 
         enum
@@ -22,6 +22,7 @@ namespace ESM
 
     ReadersCache::BusyItem ReadersCache::get(std::size_t index)
     {
+        const std::lock_guard lock(mMutex);
         const auto indexIt = mIndex.find(index);
         std::list<Item>::iterator it;
         if (indexIt == mIndex.end())
@@ -74,6 +75,7 @@ namespace ESM
 
     void ReadersCache::releaseItem(std::list<Item>::iterator it) noexcept
     {
+        const std::lock_guard lock(mMutex);
         assert(it->mState == State::Busy);
         if (it->mReader.isOpen())
         {
@@ -89,6 +91,7 @@ namespace ESM
 
     void ReadersCache::clear()
     {
+        const std::lock_guard lock(mMutex);
         mIndex.clear();
         mBusyItems.clear();
         mFreeItems.clear();
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <list>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -53,12 +54,15 @@ namespace ESM
 
         explicit ReadersCache(std::size_t capacity = 100);
 
+        /// Thread-safe as long as each index is requested by at most one thread at a time;
+        /// requesting an index that is already busy throws std::logic_error.
         BusyItem get(std::size_t index);
 
         void clear();
 
     private:
         const std::size_t mCapacity;
+        std::mutex mMutex;
         std::map<std::size_t, std::list<Item>::iterator> mIndex;
         std::list<Item> mBusyItems;
         std::list<Item> mFreeItems;
@@ -22,13 +22,19 @@
 #include <components/misc/strings/lower.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <exception>
 #include <filesystem>
+#include <iterator>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -205,12 +211,63 @@ namespace EsmLoader
             }
         }
 
+        void mergeCells(CellRecords& result, CellRecords&& added)
+        {
+            for (Record<ESM::Cell>& record : added.mValues)
+            {
+                std::size_t* index = nullptr;
+                if ((record.mValue.mData.mFlags & ESM::Cell::Interior) != 0)
+                {
+                    const auto it = result.mByName.find(record.mValue.mName);
+                    if (it == result.mByName.end())
+                        result.mByName.emplace_hint(it, record.mValue.mName, result.mValues.size());
+                    else
+                        index = &it->second;
+                }
+                else
+                {
+                    const std::pair<int, int> position(record.mValue.mData.mX, record.mValue.mData.mY);
+                    const auto it = result.mByPosition.find(position);
+                    if (it == result.mByPosition.end())
+                        result.mByPosition.emplace_hint(it, position, result.mValues.size());
+                    else
+                        index = &it->second;
+                }
+
+                if (index == nullptr)
+                {
+                    result.mValues.push_back(std::move(record));
+                    continue;
+                }
+
+                // The later file re-read the whole cell; keep the reference contexts accumulated
+                // in load order like the sequential loader does.
+                Record<ESM::Cell>& old = result.mValues[*index];
+                record.mValue.mContextList.insert(record.mValue.mContextList.begin(),
+                    old.mValue.mContextList.begin(), old.mValue.mContextList.end());
+                record.mDeleted = old.mDeleted;
+                old = std::move(record);
+            }
+        }
+
+        void merge(ShallowContent& result, ShallowContent&& added)
+        {
+            const auto append = [](auto& dst, auto& src) {
+                dst.insert(dst.end(), std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));
+            };
+            append(result.mActivators, added.mActivators);
+            mergeCells(result.mCells, std::move(added.mCells));
+            append(result.mContainers, added.mContainers);
+            append(result.mDoors, added.mDoors);
+            append(result.mGameSettings, added.mGameSettings);
+            append(result.mLands, added.mLands);
+            append(result.mStatics, added.mStatics);
+        }
+
         ShallowContent shallowLoad(const Query& query, const std::vector<std::string>& contentFiles,
             const Files::Collections& fileCollections, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder,
             Loading::Listener* listener)
         {
-            ShallowContent result;
-
             const std::set<std::string> supportedFormats{
                 ".esm",
                 ".esp",
@@ -219,6 +276,12 @@ namespace EsmLoader
                 ".project",
             };
 
+            // Resolve the collections and loadable file names up front: Files::Collections builds
+            // collections lazily, so this has to happen before any worker threads start. An empty
+            // name marks a file that is not loaded, matching resolveParentFileIndices().
+            std::vector<const Files::MultiDirCollection*> collections(contentFiles.size(), nullptr);
+            std::vector<std::string> loadableNames(contentFiles.size());
+            std::size_t loadableCount = 0;
             for (std::size_t i = 0; i < contentFiles.size(); ++i)
             {
                 const std::string& file = contentFiles[i];
@@ -231,24 +294,105 @@ namespace EsmLoader
                     continue;
                 }
 
-                if (listener != nullptr)
-                {
-                    listener->setLabel(file);
-                    listener->setProgressRange(fileProgress);
-                }
-
-                const Files::MultiDirCollection& collection = fileCollections.getCollection(extension);
+                collections[i] = &fileCollections.getCollection(extension);
+                loadableNames[i] = file;
+                ++loadableCount;
+            }
 
+            const auto loadFile = [&](std::size_t i, ShallowContent& content, Loading::Listener* fileListener) {
                 const ESM::ReadersCache::BusyItem reader = readers.get(i);
                 reader->setEncoder(encoder);
                 reader->setIndex(static_cast<int>(i));
-                reader->open(collection.getPath(file));
+                reader->open(collections[i]->getPath(contentFiles[i]));
                 if (query.mLoadCells)
-                    reader->resolveParentFileIndices(readers);
+                    reader->resolveParentFileIndices(loadableNames);
+
+                loadEsm(query, *reader, content, fileListener);
+            };
+
+            const std::size_t threadsCount
+                = std::min<std::size_t>(std::max<std::size_t>(std::thread::hardware_concurrency(), 1), loadableCount);
+
+            if (threadsCount <= 1)
+            {
+                ShallowContent result;
+                for (std::size_t i = 0; i < contentFiles.size(); ++i)
+                {
+                    if (collections[i] == nullptr)
+                        continue;
+                    if (listener != nullptr)
+                    {
+                        listener->setLabel(contentFiles[i]);
+                        listener->setProgressRange(fileProgress);
+                    }
+                    loadFile(i, result, listener);
+                }
+                return result;
+            }
 
-                loadEsm(query, *reader, result, listener);
+            // Read each file on its own thread into its own content, then merge in load order.
+            // The listener is driven from this thread only since it may render a loading screen.
+            std::vector<ShallowContent> fileContents(contentFiles.size());
+            std::atomic_size_t nextFile = 0;
+            std::mutex progressMutex;
+            std::condition_variable progressCv;
+            std::size_t completedFiles = 0;
+            std::string lastFile;
+            std::exception_ptr exception;
+            const auto worker = [&] {
+                for (std::size_t i = nextFile.fetch_add(1); i < contentFiles.size(); i = nextFile.fetch_add(1))
+                {
+                    if (collections[i] == nullptr)
+                        continue;
+                    bool failed = false;
+                    try
+                    {
+                        loadFile(i, fileContents[i], nullptr);
+                    }
+                    catch (...)
+                    {
+                        failed = true;
+                        const std::lock_guard lock(progressMutex);
+                        if (exception == nullptr)
+                            exception = std::current_exception();
+                    }
+                    {
+                        const std::lock_guard lock(progressMutex);
+                        ++completedFiles;
+                        lastFile = contentFiles[i];
+                    }
+                    progressCv.notify_one();
+                    if (failed)
+                        break;
+                }
+                progressCv.notify_one();
+            };
+            std::vector<std::thread> threads;
+            threads.reserve(threadsCount);
+            for (std::size_t i = 0; i < threadsCount; ++i)
+                threads.emplace_back(worker);
+            {
+                std::unique_lock lock(progressMutex);
+                if (listener != nullptr)
+                    listener->setProgressRange(fileProgress);
+                while (completedFiles < loadableCount && exception == nullptr)
+                {
+                    progressCv.wait(lock);
+                    if (listener != nullptr && completedFiles > 0)
+                    {
+                        listener->setLabel(lastFile);
+                        listener->setProgress(fileProgress * completedFiles / loadableCount);
+                    }
+                }
             }
+            for (std::thread& thread : threads)
+                thread.join();
+            if (exception != nullptr)
+                std::rethrow_exception(exception);
 
+            ShallowContent result;
+            for (ShallowContent& content : fileContents)
+                merge(result, std::move(content));
             return result;
         }
 
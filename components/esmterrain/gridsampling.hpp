@@ -3,11 +3,13 @@
 
 #include <components/misc/mathutil.hpp>
 
+#include <bit>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace ESMTerrain
@@ -15,7 +17,8 @@ namespace ESMTerrain
     inline std::pair<std::size_t, std::size_t> toCellAndLocal(
         std::size_t begin, std::size_t global, std::size_t cellSize)
     {
-        std::size_t cell = global / (cellSize - 1);
+        // cellSize - 1 is a power of two (asserted by the callers), so divide with a shift
+        std::size_t cell = global >> std::countr_zero(cellSize - 1);
         std::size_t local = global & (cellSize - 2);
         if (global != begin && local == 0)
         {
@@ -25,9 +28,11 @@ namespace ESMTerrain
         return { cell, local };
     }
 
-    template <class F>
+    /// \a sampleSize is either a std::size_t or a std::integral_constant carrying a compile-time
+    /// known sample size, letting the compiler strength-reduce and unroll the loops per LOD.
+    template <class SampleSize, class F>
     void sampleGrid(
-        std::size_t sampleSize, std::size_t beginX, std::size_t beginY, std::size_t endX, std::size_t endY, F&& f)
+        SampleSize sampleSize, std::size_t beginX, std::size_t beginY, std::size_t endX, std::size_t endY, F&& f)
     {
         std::size_t vertY = 0;
         for (std::size_t y = beginY; y < endY; y += sampleSize)
@@ -49,8 +54,8 @@ namespace ESMTerrain
         std::size_t mDstCol;
     };
 
-    template <class F>
-    void sampleCellGridSimple(std::size_t cellSize, std::size_t sampleSize, std::size_t beginX, std::size_t beginY,
+    template <class SampleSize, class F>
+    void sampleCellGridSimple(std::size_t cellSize, SampleSize sampleSize, std::size_t beginX, std::size_t beginY,
         std::size_t endX, std::size_t endY, F&& f)
     {
         assert(cellSize > 1);
@@ -65,19 +70,10 @@ namespace ESMTerrain
             });
     }
 
-    template <class F>
-    void sampleCellGrid(std::size_t cellSize, std::size_t sampleSize, std::size_t beginX, std::size_t beginY,
+    template <class SampleSize, class F>
+    void sampleCellGridImpl(std::size_t cellSize, SampleSize sampleSize, std::size_t beginX, std::size_t beginY,
         std::size_t distance, F&& f)
     {
-        if (cellSize < 2 || !Misc::isPowerOfTwo(cellSize - 1))
-            throw std::invalid_argument("Invalid cell size for cell grid sampling: " + std::to_string(cellSize));
-
-        if (sampleSize == 0 || !Misc::isPowerOfTwo(sampleSize))
-            throw std::invalid_argument("Invalid sample size for cell grid sampling: " + std::to_string(sampleSize));
-
-        if (distance < 2 || !Misc::isPowerOfTwo(distance - 1))
-            throw std::invalid_argument("Invalid count for cell grid sampling: " + std::to_string(distance));
-
         const std::size_t endX = beginX + distance;
         const std::size_t endY = beginY + distance;
 
@@ -127,6 +123,49 @@ namespace ESMTerrain
         }
     }
 
+    template <class F>
+    void sampleCellGrid(std::size_t cellSize, std::size_t sampleSize, std::size_t beginX, std::size_t beginY,
+        std::size_t distance, F&& f)
+    {
+        if (cellSize < 2 || !Misc::isPowerOfTwo(cellSize - 1))
+            throw std::invalid_argument("Invalid cell size for cell grid sampling: " + std::to_string(cellSize));
+
+        if (sampleSize == 0 || !Misc::isPowerOfTwo(sampleSize))
+            throw std::invalid_argument("Invalid sample size for cell grid sampling: " + std::to_string(sampleSize));
+
+        if (distance < 2 || !Misc::isPowerOfTwo(distance - 1))
+            throw std::invalid_argument("Invalid count for cell grid sampling: " + std::to_string(distance));
+
+        // Specialize the sampling loops at compile time for the power-of-two sample sizes
+        // terrain LOD actually uses (1 << lodLevel); anything else takes the generic loop.
+        switch (sampleSize)
+        {
+            case 1:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 1>{}, beginX, beginY, distance, std::forward<F>(f));
+            case 2:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 2>{}, beginX, beginY, distance, std::forward<F>(f));
+            case 4:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 4>{}, beginX, beginY, distance, std::forward<F>(f));
+            case 8:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 8>{}, beginX, beginY, distance, std::forward<F>(f));
+            case 16:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 16>{}, beginX, beginY, distance, std::forward<F>(f));
+            case 32:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 32>{}, beginX, beginY, distance, std::forward<F>(f));
+            case 64:
+                return sampleCellGridImpl(
+                    cellSize, std::integral_constant<std::size_t, 64>{}, beginX, beginY, distance, std::forward<F>(f));
+            default:
+                return sampleCellGridImpl(cellSize, sampleSize, beginX, beginY, distance, std::forward<F>(f));
+        }
+    }
+
     inline int getBlendmapSize(float size, int textureSize)
     {
         return static_cast<int>(textureSize * size) + 1;
@@ -258,6 +258,8 @@ namespace ESMTerrain
 
         const bool alteration = useAlteration();
         const int landSizeInUnits = ESM::getCellSize(worldspace);
+        const float chunkSizeInUnits = size * landSizeInUnits;
+        const float vertexStep = 1.f / (numVerts - 1);
         const osg::Vec2f origin = center - osg::Vec2f(size, size) * 0.5f;
         const int startCellX = static_cast<int>(std::floor(origin.x()));
         const int startCellY = static_cast<int>(std::floor(origin.y()));
@@ -311,9 +313,8 @@ namespace ESMTerrain
 
             const std::size_t vertIndex = vertX * numVerts + vertY;
 
-            positions[vertIndex]
-                = osg::Vec3f((vertX / static_cast<float>(numVerts - 1) - 0.5f) * size * landSizeInUnits,
-                    (vertY / static_cast<float>(numVerts - 1) - 0.5f) * size * landSizeInUnits, height);
+            positions[vertIndex] = osg::Vec3f(
+                (vertX * vertexStep - 0.5f) * chunkSizeInUnits, (vertY * vertexStep - 0.5f) * chunkSizeInUnits, height);
 
             const std::size_t srcArrayIndex = col * cellSize * 3 + row * 3;
 
@@ -360,7 +361,12 @@ namespace ESMTerrain
         const std::size_t beginY = static_cast<std::size_t>((origin.y() - startCellY) * cellSize);
         const std::size_t distance = static_cast<std::size_t>(size * (cellSize - 1)) + 1;
 
-        sampleCellGrid(cellSize, sampleSize, beginX, beginY, distance, handleSample);
+        // The vertex index is vertX * numVerts + vertY while sampleCellGrid keeps its second axis in
+        // the inner loop, which would write the output arrays with a stride of numVerts elements.
+        // Hand it the axes swapped so that consecutive samples write consecutive vertices instead.
+        sampleCellGrid(cellSize, sampleSize, beginY, beginX, distance,
+            [&](std::size_t cellShiftY, std::size_t cellShiftX, std::size_t col, std::size_t row, std::size_t vertY,
+                std::size_t vertX) { handleSample(cellShiftX, cellShiftY, row, col, vertX, vertY); });
 
         if (!validHeightDataExists && ESM::isEsm4Ext(worldspace))
             std::fill(positions.begin(), positions.end(), osg::Vec3f());
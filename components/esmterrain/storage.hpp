@@ -51,6 +51,8 @@ namespace ESMTerrain
 
         int getPlugin() const { return mData.getPlugin(); }
 
+        std::size_t getByteSize() const { return mData.getByteSize(); }
+
     private:
         ESM::LandData mData;
 
@@ -18,6 +18,12 @@ namespace Files
         if (start != 0)
             File::seek(mFile, start);
 
+        // Consumers of constrained streams (NIF parsing, BSA entries) read their region front to
+        // back in 8k chunks; telling the kernel about the whole region up front lets it fetch the
+        // data while the previous chunk is still being parsed, instead of blocking underflow() on
+        // the device every time.
+        File::readAhead(mFile, start, mSize);
+
         setg(nullptr, nullptr, nullptr);
     }
 
@@ -0,0 +1,135 @@
+#include "memorymappedstream.hpp"
+
+#include "memorystream.hpp"
+#include "streamwithbuffer.hpp"
+
+#include <cassert>
+#include <limits>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Files
+{
+#if defined(_WIN32)
+    std::shared_ptr<const MemoryMappedFile> tryMapFile(const std::filesystem::path& filename)
+    {
+        const HANDLE file = CreateFileW(
+            filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0
+            || static_cast<ULONGLONG>(size.QuadPart) > std::numeric_limits<std::size_t>::max())
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile);
+        result->mData = static_cast<const char*>(data);
+        result->mSize = static_cast<std::size_t>(size.QuadPart);
+        result->mFile = file;
+        result->mMapping = mapping;
+        return result;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (mData == nullptr)
+            return;
+        UnmapViewOfFile(mData);
+        CloseHandle(mMapping);
+        CloseHandle(mFile);
+    }
+#else
+    std::shared_ptr<const MemoryMappedFile> tryMapFile(const std::filesystem::path& filename)
+    {
+        const int file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file == -1)
+            return nullptr;
+
+        struct stat status;
+        if (::fstat(file, &status) == -1 || status.st_size <= 0)
+        {
+            ::close(file);
+            return nullptr;
+        }
+
+        void* data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        // The mapping keeps the file referenced, the descriptor is no longer needed.
+        ::close(file);
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile);
+        result->mData = static_cast<const char*>(data);
+        result->mSize = static_cast<std::size_t>(status.st_size);
+        return result;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (mData != nullptr)
+            ::munmap(const_cast<char*>(mData), mSize);
+    }
+#endif
+
+    namespace
+    {
+        class MemoryMappedViewBuf final : public MemBuf
+        {
+        public:
+            MemoryMappedViewBuf(std::shared_ptr<const MemoryMappedFile> file, std::size_t offset, std::size_t size)
+                : MemBuf(file->data() + offset, size)
+                , mFile(std::move(file))
+            {
+            }
+
+            MemoryMappedViewBuf(const MemoryMappedViewBuf&) = delete;
+            MemoryMappedViewBuf& operator=(const MemoryMappedViewBuf&) = delete;
+
+        private:
+            std::shared_ptr<const MemoryMappedFile> mFile;
+        };
+    }
+
+    IStreamPtr openMemoryMappedView(std::shared_ptr<const MemoryMappedFile> file, std::size_t offset, std::size_t size)
+    {
+        assert(file != nullptr);
+        assert(offset <= file->size() && size <= file->size() - offset);
+        return std::make_unique<StreamWithBuffer<MemoryMappedViewBuf>>(
+            std::make_unique<MemoryMappedViewBuf>(std::move(file), offset, size));
+    }
+
+    IStreamPtr tryOpenMemoryMappedStream(const std::filesystem::path& filename)
+    {
+        std::shared_ptr<const MemoryMappedFile> file = tryMapFile(filename);
+        if (file == nullptr)
+            return nullptr;
+        const std::size_t size = file->size();
+        return openMemoryMappedView(std::move(file), 0, size);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef OPENMW_COMPONENTS_FILES_MEMORYMAPPEDSTREAM_H
+#define OPENMW_COMPONENTS_FILES_MEMORYMAPPEDSTREAM_H
+
+#include "istreamptr.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+namespace Files
+{
+    /// A read-only memory mapping of a whole file. The mapping is released on destruction.
+    /// Multiple streams can share one mapping (see openMemoryMappedView), so the OS page
+    /// cache backs all of them without per-stream buffers.
+    class MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        ~MemoryMappedFile();
+
+        const char* data() const { return mData; }
+
+        std::size_t size() const { return mSize; }
+
+    private:
+        friend std::shared_ptr<const MemoryMappedFile> tryMapFile(const std::filesystem::path& filename);
+
+        MemoryMappedFile() = default;
+
+        const char* mData = nullptr;
+        std::size_t mSize = 0;
+#if defined(_WIN32)
+        void* mFile = nullptr; // HANDLE
+        void* mMapping = nullptr; // HANDLE
+#endif
+    };
+
+    /// Map the whole file read-only.
+    /// \return nullptr if the file cannot be mapped (e.g. it is empty or the platform does not
+    /// support mapping); callers are expected to fall back to buffered streams.
+    std::shared_ptr<const MemoryMappedFile> tryMapFile(const std::filesystem::path& filename);
+
+    /// Open a zero-copy stream over [offset, offset + size) of the given mapping.
+    /// The stream keeps the mapping alive. The range must lie within the mapping.
+    IStreamPtr openMemoryMappedView(std::shared_ptr<const MemoryMappedFile> file, std::size_t offset, std::size_t size);
+
+    /// Open a read-only stream backed by a memory mapping of the whole file, so reads are served
+    /// directly from the page cache without intermediate buffering or read syscalls.
+    /// \return nullptr if the file cannot be mapped (e.g. it is empty or the platform does not
+    /// support mapping); callers are expected to fall back to a buffered stream.
+    IStreamPtr tryOpenMemoryMappedStream(const std::filesystem::path& filename);
+}
+
+#endif
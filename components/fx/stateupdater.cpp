@@ -19,6 +19,9 @@ namespace fx
         if (mUseUBO)
         {
             osg::ref_ptr<osg::UniformBufferObject> ubo = new osg::UniformBufferObject;
+            // Rewritten every frame, don't let the driver place it as static data. The per-frame
+            // stateset rotation of StateSetUpdater already keeps one buffer per frame in flight.
+            ubo->setUsage(GL_STREAM_DRAW);
 
             osg::ref_ptr<osg::BufferTemplate<UniformData::BufferType>> data
                 = new osg::BufferTemplate<UniformData::BufferType>();
@@ -69,6 +69,7 @@ namespace fx
         mTextures.clear();
         mStatus = Status::Uncompiled;
         mValid = false;
+        mPassesCompiled = false;
         mHDR = false;
         mNormals = false;
         mLights = false;
@@ -155,8 +156,6 @@ namespace fx
                     mGLSLExtensions.insert("GL_EXT_texture_array");
                 }
 
-                it->second->compile(*this, mShared);
-
                 if (!it->second->mTarget.empty())
                 {
                     auto rtIt = mRenderTargets.find(it->second->mTarget);
@@ -185,6 +184,31 @@ namespace fx
         return mValid;
     }
 
+    bool Technique::compilePasses()
+    {
+        if (mPassesCompiled || !mValid)
+            return mValid;
+
+        try
+        {
+            for (const auto& pass : mPasses)
+                pass->compile(*this, mShared);
+
+            mPassesCompiled = true;
+        }
+        catch (const std::runtime_error& e)
+        {
+            clear();
+            mStatus = Status::Parse_Error;
+
+            mLastError = "Failed parsing technique '" + getName() + "' " + e.what();
+
+            Log(Debug::Error) << mLastError;
+        }
+
+        return mValid;
+    }
+
     std::string Technique::getName() const
     {
         return mName;
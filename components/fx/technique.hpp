@@ -44,8 +44,23 @@ namespace fx
         {
             mPasses.reserve(other.mPasses.size());
 
-            for (const auto& subpass : other.mPasses)
-                mPasses.emplace_back(subpass, copyOp);
+            for (size_t i = 0; i < other.mPasses.size(); ++i)
+            {
+                mPasses.emplace_back(other.mPasses[i], copyOp);
+
+                // passes rendering to the same target share one framebuffer, keep that sharing intact
+                if (!other.mPasses[i].mRenderTarget)
+                    continue;
+
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (other.mPasses[j].mRenderTarget == other.mPasses[i].mRenderTarget)
+                    {
+                        mPasses[i].mRenderTarget = mPasses[j].mRenderTarget;
+                        break;
+                    }
+                }
+            }
         }
 
         struct SubPass
@@ -128,6 +143,10 @@ namespace fx
 
         bool compile();
 
+        /// Assembles the GLSL sources of all passes. Deferred from compile() so techniques that are
+        /// merely browsed in the HUD stay parse-only; must be called before the passes are used.
+        bool compilePasses();
+
         std::string getName() const;
 
         const VFS::Path::Normalized& getFileName() const { return mFilePath; }
@@ -277,6 +296,7 @@ namespace fx
 
         std::filesystem::file_time_type mLastModificationTime;
         bool mValid;
+        bool mPassesCompiled = false;
         bool mHDR;
         bool mNormals;
         bool mLights;
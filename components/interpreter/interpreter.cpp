@@ -32,8 +32,23 @@ namespace Interpreter
         return it->second;
     }
 
-    void Interpreter::execute(Type_Code code)
+    // Direct-indexed segments; the decoded opcode is guaranteed to be within the fixed field
+    // width by the caller.
+    template <class Opcode, std::size_t size>
+    auto& getDispatcher(const std::array<std::unique_ptr<Opcode>, size>& segment, unsigned int seg, int opcode)
     {
+        const auto& dispatcher = segment[static_cast<std::size_t>(opcode)];
+        if (dispatcher == nullptr)
+        {
+            abortUnknownCode(seg, opcode);
+        }
+        return dispatcher;
+    }
+
+    Interpreter::ThreadedInstruction Interpreter::translate(Type_Code code) const
+    {
+        ThreadedInstruction instruction;
+
         unsigned int segSpec = code >> 30;
 
         switch (segSpec)
@@ -41,17 +56,17 @@ namespace Interpreter
             case 0:
             {
                 const int opcode = code >> 24;
-                const unsigned int arg0 = code & 0xffffff;
-
-                return getDispatcher(mSegment0, 0, opcode)->execute(mRuntime, arg0);
+                instruction.mOpcode1 = getDispatcher(mSegment0, 0, opcode).get();
+                instruction.mArg0 = code & 0xffffff;
+                return instruction;
             }
 
             case 2:
             {
                 const int opcode = (code >> 20) & 0x3ff;
-                const unsigned int arg0 = code & 0xfffff;
-
-                return getDispatcher(mSegment2, 2, opcode)->execute(mRuntime, arg0);
+                instruction.mOpcode1 = getDispatcher(mSegment2, 2, opcode).get();
+                instruction.mArg0 = code & 0xfffff;
+                return instruction;
             }
         }
 
@@ -62,22 +77,37 @@ namespace Interpreter
             case 0x30:
             {
                 const int opcode = (code >> 8) & 0x3ffff;
-                const unsigned int arg0 = code & 0xff;
-
-                return getDispatcher(mSegment3, 3, opcode)->execute(mRuntime, arg0);
+                instruction.mOpcode1 = getDispatcher(mSegment3, 3, opcode).get();
+                instruction.mArg0 = code & 0xff;
+                return instruction;
             }
 
             case 0x32:
             {
                 const int opcode = code & 0x3ffffff;
-
-                return getDispatcher(mSegment5, 5, opcode)->execute(mRuntime);
+                instruction.mOpcode0 = getDispatcher(mSegment5, 5, opcode).get();
+                return instruction;
             }
         }
 
         abortUnknownSegment(code);
     }
 
+    const std::vector<Interpreter::ThreadedInstruction>& Interpreter::getThreaded(const Program& program)
+    {
+        std::vector<ThreadedInstruction>& threaded = mThreadedPrograms[&program];
+
+        if (threaded.size() != program.mInstructions.size())
+        {
+            threaded.clear();
+            threaded.reserve(program.mInstructions.size());
+            for (const Type_Code code : program.mInstructions)
+                threaded.push_back(translate(code));
+        }
+
+        return threaded;
+    }
+
     void Interpreter::begin()
     {
         if (mRunning)
@@ -111,13 +141,20 @@ namespace Interpreter
 
         try
         {
+            // Translated programs are cached, so recursive runs of the same program reuse
+            // the existing entry and the reference stays valid across nested calls.
+            const std::vector<ThreadedInstruction>& threaded = getThreaded(program);
+
             mRuntime.configure(program, context);
 
-            while (mRuntime.getPC() >= 0 && static_cast<std::size_t>(mRuntime.getPC()) < program.mInstructions.size())
+            while (mRuntime.getPC() >= 0 && static_cast<std::size_t>(mRuntime.getPC()) < threaded.size())
             {
-                const Type_Code instruction = program.mInstructions[mRuntime.getPC()];
+                const ThreadedInstruction& instruction = threaded[mRuntime.getPC()];
                 mRuntime.setPC(mRuntime.getPC() + 1);
-                execute(instruction);
+                if (instruction.mOpcode1 != nullptr)
+                    instruction.mOpcode1->execute(mRuntime, instruction.mArg0);
+                else
+                    instruction.mOpcode0->execute(mRuntime);
             }
         }
         catch (...)
@@ -1,11 +1,14 @@
 #ifndef INTERPRETER_INTERPRETER_H_INCLUDED
 #define INTERPRETER_INTERPRETER_H_INCLUDED
 
+#include <array>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <stack>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <components/misc/strings/format.hpp>
 
@@ -20,15 +23,36 @@ namespace Interpreter
 
     class Interpreter
     {
+        /// A pre-decoded instruction: the dispatcher resolved from the segment tables plus
+        /// the immediate argument extracted from the code word. Exactly one of the two
+        /// opcode pointers is set.
+        struct ThreadedInstruction
+        {
+            Opcode1* mOpcode1 = nullptr;
+            Opcode0* mOpcode0 = nullptr;
+            unsigned int mArg0 = 0;
+        };
+
         std::stack<Runtime> mCallstack;
         bool mRunning = false;
         Runtime mRuntime;
-        std::map<int, std::unique_ptr<Opcode1>> mSegment0;
-        std::map<int, std::unique_ptr<Opcode1>> mSegment2;
+        // Segments 0 and 2 have fixed 6 and 10 bit opcode fields, so their tables are
+        // direct-indexed by opcode. Segments 3 and 5 use 18 and 26 bit codes and are far too
+        // sparse for that; they stay maps, which only matters during translation anyway.
+        std::array<std::unique_ptr<Opcode1>, 64> mSegment0;
+        std::array<std::unique_ptr<Opcode1>, 1024> mSegment2;
         std::map<int, std::unique_ptr<Opcode1>> mSegment3;
         std::map<int, std::unique_ptr<Opcode0>> mSegment5;
 
-        void execute(Type_Code code);
+        // Programs translated to threaded form, keyed by address. Compiled scripts are
+        // owned by the script manager and are neither replaced nor destroyed while the
+        // interpreter is alive; short-lived interpreters (console, dialogue) do not
+        // outlive their programs.
+        std::map<const Program*, std::vector<ThreadedInstruction>> mThreadedPrograms;
+
+        ThreadedInstruction translate(Type_Code code) const;
+
+        const std::vector<ThreadedInstruction>& getThreaded(const Program& program);
 
         void begin();
 
@@ -43,6 +67,19 @@ namespace Interpreter
             segment.emplace(code, std::make_unique<T>(std::forward<Args>(args)...));
         }
 
+        template <typename T, class Opcode, std::size_t size, typename... Args>
+        void installSegment(
+            std::array<std::unique_ptr<Opcode>, size>& segment, std::string_view name, int code, Args&&... args)
+        {
+            if (code < 0 || static_cast<std::size_t>(code) >= size)
+                throw std::invalid_argument(Misc::StringUtils::format(
+                    "Interpreter instruction code does not fit into segment %s: 0x%x", name, code));
+            if (segment[static_cast<std::size_t>(code)] != nullptr)
+                throw std::invalid_argument(Misc::StringUtils::format(
+                    "Duplicated interpreter instruction code in segment %s: 0x%x", name, code));
+            segment[static_cast<std::size_t>(code)] = std::make_unique<T>(std::forward<Args>(args)...);
+        }
+
     public:
         Interpreter() = default;
 
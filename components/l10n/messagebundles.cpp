@@ -17,6 +17,11 @@ namespace l10n
 
     void MessageBundles::setPreferredLocales(const std::vector<icu::Locale>& preferredLocales)
     {
+        {
+            // Cached default messages were parsed with the old default locale.
+            std::lock_guard<std::mutex> lock(mDefaultMessagesMutex);
+            mDefaultMessages.clear();
+        }
         mPreferredLocales.clear();
         mPreferredLocaleStrings.clear();
         for (const icu::Locale& loc : preferredLocales)
@@ -75,6 +80,12 @@ namespace l10n
         {
             const auto key = it.first.as<std::string>();
             const auto value = it.second.as<std::string>();
+            // Without arguments or quoting the pattern formats to itself, so parsing it is not needed.
+            if (value.find('{') == std::string::npos && value.find('\'') == std::string::npos)
+            {
+                mBundles[localeName].insert(std::make_pair(key, Message{ std::nullopt, value }));
+                continue;
+            }
             icu::UnicodeString pattern
                 = icu::UnicodeString::fromUTF8(icu::StringPiece(value.data(), static_cast<std::int32_t>(value.size())));
             icu::ErrorCode status;
@@ -83,12 +94,12 @@ namespace l10n
             if (checkSuccess(status, std::string("Failed to create message ") + key + " for locale " + lang.getName(),
                     parseError))
             {
-                mBundles[localeName].insert(std::make_pair(key, message));
+                mBundles[localeName].insert(std::make_pair(key, Message{ std::move(message), std::string() }));
             }
         }
     }
 
-    const icu::MessageFormat* MessageBundles::findMessage(std::string_view key, const std::string& localeName) const
+    const MessageBundles::Message* MessageBundles::findMessage(std::string_view key, const std::string& localeName) const
     {
         auto iter = mBundles.find(localeName);
         if (iter != mBundles.end())
@@ -117,13 +128,8 @@ namespace l10n
     }
 
     static std::string loadGmst(
-        const std::function<std::string(std::string_view)> gmstLoader, const icu::MessageFormat* message)
+        const std::function<std::string(std::string_view)>& gmstLoader, const std::string& gmstName)
     {
-        icu::UnicodeString gmstNameUnicode;
-        std::string gmstName;
-        icu::ErrorCode success;
-        message->format(nullptr, nullptr, 0, gmstNameUnicode, success);
-        gmstNameUnicode.toUTF8String(gmstName);
         if (gmstLoader)
             return gmstLoader(gmstName);
         else
@@ -137,14 +143,22 @@ namespace l10n
         std::string resultString;
         icu::ErrorCode success;
 
-        const icu::MessageFormat* message = nullptr;
+        const Message* message = nullptr;
         for (auto& loc : mPreferredLocaleStrings)
         {
             message = findMessage(key, loc);
             if (message)
             {
                 if (loc == "gmst")
-                    return loadGmst(mGmstLoader, message);
+                {
+                    if (!message->mFormat)
+                        return loadGmst(mGmstLoader, message->mPlainText);
+                    icu::UnicodeString gmstNameUnicode;
+                    std::string gmstName;
+                    message->mFormat->format(nullptr, nullptr, 0, gmstNameUnicode, success);
+                    gmstNameUnicode.toUTF8String(gmstName);
+                    return loadGmst(mGmstLoader, gmstName);
+                }
                 break;
             }
         }
@@ -154,27 +168,44 @@ namespace l10n
 
         if (message)
         {
+            if (!message->mFormat)
+                return message->mPlainText;
             if (!args.empty() && !argNames.empty())
-                message->format(argNames.data(), args.data(), static_cast<std::int32_t>(args.size()), result, success);
+                message->mFormat->format(
+                    argNames.data(), args.data(), static_cast<std::int32_t>(args.size()), result, success);
             else
-                message->format(nullptr, nullptr, static_cast<std::int32_t>(args.size()), result, success);
+                message->mFormat->format(nullptr, nullptr, static_cast<std::int32_t>(args.size()), result, success);
             checkSuccess(success, std::string("Failed to format message ") + key.data());
             result.toUTF8String(resultString);
             return resultString;
         }
+
+        // The key itself is used as the pattern. Without arguments or quoting it formats to itself.
+        if (key.find('{') == std::string_view::npos && key.find('\'') == std::string_view::npos)
+            return std::string(key);
+
         icu::Locale defaultLocale(nullptr);
         if (!mPreferredLocales.empty())
         {
             defaultLocale = mPreferredLocales[0];
         }
-        UParseError parseError;
-        icu::MessageFormat defaultMessage(
-            icu::UnicodeString::fromUTF8(icu::StringPiece(key.data(), static_cast<std::int32_t>(key.size()))),
-            defaultLocale, parseError, success);
-        if (!checkSuccess(success, std::string("Failed to create message ") + key.data(), parseError))
-            // If we can't parse the key as a pattern, just return the key
-            return std::string(key);
+        // Parsing the key as a pattern is expensive, so the result is cached. The same cache entry
+        // is reused for all argument values; only the set of known keys grows over time.
+        std::lock_guard<std::mutex> lock(mDefaultMessagesMutex);
+        auto defaultIt = mDefaultMessages.find(std::string(key));
+        if (defaultIt == mDefaultMessages.end())
+        {
+            UParseError parseError;
+            icu::MessageFormat defaultMessage(
+                icu::UnicodeString::fromUTF8(icu::StringPiece(key.data(), static_cast<std::int32_t>(key.size()))),
+                defaultLocale, parseError, success);
+            if (!checkSuccess(success, std::string("Failed to create message ") + key.data(), parseError))
+                // If we can't parse the key as a pattern, just return the key
+                return std::string(key);
+            defaultIt = mDefaultMessages.emplace(std::string(key), defaultMessage).first;
+        }
 
+        const icu::MessageFormat& defaultMessage = defaultIt->second;
         if (!args.empty() && !argNames.empty())
             defaultMessage.format(
                 argNames.data(), args.data(), static_cast<std::int32_t>(args.size()), result, success);
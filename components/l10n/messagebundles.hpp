@@ -3,6 +3,8 @@
 
 #include <functional>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
@@ -46,13 +48,25 @@ namespace l10n
         void setGmstLoader(std::function<std::string(std::string_view)> fn) { mGmstLoader = std::move(fn); }
 
     private:
+        // Messages without arguments or quoting always format to themselves, so for them only
+        // the text is stored and ICU is skipped entirely when formatting.
+        struct Message
+        {
+            std::optional<icu::MessageFormat> mFormat;
+            std::string mPlainText;
+        };
+
         // icu::Locale isn't hashable (or comparable), so we use the string form instead, which is canonicalized
-        std::unordered_map<std::string, std::unordered_map<std::string, icu::MessageFormat>> mBundles;
+        std::unordered_map<std::string, std::unordered_map<std::string, Message>> mBundles;
         const icu::Locale mFallbackLocale;
         std::vector<std::string> mPreferredLocaleStrings;
         std::vector<icu::Locale> mPreferredLocales;
         std::function<std::string(std::string_view)> mGmstLoader;
-        const icu::MessageFormat* findMessage(std::string_view key, const std::string& localeName) const;
+        // Keys that were not found in any bundle and had to be parsed as patterns themselves.
+        // Cleared when the preferred locales change.
+        mutable std::mutex mDefaultMessagesMutex;
+        mutable std::unordered_map<std::string, icu::MessageFormat> mDefaultMessages;
+        const Message* findMessage(std::string_view key, const std::string& localeName) const;
     };
 
 }
@@ -4,6 +4,8 @@
 #include <luajit.h>
 #endif // NO_LUAJIT
 
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
@@ -66,6 +68,8 @@ namespace LuaUtil
             return;
         const ScriptId& activeScript = self->mActiveScriptIdStack.back();
         activeScript.mContainer->addInstructionCount(activeScript.mIndex, countHookStep);
+        if (self->mStackSamplingEnabled)
+            self->sampleStack(L);
         self->mWatchdogInstructionCounter += countHookStep;
         if (self->mSettings.mInstructionLimit > 0
             && self->mWatchdogInstructionCounter > self->mSettings.mInstructionLimit)
@@ -77,6 +81,133 @@ namespace LuaUtil
         }
     }
 
+    void LuaState::sampleStack(lua_State* L)
+    {
+        constexpr int maxDepth = 64;
+        lua_Debug ar;
+        int depth = 0;
+        while (depth < maxDepth && lua_getstack(L, depth, &ar))
+            depth++;
+        std::string stack;
+        // Root frame first: the collapsed stack format expected by flamegraph tools.
+        for (int i = depth - 1; i >= 0; --i)
+        {
+            if (lua_getstack(L, i, &ar) == 0 || lua_getinfo(L, "Sn", &ar) == 0)
+                continue;
+            if (!stack.empty())
+                stack += ';';
+            if (ar.name != nullptr && *ar.name != '\0')
+                stack += ar.name;
+            else if (ar.what != nullptr && std::strcmp(ar.what, "main") == 0)
+                stack += "main_chunk";
+            else
+                stack += "anonymous";
+            stack += '@';
+            stack += ar.short_src;
+            if (ar.linedefined > 0)
+            {
+                stack += ':';
+                stack += std::to_string(ar.linedefined);
+            }
+        }
+        // The hook fires once per countHookStep instructions, so weight the sample accordingly.
+        mSampledStacks[std::move(stack)] += countHookStep;
+    }
+
+    std::string LuaState::formatSampledStacks() const
+    {
+        // Sorted for deterministic output; the string_view keys point into mSampledStacks.
+        std::map<std::string_view, uint64_t> sorted(mSampledStacks.begin(), mSampledStacks.end());
+        std::string out;
+        for (const auto& [stack, count] : sorted)
+        {
+            out += stack;
+            out += ' ';
+            out += std::to_string(count);
+            out += '\n';
+        }
+        return out;
+    }
+
+    LuaState::SmallAllocPool::~SmallAllocPool()
+    {
+        for (void* block : mBlocks)
+            free(block);
+    }
+
+    void* LuaState::SmallAllocPool::allocate(size_t size)
+    {
+        const size_t index = sizeClass(size) - 1;
+        if (FreeNode* node = mFreeLists[index])
+        {
+            mFreeLists[index] = node->mNext;
+            return node;
+        }
+        const size_t classSize = (index + 1) * sAlignment;
+        if (mRemaining < classSize)
+        {
+            void* block = malloc(sBlockSize);
+            if (!block)
+                return nullptr;
+            mBlocks.push_back(block);
+            mCursor = static_cast<char*>(block);
+            mRemaining = sBlockSize;
+            mReserved += sBlockSize;
+        }
+        void* result = mCursor;
+        mCursor += classSize;
+        mRemaining -= classSize;
+        return result;
+    }
+
+    void LuaState::SmallAllocPool::deallocate(void* ptr, size_t size)
+    {
+        const size_t index = sizeClass(size) - 1;
+        FreeNode* node = static_cast<FreeNode*>(ptr);
+        node->mNext = mFreeLists[index];
+        mFreeLists[index] = node;
+    }
+
+    void* LuaState::reallocImpl(void* ptr, size_t osize, size_t nsize)
+    {
+        if (nsize == 0)
+        {
+            if (ptr)
+            {
+                if (osize <= SmallAllocPool::sMaxSize)
+                    mPool.deallocate(ptr, osize);
+                else
+                    free(ptr);
+            }
+            return nullptr;
+        }
+        const bool newPooled = nsize <= SmallAllocPool::sMaxSize;
+        if (!ptr)
+            return newPooled ? mPool.allocate(nsize) : malloc(nsize);
+        const bool oldPooled = osize <= SmallAllocPool::sMaxSize;
+        if (!oldPooled && !newPooled)
+            return realloc(ptr, nsize);
+        if (oldPooled && newPooled && SmallAllocPool::sizeClass(osize) == SmallAllocPool::sizeClass(nsize))
+            return ptr;
+        void* newPtr = newPooled ? mPool.allocate(nsize) : malloc(nsize);
+        if (!newPtr)
+            return nullptr;
+        std::memcpy(newPtr, ptr, std::min(osize, nsize));
+        if (oldPooled)
+            mPool.deallocate(ptr, osize);
+        else
+            free(ptr);
+        return newPtr;
+    }
+
+    void* LuaState::plainAllocator(void* ud, void* ptr, size_t osize, size_t nsize)
+    {
+        LuaState* self = static_cast<LuaState*>(ud);
+        if (!ptr)
+            osize = 0;
+        return self->reallocImpl(ptr, osize, nsize);
+    }
+
     void* LuaState::trackingAllocator(void* ud, void* ptr, size_t osize, size_t nsize)
     {
         LuaState* self = static_cast<LuaState*>(ud);
@@ -84,7 +215,19 @@ namespace LuaUtil
         const uint64_t memoryLimit = self->mSettings.mMemoryLimit;
 
         if (!ptr)
+        {
             osize = 0;
+            if (nsize > 0 && !self->mActiveScriptIdStack.empty())
+            {
+                const ScriptId& activeScript = self->mActiveScriptIdStack.back();
+                if (activeScript.mIndex >= 0)
+                {
+                    if (static_cast<size_t>(activeScript.mIndex) >= self->mAllocationCount.size())
+                        self->mAllocationCount.resize(activeScript.mIndex + 1);
+                    ++self->mAllocationCount[activeScript.mIndex];
+                }
+            }
+        }
         int64_t smallAllocDelta = 0, bigAllocDelta = 0;
         if (osize <= smallAllocSize)
             smallAllocDelta -= osize;
@@ -104,11 +247,7 @@ namespace LuaUtil
         self->mTotalMemoryUsage += smallAllocDelta + bigAllocDelta;
         self->mSmallAllocMemoryUsage += smallAllocDelta;
 
-        void* newPtr = nullptr;
-        if (nsize == 0)
-            free(ptr);
-        else
-            newPtr = realloc(ptr, nsize);
+        void* newPtr = self->reallocImpl(ptr, osize, nsize);
 
         if (bigAllocDelta != 0)
         {
@@ -160,7 +299,11 @@ namespace LuaUtil
             }
         }
         Log(Debug::Info) << "Initializing LuaUtil::LuaState without profiler";
-        lua_State* L = luaL_newstate();
+        lua_State* L = lua_newstate(&plainAllocator, luaState);
+        if (L)
+            return L;
+        // Some Lua builds reject a custom allocator; fall back to the default one.
+        L = luaL_newstate();
         if (!L)
             throw std::runtime_error("Can't create Lua runtime");
         return L;
@@ -1,9 +1,11 @@
 #ifndef COMPONENTS_LUA_LUASTATE_H
 #define COMPONENTS_LUA_LUASTATE_H
 
+#include <array>
 #include <filesystem>
 #include <map>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <sol/sol.hpp>
 
@@ -109,6 +111,11 @@ namespace LuaUtil
         {
             return id < mMemoryUsage.size() ? mMemoryUsage[id] : 0;
         }
+        uint64_t getAllocationCountByScriptIndex(unsigned id) const
+        {
+            return id < mAllocationCount.size() ? mAllocationCount[id] : 0;
+        }
+        uint64_t getSmallAllocPoolReservedMemory() const { return mPool.getReservedMemory(); }
 
         const LuaStateSettings& getSettings() const { return mSettings; }
 
@@ -116,6 +123,16 @@ namespace LuaUtil
         static void disableProfiler() { sProfilerEnabled = false; }
         static bool isProfilerEnabled() { return sProfilerEnabled; }
 
+        // Opt-in stack sampling on top of the profiler instruction hook: every time the hook
+        // fires the current Lua call stack is aggregated. Has no effect if the profiler is disabled.
+        void setStackSamplingEnabled(bool enable) { mStackSamplingEnabled = enable; }
+        bool isStackSamplingEnabled() const { return mStackSamplingEnabled; }
+        void clearSampledStacks() { mSampledStacks.clear(); }
+        // Returns the aggregated samples in the collapsed stack format understood by flamegraph
+        // tools: one "frame;frame;...;frame count" line per distinct stack, root frame first.
+        // Counts are numbers of executed Lua instructions.
+        std::string formatSampledStacks() const;
+
         static sol::protected_function_result throwIfError(sol::protected_function_result&&);
 
     private:
@@ -127,10 +144,47 @@ namespace LuaUtil
 
         sol::function loadScriptAndCache(const std::string& path);
         static void countHook(lua_State* L, lua_Debug* ar);
+        void sampleStack(lua_State* L);
         static void* trackingAllocator(void* ud, void* ptr, size_t osize, size_t nsize);
+        static void* plainAllocator(void* ud, void* ptr, size_t osize, size_t nsize);
+
+        void* reallocImpl(void* ptr, size_t osize, size_t nsize);
 
         lua_State* createLuaRuntime(LuaState* luaState);
 
+        // Pools small Lua allocations in per-size-class free lists carved from larger arena
+        // blocks, so the constant churn of tiny GC-managed objects doesn't fragment the
+        // process heap. Blocks are only returned to the system when the state dies.
+        class SmallAllocPool
+        {
+        public:
+            static constexpr size_t sMaxSize = 256;
+
+            static constexpr size_t sizeClass(size_t size) { return (size + sAlignment - 1) / sAlignment; }
+
+            ~SmallAllocPool();
+
+            void* allocate(size_t size);
+            void deallocate(void* ptr, size_t size);
+
+            uint64_t getReservedMemory() const { return mReserved; }
+
+        private:
+            static constexpr size_t sAlignment = 16;
+            static constexpr size_t sBlockSize = 64 * 1024;
+
+            struct FreeNode
+            {
+                FreeNode* mNext;
+            };
+
+            std::array<FreeNode*, sMaxSize / sAlignment> mFreeLists{};
+            std::vector<void*> mBlocks;
+            char* mCursor = nullptr;
+            size_t mRemaining = 0;
+            uint64_t mReserved = 0;
+        };
+
         struct AllocOwner
         {
             std::shared_ptr<ScriptsContainer*> mContainer;
@@ -146,6 +200,10 @@ namespace LuaUtil
         uint64_t mTotalMemoryUsage = 0;
         uint64_t mSmallAllocMemoryUsage = 0;
         std::vector<int64_t> mMemoryUsage;
+        std::vector<uint64_t> mAllocationCount;
+        bool mStackSamplingEnabled = false;
+        std::unordered_map<std::string, uint64_t> mSampledStacks;
+        SmallAllocPool mPool; // must outlive mLuaHolder; the state frees into it on close
 
         class LuaStateHolder
         {
@@ -1,5 +1,8 @@
 #include "serialization.hpp"
 
+#include <unordered_map>
+#include <vector>
+
 #include <osg/Matrixf>
 #include <osg/Quat>
 #include <osg/Vec2f>
@@ -15,7 +18,9 @@
 namespace LuaUtil
 {
 
-    constexpr unsigned char FORMAT_VERSION = 0;
+    // Version 1 adds STRING_REF: a back-reference to an already written string, so repeated
+    // table keys are stored only once. Version 0 data (without back-references) is still readable.
+    constexpr unsigned char FORMAT_VERSION = 1;
 
     enum class SerializedType : char
     {
@@ -24,6 +29,7 @@ namespace LuaUtil
         BOOLEAN = 0x2,
         TABLE_START = 0x3,
         TABLE_END = 0x4,
+        STRING_REF = 0x5,
 
         VEC2 = 0x10,
         VEC3 = 0x11,
@@ -34,6 +40,11 @@ namespace LuaUtil
 
         // All values should be lesser than 0x20 (SHORT_STRING_FLAG).
     };
+
+    // Strings of at least this size are assigned an id when first written; later occurrences
+    // are stored as STRING_REF + 16-bit id (3 bytes). Shorter strings are cheaper to store inline.
+    constexpr size_t MIN_INTERNED_STRING_SIZE = 4;
+    constexpr size_t MAX_INTERNED_STRINGS = 1 << 16;
     constexpr unsigned char SHORT_STRING_FLAG = 0x20; // 0b001SSSSS. SSSSS = string length
     constexpr unsigned char CUSTOM_FULL_FLAG = 0x40; // 0b01TTTTTT + 32bit dataSize
     constexpr unsigned char CUSTOM_COMPACT_FLAG = 0x80; // 0b1SSSSTTT. SSSS = dataSize, TTT = (typeName size - 1)
@@ -61,8 +72,23 @@ namespace LuaUtil
         return Misc::fromLittleEndian(v);
     }
 
-    static void appendString(BinaryData& out, std::string_view str)
+    static void appendString(
+        BinaryData& out, std::unordered_map<std::string_view, uint16_t>& internedStrings, std::string_view str)
     {
+        if (str.size() >= MIN_INTERNED_STRING_SIZE)
+        {
+            const auto it = internedStrings.find(str);
+            if (it != internedStrings.end())
+            {
+                appendType(out, SerializedType::STRING_REF);
+                appendValue<uint16_t>(out, it->second);
+                return;
+            }
+            // The string_view points into a Lua string that is referenced by the serialized
+            // object, so it stays valid for the duration of the serialization.
+            if (internedStrings.size() < MAX_INTERNED_STRINGS)
+                internedStrings.emplace(str, static_cast<uint16_t>(internedStrings.size()));
+        }
         if (str.size() < 32)
             out.push_back(SHORT_STRING_FLAG | char(str.size()));
         else
@@ -195,8 +221,8 @@ namespace LuaUtil
             throw std::runtime_error("Value is not serializable.");
     }
 
-    static void serialize(
-        BinaryData& out, const sol::object& obj, const UserdataSerializer* customSerializer, int recursionCounter)
+    static void serialize(BinaryData& out, std::unordered_map<std::string_view, uint16_t>& internedStrings,
+        const sol::object& obj, const UserdataSerializer* customSerializer, int recursionCounter)
     {
         if (obj.get_type() == sol::type::lightuserdata)
             throw std::runtime_error("Light userdata is not allowed to be serialized.");
@@ -213,8 +239,8 @@ namespace LuaUtil
             appendType(out, SerializedType::TABLE_START);
             for (auto& [key, value] : table)
             {
-                serialize(out, key, customSerializer, recursionCounter + 1);
-                serialize(out, value, customSerializer, recursionCounter + 1);
+                serialize(out, internedStrings, key, customSerializer, recursionCounter + 1);
+                serialize(out, internedStrings, value, customSerializer, recursionCounter + 1);
             }
             appendType(out, SerializedType::TABLE_END);
         }
@@ -224,7 +250,7 @@ namespace LuaUtil
             appendValue<double>(out, obj.as<double>());
         }
         else if (obj.is<std::string_view>())
-            appendString(out, obj.as<std::string_view>());
+            appendString(out, internedStrings, obj.as<std::string_view>());
         else if (obj.is<bool>())
         {
             char v = obj.as<bool>() ? 1 : 0;
@@ -235,8 +261,8 @@ namespace LuaUtil
             throw std::runtime_error("Unknown Lua type.");
     }
 
-    static void deserializeImpl(
-        lua_State* lua, std::string_view& binaryData, const UserdataSerializer* customSerializer, bool readOnly)
+    static void deserializeImpl(lua_State* lua, std::string_view& binaryData,
+        std::vector<std::string_view>& internedStrings, const UserdataSerializer* customSerializer, bool readOnly)
     {
         if (binaryData.empty())
             throw std::runtime_error("Unexpected end of serialized data.");
@@ -265,7 +291,10 @@ namespace LuaUtil
         if (type & SHORT_STRING_FLAG)
         {
             size_t size = type & 0x1f;
-            sol::stack::push<std::string_view>(lua, binaryData.substr(0, size));
+            std::string_view str = binaryData.substr(0, size);
+            if (size >= MIN_INTERNED_STRING_SIZE && internedStrings.size() < MAX_INTERNED_STRINGS)
+                internedStrings.push_back(str);
+            sol::stack::push<std::string_view>(lua, str);
             binaryData = binaryData.substr(size);
             return;
         }
@@ -280,17 +309,28 @@ namespace LuaUtil
             case SerializedType::LONG_STRING:
             {
                 uint32_t size = getValue<uint32_t>(binaryData);
-                sol::stack::push<std::string_view>(lua, binaryData.substr(0, size));
+                std::string_view str = binaryData.substr(0, size);
+                if (internedStrings.size() < MAX_INTERNED_STRINGS)
+                    internedStrings.push_back(str);
+                sol::stack::push<std::string_view>(lua, str);
                 binaryData = binaryData.substr(size);
                 return;
             }
+            case SerializedType::STRING_REF:
+            {
+                uint16_t id = getValue<uint16_t>(binaryData);
+                if (id >= internedStrings.size())
+                    throw std::runtime_error("Invalid string reference in serialized data.");
+                sol::stack::push<std::string_view>(lua, internedStrings[id]);
+                return;
+            }
             case SerializedType::TABLE_START:
             {
                 lua_createtable(lua, 0, 0);
                 while (!binaryData.empty() && binaryData[0] != char(SerializedType::TABLE_END))
                 {
-                    deserializeImpl(lua, binaryData, customSerializer, readOnly);
-                    deserializeImpl(lua, binaryData, customSerializer, readOnly);
+                    deserializeImpl(lua, binaryData, internedStrings, customSerializer, readOnly);
+                    deserializeImpl(lua, binaryData, internedStrings, customSerializer, readOnly);
                     lua_settable(lua, -3);
                 }
                 if (binaryData.empty())
@@ -362,7 +402,8 @@ namespace LuaUtil
             return "";
         BinaryData res;
         res.push_back(FORMAT_VERSION);
-        serialize(res, obj, customSerializer, 0);
+        std::unordered_map<std::string_view, uint16_t> internedStrings;
+        serialize(res, internedStrings, obj, customSerializer, 0);
         return res;
     }
 
@@ -371,11 +412,12 @@ namespace LuaUtil
     {
         if (binaryData.empty())
             return sol::nil;
-        if (binaryData[0] != FORMAT_VERSION)
+        if (binaryData[0] > FORMAT_VERSION)
             throw std::runtime_error("Incorrect version of Lua serialization format: "
                 + std::to_string(static_cast<unsigned>(binaryData[0])));
         binaryData = binaryData.substr(1);
-        deserializeImpl(lua, binaryData, customSerializer, readOnly);
+        std::vector<std::string_view> internedStrings;
+        deserializeImpl(lua, binaryData, internedStrings, customSerializer, readOnly);
         if (!binaryData.empty())
             throw std::runtime_error("Unexpected data after serialized object");
         return sol::stack::pop<sol::object>(lua);
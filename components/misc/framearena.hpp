@@ -0,0 +1,113 @@
+#ifndef OPENMW_COMPONENTS_MISC_FRAMEARENA_H
+#define OPENMW_COMPONENTS_MISC_FRAMEARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Misc
+{
+    /// @brief Bump allocator for temporaries that do not outlive the current frame.
+    ///
+    /// Each thread has its own arena, so allocation is a pointer increment without
+    /// synchronization. reset() makes all memory allocated since the previous reset available
+    /// again while keeping the pages, so a steady-state frame performs no heap allocation.
+    ///
+    /// The owner of a thread's frame loop is responsible for calling reset() once per frame.
+    /// Containers using FrameAllocator must be destroyed before the reset that reclaims their
+    /// memory and must never be stored across frames.
+    class FrameArena
+    {
+    public:
+        static FrameArena& instance()
+        {
+            thread_local FrameArena arena;
+            return arena;
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            while (mPage < mPages.size())
+            {
+                const Page& page = mPages[mPage];
+                const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(page.mData.get());
+                const std::uintptr_t aligned = (base + mOffset + alignment - 1) & ~(alignment - 1);
+                if (aligned + size <= base + page.mSize)
+                {
+                    mOffset = aligned + size - base;
+                    return reinterpret_cast<void*>(aligned);
+                }
+                ++mPage;
+                mOffset = 0;
+            }
+
+            const std::size_t prevPageSize = mPages.empty() ? sMinPageSize / 2 : mPages.back().mSize;
+            const std::size_t pageSize = std::max(2 * prevPageSize, size + alignment);
+            mPages.push_back(Page{ std::make_unique<std::byte[]>(pageSize), pageSize });
+            return allocate(size, alignment);
+        }
+
+        /// Invalidate all allocations made since the previous reset, keeping the pages.
+        void reset()
+        {
+            mPage = 0;
+            mOffset = 0;
+        }
+
+    private:
+        struct Page
+        {
+            std::unique_ptr<std::byte[]> mData;
+            std::size_t mSize;
+        };
+
+        static constexpr std::size_t sMinPageSize = 64 * 1024;
+
+        std::vector<Page> mPages;
+        std::size_t mPage = 0;
+        std::size_t mOffset = 0;
+    };
+
+    /// Standard allocator adapter placing allocations in the current thread's FrameArena.
+    /// Deallocation is a no-op; memory is reclaimed in bulk by FrameArena::reset().
+    template <class T>
+    class FrameAllocator
+    {
+    public:
+        using value_type = T;
+
+        FrameAllocator() noexcept
+            : mArena(&FrameArena::instance())
+        {
+        }
+
+        template <class U>
+        FrameAllocator(const FrameAllocator<U>& other) noexcept
+            : mArena(other.mArena)
+        {
+        }
+
+        T* allocate(std::size_t n) { return static_cast<T*>(mArena->allocate(n * sizeof(T), alignof(T))); }
+
+        void deallocate(T* /*pointer*/, std::size_t /*n*/) noexcept {}
+
+        template <class U>
+        friend bool operator==(const FrameAllocator& lhs, const FrameAllocator<U>& rhs) noexcept
+        {
+            return lhs.mArena == rhs.mArena;
+        }
+
+    private:
+        template <class U>
+        friend class FrameAllocator;
+
+        FrameArena* mArena;
+    };
+
+    template <class T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
+
+#endif
@@ -1,8 +1,10 @@
 #include "resourcehelpers.hpp"
 
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 #include <string_view>
+#include <unordered_map>
 
 #include <components/esm/common.hpp>
 #include <components/esm/refid.hpp>
@@ -28,6 +30,56 @@ namespace
             std::find_if(pathname.rbegin(), pathname.rend(), MatchPathSeparator()).base(), pathname.end());
     }
 
+    // The same raw references get corrected over and over: every NIF repeats the stock texture
+    // paths and every terrain chunk repeats its layer textures, and each correction probes the
+    // VFS several times. Results only depend on the VFS index, so they are memoized until the
+    // next buildIndex() call of any manager.
+    struct CorrectedPathCache
+    {
+        std::mutex mMutex;
+        std::size_t mGeneration = 0;
+        std::unordered_map<std::string, std::string> mValues;
+
+        const std::string* find(const std::string& key)
+        {
+            const std::size_t generation = VFS::Manager::getIndexGeneration();
+            if (generation != mGeneration)
+            {
+                mValues.clear();
+                mGeneration = generation;
+                return nullptr;
+            }
+            const auto it = mValues.find(key);
+            return it == mValues.end() ? nullptr : &it->second;
+        }
+
+        void insert(std::string&& key, const std::string& value)
+        {
+            if (mGeneration == VFS::Manager::getIndexGeneration())
+                mValues.emplace(std::move(key), value);
+        }
+    };
+
+    CorrectedPathCache& correctedPathCache()
+    {
+        static CorrectedPathCache cache;
+        return cache;
+    }
+
+    std::string makeCorrectedPathKey(
+        std::span<const std::string_view> topLevelDirectories, std::string_view resPath)
+    {
+        std::string key;
+        key.reserve(resPath.size() + 16);
+        for (std::string_view directory : topLevelDirectories)
+        {
+            key += directory;
+            key += '\0';
+        }
+        key += resPath;
+        return key;
+    }
+
 }
 
 bool changeExtension(std::string& path, std::string_view ext)
@@ -46,10 +98,13 @@ bool Misc::ResourceHelpers::changeExtensionToDds(std::string& path)
     return changeExtension(path, ".dds");
 }
 
-std::string Misc::ResourceHelpers::correctResourcePath(
-    std::span<const std::string_view> topLevelDirectories, std::string_view resPath, const VFS::Manager* vfs)
+namespace
 {
-    /* Bethesda at some point converted all their BSA
+
+    std::string correctResourcePathImpl(
+        std::span<const std::string_view> topLevelDirectories, std::string_view resPath, const VFS::Manager* vfs)
+    {
+        /* Bethesda at some point converted all their BSA
      * textures from tga to dds for increased load speed, but all
      * texture file name references were kept as .tga.
      */
@@ -95,7 +150,7 @@ std::string Misc::ResourceHelpers::correctResourcePath(
 
     // since we know all (GOTY edition or less) textures end
     // in .dds, we change the extension
-    bool changedToDds = changeExtensionToDds(correctedPath);
+    bool changedToDds = Misc::ResourceHelpers::changeExtensionToDds(correctedPath);
     if (vfs->exists(correctedPath))
         return correctedPath;
     // if it turns out that the above wasn't true in all cases (not for vanilla, but maybe mods)
@@ -122,6 +177,28 @@ std::string Misc::ResourceHelpers::correctResourcePath(
     return correctedPath;
 }
 
+}
+
+std::string Misc::ResourceHelpers::correctResourcePath(
+    std::span<const std::string_view> topLevelDirectories, std::string_view resPath, const VFS::Manager* vfs)
+{
+    std::string key = makeCorrectedPathKey(topLevelDirectories, resPath);
+    CorrectedPathCache& cache = correctedPathCache();
+    {
+        const std::lock_guard lock(cache.mMutex);
+        if (const std::string* found = cache.find(key))
+            return *found;
+    }
+
+    const std::string result = correctResourcePathImpl(topLevelDirectories, resPath, vfs);
+
+    {
+        const std::lock_guard lock(cache.mMutex);
+        cache.insert(std::move(key), result);
+    }
+    return result;
+}
+
 std::string Misc::ResourceHelpers::correctTexturePath(std::string_view resPath, const VFS::Manager* vfs)
 {
     return correctResourcePath({ { "textures", "bookart" } }, resPath, vfs);
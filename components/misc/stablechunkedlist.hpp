@@ -0,0 +1,243 @@
+#ifndef OPENMW_COMPONENTS_MISC_STABLECHUNKEDLIST_H
+#define OPENMW_COMPONENTS_MISC_STABLECHUNKEDLIST_H
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Misc
+{
+    /// \brief Sequence container storing its elements in fixed-size chunks.
+    ///
+    /// Element addresses are stable across push_back and erase and insertion order is preserved,
+    /// so it can replace std::list where elements are referenced by pointer. Erased slots are
+    /// destroyed and tombstoned rather than reused, which keeps forward iteration a linear scan
+    /// over mostly contiguous memory and makes destroying the container a bulk free of whole
+    /// chunks. push_back may invalidate end iterators, erase only invalidates iterators to the
+    /// erased element.
+    template <class T, std::size_t ChunkCapacity = 64>
+    class StableChunkedList
+    {
+        static_assert(ChunkCapacity > 0);
+
+        struct Chunk
+        {
+            alignas(T) std::byte mStorage[sizeof(T) * ChunkCapacity];
+            std::array<bool, ChunkCapacity> mAlive{};
+            std::size_t mConstructed = 0; // slots ever used, including tombstones
+
+            T* slot(std::size_t index) noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(mStorage + sizeof(T) * index));
+            }
+
+            const T* slot(std::size_t index) const noexcept
+            {
+                return std::launder(reinterpret_cast<const T*>(mStorage + sizeof(T) * index));
+            }
+        };
+
+        template <bool IsConst>
+        class IteratorImpl
+        {
+            using ListPtr = std::conditional_t<IsConst, const StableChunkedList*, StableChunkedList*>;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T*, T*>;
+            using reference = std::conditional_t<IsConst, const T&, T&>;
+
+            IteratorImpl() = default;
+
+            template <bool C = IsConst, class = std::enable_if_t<C>>
+            IteratorImpl(const IteratorImpl<false>& other)
+                : mList(other.mList)
+                , mChunk(other.mChunk)
+                , mSlot(other.mSlot)
+            {
+            }
+
+            reference operator*() const { return *mList->mChunks[mChunk]->slot(mSlot); }
+
+            pointer operator->() const { return mList->mChunks[mChunk]->slot(mSlot); }
+
+            IteratorImpl& operator++()
+            {
+                ++mSlot;
+                skipDead();
+                return *this;
+            }
+
+            IteratorImpl operator++(int)
+            {
+                IteratorImpl result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend bool operator==(const IteratorImpl& lhs, const IteratorImpl& rhs)
+            {
+                return lhs.mChunk == rhs.mChunk && lhs.mSlot == rhs.mSlot;
+            }
+
+            friend bool operator!=(const IteratorImpl& lhs, const IteratorImpl& rhs) { return !(lhs == rhs); }
+
+        private:
+            friend class StableChunkedList;
+            friend class IteratorImpl<true>;
+
+            ListPtr mList = nullptr;
+            std::size_t mChunk = 0;
+            std::size_t mSlot = 0;
+
+            IteratorImpl(ListPtr list, std::size_t chunk, std::size_t slot)
+                : mList(list)
+                , mChunk(chunk)
+                , mSlot(slot)
+            {
+                skipDead();
+            }
+
+            void skipDead()
+            {
+                while (mChunk < mList->mChunks.size())
+                {
+                    const Chunk& chunk = *mList->mChunks[mChunk];
+                    while (mSlot < chunk.mConstructed && !chunk.mAlive[mSlot])
+                        ++mSlot;
+                    if (mSlot < chunk.mConstructed)
+                        return;
+                    ++mChunk;
+                    mSlot = 0;
+                }
+                mSlot = 0;
+            }
+        };
+
+    public:
+        using value_type = T;
+        using iterator = IteratorImpl<false>;
+        using const_iterator = IteratorImpl<true>;
+
+        StableChunkedList() = default;
+
+        StableChunkedList(const StableChunkedList& other)
+        {
+            for (const T& value : other)
+                push_back(value);
+        }
+
+        StableChunkedList(StableChunkedList&& other) noexcept
+            : mChunks(std::move(other.mChunks))
+            , mSize(std::exchange(other.mSize, 0))
+        {
+            other.mChunks.clear();
+        }
+
+        StableChunkedList& operator=(const StableChunkedList& other)
+        {
+            if (this != &other)
+            {
+                StableChunkedList copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        StableChunkedList& operator=(StableChunkedList&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                mChunks = std::move(other.mChunks);
+                mSize = std::exchange(other.mSize, 0);
+                other.mChunks.clear();
+            }
+            return *this;
+        }
+
+        ~StableChunkedList() { clear(); }
+
+        iterator begin() { return iterator(this, 0, 0); }
+        iterator end() { return iterator(this, mChunks.size(), 0); }
+        const_iterator begin() const { return const_iterator(this, 0, 0); }
+        const_iterator end() const { return const_iterator(this, mChunks.size(), 0); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        bool empty() const { return mSize == 0; }
+
+        std::size_t size() const { return mSize; }
+
+        T& front()
+        {
+            assert(!empty());
+            return *begin();
+        }
+
+        const T& front() const
+        {
+            assert(!empty());
+            return *begin();
+        }
+
+        T& push_back(const T& value) { return emplace_back(value); }
+
+        T& push_back(T&& value) { return emplace_back(std::move(value)); }
+
+        template <class... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (mChunks.empty() || mChunks.back()->mConstructed == ChunkCapacity)
+                mChunks.push_back(std::make_unique<Chunk>());
+            Chunk& chunk = *mChunks.back();
+            T* result = new (chunk.mStorage + sizeof(T) * chunk.mConstructed) T(std::forward<Args>(args)...);
+            chunk.mAlive[chunk.mConstructed] = true;
+            ++chunk.mConstructed;
+            ++mSize;
+            return *result;
+        }
+
+        /// Destroys the element and tombstones its slot; addresses of other elements are unaffected.
+        iterator erase(iterator position)
+        {
+            assert(position.mList == this);
+            Chunk& chunk = *mChunks[position.mChunk];
+            assert(chunk.mAlive[position.mSlot]);
+            chunk.slot(position.mSlot)->~T();
+            chunk.mAlive[position.mSlot] = false;
+            --mSize;
+            return iterator(this, position.mChunk, position.mSlot + 1);
+        }
+
+        void clear()
+        {
+            for (const std::unique_ptr<Chunk>& chunk : mChunks)
+                for (std::size_t i = 0; i < chunk->mConstructed; ++i)
+                    if (chunk->mAlive[i])
+                        chunk->slot(i)->~T();
+            mChunks.clear();
+            mSize = 0;
+        }
+
+        void swap(StableChunkedList& other) noexcept
+        {
+            mChunks.swap(other.mChunks);
+            std::swap(mSize, other.mSize);
+        }
+
+    private:
+        std::vector<std::unique_ptr<Chunk>> mChunks;
+        std::size_t mSize = 0;
+    };
+}
+
+#endif
@@ -27,19 +27,42 @@ namespace Misc::StringUtils
         return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end(), CiCharLess());
     }
 
+    namespace Detail
+    {
+        // Compares fixed-size blocks without an early exit inside the block, so the fold and
+        // comparison vectorize into 16-byte operations; per-character std::equal can not because
+        // it may not read past the first mismatch.
+        template <class Char>
+        bool ciEqual(std::basic_string_view<Char> x, std::basic_string_view<Char> y)
+        {
+            constexpr std::size_t blockSize = 16;
+            std::size_t i = 0;
+            for (; i + blockSize <= x.size(); i += blockSize)
+            {
+                bool equal = true;
+                for (std::size_t j = i; j < i + blockSize; ++j)
+                    equal &= toLower(x[j]) == toLower(y[j]);
+                if (!equal)
+                    return false;
+            }
+            bool equal = true;
+            for (; i < x.size(); ++i)
+                equal &= toLower(x[i]) == toLower(y[i]);
+            return equal;
+        }
+    }
+
     inline bool ciEqual(std::string_view x, std::string_view y)
     {
         if (std::size(x) != std::size(y))
             return false;
-        return std::equal(
-            std::begin(x), std::end(x), std::begin(y), [](char l, char r) { return toLower(l) == toLower(r); });
+        return Detail::ciEqual(x, y);
     }
     inline bool ciEqual(std::u8string_view x, std::u8string_view y)
     {
         if (std::size(x) != std::size(y))
             return false;
-        return std::equal(
-            std::begin(x), std::end(x), std::begin(y), [](char l, char r) { return toLower(l) == toLower(r); });
+        return Detail::ciEqual(x, y);
     }
 
     inline bool ciStartsWith(std::string_view value, std::string_view prefix)
@@ -100,6 +100,11 @@ namespace osgMyGUI
 
             mReadFrom = (mReadFrom + 1) % sNumBuffers;
             const std::vector<Batch>& vec = mBatchVector[mReadFrom];
+            // Adjacent batches usually sample the same texture (font atlas or skin atlas), so
+            // only change the binding when it actually differs. The draws themselves cannot be
+            // merged or reordered: the buffers are retained per layer node by MyGUI and the
+            // blending depends on back-to-front submission order.
+            const osg::Texture2D* appliedTexture = nullptr;
             for (std::vector<Batch>::const_iterator it = vec.begin(); it != vec.end(); ++it)
             {
                 const Batch& batch = *it;
@@ -109,16 +114,20 @@ namespace osgMyGUI
                 {
                     state->pushStateSet(batch.mStateSet);
                     state->apply();
+                    appliedTexture = nullptr;
                 }
 
                 // A GUI element without an associated texture would be extremely rare.
                 // It is worth it to use a dummy 1x1 black texture sampler instead of either adding a conditional or
                 // relinking shaders.
                 osg::Texture2D* texture = batch.mTexture;
-                if (texture)
+                if (!texture)
+                    texture = mDummyTexture;
+                if (texture != appliedTexture)
+                {
                     state->applyTextureAttribute(0, texture);
-                else
-                    state->applyTextureAttribute(0, mDummyTexture);
+                    appliedTexture = texture;
+                }
 
                 osg::GLBufferObject* bufferobject = state->isVertexBufferObjectSupported()
                     ? vbo->getOrCreateGLBufferObject(state->getContextID())
@@ -147,6 +156,7 @@ namespace osgMyGUI
                 {
                     state->popStateSet();
                     state->apply();
+                    appliedTexture = nullptr;
                 }
             }
 
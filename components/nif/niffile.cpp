@@ -30,6 +30,7 @@ namespace Nif
         , mBethVersion(file.mBethVersion)
         , mFilename(file.mPath)
         , mHash(file.mHash)
+        , mArena(file.mArena)
         , mRecords(file.mRecords)
         , mRoots(file.mRoots)
         , mUseSkinning(file.mUseSkinning)
@@ -38,14 +39,14 @@ namespace Nif
     }
 
     template <typename NodeType, RecordType recordType>
-    static std::unique_ptr<Record> construct()
+    static RecordPtr construct(RecordArena& arena)
     {
-        auto result = std::make_unique<NodeType>();
+        RecordPtr result(new (arena.allocate(sizeof(NodeType), alignof(NodeType))) NodeType);
         result->recType = recordType;
         return result;
     }
 
-    using CreateRecord = std::unique_ptr<Record> (*)();
+    using CreateRecord = RecordPtr (*)(RecordArena&);
 
     /// These are all the record types we know how to read.
     static std::map<std::string, CreateRecord> makeFactory()
@@ -663,7 +664,7 @@ namespace Nif
 
         for (std::size_t i = 0; i < mRecords.size(); i++)
         {
-            std::unique_ptr<Record> r;
+            RecordPtr r;
 
             std::string rec = hasRecTypeListings ? recTypes[recTypeIndices[i]] : nif.get<std::string>();
             if (rec.empty())
@@ -682,7 +683,7 @@ namespace Nif
             if (entry == factories.end())
                 throw Nif::Exception("Unknown record type " + rec, mFilename);
 
-            r = entry->second();
+            r = entry->second(mArena);
 
             if (writeDebug)
                 Log(Debug::Verbose) << "NIF Debug: Reading record of type " << rec << ", index " << i;
@@ -10,6 +10,7 @@
 #include <components/files/istreamptr.hpp>
 
 #include "record.hpp"
+#include "recordarena.hpp"
 
 namespace ToUTF8
 {
@@ -48,8 +49,12 @@ namespace Nif
         std::string mPath;
         std::string mHash;
 
+        /// Arena all records are constructed in. Must precede the record list so that it
+        /// outlives the records during destruction.
+        RecordArena mArena;
+
         /// Record list
-        std::vector<std::unique_ptr<Record>> mRecords;
+        std::vector<RecordPtr> mRecords;
 
         /// Root list.  This is a select portion of the pointers from records
         std::vector<Record*> mRoots;
@@ -107,8 +112,11 @@ namespace Nif
         std::string_view mFilename;
         std::string& mHash;
 
+        /// Arena all records are constructed in
+        RecordArena& mArena;
+
         /// Record list
-        std::vector<std::unique_ptr<Record>>& mRecords;
+        std::vector<RecordPtr>& mRecords;
 
         /// Root list.  This is a select portion of the pointers from records
         std::vector<Record*>& mRoots;
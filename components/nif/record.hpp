@@ -24,6 +24,7 @@
 #ifndef OPENMW_COMPONENTS_NIF_RECORD_HPP
 #define OPENMW_COMPONENTS_NIF_RECORD_HPP
 
+#include <memory>
 #include <string>
 
 namespace Nif
@@ -334,5 +335,14 @@ namespace Nif
         virtual ~Record() {}
     };
 
+    /// Destroys a record whose storage is owned by the file's RecordArena: runs the destructor
+    /// without freeing the memory, the arena releases it wholesale.
+    struct RecordDeleter
+    {
+        void operator()(Record* record) const { record->~Record(); }
+    };
+
+    using RecordPtr = std::unique_ptr<Record, RecordDeleter>;
+
 } // Namespace
 #endif
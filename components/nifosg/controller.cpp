@@ -9,6 +9,9 @@
 
 #include <osgParticle/Emitter>
 
+#include <algorithm>
+
+#include <components/misc/hash.hpp>
 #include <components/nif/data.hpp>
 #include <components/sceneutil/morphgeometry.hpp>
 
@@ -74,6 +77,96 @@ namespace NifOsg
         return mStopTime;
     }
 
+    namespace
+    {
+        void hashKeyValue(std::size_t& seed, float value)
+        {
+            Misc::hashCombine(seed, value);
+        }
+
+        void hashKeyValue(std::size_t& seed, const osg::Vec3f& value)
+        {
+            for (int i = 0; i < 3; ++i)
+                Misc::hashCombine(seed, value[i]);
+        }
+
+        void hashKeyValue(std::size_t& seed, const osg::Quat& value)
+        {
+            for (int i = 0; i < 4; ++i)
+                Misc::hashCombine(seed, value[i]);
+        }
+
+        template <typename MapT>
+        std::size_t hashTrack(const MapT& track)
+        {
+            std::size_t seed = 0;
+            Misc::hashCombine(seed, track.mInterpolationType);
+            Misc::hashCombine(seed, track.mKeys.size());
+            for (const auto& [time, key] : track.mKeys)
+            {
+                Misc::hashCombine(seed, time);
+                hashKeyValue(seed, key.mValue);
+                hashKeyValue(seed, key.mInTan);
+                hashKeyValue(seed, key.mOutTan);
+            }
+            return seed;
+        }
+
+        template <typename MapT>
+        bool equalTracks(const MapT& lhs, const MapT& rhs)
+        {
+            if (lhs.mInterpolationType != rhs.mInterpolationType || lhs.mKeys.size() != rhs.mKeys.size())
+                return false;
+            return std::equal(
+                lhs.mKeys.begin(), lhs.mKeys.end(), rhs.mKeys.begin(), [](const auto& l, const auto& r) {
+                    return l.first == r.first && l.second.mValue == r.second.mValue
+                        && l.second.mInTan == r.second.mInTan && l.second.mOutTan == r.second.mOutTan;
+                });
+        }
+    }
+
+    template <typename MapT>
+    std::shared_ptr<const MapT> KeyframeTrackStore::share(
+        TracksByHash<MapT>& tracks, std::shared_ptr<const MapT> keys)
+    {
+        if (keys == nullptr || keys->mKeys.empty())
+            return keys;
+        std::vector<std::weak_ptr<const MapT>>& candidates = tracks[hashTrack(*keys)];
+        for (auto it = candidates.begin(); it != candidates.end();)
+        {
+            if (std::shared_ptr<const MapT> existing = it->lock())
+            {
+                if (equalTracks(*existing, *keys))
+                    return existing;
+                ++it;
+            }
+            else
+                it = candidates.erase(it);
+        }
+        candidates.push_back(keys);
+        return keys;
+    }
+
+    std::shared_ptr<const Nif::FloatKeyMap> KeyframeTrackStore::share(std::shared_ptr<const Nif::FloatKeyMap> keys)
+    {
+        const std::lock_guard lock(mMutex);
+        return share(mFloatTracks, std::move(keys));
+    }
+
+    std::shared_ptr<const Nif::QuaternionKeyMap> KeyframeTrackStore::share(
+        std::shared_ptr<const Nif::QuaternionKeyMap> keys)
+    {
+        const std::lock_guard lock(mMutex);
+        return share(mQuaternionTracks, std::move(keys));
+    }
+
+    std::shared_ptr<const Nif::Vector3KeyMap> KeyframeTrackStore::share(
+        std::shared_ptr<const Nif::Vector3KeyMap> keys)
+    {
+        const std::lock_guard lock(mMutex);
+        return share(mVec3Tracks, std::move(keys));
+    }
+
     KeyframeController::KeyframeController() {}
 
     KeyframeController::KeyframeController(const KeyframeController& copy, const osg::CopyOp& copyop)
@@ -175,6 +268,16 @@ namespace NifOsg
         return osg::Vec3f();
     }
 
+    void KeyframeController::shareTracks(KeyframeTrackStore& store)
+    {
+        mRotations.setKeys(store.share(mRotations.getKeys()));
+        mXRotations.setKeys(store.share(mXRotations.getKeys()));
+        mYRotations.setKeys(store.share(mYRotations.getKeys()));
+        mZRotations.setKeys(store.share(mZRotations.getKeys()));
+        mTranslations.setKeys(store.share(mTranslations.getKeys()));
+        mScales.setKeys(store.share(mScales.getKeys()));
+    }
+
     void KeyframeController::operator()(NifOsg::MatrixTransform* node, osg::NodeVisitor* nv)
     {
         auto [translation, rotation, scale] = getCurrentTransformation(nv);
@@ -1,8 +1,12 @@
 #ifndef COMPONENTS_NIFOSG_CONTROLLER_H
 #define COMPONENTS_NIFOSG_CONTROLLER_H
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <type_traits>
+#include <vector>
 
 #include <osg/Texture2D>
 
@@ -92,6 +96,19 @@ namespace NifOsg
             }
         }
 
+        const std::shared_ptr<const MapT>& getKeys() const { return mKeys; }
+
+        /// Replace the key track, e.g. with an equal instance shared between controllers.
+        void setKeys(std::shared_ptr<const MapT> keys)
+        {
+            mKeys = std::move(keys);
+            if (mKeys)
+            {
+                mLastLowKey = mKeys->mKeys.end();
+                mLastHighKey = mKeys->mKeys.end();
+            }
+        }
+
         ValueT interpKey(float time) const
         {
             if (empty())
@@ -183,6 +200,30 @@ namespace NifOsg
     using Vec4Interpolator = ValueInterpolator<Nif::Vector4KeyMap>;
     using BoolInterpolator = ValueInterpolator<Nif::BoolKeyMap>;
 
+    /// Content-addressed store of key tracks, sharing one instance between controllers whose
+    /// tracks hold identical keys. Animation replacer files commonly repeat the same tracks, so
+    /// deduplicating them saves memory. Entries are held weakly and expire with their last user.
+    /// @note May be used from any thread.
+    class KeyframeTrackStore
+    {
+    public:
+        std::shared_ptr<const Nif::FloatKeyMap> share(std::shared_ptr<const Nif::FloatKeyMap> keys);
+        std::shared_ptr<const Nif::QuaternionKeyMap> share(std::shared_ptr<const Nif::QuaternionKeyMap> keys);
+        std::shared_ptr<const Nif::Vector3KeyMap> share(std::shared_ptr<const Nif::Vector3KeyMap> keys);
+
+    private:
+        template <typename MapT>
+        using TracksByHash = std::map<std::size_t, std::vector<std::weak_ptr<const MapT>>>;
+
+        template <typename MapT>
+        static std::shared_ptr<const MapT> share(TracksByHash<MapT>& tracks, std::shared_ptr<const MapT> keys);
+
+        std::mutex mMutex;
+        TracksByHash<Nif::FloatKeyMap> mFloatTracks;
+        TracksByHash<Nif::QuaternionKeyMap> mQuaternionTracks;
+        TracksByHash<Nif::Vector3KeyMap> mVec3Tracks;
+    };
+
     class ControllerFunction : public SceneUtil::ControllerFunction
     {
     private:
@@ -242,6 +283,9 @@ namespace NifOsg
 
         void operator()(NifOsg::MatrixTransform*, osg::NodeVisitor*);
 
+        /// Replace this controller's key tracks with instances shared through the given store.
+        void shareTracks(KeyframeTrackStore& store);
+
     private:
         QuaternionInterpolator mRotations;
 
@@ -30,6 +30,12 @@ namespace Platform::File
 
     size_t read(Handle handle, void* data, size_t size);
 
+    /// Hint that the given byte range is about to be read sequentially. Where the platform
+    /// supports it the kernel starts fetching the range in the background, so subsequent read()
+    /// calls are served from the page cache instead of blocking on the device. Purely advisory:
+    /// a no-op on platforms without an equivalent and never fails.
+    void readAhead(Handle handle, size_t offset, size_t size);
+
     class ScopedHandle
     {
         Handle mHandle{ Handle::Invalid };
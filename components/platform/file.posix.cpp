@@ -103,4 +103,17 @@ namespace Platform::File
         return amount;
     }
 
+    void readAhead(Handle handle, size_t offset, size_t size)
+    {
+#ifdef POSIX_FADV_WILLNEED
+        // Best effort: without the hint the data is merely read slower, so errors are ignored.
+        ::posix_fadvise(
+            getNativeHandle(handle), static_cast<off_t>(offset), static_cast<off_t>(size), POSIX_FADV_WILLNEED);
+#else
+        (void)handle;
+        (void)offset;
+        (void)size;
+#endif
+    }
+
 }
@@ -93,4 +93,9 @@ namespace Platform::File
         return static_cast<size_t>(amount);
     }
 
+    void readAhead(Handle /*handle*/, size_t /*offset*/, size_t /*size*/)
+    {
+        // stdio offers no portable read-ahead hint.
+    }
+
 }
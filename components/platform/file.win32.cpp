@@ -100,4 +100,10 @@ namespace Platform::File
 
         return bytesRead;
     }
+
+    void readAhead(Handle /*handle*/, size_t /*offset*/, size_t /*size*/)
+    {
+        // No per-range equivalent of posix_fadvise(WILLNEED); the cache manager already detects
+        // sequential access on its own.
+    }
 }
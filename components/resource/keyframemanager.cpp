@@ -222,6 +222,12 @@ namespace Resource
                 Nif::Reader reader(*file, mEncoder);
                 reader.parse(mVFS->get(normalized));
                 NifOsg::Loader::loadKf(*file, *loaded.get());
+                for (const auto& [controllerName, controller] : loaded->mKeyframeControllers)
+                {
+                    if (auto* keyframeController = dynamic_cast<NifOsg::KeyframeController*>(
+                            const_cast<SceneUtil::KeyframeController*>(controller.get())))
+                        keyframeController->shareTracks(mTrackStore);
+                }
             }
             else
             {
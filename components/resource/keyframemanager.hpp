@@ -6,6 +6,7 @@
 #include <osg/ref_ptr>
 #include <osgAnimation/BasicAnimationManager>
 
+#include <components/nifosg/controller.hpp>
 #include <components/sceneutil/keyframe.hpp>
 
 #include "resourcemanager.hpp"
@@ -63,6 +64,9 @@ namespace Resource
     private:
         SceneManager* mSceneManager;
         const ToUTF8::StatelessUtf8Encoder* mEncoder;
+        // Shares identical key tracks between keyframe resources, so animation replacer files
+        // repeating the same tracks per NPC are stored once.
+        NifOsg::KeyframeTrackStore mTrackStore;
     };
 
 }
@@ -3,6 +3,7 @@
 // - removeExpiredObjectsInCache no longer keeps a lock while the unref happens.
 // - template allows customized KeyType.
 // - objects with uninitialized time stamp are not removed.
+// - the map is sharded by key hash with one mutex per shard.
 
 /* -*-c++-*- OpenSceneGraph - Copyright (C) 1998-2006 Robert Osfield
  *
@@ -27,10 +28,14 @@
 #include <osg/ref_ptr>
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <vector>
 
 namespace osg
@@ -43,6 +48,49 @@ namespace osg
 
 namespace Resource
 {
+    inline void hashCombineCacheKey(std::size_t& seed, const auto& value);
+
+    // Shard selection hash for GenericObjectCache. Cache keys are string-like, have a std::hash
+    // specialization, or are tuple-like composites of such values (see Terrain::ChunkKey), so the
+    // hash resolves recursively instead of requiring std::hash for every key type. String-like
+    // keys always hash their characters so that heterogeneous lookups land on the same shard.
+    inline std::size_t hashCacheKey(const auto& value)
+    {
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            return std::hash<std::string_view>{}(std::string_view(value));
+        else if constexpr (requires { std::string_view(value.value()); })
+            return std::hash<std::string_view>{}(std::string_view(value.value()));
+        else if constexpr (requires { std::hash<T>{}(value); })
+            return std::hash<T>{}(value);
+        else if constexpr (requires { std::tuple_size<T>::value; })
+        {
+            return std::apply(
+                [](const auto&... args) {
+                    std::size_t seed = 0;
+                    (hashCombineCacheKey(seed, args), ...);
+                    return seed;
+                },
+                value);
+        }
+        else if constexpr (requires { value.ptr(); T::num_components; })
+        {
+            // osg vector types, e.g. the center of a terrain chunk key
+            std::size_t seed = 0;
+            for (int i = 0; i < T::num_components; ++i)
+                hashCombineCacheKey(seed, value.ptr()[i]);
+            return seed;
+        }
+        else
+            return hashCacheKey(tie(value)); // aggregates providing tie(), e.g. Terrain::ChunkKey
+    }
+
+    // Implemented similar to the boost::hash_combine
+    inline void hashCombineCacheKey(std::size_t& seed, const auto& value)
+    {
+        seed ^= hashCacheKey(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
     struct GenericObjectCacheItem
     {
         osg::ref_ptr<osg::Object> mValue;
@@ -59,16 +107,17 @@ namespace Resource
         void update(double referenceTime, double expiryDelay)
         {
             std::vector<osg::ref_ptr<osg::Object>> objectsToRemove;
+            const double expiryTime = referenceTime - expiryDelay;
+            for (Shard& shard : mShards)
             {
-                const double expiryTime = referenceTime - expiryDelay;
-                std::lock_guard<std::mutex> lock(mMutex);
-                std::erase_if(mItems, [&](auto& v) {
+                std::lock_guard<std::mutex> lock(shard.mMutex);
+                std::erase_if(shard.mItems, [&](auto& v) {
                     Item& item = v.second;
                     if ((item.mValue != nullptr && item.mValue->referenceCount() > 1) || item.mLastUsage == 0)
                         item.mLastUsage = referenceTime;
                     if (item.mLastUsage > expiryTime)
                         return false;
-                    ++mExpired;
+                    ++shard.mExpired;
                     if (item.mValue != nullptr)
                         objectsToRemove.push_back(std::move(item.mValue));
                     return true;
@@ -78,21 +127,64 @@ namespace Resource
             objectsToRemove.clear();
         }
 
+        // Remove the least recently used items until the total size measured by getSize fits into capacity.
+        // Items that are still referenced from elsewhere are never removed. Removed items count as expired
+        // in the stats.
+        template <class GetSize>
+        void removeLeastRecentlyUsed(std::size_t capacity, GetSize&& getSize)
+        {
+            std::vector<osg::ref_ptr<osg::Object>> objectsToRemove;
+            {
+                // Eviction has to rank all items against each other, so it locks the whole cache.
+                const LockAllShards lock(mShards);
+                std::size_t total = 0;
+                std::vector<std::pair<double, KeyType>> candidates;
+                for (const Shard& shard : mShards)
+                {
+                    for (const auto& [key, item] : shard.mItems)
+                    {
+                        total += getSize(item.mValue.get());
+                        if (item.mValue == nullptr || item.mValue->referenceCount() <= 1)
+                            candidates.emplace_back(item.mLastUsage, key);
+                    }
+                }
+                std::sort(candidates.begin(), candidates.end());
+                for (const auto& [lastUsage, key] : candidates)
+                {
+                    if (total <= capacity)
+                        break;
+                    Shard& shard = shardFor(key);
+                    const auto it = shard.mItems.find(key);
+                    total -= getSize(it->second.mValue.get());
+                    ++shard.mExpired;
+                    if (it->second.mValue != nullptr)
+                        objectsToRemove.push_back(std::move(it->second.mValue));
+                    shard.mItems.erase(it);
+                }
+            }
+            // note, actual unref happens outside of the lock
+            objectsToRemove.clear();
+        }
+
         /** Remove all objects in the cache regardless of having external references or expiry times.*/
         void clear()
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mItems.clear();
+            for (Shard& shard : mShards)
+            {
+                std::lock_guard<std::mutex> lock(shard.mMutex);
+                shard.mItems.clear();
+            }
         }
 
         /** Add a key,object,timestamp triple to the Registry::ObjectCache.*/
         template <class K>
         void addEntryToObjectCache(K&& key, osg::Object* object, double timestamp = 0.0)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            const auto it = mItems.find(key);
-            if (it == mItems.end())
-                mItems.emplace_hint(it, std::forward<K>(key), Item{ object, timestamp });
+            Shard& shard = shardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mMutex);
+            const auto it = shard.mItems.find(key);
+            if (it == shard.mItems.end())
+                shard.mItems.emplace_hint(it, std::forward<K>(key), Item{ object, timestamp });
             else
                 it->second = Item{ object, timestamp };
         }
@@ -100,25 +192,28 @@ namespace Resource
         /** Remove Object from cache.*/
         void removeFromObjectCache(const auto& key)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            const auto itr = mItems.find(key);
-            if (itr != mItems.end())
-                mItems.erase(itr);
+            Shard& shard = shardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mMutex);
+            const auto itr = shard.mItems.find(key);
+            if (itr != shard.mItems.end())
+                shard.mItems.erase(itr);
         }
 
         /** Get an ref_ptr<Object> from the object cache*/
         osg::ref_ptr<osg::Object> getRefFromObjectCache(const auto& key)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            if (Item* const item = find(key))
+            Shard& shard = shardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mMutex);
+            if (Item* const item = find(shard, key))
                 return item->mValue;
             return nullptr;
         }
 
         std::optional<osg::ref_ptr<osg::Object>> getRefFromObjectCacheOrNone(const auto& key)
         {
-            const std::lock_guard<std::mutex> lock(mMutex);
-            if (Item* const item = find(key))
+            Shard& shard = shardFor(key);
+            const std::lock_guard<std::mutex> lock(shard.mMutex);
+            if (Item* const item = find(shard, key))
                 return item->mValue;
             return std::nullopt;
         }
@@ -126,8 +221,9 @@ namespace Resource
         /** Check if an object is in the cache, and if it is, update its usage time stamp. */
         bool checkInObjectCache(const auto& key, double timeStamp)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            if (Item* const item = find(key))
+            Shard& shard = shardFor(key);
+            std::lock_guard<std::mutex> lock(shard.mMutex);
+            if (Item* const item = find(shard, key))
             {
                 item->mLastUsage = timeStamp;
                 return true;
@@ -138,67 +234,109 @@ namespace Resource
         /** call releaseGLObjects on all objects attached to the object cache.*/
         void releaseGLObjects(osg::State* state)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& [k, v] : mItems)
-                v.mValue->releaseGLObjects(state);
+            for (Shard& shard : mShards)
+            {
+                std::lock_guard<std::mutex> lock(shard.mMutex);
+                for (const auto& [k, v] : shard.mItems)
+                    v.mValue->releaseGLObjects(state);
+            }
         }
 
         /** call node->accept(nv); for all nodes in the objectCache. */
         void accept(osg::NodeVisitor& nv)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& [k, v] : mItems)
-                if (osg::Object* const object = v.mValue.get())
-                    if (osg::Node* const node = dynamic_cast<osg::Node*>(object))
-                        node->accept(nv);
+            for (Shard& shard : mShards)
+            {
+                std::lock_guard<std::mutex> lock(shard.mMutex);
+                for (const auto& [k, v] : shard.mItems)
+                    if (osg::Object* const object = v.mValue.get())
+                        if (osg::Node* const node = dynamic_cast<osg::Node*>(object))
+                            node->accept(nv);
+            }
         }
 
-        /** call operator()(KeyType, osg::Object*) for each object in the cache. */
+        /** call operator()(KeyType, osg::Object*) for each object in the cache in key order. */
         template <class Functor>
         void call(Functor&& f)
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            for (const auto& [k, v] : mItems)
-                f(k, v.mValue.get());
+            const LockAllShards lock(mShards);
+            std::vector<std::pair<const KeyType*, osg::Object*>> items;
+            for (const Shard& shard : mShards)
+                for (const auto& [k, v] : shard.mItems)
+                    items.emplace_back(&k, v.mValue.get());
+            std::sort(items.begin(), items.end(), [](const auto& l, const auto& r) { return *l.first < *r.first; });
+            for (const auto& [key, value] : items)
+                f(*key, value);
         }
 
         template <class K>
-        std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> lowerBound(K&& key)
+        std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> lowerBound(const K& key)
         {
-            const std::lock_guard<std::mutex> lock(mMutex);
-            const auto it = mItems.lower_bound(std::forward<K>(key));
-            if (it == mItems.end())
-                return std::nullopt;
-            return std::pair(it->first, it->second.mValue);
+            std::optional<std::pair<KeyType, osg::ref_ptr<osg::Object>>> result;
+            for (Shard& shard : mShards)
+            {
+                const std::lock_guard<std::mutex> lock(shard.mMutex);
+                const auto it = shard.mItems.lower_bound(key);
+                if (it != shard.mItems.end() && (!result.has_value() || it->first < result->first))
+                    result = std::pair(it->first, it->second.mValue);
+            }
+            return result;
         }
 
         CacheStats getStats() const
         {
-            const std::lock_guard<std::mutex> lock(mMutex);
-            return CacheStats{
-                .mSize = mItems.size(),
-                .mGet = mGet,
-                .mHit = mHit,
-                .mExpired = mExpired,
-            };
+            CacheStats stats;
+            for (const Shard& shard : mShards)
+            {
+                const std::lock_guard<std::mutex> lock(shard.mMutex);
+                stats.mSize += shard.mItems.size();
+                stats.mGet += shard.mGet;
+                stats.mHit += shard.mHit;
+                stats.mExpired += shard.mExpired;
+            }
+            return stats;
         }
 
     protected:
         using Item = GenericObjectCacheItem;
 
-        std::map<KeyType, Item, std::less<>> mItems;
-        mutable std::mutex mMutex;
-        std::size_t mGet = 0;
-        std::size_t mHit = 0;
-        std::size_t mExpired = 0;
+        // The items are sharded by key hash so that loading threads working on different objects
+        // do not serialize on a single cache-wide mutex during cell preload.
+        static constexpr std::size_t sShardCount = 16; // power of two
+
+        struct Shard
+        {
+            std::map<KeyType, Item, std::less<>> mItems;
+            mutable std::mutex mMutex;
+            std::size_t mGet = 0;
+            std::size_t mHit = 0;
+            std::size_t mExpired = 0;
+        };
+
+        class LockAllShards
+        {
+        public:
+            explicit LockAllShards(std::array<Shard, sShardCount>& shards)
+            {
+                for (std::size_t i = 0; i < sShardCount; ++i)
+                    mLocks[i] = std::unique_lock<std::mutex>(shards[i].mMutex);
+            }
+
+        private:
+            std::array<std::unique_lock<std::mutex>, sShardCount> mLocks;
+        };
+
+        std::array<Shard, sShardCount> mShards;
+
+        Shard& shardFor(const auto& key) { return mShards[hashCacheKey(key) & (sShardCount - 1)]; }
 
-        Item* find(const auto& key)
+        static Item* find(Shard& shard, const auto& key)
         {
-            ++mGet;
-            const auto it = mItems.find(key);
-            if (it == mItems.end())
+            ++shard.mGet;
+            const auto it = shard.mItems.find(key);
+            if (it == shard.mItems.end())
                 return nullptr;
-            ++mHit;
+            ++shard.mHit;
             return &it->second;
         }
     };
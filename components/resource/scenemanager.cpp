@@ -236,6 +236,52 @@ namespace Resource
         int mMaxAnisotropy;
     };
 
+    /// Ask the driver to compress eligible uncompressed textures when they are first uploaded.
+    class CompressTexturesVisitor : public osg::NodeVisitor
+    {
+    public:
+        CompressTexturesVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+        {
+        }
+
+        void apply(osg::Node& node) override
+        {
+            osg::StateSet* stateset = node.getStateSet();
+            if (stateset)
+                applyStateSet(stateset);
+
+            traverse(node);
+        }
+
+        void applyStateSet(osg::StateSet* stateset)
+        {
+            const osg::StateSet::TextureAttributeList& texAttributes = stateset->getTextureAttributeList();
+            for (unsigned int unit = 0; unit < texAttributes.size(); ++unit)
+            {
+                osg::StateAttribute* texture = stateset->getTextureAttribute(unit, osg::StateAttribute::TEXTURE);
+                if (texture)
+                    applyStateAttribute(texture);
+            }
+        }
+
+        void applyStateAttribute(osg::StateAttribute* attr)
+        {
+            osg::Texture* tex = attr->asTexture();
+            if (!tex)
+                return;
+            const osg::Image* image = tex->getImage(0);
+            // Only textures that ship uncompressed RGB(A) data benefit. S3TC operates on 4x4 blocks,
+            // so skip images the driver could not compress without resampling.
+            if (!image || image->isCompressed() || image->s() % 4 != 0 || image->t() % 4 != 0)
+                return;
+            if (image->getPixelFormat() == GL_RGB)
+                tex->setInternalFormatMode(osg::Texture::USE_S3TC_DXT1_COMPRESSION);
+            else if (image->getPixelFormat() == GL_RGBA)
+                tex->setInternalFormatMode(osg::Texture::USE_S3TC_DXT5_COMPRESSION);
+        }
+    };
+
     // Check Collada extra descriptions
     class ColladaDescriptionVisitor : public osg::NodeVisitor
     {
@@ -937,6 +983,13 @@ namespace Resource
                 options ^= Optimizer::MERGE_GEOMETRY;
             else if (str.find("MERGE_GEOMETRY") != std::string::npos)
                 options |= Optimizer::MERGE_GEOMETRY;
+
+            // opt-in: atlasing bleeds across tile edges in lower mip levels and can not
+            // pack the compressed textures most content ships with.
+            if (str.find("~TEXTURE_ATLAS_BUILDER") != std::string::npos)
+                options ^= Optimizer::TEXTURE_ATLAS_BUILDER;
+            else if (str.find("TEXTURE_ATLAS_BUILDER") != std::string::npos)
+                options |= Optimizer::TEXTURE_ATLAS_BUILDER;
         }
         return options;
     }
@@ -985,57 +1038,145 @@ namespace Resource
         osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
         if (obj)
             return osg::ref_ptr<const osg::Node>(static_cast<osg::Node*>(obj.get()));
-        else
+
+        // Join a load of the same template already running on the work queue instead of loading it a
+        // second time. Requests no worker has picked up yet are loaded here anyway: waiting behind a
+        // deep work queue could take longer than the load itself.
+        if (osg::ref_ptr<TemplateRequest> request = findPendingTemplate(normalized))
+            if (request->hasStarted())
+                if (osg::ref_ptr<const osg::Node> node = request->getNode())
+                    return node;
+
+        return loadTemplate(normalized, compile);
+    }
+
+    osg::ref_ptr<const osg::Node> SceneManager::loadTemplate(const VFS::Path::Normalized& normalized, bool compile)
+    {
+        osg::ref_ptr<osg::Node> loaded;
+        try
         {
-            osg::ref_ptr<osg::Node> loaded;
-            try
-            {
-                loaded = load(normalized, mVFS, mImageManager, mNifFileManager, mBgsmFileManager);
+            loaded = load(normalized, mVFS, mImageManager, mNifFileManager, mBgsmFileManager);
 
-                SceneUtil::ProcessExtraDataVisitor extraDataVisitor(this);
-                loaded->accept(extraDataVisitor);
-            }
-            catch (const std::exception& e)
-            {
-                Log(Debug::Error) << "Failed to load '" << name << "': " << e.what() << ", using marker_error instead";
-                loaded = cloneErrorMarker();
-            }
+            SceneUtil::ProcessExtraDataVisitor extraDataVisitor(this);
+            loaded->accept(extraDataVisitor);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to load '" << normalized << "': " << e.what()
+                              << ", using marker_error instead";
+            loaded = cloneErrorMarker();
+        }
 
-            // set filtering settings
-            SetFilterSettingsVisitor setFilterSettingsVisitor(mMinFilter, mMagFilter, mMaxAnisotropy);
-            loaded->accept(setFilterSettingsVisitor);
-            SetFilterSettingsControllerVisitor setFilterSettingsControllerVisitor(
-                mMinFilter, mMagFilter, mMaxAnisotropy);
-            loaded->accept(setFilterSettingsControllerVisitor);
+        // set filtering settings
+        SetFilterSettingsVisitor setFilterSettingsVisitor(mMinFilter, mMagFilter, mMaxAnisotropy);
+        loaded->accept(setFilterSettingsVisitor);
+        SetFilterSettingsControllerVisitor setFilterSettingsControllerVisitor(
+            mMinFilter, mMagFilter, mMaxAnisotropy);
+        loaded->accept(setFilterSettingsControllerVisitor);
 
-            SceneUtil::ReplaceDepthVisitor replaceDepthVisitor;
-            loaded->accept(replaceDepthVisitor);
+        if (mAutoCompressTextures)
+        {
+            CompressTexturesVisitor compressTexturesVisitor;
+            loaded->accept(compressTexturesVisitor);
+        }
 
-            osg::ref_ptr<Shader::ShaderVisitor> shaderVisitor(createShaderVisitor());
-            loaded->accept(*shaderVisitor);
+        SceneUtil::ReplaceDepthVisitor replaceDepthVisitor;
+        loaded->accept(replaceDepthVisitor);
 
-            if (canOptimize(normalized))
-            {
-                SceneUtil::Optimizer optimizer;
-                optimizer.setSharedStateManager(mSharedStateManager, &mSharedStateMutex);
-                optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
+        osg::ref_ptr<Shader::ShaderVisitor> shaderVisitor(createShaderVisitor());
+        loaded->accept(*shaderVisitor);
 
-                static const unsigned int options
-                    = getOptimizationOptions() | SceneUtil::Optimizer::SHARE_DUPLICATE_STATE;
+        if (canOptimize(normalized))
+        {
+            SceneUtil::Optimizer optimizer;
+            optimizer.setSharedStateManager(mSharedStateManager, &mSharedStateMutex);
+            optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
 
-                optimizer.optimize(loaded, options);
-            }
-            else
-                shareState(loaded);
+            static const unsigned int options
+                = getOptimizationOptions() | SceneUtil::Optimizer::SHARE_DUPLICATE_STATE;
 
-            if (compile && mIncrementalCompileOperation)
-                mIncrementalCompileOperation->add(loaded);
-            else
-                loaded->getBound();
+            optimizer.optimize(loaded, options);
+        }
+        else
+            shareState(loaded);
+
+        if (compile && mIncrementalCompileOperation)
+            mIncrementalCompileOperation->add(loaded);
+        else
+            loaded->getBound();
+
+        mCache->addEntryToObjectCache(normalized, loaded);
+        return loaded;
+    }
+
+    osg::ref_ptr<TemplateRequest> SceneManager::requestTemplate(std::string_view name, bool compile)
+    {
+        VFS::Path::Normalized normalized(name);
+
+        if (osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized))
+        {
+            osg::ref_ptr<TemplateRequest> request(new TemplateRequest(*this, std::move(normalized), compile));
+            request->mNode = static_cast<osg::Node*>(obj.get());
+            request->signalDone();
+            return request;
+        }
 
-            mCache->addEntryToObjectCache(normalized, loaded);
-            return loaded;
+        osg::ref_ptr<TemplateRequest> request;
+        {
+            const std::lock_guard<std::mutex> lock(mPendingTemplatesMutex);
+            osg::ref_ptr<TemplateRequest>& pending = mPendingTemplates[normalized];
+            if (pending != nullptr)
+                return pending;
+            pending = new TemplateRequest(*this, std::move(normalized), compile);
+            request = pending;
+        }
+
+        if (mWorkQueue != nullptr)
+        {
+            // Demand loads are urgent so they are not stuck behind cell preloading.
+            mWorkQueue->addWorkItem(request, SceneUtil::WorkPriority::Urgent);
+        }
+        else
+        {
+            // No work queue: load synchronously like getTemplate() would.
+            request->doWork();
+            request->signalDone();
+        }
+        return request;
+    }
+
+    osg::ref_ptr<TemplateRequest> SceneManager::findPendingTemplate(const VFS::Path::Normalized& normalized)
+    {
+        const std::lock_guard<std::mutex> lock(mPendingTemplatesMutex);
+        const auto it = mPendingTemplates.find(normalized);
+        if (it == mPendingTemplates.end())
+            return nullptr;
+        return it->second;
+    }
+
+    void SceneManager::removePendingTemplate(const TemplateRequest& request)
+    {
+        const std::lock_guard<std::mutex> lock(mPendingTemplatesMutex);
+        const auto it = mPendingTemplates.find(request.mPath);
+        if (it != mPendingTemplates.end() && it->second.get() == &request)
+            mPendingTemplates.erase(it);
+    }
+
+    void TemplateRequest::doWork()
+    {
+        mStarted = true;
+        try
+        {
+            if (osg::ref_ptr<osg::Object> obj = mSceneManager.mCache->getRefFromObjectCache(mPath))
+                mNode = static_cast<osg::Node*>(obj.get());
+            else
+                mNode = mSceneManager.loadTemplate(mPath, mCompile);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to load '" << mPath << "': " << e.what();
         }
+        mSceneManager.removePendingTemplate(*this);
     }
 
     osg::ref_ptr<osg::Node> SceneManager::getInstance(std::string_view name)
@@ -1104,6 +1245,9 @@ namespace Resource
     void SceneManager::setIncrementalCompileOperation(osgUtil::IncrementalCompileOperation* ico)
     {
         mIncrementalCompileOperation = ico;
+        // Pass it on so that shader programs created outside of the template loading path (water,
+        // sky, postprocessing, settings changes) are linked in the background as well.
+        mShaderManager->setIncrementalCompileOperation(ico);
     }
 
     osgUtil::IncrementalCompileOperation* SceneManager::getIncrementalCompileOperation()
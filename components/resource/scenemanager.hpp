@@ -2,6 +2,8 @@
 #define OPENMW_COMPONENTS_RESOURCE_SCENEMANAGER_H
 
 #include <array>
+#include <atomic>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -12,6 +14,8 @@
 #include "resourcemanager.hpp"
 
 #include <components/sceneutil/lightmanager.hpp>
+#include <components/sceneutil/workqueue.hpp>
+#include <components/vfs/pathutil.hpp>
 #include <filesystem>
 
 namespace VFS
@@ -84,6 +88,43 @@ namespace Resource
         std::vector<osg::ref_ptr<const Object>> mObjects;
     };
 
+    class SceneManager;
+
+    /// @brief A scene template load in flight on the scene manager's work queue.
+    /// @see SceneManager::requestTemplate
+    class TemplateRequest : public SceneUtil::WorkItem
+    {
+    public:
+        TemplateRequest(SceneManager& sceneManager, VFS::Path::Normalized path, bool compile)
+            : mSceneManager(sceneManager)
+            , mPath(std::move(path))
+            , mCompile(compile)
+        {
+        }
+
+        /// Wait for the load to finish and return the loaded template, or nullptr if loading failed.
+        /// @note Thread safe.
+        osg::ref_ptr<const osg::Node> getNode()
+        {
+            waitTillDone();
+            return mNode;
+        }
+
+        /// Whether a worker thread has picked up the request yet.
+        bool hasStarted() const { return mStarted; }
+
+        void doWork() override;
+
+    private:
+        friend class SceneManager;
+
+        SceneManager& mSceneManager;
+        VFS::Path::Normalized mPath;
+        bool mCompile;
+        std::atomic_bool mStarted{ false };
+        osg::ref_ptr<const osg::Node> mNode;
+    };
+
     /// @brief Handles loading and caching of scenes, e.g. .nif files or .osg files
     /// @note Some methods of the scene manager can be used from any thread, see the methods documentation for more
     /// details.
@@ -160,6 +201,18 @@ namespace Resource
         /// @note Thread safe.
         osg::ref_ptr<const osg::Node> getTemplate(std::string_view name, bool compile = true);
 
+        /// Set up a work queue used to load templates requested through requestTemplate() in the background.
+        /// @note The work queue must be destroyed (joining its threads) before this scene manager.
+        void setWorkQueue(SceneUtil::WorkQueue* workQueue) { mWorkQueue = workQueue; }
+
+        /// Begin loading the given scene template on the work queue and return a handle to the load in
+        /// flight. Requests for a template that is already pending share one load, and getTemplate() joins
+        /// a running load instead of starting a second one. When no work queue is set the template is
+        /// loaded synchronously before returning.
+        /// @see getTemplate
+        /// @note Thread safe.
+        osg::ref_ptr<TemplateRequest> requestTemplate(std::string_view name, bool compile = true);
+
         /// Clone osg::Node safely.
         /// @note Thread safe.
         static osg::ref_ptr<osg::Node> cloneNode(const osg::Node* base);
@@ -215,6 +268,11 @@ namespace Resource
         /// contexts, otherwise should be disabled to reduce memory usage.
         void setUnRefImageDataAfterApply(bool unref);
 
+        /// Ask the driver to compress uncompressed textures when they are first uploaded, trading some upload
+        /// time and image quality for a large reduction in texture memory. Only affects objects loaded through
+        /// this scene manager.
+        void setAutoCompressTextures(bool enabled) { mAutoCompressTextures = enabled; }
+
         /// @see ResourceManager::updateCache
         void updateCache(double referenceTime) override;
 
@@ -233,9 +291,14 @@ namespace Resource
         void setWeatherParticleOcclusion(bool value) { mWeatherParticleOcclusion = value; }
 
     private:
+        friend class TemplateRequest;
+
         osg::ref_ptr<Shader::ShaderVisitor> createShaderVisitor(const std::string& shaderPrefix = "objects");
         osg::ref_ptr<osg::Node> loadErrorMarker();
         osg::ref_ptr<osg::Node> cloneErrorMarker();
+        osg::ref_ptr<const osg::Node> loadTemplate(const VFS::Path::Normalized& normalized, bool compile);
+        osg::ref_ptr<TemplateRequest> findPendingTemplate(const VFS::Path::Normalized& normalized);
+        void removePendingTemplate(const TemplateRequest& request);
 
         std::unique_ptr<Shader::ShaderManager> mShaderManager;
         bool mForceShaders;
@@ -265,6 +328,7 @@ namespace Resource
         osg::Texture::FilterMode mMinFilter;
         osg::Texture::FilterMode mMagFilter;
         int mMaxAnisotropy;
+        bool mAutoCompressTextures = false;
         bool mUnRefImageDataAfterApply;
 
         osg::ref_ptr<osgUtil::IncrementalCompileOperation> mIncrementalCompileOperation;
@@ -272,6 +336,10 @@ namespace Resource
         unsigned int mParticleSystemMask;
         mutable osg::ref_ptr<osg::Node> mErrorMarker;
 
+        SceneUtil::WorkQueue* mWorkQueue = nullptr;
+        std::mutex mPendingTemplatesMutex;
+        std::map<VFS::Path::Normalized, osg::ref_ptr<TemplateRequest>, std::less<>> mPendingTemplates;
+
         SceneManager(const SceneManager&);
         void operator=(const SceneManager&);
     };
@@ -1,14 +1,19 @@
 #include "stats.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <limits>
+#include <ostream>
 #include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <osg/PolygonMode>
+#include <osg/Stats>
 
 #include <osgText/Font>
 #include <osgText/Text>
@@ -47,6 +52,22 @@ namespace Resource
         bool collectStatUpdate = false;
         bool collectStatEngine = false;
 
+        void writeJsonString(std::string_view value, std::ostream& out)
+        {
+            out << '"';
+            for (const char c : value)
+            {
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                        << std::setfill(' ');
+                else
+                    out << c;
+            }
+            out << '"';
+        }
+
         std::vector<std::string> generateAllStatNames()
         {
             constexpr std::size_t itemsPerPage = 24;
@@ -59,7 +80,7 @@ namespace Resource
                 "WorkQueue",
                 "WorkThread",
                 "UnrefQueue",
-                "",
+                "UnrefBacklog",
                 "Texture",
                 "StateSet",
                 "Composite",
@@ -74,8 +95,8 @@ namespace Resource
                 "",
                 "Lua UsedMemory",
                 "",
-                "",
-                "",
+                "Occlusion Tested",
+                "Occlusion Culled",
             };
 
             static_assert(std::size(firstPage) == itemsPerPage);
@@ -94,6 +115,7 @@ namespace Resource
                 "Terrain Texture",
                 "Land",
                 "Blending Rules",
+                "BSA Decompress",
             };
 
             constexpr std::string_view cellPreloader[] = {
@@ -102,6 +124,7 @@ namespace Resource
                 "CellPreloader Evicted",
                 "CellPreloader Loaded",
                 "CellPreloader Expired",
+                "CellPreloader Deferred",
             };
 
             constexpr std::string_view navMesh[] = {
@@ -617,4 +640,25 @@ namespace Resource
         if (collectStatEngine)
             viewer.getViewerStats()->collectStats("engine", true);
     }
+
+    void reportStatsJson(const osg::Stats& stats, unsigned frameNumber, std::ostream& out)
+    {
+        const auto oldPrecision = out.precision(std::numeric_limits<double>::max_digits10);
+        out << "{\"frame\":" << frameNumber << ",\"attributes\":{";
+        bool first = true;
+        for (const auto& [name, value] : stats.getAttributeMap(frameNumber))
+        {
+            if (!std::exchange(first, false))
+                out << ',';
+            writeJsonString(name, out);
+            out << ':';
+            if (std::isfinite(value))
+                out << value;
+            else
+                out << "null";
+        }
+        // Flush per line so the file can be tailed while the process is running.
+        out << "}}" << std::endl;
+        out.precision(oldPrecision);
+    }
 }
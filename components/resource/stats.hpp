@@ -1,6 +1,8 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_STATS_H
 #define OPENMW_COMPONENTS_RESOURCE_STATS_H
 
+#include <iosfwd>
+
 #include <osgViewer/ViewerEventHandlers>
 
 namespace osgViewer
@@ -10,6 +12,7 @@ namespace osgViewer
 
 namespace osg
 {
+    class Stats;
     class Switch;
 }
 
@@ -69,6 +72,11 @@ namespace Resource
     };
 
     void collectStatistics(osgViewer::ViewerBase& viewer);
+
+    /// Writes all attributes recorded for the given frame as a single JSON object on one line
+    /// ({"frame":<n>,"attributes":{"<name>":<value>,...}}), so external telemetry can consume the
+    /// cache and resource metrics without parsing the on-screen stats format.
+    void reportStatsJson(const osg::Stats& stats, unsigned frameNumber, std::ostream& out);
 }
 
 #endif
@@ -1131,6 +1131,8 @@ namespace SceneUtil
         {
             it = mLightsInViewSpace.insert(std::make_pair(camPtr, LightSourceViewBoundCollection())).first;
 
+            osg::CullingSet& cullingSet = cv->getModelViewCullingStack().front();
+
             for (const auto& transform : mLights)
             {
                 osg::Matrixf worldViewMat = transform.mWorldMatrix * (*viewMatrix);
@@ -1140,6 +1142,15 @@ namespace SceneUtil
                 osg::BoundingSphere viewBound(osg::Vec3f(), radius * mPointLightRadiusMultiplier);
                 transformBoundingSphere(worldViewMat, viewBound);
 
+                // A light volume that does not intersect the view frustum cannot light any
+                // visible surface, so cull it here before any per-drawable work happens.
+                // The postprocessing light buffer collects lights with twice their radius
+                // below, so test against the wider of the two bounds.
+                osg::BoundingSphere frustumBound(
+                    viewBound.center(), radius * std::max(mPointLightRadiusMultiplier, 2.f));
+                if (cullingSet.isCulled(frustumBound))
+                    continue;
+
                 if (transform.mLightSource->getLastAppliedFrame() != frameNum && mPointLightFadeEnd != 0.f)
                 {
                     const float fadeDelta = mPointLightFadeEnd - mPointLightFadeStart;
@@ -1317,16 +1328,18 @@ namespace SceneUtil
             if (mLightList.size() > maxLights)
             {
                 // Sort by proximity to object: prefer closer lights with larger radius
-                std::sort(mLightList.begin(), mLightList.end(),
-                    [&](const SceneUtil::LightManager::LightSourceViewBound* left,
-                        const SceneUtil::LightManager::LightSourceViewBound* right) {
-                        const float leftDist = (nodeBound.center() - left->mViewBound.center()).length2();
-                        const float rightDist = (nodeBound.center() - right->mViewBound.center()).length2();
-                        // A tricky way to compare normalized distance. This avoids division by near zero
-                        return left->mViewBound.radius() * rightDist > right->mViewBound.radius() * leftDist;
-                    });
+                const auto sorter = [&](const SceneUtil::LightManager::LightSourceViewBound* left,
+                                        const SceneUtil::LightManager::LightSourceViewBound* right) {
+                    const float leftDist = (nodeBound.center() - left->mViewBound.center()).length2();
+                    const float rightDist = (nodeBound.center() - right->mViewBound.center()).length2();
+                    // A tricky way to compare normalized distance. This avoids division by near zero
+                    return left->mViewBound.radius() * rightDist > right->mViewBound.radius() * leftDist;
+                };
 
+                // only the lights that make the cut need to be fully sorted
+                std::nth_element(mLightList.begin(), mLightList.begin() + maxLights, mLightList.end(), sorter);
                 mLightList.resize(maxLights);
+                std::sort(mLightList.begin(), mLightList.end(), sorter);
             }
         }
 
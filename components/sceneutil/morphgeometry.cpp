@@ -2,7 +2,10 @@
 
 #include <osgUtil/CullVisitor>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+
 #include <components/resource/scenemanager.hpp>
 
 namespace SceneUtil
@@ -34,6 +37,9 @@ namespace SceneUtil
 
         for (unsigned int i = 0; i < 2; ++i)
         {
+            // the fresh clone below holds unmorphed vertex data again
+            mAppliedWeights[i].clear();
+
             // DO NOT COPY AND PASTE THIS CODE. Cloning osg::Geometry without also cloning its contained Arrays is
             // generally unsafe. In this specific case the operation is safe under the following two assumptions:
             // - When Arrays are removed or replaced in the cloned geometry, the original Arrays in their place must
@@ -188,22 +194,76 @@ namespace SceneUtil
         const osg::Vec3Array* positionSrc = mMorphTargets[0].getOffsets();
         osg::Vec3Array* positionDst = static_cast<osg::Vec3Array*>(geom.getVertexArray());
         assert(positionSrc->size() == positionDst->size());
-        for (unsigned int vertex = 0; vertex < positionSrc->size(); ++vertex)
-            (*positionDst)[vertex] = (*positionSrc)[vertex];
+        const unsigned int numVertices = positionDst->size();
 
+        // Determine the range of vertices each morph target can affect. Morph targets driven by
+        // NiGeomMorpherController (e.g. facial animation) typically cover a small part of the mesh.
+        mTargetRanges.resize(mMorphTargets.size());
         for (unsigned int i = 1; i < mMorphTargets.size(); ++i)
         {
-            float weight = mMorphTargets[i].getWeight();
-            if (weight == 0.f)
-                continue;
+            TargetRange& range = mTargetRanges[i];
             const osg::Vec3Array* offsets = mMorphTargets[i].getOffsets();
-            for (unsigned int vertex = 0; vertex < positionSrc->size(); ++vertex)
-                (*positionDst)[vertex] += (*offsets)[vertex] * weight;
+            if (range.mOffsets == offsets)
+                continue;
+            range.mOffsets = offsets;
+            unsigned int end = std::min(static_cast<unsigned int>(offsets->size()), numVertices);
+            unsigned int begin = 0;
+            while (begin < end && (*offsets)[begin] == osg::Vec3f())
+                ++begin;
+            while (end > begin && (*offsets)[end - 1] == osg::Vec3f())
+                --end;
+            range.mBegin = begin;
+            range.mEnd = end;
         }
 
-        positionDst->dirty();
+        // Vertices outside the ranges of the targets whose weight changed since this buffer was
+        // last written are still up to date, so only the union of those ranges must be re-blended.
+        std::vector<float>& appliedWeights = mAppliedWeights[mLastFrameNumber % 2];
+        unsigned int begin = 0;
+        unsigned int end = numVertices;
+        if (appliedWeights.size() != mMorphTargets.size())
+            appliedWeights.resize(mMorphTargets.size());
+        else
+        {
+            begin = numVertices;
+            end = 0;
+            for (unsigned int i = 1; i < mMorphTargets.size(); ++i)
+            {
+                if (mMorphTargets[i].getWeight() == appliedWeights[i])
+                    continue;
+                begin = std::min(begin, mTargetRanges[i].mBegin);
+                end = std::max(end, mTargetRanges[i].mEnd);
+            }
+        }
+        for (unsigned int i = 1; i < mMorphTargets.size(); ++i)
+            appliedWeights[i] = mMorphTargets[i].getWeight();
+
+        if (begin < end)
+        {
+            // blend the dirty range from scratch, on raw floats so that the compiler can vectorize
+            std::memcpy(&(*positionDst)[begin], &(*positionSrc)[begin], (end - begin) * sizeof(osg::Vec3f));
 
-        geom.osg::Drawable::dirtyGLObjects();
+            for (unsigned int i = 1; i < mMorphTargets.size(); ++i)
+            {
+                const float weight = mMorphTargets[i].getWeight();
+                if (weight == 0.f)
+                    continue;
+                const TargetRange& range = mTargetRanges[i];
+                const unsigned int blendBegin = std::max(begin, range.mBegin);
+                const unsigned int blendEnd = std::min(end, range.mEnd);
+                if (blendBegin >= blendEnd)
+                    continue;
+                float* dst = (*positionDst)[blendBegin].ptr();
+                const float* offsets = (*range.mOffsets)[blendBegin].ptr();
+                const unsigned int count = (blendEnd - blendBegin) * 3;
+                for (unsigned int component = 0; component < count; ++component)
+                    dst[component] += offsets[component] * weight;
+            }
+
+            positionDst->dirty();
+
+            geom.osg::Drawable::dirtyGLObjects();
+        }
 
         nv->pushOntoNodePath(&geom);
         nv->apply(geom);
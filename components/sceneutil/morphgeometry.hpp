@@ -83,6 +83,19 @@ namespace SceneUtil
         osg::ref_ptr<osg::Geometry> mGeometry[2];
         osg::Geometry* getGeometry(unsigned int frame) const;
 
+        // Range of vertices with non-zero offsets per morph target, so that targets covering
+        // only a small part of the mesh (e.g. facial morphs) do not rewrite the whole array.
+        struct TargetRange
+        {
+            const osg::Vec3Array* mOffsets = nullptr;
+            unsigned int mBegin = 0;
+            unsigned int mEnd = 0;
+        };
+        std::vector<TargetRange> mTargetRanges;
+
+        // Weights last applied to each of the double buffered geometries.
+        std::vector<float> mAppliedWeights[2];
+
         unsigned int mLastFrameNumber;
         bool mDirty; // Have any morph targets changed?
 
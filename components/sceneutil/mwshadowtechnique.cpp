@@ -1177,6 +1177,60 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
     //    create a list of light sources + their matrices to place them
     selectActiveLights(&cv, vdd);
 
+    unsigned int numShadowMapsPerLight = settings->getNumShadowMapsPerLight();
+
+    LightDataList& pll = vdd->getLightDataList();
+
+    // Re-use the shadow maps of the previous frame when both the view and the light are at rest.
+    // The cascades are fitted to the view frustum, so they are only valid for re-use while the
+    // main camera does not move; the light direction is allowed a tiny drift so that imperceptibly
+    // slow sun movement does not defeat the cache. A cached result is never used for two frames in
+    // a row, so shadows of animated casters still update at no less than half the frame rate.
+    {
+        ViewDependentData::StationaryViewState& svs = vdd->_stationaryViewState;
+        bool reuseShadowMaps = false;
+        if (!frustum.useCustomClipSpace && !_debugHud && pll.size() == 1 && pll.front()->directionalLight)
+        {
+            const LightData& pl = *pll.front();
+            constexpr double lightDirEpsilon = 1.0e-3; // ~0.06 degrees for a normalized direction
+            const bool stationary = svs._projectionMatrix == frustum.projectionMatrix
+                && svs._modelViewMatrix == frustum.modelViewMatrix
+                && svs._reducedNear == reducedNear
+                && svs._reducedFar == reducedFar
+                && svs._numShadowMaps == numShadowMapsPerLight
+                && svs._castMask == _shadowedScene->getCastsShadowTraversalMask()
+                && (svs._lightPos - pl.lightPos).length2() < lightDirEpsilon * lightDirEpsilon
+                && (svs._lightDir - pl.lightDir).length2() < lightDirEpsilon * lightDirEpsilon;
+
+            if (stationary)
+                ++svs._stableFrames;
+            else
+                svs._stableFrames = 0;
+
+            svs._projectionMatrix = frustum.projectionMatrix;
+            svs._modelViewMatrix = frustum.modelViewMatrix;
+            svs._reducedNear = reducedNear;
+            svs._reducedFar = reducedFar;
+            svs._numShadowMaps = numShadowMapsPerLight;
+            svs._castMask = _shadowedScene->getCastsShadowTraversalMask();
+            svs._lightPos = pl.lightPos;
+            svs._lightDir = pl.lightDir;
+
+            // The per-frame uniforms are double buffered, so both buffers must have been filled
+            // with the current configuration before a frame can be skipped.
+            reuseShadowMaps = svs._stableFrames >= 3 && !svs._reusedLastFrame && vdd->numValidShadows() > 0
+                && vdd->getShadowDataList().size() == numShadowMapsPerLight;
+        }
+        else
+            svs._stableFrames = 0;
+
+        svs._reusedLastFrame = reuseShadowMaps;
+        if (reuseShadowMaps)
+        {
+            prepareStateSetForRenderingShadow(*vdd, cv.getTraversalNumber());
+            return;
+        }
+    }
 
     unsigned int pos_x = 0;
     unsigned int textureUnit = settings->getBaseShadowTextureUnit();
@@ -1185,10 +1239,6 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
     ShadowDataList& sdl = vdd->getShadowDataList();
     ShadowDataList previous_sdl;
     previous_sdl.swap(sdl);
-
-    unsigned int numShadowMapsPerLight = settings->getNumShadowMapsPerLight();
-
-    LightDataList& pll = vdd->getLightDataList();
     for(LightDataList::iterator itr = pll.begin();
         itr != pll.end();
         ++itr)
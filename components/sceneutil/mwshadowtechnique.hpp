@@ -222,6 +222,23 @@ namespace SceneUtil {
             friend class MWShadowTechnique;
             virtual ~ViewDependentData() {}
 
+            /** State for re-using the shadow maps of the previous frame when neither the view
+              * nor the light moved, see MWShadowTechnique::cull(). */
+            struct StationaryViewState
+            {
+                osg::Matrixd                _projectionMatrix;
+                osg::Matrixd                _modelViewMatrix;
+                double                      _reducedNear = 0.0;
+                double                      _reducedFar = 0.0;
+                osg::Vec4d                  _lightPos;
+                osg::Vec3d                  _lightDir;
+                unsigned int                _numShadowMaps = 0;
+                unsigned int                _castMask = 0;
+                unsigned int                _stableFrames = 0;
+                bool                        _reusedLastFrame = false;
+            };
+            StationaryViewState         _stationaryViewState;
+
             MWShadowTechnique*          _viewDependentShadowMap;
 
             std::array<osg::ref_ptr<osg::StateSet>, 2> _stateset;
@@ -39,6 +39,7 @@
 
 #include <iterator>
 #include <cassert>
+#include <cstring>
 
 #include <components/sceneutil/depth.hpp>
 
@@ -84,6 +85,15 @@ void Optimizer::optimize(osg::Node* node, unsigned int options)
         cstv.removeTransforms(node);
     }
 
+    if (options & TEXTURE_ATLAS_BUILDER)
+    {
+        OSG_INFO<<"Optimizer::optimize() doing TEXTURE_ATLAS_BUILDER"<<std::endl;
+
+        TextureAtlasVisitor tav(this);
+        node->accept(tav);
+        tav.buildAtlases();
+    }
+
     if (options & SHARE_DUPLICATE_STATE && _sharedStateManager)
     {
         if (_sharedStateMutex) _sharedStateMutex->lock();
@@ -949,6 +959,275 @@ void Optimizer::RemoveRedundantNodesVisitor::removeRedundantNodes()
 
 
 
+////////////////////////////////////////////////////////////////////////////
+// code to pack compatible textures into atlases so that the geometry using
+// them can subsequently be merged by the MergeGeometryVisitor.
+////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+bool isPowerOfTwo(int value)
+{
+    return value>0 && (value & (value-1))==0;
+}
+
+unsigned int nextPowerOfTwo(unsigned int value)
+{
+    unsigned int result = 1;
+    while (result<value) result <<= 1;
+    return result;
+}
+
+}
+
+void Optimizer::TextureAtlasVisitor::apply(osg::Geometry& geometry)
+{
+    osg::StateSet* stateset = geometry.getStateSet();
+    if (stateset &&
+        isOperationPermissibleForObject(&geometry) &&
+        isCandidateStateSet(stateset) &&
+        isCandidateGeometry(geometry))
+    {
+        GeometryList& geometries = _stateSetGeometries[stateset];
+        if (std::find(geometries.begin(), geometries.end(), &geometry)==geometries.end())
+            geometries.push_back(&geometry);
+    }
+}
+
+osg::Texture2D* Optimizer::TextureAtlasVisitor::getCandidateTexture(osg::StateSet* stateset)
+{
+    return dynamic_cast<osg::Texture2D*>(stateset->getTextureAttribute(0, osg::StateAttribute::TEXTURE));
+}
+
+bool Optimizer::TextureAtlasVisitor::isCandidateStateSet(osg::StateSet* stateset) const
+{
+    if (stateset->getDataVariance()==osg::Object::DYNAMIC ||
+        stateset->getUpdateCallback() ||
+        stateset->getEventCallback() ||
+        !isOperationPermissibleForObject(stateset))
+        return false;
+
+    // only plain single textured state can be atlased: a texture matrix or texture
+    // coordinate generation would invalidate the remapped texture coordinates, and
+    // additional texture units (e.g. detected normal maps) would need an atlas of
+    // their own that we cannot guarantee to pack identically.
+    if (stateset->getTextureAttribute(0, osg::StateAttribute::TEXMAT) ||
+        stateset->getTextureAttribute(0, osg::StateAttribute::TEXGEN))
+        return false;
+    for (unsigned int unit=1; unit<stateset->getTextureAttributeList().size(); ++unit)
+    {
+        if (stateset->getTextureAttribute(unit, osg::StateAttribute::TEXTURE))
+            return false;
+    }
+
+    osg::Texture2D* texture = getCandidateTexture(stateset);
+    return texture && isCandidateTexture(texture) && isOperationPermissibleForObject(texture);
+}
+
+bool Optimizer::TextureAtlasVisitor::isCandidateTexture(const osg::Texture2D* texture)
+{
+    const osg::Image* image = texture->getImage();
+    return image &&
+           image->valid() &&
+           image->data() &&
+           !image->isCompressed() &&
+           image->getNumMipmapLevels()<=1 &&
+           image->r()<=1 &&
+           isPowerOfTwo(image->s()) && isPowerOfTwo(image->t()) &&
+           image->s()>=4 && image->t()>=4 &&
+           image->s()<=512 && image->t()<=512 &&
+           texture->getBorderWidth()==0;
+}
+
+bool Optimizer::TextureAtlasVisitor::areTexturesCompatible(const osg::Texture2D* lhs, const osg::Texture2D* rhs)
+{
+    const osg::Image* lhsImage = lhs->getImage();
+    const osg::Image* rhsImage = rhs->getImage();
+    return lhsImage->s()==rhsImage->s() &&
+           lhsImage->t()==rhsImage->t() &&
+           lhsImage->getPixelFormat()==rhsImage->getPixelFormat() &&
+           lhsImage->getDataType()==rhsImage->getDataType() &&
+           lhsImage->getInternalTextureFormat()==rhsImage->getInternalTextureFormat() &&
+           lhs->getFilter(osg::Texture::MIN_FILTER)==rhs->getFilter(osg::Texture::MIN_FILTER) &&
+           lhs->getFilter(osg::Texture::MAG_FILTER)==rhs->getFilter(osg::Texture::MAG_FILTER) &&
+           lhs->getInternalFormatMode()==rhs->getInternalFormatMode();
+}
+
+bool Optimizer::TextureAtlasVisitor::isCandidateGeometry(const osg::Geometry& geometry) const
+{
+    if (geometry.getDataVariance()==osg::Object::DYNAMIC ||
+        geometry.getUpdateCallback() ||
+        geometry.getEventCallback() ||
+        geometry.getCullCallback())
+        return false;
+
+    const osg::Vec2Array* texcoords = dynamic_cast<const osg::Vec2Array*>(geometry.getTexCoordArray(0));
+    if (!texcoords)
+        return false;
+
+    // texture coordinates outside [0,1] rely on wrapping, which an atlas cannot provide.
+    const float epsilon = 0.001f;
+    for (osg::Vec2Array::const_iterator itr=texcoords->begin(); itr!=texcoords->end(); ++itr)
+    {
+        if (itr->x()<-epsilon || itr->x()>1.f+epsilon || itr->y()<-epsilon || itr->y()>1.f+epsilon)
+            return false;
+    }
+    return true;
+}
+
+void Optimizer::TextureAtlasVisitor::buildAtlases()
+{
+    static const int maximumAtlasSize = 2048;
+
+    struct Source
+    {
+        osg::StateSet* _stateset;
+        osg::Texture2D* _texture;
+        osg::ref_ptr<osg::StateSet> _strippedStateSet;
+    };
+    typedef std::vector<Source> SourceList;
+
+    // group the collected statesets into classes that are identical apart from
+    // their unit 0 texture, and whose textures can share an atlas.
+    std::vector<SourceList> classes;
+    for (StateSetGeometryMap::iterator itr=_stateSetGeometries.begin();
+        itr!=_stateSetGeometries.end();
+        ++itr)
+    {
+        Source source;
+        source._stateset = itr->first;
+        source._texture = getCandidateTexture(itr->first);
+        source._strippedStateSet = new osg::StateSet(*itr->first, osg::CopyOp::SHALLOW_COPY);
+        source._strippedStateSet->removeTextureAttribute(0, osg::StateAttribute::TEXTURE);
+
+        std::vector<SourceList>::iterator citr = classes.begin();
+        for (; citr!=classes.end(); ++citr)
+        {
+            if (areTexturesCompatible(citr->front()._texture, source._texture) &&
+                citr->front()._strippedStateSet->compare(*source._strippedStateSet, true)==0)
+            {
+                citr->push_back(source);
+                break;
+            }
+        }
+        if (citr==classes.end())
+            classes.push_back(SourceList(1, source));
+    }
+
+    for (std::vector<SourceList>::iterator citr=classes.begin();
+        citr!=classes.end();
+        ++citr)
+    {
+        SourceList& sources = *citr;
+
+        // assign one atlas tile per unique texture.
+        typedef std::map<osg::Texture2D*, unsigned int> TextureTileMap;
+        TextureTileMap tiles;
+        std::vector<osg::Texture2D*> textures;
+        for (SourceList::iterator sitr=sources.begin(); sitr!=sources.end(); ++sitr)
+        {
+            if (tiles.insert(TextureTileMap::value_type(sitr->_texture, textures.size())).second)
+                textures.push_back(sitr->_texture);
+        }
+        if (textures.size()<2)
+            continue;
+
+        const osg::Image* prototypeImage = textures.front()->getImage();
+        int tileWidth = prototypeImage->s();
+        int tileHeight = prototypeImage->t();
+        unsigned int maximumColumns = static_cast<unsigned int>(maximumAtlasSize/tileWidth);
+        unsigned int maximumRows = static_cast<unsigned int>(maximumAtlasSize/tileHeight);
+        if (textures.size()>maximumColumns*maximumRows)
+        {
+            // more textures than fit into a single atlas; not worth chasing in practice.
+            OSG_INFO<<"TextureAtlasVisitor: skipping class with "<<textures.size()<<" textures, exceeds atlas capacity"<<std::endl;
+            continue;
+        }
+
+        unsigned int columns = 1;
+        while (columns*columns<textures.size()) columns <<= 1;
+        columns = std::min(columns, maximumColumns);
+        unsigned int rows = (textures.size()+columns-1)/columns;
+
+        int atlasWidth = static_cast<int>(columns)*tileWidth;
+        int atlasHeight = static_cast<int>(nextPowerOfTwo(rows))*tileHeight;
+
+        osg::ref_ptr<osg::Image> atlasImage = new osg::Image;
+        atlasImage->allocateImage(atlasWidth, atlasHeight, 1, prototypeImage->getPixelFormat(), prototypeImage->getDataType(), 1);
+        atlasImage->setInternalTextureFormat(prototypeImage->getInternalTextureFormat());
+        memset(atlasImage->data(), 0, atlasImage->getTotalSizeInBytes());
+
+        unsigned int tightRowSize = osg::Image::computeRowWidthInBytes(tileWidth, prototypeImage->getPixelFormat(), prototypeImage->getDataType(), 1);
+        for (unsigned int tile=0; tile<textures.size(); ++tile)
+        {
+            const osg::Image* image = textures[tile]->getImage();
+            int column = static_cast<int>(tile%columns)*tileWidth;
+            int row = static_cast<int>(tile/columns)*tileHeight;
+            for (int y=0; y<tileHeight; ++y)
+                memcpy(atlasImage->data(column, row+y), image->data(0, y), tightRowSize);
+        }
+
+        osg::Texture2D* prototypeTexture = textures.front();
+        osg::ref_ptr<osg::Texture2D> atlasTexture = new osg::Texture2D(atlasImage);
+        atlasTexture->setFilter(osg::Texture::MIN_FILTER, prototypeTexture->getFilter(osg::Texture::MIN_FILTER));
+        atlasTexture->setFilter(osg::Texture::MAG_FILTER, prototypeTexture->getFilter(osg::Texture::MAG_FILTER));
+        atlasTexture->setMaxAnisotropy(prototypeTexture->getMaxAnisotropy());
+        atlasTexture->setInternalFormatMode(prototypeTexture->getInternalFormatMode());
+        atlasTexture->setUnRefImageDataAfterApply(prototypeTexture->getUnRefImageDataAfterApply());
+        atlasTexture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
+        atlasTexture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
+
+        // a single stateset shared by all remapped geometry - the MergeGeometryVisitor
+        // compares statesets by pointer, so this is what makes the merge possible.
+        osg::ref_ptr<osg::StateSet> atlasStateSet = new osg::StateSet(*sources.front()._stateset, osg::CopyOp::SHALLOW_COPY);
+        atlasStateSet->setTextureAttribute(0, atlasTexture);
+
+        // texture coordinate arrays may be shared, also with geometry that is not
+        // remapped, so rewritten arrays are cached per source array and tile and
+        // never modified in place.
+        typedef std::map<std::pair<const osg::Array*, unsigned int>, osg::ref_ptr<osg::Vec2Array> > RemappedArrayMap;
+        RemappedArrayMap remappedArrays;
+
+        for (SourceList::iterator sitr=sources.begin(); sitr!=sources.end(); ++sitr)
+        {
+            unsigned int tile = tiles[sitr->_texture];
+
+            // inset the coordinates by half a texel so that bilinear filtering does not
+            // bleed in neighbouring tiles.
+            float scaleU = static_cast<float>(tileWidth-1)/static_cast<float>(atlasWidth);
+            float scaleV = static_cast<float>(tileHeight-1)/static_cast<float>(atlasHeight);
+            float offsetU = (static_cast<float>((tile%columns)*tileWidth)+0.5f)/static_cast<float>(atlasWidth);
+            float offsetV = (static_cast<float>((tile/columns)*tileHeight)+0.5f)/static_cast<float>(atlasHeight);
+
+            GeometryList& geometries = _stateSetGeometries[sitr->_stateset];
+            for (GeometryList::iterator gitr=geometries.begin(); gitr!=geometries.end(); ++gitr)
+            {
+                osg::Geometry* geometry = *gitr;
+                const osg::Vec2Array* texcoords = static_cast<const osg::Vec2Array*>(geometry->getTexCoordArray(0));
+
+                osg::ref_ptr<osg::Vec2Array>& remapped = remappedArrays[std::make_pair(texcoords, tile)];
+                if (!remapped)
+                {
+                    remapped = new osg::Vec2Array;
+                    remapped->reserve(texcoords->size());
+                    for (osg::Vec2Array::const_iterator titr=texcoords->begin(); titr!=texcoords->end(); ++titr)
+                    {
+                        float u = osg::clampTo(titr->x(), 0.f, 1.f);
+                        float v = osg::clampTo(titr->y(), 0.f, 1.f);
+                        remapped->push_back(osg::Vec2(offsetU + u*scaleU, offsetV + v*scaleV));
+                    }
+                }
+                geometry->setTexCoordArray(0, remapped);
+                geometry->setStateSet(atlasStateSet);
+            }
+        }
+    }
+
+    _stateSetGeometries.clear();
+}
+
+
 ////////////////////////////////////////////////////////////////////////////
 // code to merge geometry object which share, state, and attribute bindings.
 ////////////////////////////////////////////////////////////////////////////
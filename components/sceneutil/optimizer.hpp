@@ -25,7 +25,9 @@
 
 //#include <osgUtil/Export>
 
+#include <map>
 #include <set>
+#include <vector>
 #include <mutex>
 
 namespace osgDB
@@ -390,6 +392,39 @@ class Optimizer
             void apply(osg::Sequence& sequenceNode) override;
         };
 
+        /** Pack the unit 0 textures of statesets that are otherwise identical into
+          * texture atlases and remap the texture coordinates of the affected
+          * geometry, so that the MergeGeometryVisitor can collapse the draw calls
+          * afterwards. Only uncompressed images without baked mipmaps and of equal,
+          * power-of-two size that are referenced with texture coordinates within
+          * [0,1] are packed. */
+        class TextureAtlasVisitor : public BaseOptimizerVisitor
+        {
+            public:
+
+                TextureAtlasVisitor(Optimizer* optimizer=0):
+                    BaseOptimizerVisitor(optimizer, TEXTURE_ATLAS_BUILDER) {}
+
+                void apply(osg::Geometry& geometry) override;
+
+                /** Build the atlases and rewrite the collected statesets and geometries.*/
+                void buildAtlases();
+
+            protected:
+
+                typedef std::vector<osg::Geometry*> GeometryList;
+                typedef std::map<osg::StateSet*, GeometryList> StateSetGeometryMap;
+
+                bool isCandidateStateSet(osg::StateSet* stateset) const;
+                bool isCandidateGeometry(const osg::Geometry& geometry) const;
+
+                static osg::Texture2D* getCandidateTexture(osg::StateSet* stateset);
+                static bool isCandidateTexture(const osg::Texture2D* texture);
+                static bool areTexturesCompatible(const osg::Texture2D* lhs, const osg::Texture2D* rhs);
+
+                StateSetGeometryMap _stateSetGeometries;
+        };
+
         struct GeometryArraySizes
         {
             unsigned mVertex = 0;
@@ -87,9 +87,41 @@ namespace SceneUtil
         }
     }
 
+    OsgAnimationController::AnimationBinding* OsgAnimationController::getAnimationBinding(
+        std::string_view animationName) const
+    {
+        if (mBindingsDirty)
+        {
+            // Resolve the string-keyed channel lookups into direct sampler pointers once, so the
+            // per-frame update does not scan every channel of every track.
+            mAnimationBindings.clear();
+            for (const auto& mergedAnimationTrack : mMergedAnimationTracks)
+            {
+                AnimationBinding& binding = mAnimationBindings[mergedAnimationTrack->getName()];
+                binding.mTracks.push_back(mergedAnimationTrack.get());
+
+                for (const auto& channel : mergedAnimationTrack->getChannels())
+                {
+                    if (channel->getName() != "transform")
+                        continue;
+
+                    if (osgAnimation::MatrixLinearSampler* sampler
+                        = dynamic_cast<osgAnimation::MatrixLinearSampler*>(channel->getSampler()))
+                        binding.mTransformSamplers.emplace(channel->getTargetName(), sampler);
+                }
+            }
+            mBindingsDirty = false;
+        }
+
+        const auto it = mAnimationBindings.find(animationName);
+        if (it == mAnimationBindings.end())
+            return nullptr;
+        return &it->second;
+    }
+
     osg::Matrixf OsgAnimationController::getTransformForNode(float time, const std::string_view name) const
     {
-        std::string animationName;
+        std::string_view animationName;
         float newTime = time;
 
         // Find the correct animation based on time
@@ -104,25 +136,14 @@ namespace SceneUtil
         }
 
         // Find the bone's transform track in animation
-        for (const auto& mergedAnimationTrack : mMergedAnimationTracks)
+        if (const AnimationBinding* binding = getAnimationBinding(animationName))
         {
-            if (mergedAnimationTrack->getName() != animationName)
-                continue;
-
-            const osgAnimation::ChannelList& channels = mergedAnimationTrack->getChannels();
-
-            for (const auto& channel : channels)
+            const auto it = binding->mTransformSamplers.find(name);
+            if (it != binding->mTransformSamplers.end())
             {
-                if (!Misc::StringUtils::ciEqual(name, channel->getTargetName()) || channel->getName() != "transform")
-                    continue;
-
-                if (osgAnimation::MatrixLinearSampler* templateSampler
-                    = dynamic_cast<osgAnimation::MatrixLinearSampler*>(channel->getSampler()))
-                {
-                    osg::Matrixf matrix;
-                    templateSampler->getValueAt(newTime, matrix);
-                    return matrix;
-                }
+                osg::Matrixf matrix;
+                it->second->getValueAt(newTime, matrix);
+                return matrix;
             }
         }
 
@@ -136,11 +157,13 @@ namespace SceneUtil
 
     void OsgAnimationController::update(float time, const std::string& animationName)
     {
-        for (const auto& mergedAnimationTrack : mMergedAnimationTracks)
-        {
-            if (mergedAnimationTrack->getName() == animationName)
-                mergedAnimationTrack->update(time);
-        }
+        AnimationBinding* binding = getAnimationBinding(animationName);
+        if (binding == nullptr || binding->mLastUpdateTime == time)
+            return;
+        binding->mLastUpdateTime = time;
+
+        for (Resource::Animation* track : binding->mTracks)
+            track->update(time);
     }
 
     void OsgAnimationController::operator()(osg::Node* node, osg::NodeVisitor* nv)
@@ -187,5 +210,6 @@ namespace SceneUtil
     void OsgAnimationController::addMergedAnimationTrack(osg::ref_ptr<Resource::Animation> animationTrack)
     {
         mMergedAnimationTracks.emplace_back(animationTrack);
+        mBindingsDirty = true;
     }
 }
@@ -4,11 +4,15 @@
 #include <osg/Node>
 #include <osg/NodeVisitor>
 #include <osg/ref_ptr>
+#include <osgAnimation/Sampler>
 #include <osgAnimation/UpdateMatrixTransform>
 
+#include <unordered_map>
+
 #include "keyframe.hpp"
 #include "nodecallback.hpp"
 
+#include <components/misc/strings/algorithm.hpp>
 #include <components/resource/animation.hpp>
 
 namespace SceneUtil
@@ -75,11 +79,28 @@ namespace SceneUtil
         void addMergedAnimationTrack(osg::ref_ptr<Resource::Animation> animationTrack);
 
     private:
+        struct AnimationBinding
+        {
+            std::vector<Resource::Animation*> mTracks; // owned by mMergedAnimationTracks
+            // Channel target name -> sampler of that target's "transform" channel.
+            std::unordered_map<std::string, osgAnimation::MatrixLinearSampler*, Misc::StringUtils::CiHash,
+                Misc::StringUtils::CiEqual>
+                mTransformSamplers;
+            float mLastUpdateTime = -1.f;
+        };
+
+        /// Get the resolved channel bindings for an animation, or nullptr if there is none.
+        /// Bindings are resolved once and reused since tracks do not change after setup.
+        AnimationBinding* getAnimationBinding(std::string_view animationName) const;
+
         bool mNeedToLink = true;
         osg::ref_ptr<LinkVisitor> mLinker;
         std::vector<osg::ref_ptr<Resource::Animation>>
             mMergedAnimationTracks; // Used only by osgAnimation-based formats (e.g. dae)
         std::vector<EmulatedAnimation> mEmulatedAnimations;
+        mutable std::unordered_map<std::string, AnimationBinding, Misc::StringUtils::StringHash, std::equal_to<>>
+            mAnimationBindings;
+        mutable bool mBindingsDirty = true;
     };
 #ifdef _MSC_VER
 #pragma warning(pop)
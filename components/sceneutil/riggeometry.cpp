@@ -1,5 +1,6 @@
 #include "riggeometry.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include <osg/MatrixTransform>
@@ -38,6 +39,8 @@ namespace SceneUtil
 
         for (unsigned int i = 0; i < 2; ++i)
         {
+            // the fresh clones below hold unskinned vertex data again
+            mAppliedBlendMatrices[i].clear();
             const osg::Geometry& from = *sourceGeometry;
 
             // DO NOT COPY AND PASTE THIS CODE. Cloning osg::Geometry without also cloning its contained Arrays is
@@ -170,11 +173,13 @@ namespace SceneUtil
         osg::Vec3Array* normalDst = static_cast<osg::Vec3Array*>(geom.getNormalArray());
         osg::Vec4Array* tangentDst = static_cast<osg::Vec4Array*>(geom.getTexCoordArray(7));
 
-        for (const auto& [influences, vertices] : mData->mInfluences)
+        const size_t numGroups = mData->mInfluences.size();
+        mBlendMatrices.resize(numGroups);
+        for (size_t group = 0; group < numGroups; ++group)
         {
             osg::Matrixf resultMat(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
 
-            for (const auto& [index, weight] : influences)
+            for (const auto& [index, weight] : mData->mInfluences[group].first)
             {
                 const Bone* bone = mNodes[index];
                 if (bone == nullptr)
@@ -191,29 +196,73 @@ namespace SceneUtil
             if (mGeomToSkelMatrix)
                 resultMat *= (*mGeomToSkelMatrix);
 
+            mBlendMatrices[group] = resultMat;
+        }
+
+        // This buffer was last written two frames ago, so vertices whose blend matrix is
+        // unchanged since then (e.g. only an arm moved, or idle animations that hold most
+        // bones still) are already up to date and can be skipped.
+        std::vector<osg::Matrixf>& appliedMatrices = mAppliedBlendMatrices[mLastFrameNumber % 2];
+        const bool firstRun = appliedMatrices.size() != numGroups;
+        if (firstRun)
+            appliedMatrices.resize(numGroups);
+
+        bool dirty = false;
+        for (size_t group = 0; group < numGroups; ++group)
+        {
+            const osg::Matrixf& resultMat = mBlendMatrices[group];
+            if (!firstRun && appliedMatrices[group] == resultMat)
+                continue;
+            appliedMatrices[group] = resultMat;
+            dirty = true;
+
+            // The blend matrix is affine with column 3 equal to (0,0,0,1), so the perspective
+            // divide of Matrixf::preMult can be omitted. Keeping the matrix in scalars and
+            // streaming each array in its own loop lets the compiler vectorize the transform.
+            const float* mat = resultMat.ptr();
+            const float m00 = mat[0], m01 = mat[1], m02 = mat[2];
+            const float m10 = mat[4], m11 = mat[5], m12 = mat[6];
+            const float m20 = mat[8], m21 = mat[9], m22 = mat[10];
+            const float m30 = mat[12], m31 = mat[13], m32 = mat[14];
+
+            const VertexList& vertices = mData->mInfluences[group].second;
             for (unsigned short vertex : vertices)
             {
-                (*positionDst)[vertex] = resultMat.preMult((*positionSrc)[vertex]);
-                if (normalDst)
-                    (*normalDst)[vertex] = osg::Matrixf::transform3x3((*normalSrc)[vertex], resultMat);
-
-                if (tangentDst)
+                const osg::Vec3f& p = (*positionSrc)[vertex];
+                (*positionDst)[vertex].set(p.x() * m00 + p.y() * m10 + p.z() * m20 + m30,
+                    p.x() * m01 + p.y() * m11 + p.z() * m21 + m31,
+                    p.x() * m02 + p.y() * m12 + p.z() * m22 + m32);
+            }
+            if (normalDst)
+            {
+                for (unsigned short vertex : vertices)
                 {
-                    const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
-                    osg::Vec3f transformedTangent = osg::Matrixf::transform3x3(
-                        osg::Vec3f(srcTangent.x(), srcTangent.y(), srcTangent.z()), resultMat);
-                    (*tangentDst)[vertex] = osg::Vec4f(transformedTangent, srcTangent.w());
+                    const osg::Vec3f& n = (*normalSrc)[vertex];
+                    (*normalDst)[vertex].set(n.x() * m00 + n.y() * m10 + n.z() * m20,
+                        n.x() * m01 + n.y() * m11 + n.z() * m21, n.x() * m02 + n.y() * m12 + n.z() * m22);
+                }
+            }
+            if (tangentDst)
+            {
+                for (unsigned short vertex : vertices)
+                {
+                    const osg::Vec4f& t = (*tangentSrc)[vertex];
+                    (*tangentDst)[vertex].set(t.x() * m00 + t.y() * m10 + t.z() * m20,
+                        t.x() * m01 + t.y() * m11 + t.z() * m21, t.x() * m02 + t.y() * m12 + t.z() * m22, t.w());
                 }
             }
         }
 
-        positionDst->dirty();
-        if (normalDst)
-            normalDst->dirty();
-        if (tangentDst)
-            tangentDst->dirty();
+        if (dirty)
+        {
+            positionDst->dirty();
+            if (normalDst)
+                normalDst->dirty();
+            if (tangentDst)
+                tangentDst->dirty();
 
-        geom.osg::Drawable::dirtyGLObjects();
+            geom.osg::Drawable::dirtyGLObjects();
+        }
 
         nv->pushOntoNodePath(&geom);
         nv->apply(geom);
@@ -327,6 +376,10 @@ namespace SceneUtil
         for (const auto& [vertex, weights] : vertexToInfluences)
             influencesToVertices[weights].emplace_back(vertex);
 
+        // restore a cache friendly vertex order, lost by the unordered_map above
+        for (auto& [weights, vertices] : influencesToVertices)
+            std::sort(vertices.begin(), vertices.end());
+
         mData->mInfluences.reserve(influencesToVertices.size());
         mData->mInfluences.assign(influencesToVertices.begin(), influencesToVertices.end());
     }
@@ -100,6 +100,12 @@ namespace SceneUtil
         osg::ref_ptr<InfluenceData> mData;
         std::vector<Bone*> mNodes;
 
+        // Blend matrix per influence group, recomputed each update (member to avoid reallocation).
+        std::vector<osg::Matrixf> mBlendMatrices;
+        // Blend matrices last applied to each of the double buffered geometries. Vertices whose
+        // bones did not move since their buffer was last written are skipped.
+        std::vector<osg::Matrixf> mAppliedBlendMatrices[2];
+
         unsigned int mLastFrameNumber{ 0 };
         bool mBoundsFirstFrame{ true };
 
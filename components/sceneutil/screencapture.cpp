@@ -4,19 +4,30 @@
 #include <components/files/conversion.hpp>
 #include <components/sceneutil/workqueue.hpp>
 
+#include <osg/BufferObject>
+#include <osg/Camera>
+#include <osg/GLExtensions>
 #include <osg/Image>
 #include <osg/ref_ptr>
 #include <osgDB/ReaderWriter>
 #include <osgDB/Registry>
+#include <osgViewer/GraphicsWindow>
 
 #include <atomic>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 
+#ifndef GL_READ_ONLY
+#define GL_READ_ONLY 0x88B8
+#endif
+
 namespace
 {
     class ScreenCaptureWorkItem : public SceneUtil::WorkItem
@@ -162,4 +173,152 @@ namespace SceneUtil
         workItems->erase(std::remove_if(workItems->begin(), workItems->end(), isDone), workItems->end());
         workItems->emplace_back(std::move(item));
     }
+
+    class PixelBufferCaptureCallback : public osg::Camera::DrawCallback
+    {
+    public:
+        explicit PixelBufferCaptureCallback(osg::ref_ptr<osgViewer::ScreenCaptureHandler::CaptureOperation> operation)
+            : mOperation(std::move(operation))
+        {
+            assert(mOperation != nullptr);
+        }
+
+        void requestFrames(int numFrames) { mFramesToIssue = numFrames; }
+
+        void operator()(osg::RenderInfo& renderInfo) const override
+        {
+            osg::State& state = *renderInfo.getState();
+            osg::GLExtensions* ext = state.get<osg::GLExtensions>();
+            osg::Camera* camera = renderInfo.getCurrentCamera();
+            const osg::Viewport* viewport = camera->getViewport();
+
+            const bool issue = mFramesToIssue > 0;
+            if (issue)
+                --mFramesToIssue;
+
+            if (!ext->isPBOSupported)
+            {
+                // No PBOs, read synchronously like osgViewer's handler would.
+                if (issue)
+                {
+                    osg::ref_ptr<osg::Image> image(new osg::Image);
+                    image->readPixels(static_cast<int>(viewport->x()), static_cast<int>(viewport->y()),
+                        static_cast<int>(viewport->width()), static_cast<int>(viewport->height()), GL_RGBA,
+                        GL_UNSIGNED_BYTE);
+                    (*mOperation)(*image, state.getContextID());
+                }
+                if (mFramesToIssue <= 0)
+                    camera->setFinalDrawCallback(nullptr);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            PerContext& data = mContextData[state.getContextID()];
+
+            // Deliver the read issued last frame first; its transfer is complete by
+            // now, so the map doesn't block.
+            deliver(data, data.mNext ^ 1u, ext, state.getContextID());
+
+            if (issue)
+            {
+                const unsigned int index = data.mNext;
+                // When capturing every frame, this buffer was already mapped two
+                // frames ago and is free again.
+                deliver(data, index, ext, state.getContextID());
+
+                if (data.mBuffers[index] == 0)
+                    ext->glGenBuffers(1, &data.mBuffers[index]);
+                ext->glBindBuffer(GL_PIXEL_PACK_BUFFER, data.mBuffers[index]);
+
+                const int width = static_cast<int>(viewport->width());
+                const int height = static_cast<int>(viewport->height());
+                const GLsizeiptr size = static_cast<GLsizeiptr>(width) * height * 4;
+                if (size != data.mSizes[index])
+                {
+                    ext->glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+                    data.mSizes[index] = size;
+                }
+
+                glReadPixels(static_cast<int>(viewport->x()), static_cast<int>(viewport->y()), width, height, GL_RGBA,
+                    GL_UNSIGNED_BYTE, nullptr);
+                ext->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+                data.mWidth[index] = width;
+                data.mHeight[index] = height;
+                data.mPending[index] = true;
+                data.mNext = index ^ 1u;
+            }
+
+            // Stay attached while a transfer is in flight so it gets mapped on the
+            // next frame. The handler keeps a reference, so detaching is safe here.
+            if (mFramesToIssue <= 0 && !data.mPending[0] && !data.mPending[1])
+                camera->setFinalDrawCallback(nullptr);
+        }
+
+    private:
+        struct PerContext
+        {
+            GLuint mBuffers[2] = { 0, 0 };
+            GLsizeiptr mSizes[2] = { 0, 0 };
+            int mWidth[2] = { 0, 0 };
+            int mHeight[2] = { 0, 0 };
+            bool mPending[2] = { false, false };
+            unsigned int mNext = 0;
+        };
+
+        void deliver(PerContext& data, unsigned int index, osg::GLExtensions* ext, unsigned int contextId) const
+        {
+            if (!data.mPending[index])
+                return;
+            data.mPending[index] = false;
+
+            ext->glBindBuffer(GL_PIXEL_PACK_BUFFER, data.mBuffers[index]);
+            if (const void* pixels = ext->glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY))
+            {
+                osg::ref_ptr<osg::Image> image(new osg::Image);
+                image->allocateImage(data.mWidth[index], data.mHeight[index], 1, GL_RGBA, GL_UNSIGNED_BYTE, 1);
+                std::memcpy(image->data(), pixels, static_cast<std::size_t>(data.mSizes[index]));
+                ext->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+                (*mOperation)(*image, contextId);
+            }
+            ext->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+
+        const osg::ref_ptr<osgViewer::ScreenCaptureHandler::CaptureOperation> mOperation;
+        mutable std::atomic_int mFramesToIssue{ 0 };
+        mutable std::mutex mMutex;
+        mutable std::map<unsigned int, PerContext> mContextData;
+    };
+
+    AsyncScreenCaptureHandler::AsyncScreenCaptureHandler(
+        osg::ref_ptr<osgViewer::ScreenCaptureHandler::CaptureOperation> operation)
+        : mCallback(new PixelBufferCaptureCallback(std::move(operation)))
+    {
+    }
+
+    AsyncScreenCaptureHandler::~AsyncScreenCaptureHandler() = default;
+
+    void AsyncScreenCaptureHandler::captureNextFrame(osgViewer::ViewerBase& viewer)
+    {
+        osgViewer::ViewerBase::Windows windows;
+        viewer.getWindows(windows);
+        if (windows.empty())
+            return;
+
+        // Mirror osgViewer::ScreenCaptureHandler: capture the first window, from
+        // the camera that renders to it last.
+        osg::Camera* lastCamera = nullptr;
+        for (osg::Camera* camera : windows.front()->getCameras())
+        {
+            if (lastCamera == nullptr || camera->getRenderOrder() > lastCamera->getRenderOrder()
+                || (camera->getRenderOrder() == lastCamera->getRenderOrder()
+                    && camera->getRenderOrderNum() >= lastCamera->getRenderOrderNum()))
+                lastCamera = camera;
+        }
+        if (lastCamera == nullptr)
+            return;
+
+        mCallback->requestFrames(mFramesToCapture);
+        lastCamera->setFinalDrawCallback(mCallback);
+    }
 }
@@ -54,6 +54,33 @@ namespace SceneUtil
         const osg::ref_ptr<osgViewer::ScreenCaptureHandler::CaptureOperation> mImpl;
         Misc::ScopeGuarded<std::vector<osg::ref_ptr<SceneUtil::WorkItem>>> mWorkItems;
     };
+
+    class PixelBufferCaptureCallback;
+
+    /// Replacement for osgViewer::ScreenCaptureHandler's capture API that reads the
+    /// framebuffer through double-buffered pixel buffer objects. glReadPixels only
+    /// starts the transfer; the result is mapped on the following frame, so a
+    /// capture doesn't drain the GL pipeline. Consequently the capture operation
+    /// receives the image one frame after the capture was requested.
+    class AsyncScreenCaptureHandler : public osgGA::GUIEventHandler
+    {
+    public:
+        explicit AsyncScreenCaptureHandler(osg::ref_ptr<osgViewer::ScreenCaptureHandler::CaptureOperation> operation);
+
+        ~AsyncScreenCaptureHandler();
+
+        void setFramesToCapture(int numFrames) { mFramesToCapture = numFrames; }
+
+        /// Attaches the capture callback to the camera drawn last for the next
+        /// frame(s); the callback detaches itself once all readbacks are delivered.
+        void captureNextFrame(osgViewer::ViewerBase& viewer);
+
+        bool handle(const osgGA::GUIEventAdapter&, osgGA::GUIActionAdapter&) override { return false; }
+
+    private:
+        osg::ref_ptr<PixelBufferCaptureCallback> mCallback;
+        int mFramesToCapture = 1;
+    };
 }
 
 #endif
@@ -1,8 +1,11 @@
 #include "shadowsbin.hpp"
+#include <algorithm>
+#include <limits>
 #include <osg/AlphaFunc>
 #include <osg/Material>
 #include <osg/Program>
 #include <osg/StateSet>
+#include <osgUtil/RenderLeaf>
 #include <osgUtil/StateGraph>
 #include <unordered_set>
 
@@ -221,6 +224,23 @@ namespace SceneUtil
         }
         if (!noTestRoot->_leaves.empty())
             newList.push_back(noTestRoot);
+
+        // Leaf depth was computed by the shadow camera's cull traversal, so it's the distance from the light. Each
+        // remaining stategraph is one block of state, so drawing its leaves front to back lets early depth testing
+        // reject occluded casters without adding state switches, and ordering the blocks by their nearest leaf makes
+        // large occluders tend to fill the map first.
+        for (StateGraph* graph : newList)
+            std::sort(graph->_leaves.begin(), graph->_leaves.end(),
+                [](const osg::ref_ptr<RenderLeaf>& lhs, const osg::ref_ptr<RenderLeaf>& rhs) {
+                    return lhs->_depth < rhs->_depth;
+                });
+        const auto frontDepth = [](const StateGraph* graph) {
+            return graph->_leaves.empty() ? std::numeric_limits<float>::max()
+                                          : static_cast<float>(graph->_leaves.front()->_depth);
+        };
+        std::sort(newList.begin(), newList.end(),
+            [&](const StateGraph* lhs, const StateGraph* rhs) { return frontDepth(lhs) < frontDepth(rhs); });
+
         _stateGraphList = std::move(newList);
     }
 
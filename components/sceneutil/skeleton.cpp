@@ -7,6 +7,16 @@
 
 #include <algorithm>
 
+namespace
+{
+    // makes sure throttled skeletons don't all update on the same frame
+    unsigned int nextUpdatePhase()
+    {
+        static unsigned int phase = 0;
+        return phase++;
+    }
+}
+
 namespace SceneUtil
 {
 
@@ -35,20 +45,26 @@ namespace SceneUtil
 
     Skeleton::Skeleton()
         : mBoneCacheInit(false)
+        , mFlatBonesDirty(true)
         , mNeedToUpdateBoneMatrices(true)
         , mActive(Active)
         , mLastFrameNumber(0)
         , mLastCullFrameNumber(0)
+        , mUpdateRateDivisor(1)
+        , mUpdatePhase(nextUpdatePhase())
     {
     }
 
     Skeleton::Skeleton(const Skeleton& copy, const osg::CopyOp& copyop)
         : osg::Group(copy, copyop)
         , mBoneCacheInit(false)
+        , mFlatBonesDirty(true)
         , mNeedToUpdateBoneMatrices(true)
         , mActive(copy.mActive)
         , mLastFrameNumber(0)
         , mLastCullFrameNumber(0)
+        , mUpdateRateDivisor(copy.mUpdateRateDivisor)
+        , mUpdatePhase(nextUpdatePhase())
     {
     }
 
@@ -82,6 +98,7 @@ namespace SceneUtil
             {
                 bone = bone->mChildren.emplace_back(std::make_unique<Bone>()).get();
                 mNeedToUpdateBoneMatrices = true;
+                mFlatBonesDirty = true;
             }
             else
                 bone = it->get();
@@ -103,14 +120,58 @@ namespace SceneUtil
         {
             if (mRootBone.get())
             {
-                for (const auto& child : mRootBone->mChildren)
-                    child->update(nullptr);
+                if (mFlatBonesDirty)
+                    rebuildFlatBones();
+
+                for (const FlatBone& flatBone : mFlatBones)
+                {
+                    Bone* bone = flatBone.mBone;
+                    if (flatBone.mParent >= 0)
+                        bone->mMatrixInSkeletonSpace
+                            = bone->mNode->getMatrix() * mFlatBones[flatBone.mParent].mBone->mMatrixInSkeletonSpace;
+                    else
+                        bone->mMatrixInSkeletonSpace = bone->mNode->getMatrix();
+                }
             }
 
             mNeedToUpdateBoneMatrices = false;
         }
     }
 
+    void Skeleton::rebuildFlatBones()
+    {
+        mFlatBones.clear();
+
+        struct PendingBone
+        {
+            Bone* mBone;
+            int mParent;
+        };
+        std::vector<PendingBone> stack;
+        for (const auto& child : mRootBone->mChildren)
+            stack.push_back({ child.get(), -1 });
+
+        while (!stack.empty())
+        {
+            PendingBone pending = stack.back();
+            stack.pop_back();
+
+            if (!pending.mBone->mNode)
+            {
+                // Skips the whole subtree, matching the behaviour of the old recursive update.
+                Log(Debug::Error) << "Error: Bone without node";
+                continue;
+            }
+
+            const int index = static_cast<int>(mFlatBones.size());
+            mFlatBones.push_back({ pending.mBone, pending.mParent });
+            for (const auto& child : pending.mBone->mChildren)
+                stack.push_back({ child.get(), index });
+        }
+
+        mFlatBonesDirty = false;
+    }
+
     void Skeleton::setActive(ActiveType active)
     {
         mActive = active;
@@ -126,6 +187,7 @@ namespace SceneUtil
         mLastFrameNumber = 0;
         mBoneCache.clear();
         mBoneCacheInit = false;
+        mFlatBonesDirty = true;
     }
 
     void Skeleton::traverse(osg::NodeVisitor& nv)
@@ -134,8 +196,14 @@ namespace SceneUtil
         {
             if (mActive == Inactive && mLastFrameNumber != 0)
                 return;
-            if (mActive == SemiActive && mLastFrameNumber != 0 && mLastCullFrameNumber + 3 <= nv.getTraversalNumber())
-                return;
+            if (mActive == SemiActive && mLastFrameNumber != 0)
+            {
+                if (mLastCullFrameNumber + 3 <= nv.getTraversalNumber())
+                    return;
+                if (mUpdateRateDivisor > 1
+                    && (nv.getTraversalNumber() + mUpdatePhase) % mUpdateRateDivisor != 0)
+                    return;
+            }
         }
         else if (nv.getVisitorType() == osg::NodeVisitor::CULL_VISITOR)
             mLastCullFrameNumber = nv.getTraversalNumber();
@@ -158,20 +226,4 @@ namespace SceneUtil
     {
     }
 
-    void Bone::update(const osg::Matrixf* parentMatrixInSkeletonSpace)
-    {
-        if (!mNode)
-        {
-            Log(Debug::Error) << "Error: Bone without node";
-            return;
-        }
-        if (parentMatrixInSkeletonSpace)
-            mMatrixInSkeletonSpace = mNode->getMatrix() * (*parentMatrixInSkeletonSpace);
-        else
-            mMatrixInSkeletonSpace = mNode->getMatrix();
-
-        for (const auto& child : mChildren)
-            child->update(&mMatrixInSkeletonSpace);
-    }
-
 }
@@ -21,9 +21,6 @@ namespace SceneUtil
         osg::MatrixTransform* mNode;
 
         std::vector<std::unique_ptr<Bone>> mChildren;
-
-        /// Update the skeleton-space matrix of this bone and all its children.
-        void update(const osg::Matrixf* parentMatrixInSkeletonSpace);
     };
 
     /// @brief Handles the bone matrices for any number of child RigGeometries.
@@ -54,6 +51,11 @@ namespace SceneUtil
         /// You should set this flag to false if you know that bones are not currently moving.
         void setActive(ActiveType active);
 
+        /// Evaluate the update traversal of a visible SemiActive skeleton only every Nth frame,
+        /// leaving the bones at their last pose in between. Throttled skeletons are spread
+        /// across frames. Has no effect on Active skeletons.
+        void setUpdateRateDivisor(unsigned int divisor) { mUpdateRateDivisor = divisor; }
+
         bool getActive() const;
 
         void traverse(osg::NodeVisitor& nv) override;
@@ -68,6 +70,19 @@ namespace SceneUtil
         // As far as the scene graph goes we support multiple root bones.
         std::unique_ptr<Bone> mRootBone;
 
+        struct FlatBone
+        {
+            Bone* mBone;
+            int mParent; // index of the parent in mFlatBones, or -1 for a root bone
+        };
+        // The bone hierarchy flattened in topological order (parents before children), so the
+        // per-frame matrix update is a single loop instead of a recursive tree walk. Bones are
+        // owned by mRootBone; the flat list is rebuilt whenever the hierarchy changes.
+        std::vector<FlatBone> mFlatBones;
+        bool mFlatBonesDirty;
+
+        void rebuildFlatBones();
+
         typedef std::unordered_map<std::string, std::vector<osg::MatrixTransform*>> BoneCache;
         BoneCache mBoneCache;
         bool mBoneCacheInit;
@@ -78,6 +93,8 @@ namespace SceneUtil
 
         unsigned int mLastFrameNumber;
         unsigned int mLastCullFrameNumber;
+        unsigned int mUpdateRateDivisor;
+        unsigned int mUpdatePhase;
     };
 
 }
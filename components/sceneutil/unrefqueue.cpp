@@ -1,21 +1,60 @@
 #include "unrefqueue.hpp"
 
+#include <chrono>
+
+#include <osg/Group>
+
 #include <components/sceneutil/workqueue.hpp>
 
 namespace SceneUtil
 {
     namespace
     {
-        struct ClearVector final : SceneUtil::WorkItem
+        // Destruction runs on a worker thread in slices of at most this length, so work queued
+        // behind a large unref burst (e.g. cell preloading) is not starved.
+        constexpr std::chrono::milliseconds sliceBudget(1);
+
+        struct ReleaseSlice final : SceneUtil::WorkItem
         {
             std::vector<osg::ref_ptr<osg::Referenced>> mObjects;
+            SceneUtil::WorkQueue& mWorkQueue;
+            std::shared_ptr<std::atomic<std::size_t>> mBacklog;
 
-            explicit ClearVector(std::vector<osg::ref_ptr<osg::Referenced>>&& objects)
+            explicit ReleaseSlice(std::vector<osg::ref_ptr<osg::Referenced>>&& objects, SceneUtil::WorkQueue& workQueue,
+                std::shared_ptr<std::atomic<std::size_t>> backlog)
                 : mObjects(std::move(objects))
+                , mWorkQueue(workQueue)
+                , mBacklog(std::move(backlog))
             {
             }
 
-            void doWork() override { mObjects.clear(); }
+            void doWork() override
+            {
+                const auto deadline = std::chrono::steady_clock::now() + sliceBudget;
+                while (!mObjects.empty())
+                {
+                    osg::ref_ptr<osg::Referenced> obj = std::move(mObjects.back());
+                    mObjects.pop_back();
+                    // Break up subgraphs about to be destroyed so a single release can not cascade
+                    // through thousands of nodes within one slice.
+                    if (osg::Group* const group = dynamic_cast<osg::Group*>(obj.get());
+                        group != nullptr && obj->referenceCount() == 1)
+                    {
+                        const unsigned int childCount = group->getNumChildren();
+                        for (unsigned int i = 0; i < childCount; ++i)
+                            mObjects.emplace_back(group->getChild(i));
+                        group->removeChildren(0, childCount);
+                        mBacklog->fetch_add(childCount, std::memory_order_relaxed);
+                    }
+                    obj = nullptr;
+                    mBacklog->fetch_sub(1, std::memory_order_relaxed);
+                    if (std::chrono::steady_clock::now() >= deadline)
+                        break;
+                }
+                if (!mObjects.empty())
+                    mWorkQueue.addWorkItem(
+                        new ReleaseSlice(std::move(mObjects), mWorkQueue, mBacklog), WorkPriority::Background);
+            }
         };
     }
 
@@ -24,9 +63,13 @@ namespace SceneUtil
         if (mObjects.empty())
             return;
 
+        mBacklog->fetch_add(mObjects.size(), std::memory_order_relaxed);
         // Move only objects to keep allocated storage in mObjects
-        workQueue.addWorkItem(new ClearVector(std::vector<osg::ref_ptr<osg::Referenced>>(
-            std::move_iterator(mObjects.begin()), std::move_iterator(mObjects.end()))));
+        workQueue.addWorkItem(new ReleaseSlice(std::vector<osg::ref_ptr<osg::Referenced>>(
+                                                   std::move_iterator(mObjects.begin()),
+                                                   std::move_iterator(mObjects.end())),
+            workQueue, mBacklog),
+            WorkPriority::Background);
         mObjects.clear();
     }
 }
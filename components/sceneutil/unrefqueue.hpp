@@ -4,6 +4,9 @@
 #include <osg/Referenced>
 #include <osg/ref_ptr>
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace SceneUtil
@@ -22,12 +25,18 @@ namespace SceneUtil
 
         /// Adds a WorkItem to the given WorkQueue that will clear the list of objects in a worker thread,
         /// thus unreferencing them. Call from the main thread.
+        /// @par The worker destroys the objects in time-boxed slices, re-queueing the remainder behind
+        /// other work so a large burst (e.g. after a cell swap) does not monopolize a worker thread.
         void flush(SceneUtil::WorkQueue& workQueue);
 
         std::size_t getSize() const { return mObjects.size(); }
 
+        /// Number of objects handed to the work queue that have not been destroyed yet.
+        std::size_t getBacklog() const { return mBacklog->load(std::memory_order_relaxed); }
+
     private:
         std::vector<osg::ref_ptr<osg::Referenced>> mObjects;
+        std::shared_ptr<std::atomic<std::size_t>> mBacklog = std::make_shared<std::atomic<std::size_t>>(0);
     };
 }
 
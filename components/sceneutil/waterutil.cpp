@@ -1,5 +1,8 @@
 #include "waterutil.hpp"
 
+#include <cmath>
+#include <vector>
+
 #include <osg/Depth>
 #include <osg/Geometry>
 #include <osg/Material>
@@ -15,53 +18,80 @@ namespace SceneUtil
         osg::BoundingBox computeBound(const osg::Drawable&) const override { return osg::BoundingBox(); }
     };
 
-    osg::ref_ptr<osg::Geometry> createWaterGeometry(float size, int segments, float textureRepeats)
+    namespace
     {
-        osg::ref_ptr<osg::Vec3Array> verts(new osg::Vec3Array);
-        osg::ref_ptr<osg::Vec2Array> texcoords(new osg::Vec2Array);
-
-        // some drivers don't like huge triangles, so we do some subdivisons
-        // a paged solution would be even better
-        const float step = size / segments;
-        const float texCoordStep = textureRepeats / segments;
-        for (int x = 0; x < segments; ++x)
+        osg::ref_ptr<osg::Geometry> createWaterGeometryFromGrid(
+            const std::vector<float>& coords, float size, float textureRepeats)
         {
-            for (int y = 0; y < segments; ++y)
+            osg::ref_ptr<osg::Vec3Array> verts(new osg::Vec3Array);
+            osg::ref_ptr<osg::Vec2Array> texcoords(new osg::Vec2Array);
+
+            const auto texCoord = [&](float c) { return (c / size + 0.5f) * textureRepeats; };
+            for (std::size_t x = 0; x + 1 < coords.size(); ++x)
             {
-                float x1 = -size / 2.f + x * step;
-                float y1 = -size / 2.f + y * step;
-                float x2 = x1 + step;
-                float y2 = y1 + step;
-
-                verts->push_back(osg::Vec3f(x1, y2, 0.f));
-                verts->push_back(osg::Vec3f(x1, y1, 0.f));
-                verts->push_back(osg::Vec3f(x2, y1, 0.f));
-                verts->push_back(osg::Vec3f(x2, y2, 0.f));
-
-                float u1 = x * texCoordStep;
-                float v1 = y * texCoordStep;
-                float u2 = u1 + texCoordStep;
-                float v2 = v1 + texCoordStep;
-
-                texcoords->push_back(osg::Vec2f(u1, v2));
-                texcoords->push_back(osg::Vec2f(u1, v1));
-                texcoords->push_back(osg::Vec2f(u2, v1));
-                texcoords->push_back(osg::Vec2f(u2, v2));
+                for (std::size_t y = 0; y + 1 < coords.size(); ++y)
+                {
+                    float x1 = coords[x];
+                    float y1 = coords[y];
+                    float x2 = coords[x + 1];
+                    float y2 = coords[y + 1];
+
+                    verts->push_back(osg::Vec3f(x1, y2, 0.f));
+                    verts->push_back(osg::Vec3f(x1, y1, 0.f));
+                    verts->push_back(osg::Vec3f(x2, y1, 0.f));
+                    verts->push_back(osg::Vec3f(x2, y2, 0.f));
+
+                    float u1 = texCoord(x1);
+                    float v1 = texCoord(y1);
+                    float u2 = texCoord(x2);
+                    float v2 = texCoord(y2);
+
+                    texcoords->push_back(osg::Vec2f(u1, v2));
+                    texcoords->push_back(osg::Vec2f(u1, v1));
+                    texcoords->push_back(osg::Vec2f(u2, v1));
+                    texcoords->push_back(osg::Vec2f(u2, v2));
+                }
             }
-        }
 
-        osg::ref_ptr<osg::Geometry> waterGeom(new osg::Geometry);
-        waterGeom->setVertexArray(verts);
-        waterGeom->setTexCoordArray(0, texcoords);
+            osg::ref_ptr<osg::Geometry> waterGeom(new osg::Geometry);
+            waterGeom->setVertexArray(verts);
+            waterGeom->setTexCoordArray(0, texcoords);
+
+            osg::ref_ptr<osg::Vec3Array> normal(new osg::Vec3Array);
+            normal->push_back(osg::Vec3f(0, 0, 1));
+            waterGeom->setNormalArray(normal, osg::Array::BIND_OVERALL);
 
-        osg::ref_ptr<osg::Vec3Array> normal(new osg::Vec3Array);
-        normal->push_back(osg::Vec3f(0, 0, 1));
-        waterGeom->setNormalArray(normal, osg::Array::BIND_OVERALL);
+            waterGeom->addPrimitiveSet(new osg::DrawArrays(osg::PrimitiveSet::QUADS, 0, verts->size()));
+            waterGeom->setComputeBoundingBoxCallback(new WaterBoundCallback);
+            waterGeom->setCullingActive(false);
+            return waterGeom;
+        }
+    }
 
-        waterGeom->addPrimitiveSet(new osg::DrawArrays(osg::PrimitiveSet::QUADS, 0, verts->size()));
-        waterGeom->setComputeBoundingBoxCallback(new WaterBoundCallback);
-        waterGeom->setCullingActive(false);
-        return waterGeom;
+    osg::ref_ptr<osg::Geometry> createWaterGeometry(float size, int segments, float textureRepeats)
+    {
+        // some drivers don't like huge triangles, so we do some subdivisons
+        // a paged solution would be even better
+        std::vector<float> coords(segments + 1);
+        for (int i = 0; i <= segments; ++i)
+            coords[i] = -size / 2.f + i * size / segments;
+        return createWaterGeometryFromGrid(coords, size, textureRepeats);
+    }
+
+    osg::ref_ptr<osg::Geometry> createGradedWaterGeometry(
+        float size, int segments, float gradingExponent, float textureRepeats)
+    {
+        // The water surface is flat, so the mesh resolution only matters for the precision of
+        // interpolated varyings (depth, shadows) and for drivers that dislike huge triangles.
+        // Both concerns fade with distance, so grade the grid lines towards the center instead
+        // of spending the same amount of triangles on the horizon as next to the viewer.
+        std::vector<float> coords(segments + 1);
+        for (int i = 0; i <= segments; ++i)
+        {
+            const float t = 2.f * i / segments - 1.f;
+            coords[i] = size / 2.f * std::copysign(std::pow(std::abs(t), gradingExponent), t);
+        }
+        return createWaterGeometryFromGrid(coords, size, textureRepeats);
     }
 
     osg::ref_ptr<osg::StateSet> createSimpleWaterStateSet(float alpha, int renderBin)
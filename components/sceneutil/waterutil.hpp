@@ -13,6 +13,12 @@ namespace SceneUtil
 {
     osg::ref_ptr<osg::Geometry> createWaterGeometry(float size, int segments, float textureRepeats);
 
+    /// Variant of createWaterGeometry with the grid lines graded towards the center, so triangle
+    /// density is spent near the viewer while the horizon is covered by a few large quads.
+    /// @param gradingExponent 1 gives a uniform grid, higher values concentrate the subdivisions.
+    osg::ref_ptr<osg::Geometry> createGradedWaterGeometry(
+        float size, int segments, float gradingExponent, float textureRepeats);
+
     osg::ref_ptr<osg::StateSet> createSimpleWaterStateSet(float alpha, int renderBin);
 }
 
@@ -1,8 +1,11 @@
 #include "workqueue.hpp"
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/trace.hpp>
 
+#include <algorithm>
 #include <numeric>
+#include <typeinfo>
 
 namespace SceneUtil
 {
@@ -58,8 +61,9 @@ namespace SceneUtil
     {
         {
             std::unique_lock<std::mutex> lock(mMutex);
-            while (!mQueue.empty())
-                mQueue.pop_back();
+            for (std::deque<osg::ref_ptr<WorkItem>>& queue : mQueues)
+                while (!queue.empty())
+                    queue.pop_back();
             mIsReleased = true;
             mCondition.notify_all();
         }
@@ -67,7 +71,7 @@ namespace SceneUtil
         mThreads.clear();
     }
 
-    void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, bool front)
+    void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, WorkPriority priority)
     {
         if (item->isDone())
         {
@@ -76,25 +80,44 @@ namespace SceneUtil
         }
 
         std::unique_lock<std::mutex> lock(mMutex);
-        if (front)
-            mQueue.push_front(std::move(item));
-        else
-            mQueue.push_back(std::move(item));
+        mQueues[static_cast<std::size_t>(priority)].push_back(std::move(item));
         mCondition.notify_one();
     }
 
+    void WorkQueue::prioritize(const osg::ref_ptr<WorkItem>& item, WorkPriority priority)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        for (std::size_t i = 0; i < static_cast<std::size_t>(priority); ++i)
+        {
+            std::deque<osg::ref_ptr<WorkItem>>& queue = mQueues[i];
+            const auto it = std::find(queue.begin(), queue.end(), item);
+            if (it == queue.end())
+                continue;
+            queue.erase(it);
+            mQueues[static_cast<std::size_t>(priority)].push_back(item);
+            return;
+        }
+    }
+
     osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem()
     {
         std::unique_lock<std::mutex> lock(mMutex);
-        while (mQueue.empty() && !mIsReleased)
+        const auto empty = [&] {
+            return std::all_of(mQueues.begin(), mQueues.end(), [](const auto& queue) { return queue.empty(); });
+        };
+        while (empty() && !mIsReleased)
         {
             mCondition.wait(lock);
         }
-        if (!mQueue.empty())
+        // Highest priority first
+        for (auto queue = mQueues.rbegin(); queue != mQueues.rend(); ++queue)
         {
-            osg::ref_ptr<WorkItem> item = std::move(mQueue.front());
-            mQueue.pop_front();
-            return item;
+            if (!queue->empty())
+            {
+                osg::ref_ptr<WorkItem> item = std::move(queue->front());
+                queue->pop_front();
+                return item;
+            }
         }
         return nullptr;
     }
@@ -102,7 +125,8 @@ namespace SceneUtil
     unsigned int WorkQueue::getNumItems() const
     {
         std::unique_lock<std::mutex> lock(mMutex);
-        return mQueue.size();
+        return std::accumulate(mQueues.begin(), mQueues.end(), 0u,
+            [](unsigned int r, const auto& queue) { return r + static_cast<unsigned int>(queue.size()); });
     }
 
     unsigned int WorkQueue::getNumActiveThreads() const
@@ -131,7 +155,10 @@ namespace SceneUtil
             if (!item)
                 return;
             mActive = true;
-            item->doWork();
+            {
+                const Debug::TraceZone zone(typeid(*item).name());
+                item->doWork();
+            }
             item->signalDone();
             mActive = false;
         }
@@ -4,6 +4,7 @@
 #include <osg/Referenced>
 #include <osg/ref_ptr>
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <deque>
@@ -39,8 +40,15 @@ namespace SceneUtil
 
     class WorkThread;
 
+    enum class WorkPriority
+    {
+        Background, ///< Speculative work nothing is waiting on yet, e.g. cell preloading.
+        Normal,
+        Urgent, ///< Work the main thread is waiting on or about to wait on.
+    };
+
     /// @brief A work queue that users can push work items onto, to be completed by one or more background threads.
-    /// @note Work items will be processed in the order that they were given in, however
+    /// @note Work items of the same priority will be processed in the order that they were given in, however
     /// if multiple work threads are involved then it is possible for a later item to complete before earlier items.
     class WorkQueue : public osg::Referenced
     {
@@ -52,10 +60,15 @@ namespace SceneUtil
 
         void stop();
 
-        /// Add a new work item to the back of the queue.
+        /// Add a new work item to the back of its priority class. Higher priority items are always
+        /// processed before lower priority ones.
         /// @par The work item's waitTillDone() method may be used by the caller to wait until the work is complete.
-        /// @param front If true, add item to the front of the queue. If false (default), add to the back.
-        void addWorkItem(osg::ref_ptr<WorkItem> item, bool front = false);
+        void addWorkItem(osg::ref_ptr<WorkItem> item, WorkPriority priority = WorkPriority::Normal);
+
+        /// Move an already queued item to the given priority class, e.g. when the main thread is about
+        /// to wait on an item that was queued speculatively. Has no effect if the item is not waiting
+        /// in the queue anymore.
+        void prioritize(const osg::ref_ptr<WorkItem>& item, WorkPriority priority);
 
         /// Get the next work item from the front of the queue. If the queue is empty, waits until a new item is added.
         /// If the workqueue is in the process of being destroyed, may return nullptr.
@@ -68,7 +81,7 @@ namespace SceneUtil
 
     private:
         bool mIsReleased;
-        std::deque<osg::ref_ptr<WorkItem>> mQueue;
+        std::array<std::deque<osg::ref_ptr<WorkItem>>, 3> mQueues; // indexed by WorkPriority
 
         mutable std::mutex mMutex;
         std::condition_variable mCondition;
@@ -22,6 +22,7 @@ namespace Settings
         SettingValue<bool> mSmallFeatureCulling{ mIndex, "Camera", "small feature culling" };
         SettingValue<float> mSmallFeatureCullingPixelSize{ mIndex, "Camera", "small feature culling pixel size",
             makeMaxStrictSanitizerFloat(0) };
+        SettingValue<bool> mSoftwareOcclusionCulling{ mIndex, "Camera", "software occlusion culling" };
         SettingValue<float> mViewingDistance{ mIndex, "Camera", "viewing distance", makeMaxStrictSanitizerFloat(0) };
         SettingValue<float> mFieldOfView{ mIndex, "Camera", "field of view", makeClampSanitizerFloat(1, 179) };
         SettingValue<float> mFirstPersonFieldOfView{ mIndex, "Camera", "first person field of view",
@@ -18,6 +18,9 @@ namespace Settings
     {
         using WithIndex::WithIndex;
 
+        SettingValue<int> mCellLoadNumThreads{ mIndex, "Cells", "cell load num threads", makeMaxSanitizerInt(1) };
+        SettingValue<float> mExteriorCellLoadBudget{ mIndex, "Cells", "exterior cell load budget",
+            makeMaxSanitizerFloat(0) };
         SettingValue<bool> mPreloadEnabled{ mIndex, "Cells", "preload enabled" };
         SettingValue<int> mPreloadNumThreads{ mIndex, "Cells", "preload num threads", makeMaxSanitizerInt(1) };
         SettingValue<bool> mPreloadExteriorGrid{ mIndex, "Cells", "preload exterior grid" };
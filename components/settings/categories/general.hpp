@@ -27,6 +27,7 @@ namespace Settings
             makeEnumSanitizerString({ "nearest", "linear" }) };
         SettingValue<std::string> mTextureMipmap{ mIndex, "General", "texture mipmap",
             makeEnumSanitizerString({ "none", "nearest", "linear" }) };
+        SettingValue<bool> mCompressUncompressedTextures{ mIndex, "General", "compress uncompressed textures" };
         SettingValue<bool> mNotifyOnSavedScreenshot{ mIndex, "General", "notify on saved screenshot" };
         SettingValue<std::vector<std::string>> mPreferredLocales{ mIndex, "General", "preferred locales" };
         SettingValue<bool> mGmstOverridesL10n{ mIndex, "General", "gmst overrides l10n" };
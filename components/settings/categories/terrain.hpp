@@ -37,6 +37,9 @@ namespace Settings
             makeMaxStrictSanitizerFloat(0) };
         SettingValue<float> mObjectPagingMinSizeCostMultiplier{ mIndex, "Terrain",
             "object paging min size cost multiplier", makeMaxStrictSanitizerFloat(0) };
+        SettingValue<bool> mObjectPagingInstancing{ mIndex, "Terrain", "object paging instancing" };
+        SettingValue<bool> mSinglePassSplatting{ mIndex, "Terrain", "single pass splatting" };
+        SettingValue<std::uint64_t> mLandCacheSize{ mIndex, "Terrain", "land cache size" };
     };
 }
 
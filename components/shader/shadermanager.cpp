@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <fstream>
 #include <osg/Program>
+#include <osgUtil/IncrementalCompileOperation>
 #include <osgViewer/Viewer>
 #include <regex>
 #include <set>
@@ -352,7 +353,8 @@ namespace Shader
     }
 
     bool parseDefines(std::string& source, const ShaderManager::DefineMap& defines,
-        const ShaderManager::DefineMap& globalDefines, const std::string& templateName)
+        const ShaderManager::DefineMap& globalDefines, const std::string& templateName,
+        std::set<std::string>* usedGlobalDefines)
     {
         const char escapeCharacter = '@';
         size_t foundPos = 0;
@@ -405,6 +407,8 @@ namespace Shader
             }
             else if (globalDefineFound != globalDefines.end())
             {
+                if (usedGlobalDefines != nullptr)
+                    usedGlobalDefines->insert(define);
                 source.replace(foundPos, endPos - foundPos, globalDefineFound->second);
             }
             else
@@ -506,12 +510,15 @@ namespace Shader
                         shaderSource = std::move(source);
 
                         std::vector<std::string> linkedShaderNames;
+                        std::set<std::string> usedGlobalDefines;
                         if (!Manager.createSourceFromTemplate(
-                                shaderSource, linkedShaderNames, templateName, shaderDefines))
+                                shaderSource, linkedShaderNames, templateName, shaderDefines, &usedGlobalDefines))
                         {
                             break;
                         }
                         shaderIt->second->setShaderSource(shaderSource);
+                        Manager.mShadersUsedGlobalDefines[std::make_pair(templateName, shaderDefines)]
+                            = std::move(usedGlobalDefines);
                     }
                 }
             }
@@ -563,12 +570,14 @@ namespace Shader
         {
             std::string shaderSource = templateIt->second;
             std::vector<std::string> linkedShaderNames;
-            if (!createSourceFromTemplate(shaderSource, linkedShaderNames, templateName, defines))
+            std::set<std::string> usedGlobalDefines;
+            if (!createSourceFromTemplate(shaderSource, linkedShaderNames, templateName, defines, &usedGlobalDefines))
             {
                 // Add to the cache anyway to avoid logging the same error over and over.
                 mShaders.insert(std::make_pair(std::make_pair(templateName, defines), nullptr));
                 return nullptr;
             }
+            mShadersUsedGlobalDefines[std::make_pair(templateName, defines)] = std::move(usedGlobalDefines);
 
             osg::ref_ptr<osg::Shader> shader(new osg::Shader(type ? *type : getShaderType(templateName)));
             shader->setShaderSource(shaderSource);
@@ -616,6 +625,15 @@ namespace Shader
             addLinkedShaders(vertexShader, program);
             addLinkedShaders(fragmentShader, program);
 
+            if (mIncrementalCompileOperation)
+            {
+                // The ICO collects state to compile by traversing a subgraph, so hand it a
+                // placeholder node carrying the new program.
+                osg::ref_ptr<osg::Node> node = new osg::Node;
+                node->getOrCreateStateSet()->setAttributeAndModes(program);
+                mIncrementalCompileOperation->add(node);
+            }
+
             found = mPrograms.insert(std::make_pair(std::make_pair(vertexShader, fragmentShader), program)).first;
         }
         return found->second;
@@ -636,6 +654,19 @@ namespace Shader
 
     void ShaderManager::setGlobalDefines(DefineMap& globalDefines)
     {
+        // Figure out which defines actually changed value, so shaders that never consumed any of
+        // them keep their source and compiled program.
+        std::set<std::string> changedDefines;
+        for (const auto& [name, value] : globalDefines)
+        {
+            const auto previous = mGlobalDefines.find(name);
+            if (previous == mGlobalDefines.end() || previous->second != value)
+                changedDefines.insert(name);
+        }
+        for (const auto& [name, value] : mGlobalDefines)
+            if (globalDefines.find(name) == globalDefines.end())
+                changedDefines.insert(name);
+
         mGlobalDefines = globalDefines;
         for (const auto& [key, shader] : mShaders)
         {
@@ -645,14 +676,21 @@ namespace Shader
                 // I'm not sure how to handle a shader that was already broken as there's no way to get a potential
                 // replacement to the nodes that need it.
                 continue;
+            const auto usedDefines = mShadersUsedGlobalDefines.find(key);
+            if (usedDefines != mShadersUsedGlobalDefines.end()
+                && std::none_of(changedDefines.begin(), changedDefines.end(),
+                    [&](const std::string& name) { return usedDefines->second.contains(name); }))
+                continue;
             std::string shaderSource = mShaderTemplates[templateId];
             std::vector<std::string> linkedShaderNames;
-            if (!createSourceFromTemplate(shaderSource, linkedShaderNames, templateId, defines))
+            std::set<std::string> usedGlobalDefines;
+            if (!createSourceFromTemplate(shaderSource, linkedShaderNames, templateId, defines, &usedGlobalDefines))
                 // We just broke the shader and there's no way to force existing objects back to fixed-function mode as
                 // we would when creating the shader. If we put a nullptr in the shader map, we just lose the ability to
                 // put a working one in later.
                 continue;
             shader->setShaderSource(shaderSource);
+            mShadersUsedGlobalDefines[key] = std::move(usedGlobalDefines);
 
             getLinkedShaders(shader, linkedShaderNames, defines);
         }
@@ -670,11 +708,17 @@ namespace Shader
             program->releaseGLObjects(state);
     }
 
+    void ShaderManager::setIncrementalCompileOperation(osgUtil::IncrementalCompileOperation* ico)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIncrementalCompileOperation = ico;
+    }
+
     bool ShaderManager::createSourceFromTemplate(std::string& source,
         std::vector<std::string>& linkedShaderTemplateNames, const std::string& templateName,
-        const ShaderManager::DefineMap& defines)
+        const ShaderManager::DefineMap& defines, std::set<std::string>* usedGlobalDefines)
     {
-        if (!parseDefines(source, defines, mGlobalDefines, templateName))
+        if (!parseDefines(source, defines, mGlobalDefines, templateName, usedGlobalDefines))
             return false;
         if (!parseDirectives(source, linkedShaderTemplateNames, defines, mGlobalDefines, templateName))
             return false;
@@ -6,6 +6,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,11 @@
 #include <osg/Program>
 #include <osg/Shader>
 
+namespace osgUtil
+{
+    class IncrementalCompileOperation;
+}
+
 namespace osgViewer
 {
     class Viewer;
@@ -69,8 +75,16 @@ namespace Shader
 
         void releaseGLObjects(osg::State* state);
 
+        /// Set up an IncrementalCompileOperation that newly created programs are handed to, so they compile
+        /// and link in the background instead of stalling the draw thread on first use.
+        /// @note Thread safe.
+        void setIncrementalCompileOperation(osgUtil::IncrementalCompileOperation* ico);
+
+        /// @param usedGlobalDefines If non-null, receives the names of the global defines the template consumed,
+        /// allowing setGlobalDefines to skip shaders a later change does not affect.
         bool createSourceFromTemplate(std::string& source, std::vector<std::string>& linkedShaderTemplateNames,
-            const std::string& templateName, const ShaderManager::DefineMap& defines);
+            const std::string& templateName, const ShaderManager::DefineMap& defines,
+            std::set<std::string>* usedGlobalDefines = nullptr);
 
         void setMaxTextureUnits(int maxTextureUnits) { mMaxTextureUnits = maxTextureUnits; }
         int getMaxTextureUnits() const { return mMaxTextureUnits; }
@@ -107,6 +121,10 @@ namespace Shader
         typedef std::map<MapKey, osg::ref_ptr<osg::Shader>> ShaderMap;
         ShaderMap mShaders;
 
+        // Global define names each shader consumed when its source was generated, so
+        // setGlobalDefines only regenerates the shaders a change actually affects.
+        std::map<MapKey, std::set<std::string>> mShadersUsedGlobalDefines;
+
         typedef std::map<std::pair<osg::ref_ptr<osg::Shader>, osg::ref_ptr<osg::Shader>>, osg::ref_ptr<osg::Program>>
             ProgramMap;
         ProgramMap mPrograms;
@@ -119,6 +137,8 @@ namespace Shader
 
         osg::ref_ptr<const osg::Program> mProgramTemplate;
 
+        osg::ref_ptr<osgUtil::IncrementalCompileOperation> mIncrementalCompileOperation;
+
         int mMaxTextureUnits = 0;
         int mReservedTextureUnits = 0;
         std::unique_ptr<HotReloadManager> mHotReloadManager;
@@ -135,7 +155,8 @@ namespace Shader
         std::string& source, std::string& linkTarget, const std::string& templateName, size_t foundPos);
 
     bool parseDefines(std::string& source, const ShaderManager::DefineMap& defines,
-        const ShaderManager::DefineMap& globalDefines, const std::string& templateName);
+        const ShaderManager::DefineMap& globalDefines, const std::string& templateName,
+        std::set<std::string>* usedGlobalDefines = nullptr);
 
     bool parseDirectives(std::string& source, std::vector<std::string>& linkedShaderTemplateNames,
         const ShaderManager::DefineMap& defines, const ShaderManager::DefineMap& globalDefines,
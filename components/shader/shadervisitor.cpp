@@ -189,6 +189,7 @@ namespace Shader
         , mReconstructNormalZ(false)
         , mTexStageRequiringTangents(-1)
         , mSoftParticles(false)
+        , mInstancing(false)
         , mNode(nullptr)
     {
     }
@@ -753,6 +754,7 @@ namespace Shader
         }
 
         defineMap["softParticles"] = reqs.mSoftParticles ? "1" : "0";
+        defineMap["instancing"] = reqs.mInstancing ? "1" : "0";
 
         Stereo::shaderStereoDefines(defineMap);
 
@@ -910,7 +912,10 @@ namespace Shader
 
     void ShaderVisitor::apply(osg::Geometry& geometry)
     {
-        bool needPop = geometry.getStateSet() || mRequirements.empty();
+        // Per-instance transform arrays are bound to these attribute slots by convention, see objectpaging.cpp
+        const bool instancing
+            = geometry.getVertexAttribArray(6) != nullptr && geometry.getVertexAttribArray(7) != nullptr;
+        bool needPop = geometry.getStateSet() || mRequirements.empty() || instancing;
         if (needPop)
             pushRequirements(geometry);
 
@@ -919,6 +924,12 @@ namespace Shader
 
         if (!mRequirements.empty())
         {
+            if (instancing)
+            {
+                mRequirements.back().mShaderRequired = true;
+                mRequirements.back().mInstancing = true;
+            }
+
             const ShaderRequirements& reqs = mRequirements.back();
 
             adjustGeometry(geometry, reqs);
@@ -117,6 +117,9 @@ namespace Shader
 
             bool mSoftParticles;
 
+            // true if the geometry carries per-instance transform arrays (see objectpaging.cpp)
+            bool mInstancing;
+
             // the Node that requested these requirements
             osg::Node* mNode;
         };
@@ -1,5 +1,7 @@
 #include "db.hpp"
 
+#include <components/debug/debuglog.hpp>
+
 #include <sqlite3.h>
 
 #include <stdexcept>
@@ -27,6 +29,19 @@ namespace Sqlite3
             throw std::runtime_error("Failed to open database: " + message);
         }
         Db result(handle);
+        // Several processes may write to the same database (e.g. navmeshtool shards or the engine
+        // running next to the tool); make writers wait for each other instead of failing with SQLITE_BUSY.
+        sqlite3_busy_timeout(result.get(), 600000);
+        // Journal settings suited to the cache databases this wrapper backs. WAL turns each commit
+        // into a sequential log append instead of rewriting db pages in place and lets readers
+        // proceed while a write transaction is open; synchronous=normal then skips the per-commit
+        // fsync, which WAL makes safe against corruption (at worst the last commits are lost on
+        // power failure). The default rollback journal still works, so a failure here is not fatal.
+        if (const int ec = sqlite3_exec(
+                result.get(), "pragma journal_mode = wal; pragma synchronous = normal;", nullptr, nullptr, nullptr);
+            ec != SQLITE_OK)
+            Log(Debug::Warning) << "Failed to enable WAL journal mode for " << path << ": "
+                                << sqlite3_errmsg(result.get());
         if (const int ec = sqlite3_exec(result.get(), schema, nullptr, nullptr, nullptr); ec != SQLITE_OK)
             throw std::runtime_error("Failed create database schema: " + std::string(sqlite3_errmsg(handle)));
         return result;
@@ -10,6 +10,8 @@
 
 #include <components/sceneutil/lightmanager.hpp>
 
+#include <components/settings/values.hpp>
+
 #include "compositemaprenderer.hpp"
 #include "material.hpp"
 #include "storage.hpp"
@@ -185,6 +187,14 @@ namespace Terrain
 
         float blendmapScale = mStorage->getBlendmapScale(chunkSize);
 
+        if (useShaders && !forCompositeMap && Settings::terrain().mSinglePassSplatting)
+        {
+            osg::ref_ptr<osg::StateSet> singlePass = ::Terrain::createTextureArrayPass(
+                mSceneManager, layers, blendmapTextures, blendmapScale, blendmapScale);
+            if (singlePass != nullptr)
+                return { singlePass };
+        }
+
         return ::Terrain::createPasses(
             useShaders, mSceneManager, layers, blendmapTextures, blendmapScale, blendmapScale);
     }
@@ -214,22 +224,15 @@ namespace Terrain
         }
         else
         {
-            // Unfortunately we need to copy vertex data because of poor coupling with VertexBufferObject.
-            osg::ref_ptr<osg::Array> positions
-                = static_cast<osg::Array*>(templateGeometry->getVertexArray()->clone(osg::CopyOp::DEEP_COPY_ALL));
-            osg::ref_ptr<osg::Array> normals
-                = static_cast<osg::Array*>(templateGeometry->getNormalArray()->clone(osg::CopyOp::DEEP_COPY_ALL));
-            osg::ref_ptr<osg::Array> colors
-                = static_cast<osg::Array*>(templateGeometry->getColorArray()->clone(osg::CopyOp::DEEP_COPY_ALL));
-
-            osg::ref_ptr<osg::VertexBufferObject> vbo(new osg::VertexBufferObject);
-            positions->setVertexBufferObject(vbo);
-            normals->setVertexBufferObject(vbo);
-            colors->setVertexBufferObject(vbo);
-
-            geometry->setVertexArray(positions);
-            geometry->setNormalArray(normals, osg::Array::BIND_PER_VERTEX);
-            geometry->setColorArray(colors, osg::Array::BIND_PER_VERTEX);
+            // Stitching a chunk to lower detail neighbours only changes the index buffer, so the
+            // template holds exactly the vertex data we need. The arrays already carry a dedicated
+            // VBO, which makes them safe to share between Geometries, just like the UV buffers
+            // shared through the BufferCache. The vertex data is never modified after creation.
+            geometry->setVertexArray(const_cast<osg::Array*>(templateGeometry->getVertexArray()));
+            geometry->setNormalArray(const_cast<osg::Array*>(templateGeometry->getNormalArray()),
+                osg::Array::BIND_PER_VERTEX);
+            geometry->setColorArray(
+                const_cast<osg::Array*>(templateGeometry->getColorArray()), osg::Array::BIND_PER_VERTEX);
         }
 
         geometry->setUseDisplayList(false);
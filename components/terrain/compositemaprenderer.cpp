@@ -5,6 +5,7 @@
 #include <osg/Texture2D>
 
 #include <algorithm>
+#include <chrono>
 
 namespace Terrain
 {
@@ -12,6 +13,7 @@ namespace Terrain
     CompositeMapRenderer::CompositeMapRenderer()
         : mTargetFrameRate(120)
         , mMinimumTimeAvailable(0.0025)
+        , mSmoothedFrameTime(0.0)
     {
         setSupportsDisplayList(false);
         setCullingActive(false);
@@ -29,8 +31,14 @@ namespace Terrain
         dt = std::min(dt, 0.2);
         mTimer.setStartTick();
         double targetFrameTime = 1.0 / static_cast<double>(mTargetFrameRate);
+        mSmoothedFrameTime = mSmoothedFrameTime == 0.0 ? dt : mSmoothedFrameTime + (dt - mSmoothedFrameTime) * 0.05;
+        double minimumTimeAvailable = mMinimumTimeAvailable;
+        // When frames consistently miss the target there is no spare time to borrow; scale the
+        // floor down so compiling backs off instead of making slow frames slower.
+        if (mSmoothedFrameTime > targetFrameTime)
+            minimumTimeAvailable *= std::max(0.25, targetFrameTime / mSmoothedFrameTime);
         double conservativeTimeRatio(0.75);
-        double availableTime = std::max((targetFrameTime - dt) * conservativeTimeRatio, mMinimumTimeAvailable);
+        double availableTime = std::max((targetFrameTime - dt) * conservativeTimeRatio, minimumTimeAvailable);
 
         std::lock_guard<std::mutex> lock(mMutex);
 
@@ -54,7 +62,7 @@ namespace Terrain
             mCompileSet.erase(node);
 
             mMutex.unlock();
-            compile(*node, renderInfo);
+            compile(*node, renderInfo, deadline);
             mMutex.lock();
 
             if (node->mCompiled < node->mDrawables.size())
@@ -67,7 +75,8 @@ namespace Terrain
         mTimer.setStartTick();
     }
 
-    void CompositeMapRenderer::compile(CompositeMap& compositeMap, osg::RenderInfo& renderInfo) const
+    void CompositeMapRenderer::compile(CompositeMap& compositeMap, osg::RenderInfo& renderInfo,
+        std::chrono::steady_clock::time_point deadline) const
     {
         // if there are no more external references we can assume the texture is no longer required
         if (compositeMap.mTexture->referenceCount() <= 1)
@@ -123,6 +132,11 @@ namespace Terrain
             ++compositeMap.mCompiled;
 
             compositeMap.mDrawables[i] = nullptr;
+
+            // Respect the per frame time budget between drawables too; large maps can have
+            // hundreds of layer passes and our caller will requeue what is left of this one.
+            if (std::chrono::steady_clock::now() >= deadline)
+                break;
         }
         if (compositeMap.mCompiled == compositeMap.mDrawables.size())
             compositeMap.mDrawables = std::vector<osg::ref_ptr<osg::Drawable>>();
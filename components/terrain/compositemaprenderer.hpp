@@ -3,6 +3,7 @@
 
 #include <osg/Drawable>
 
+#include <chrono>
 #include <mutex>
 #include <set>
 
@@ -38,7 +39,9 @@ namespace Terrain
 
         void drawImplementation(osg::RenderInfo& renderInfo) const override;
 
-        void compile(CompositeMap& compositeMap, osg::RenderInfo& renderInfo) const;
+        /// Render the composite map's remaining drawables, stopping early once the deadline has passed.
+        void compile(CompositeMap& compositeMap, osg::RenderInfo& renderInfo,
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()) const;
 
         /// Set the available time in seconds for compiling (non-immediate) composite maps each frame
         void setMinimumTimeAvailableForCompile(double time);
@@ -57,6 +60,7 @@ namespace Terrain
     private:
         float mTargetFrameRate;
         double mMinimumTimeAvailable;
+        mutable double mSmoothedFrameTime;
         mutable osg::Timer mTimer;
 
         typedef std::set<osg::ref_ptr<CompositeMap>> CompileSet;
@@ -7,6 +7,7 @@
 #include <osg/TexEnvCombine>
 #include <osg/TexMat>
 #include <osg/Texture2D>
+#include <osg/Texture2DArray>
 
 #include <components/resource/scenemanager.hpp>
 #include <components/sceneutil/depth.hpp>
@@ -14,7 +15,10 @@
 #include <components/shader/shadermanager.hpp>
 #include <components/stereo/stereomanager.hpp>
 
+#include <cstddef>
+#include <cstring>
 #include <mutex>
+#include <vector>
 
 namespace
 {
@@ -208,15 +212,69 @@ namespace
         osg::ref_ptr<osg::Uniform> mBlendMap;
         osg::ref_ptr<osg::Uniform> mNormalMap;
         osg::ref_ptr<osg::Uniform> mColorMode;
+        osg::ref_ptr<osg::Uniform> mDiffuseArrayMap;
+        osg::ref_ptr<osg::Uniform> mBlendMap0;
+        osg::ref_ptr<osg::Uniform> mNormalArrayMap;
+        osg::ref_ptr<osg::Uniform> mBlendMap1;
 
         UniformCollection()
             : mDiffuseMap(new osg::Uniform("diffuseMap", 0))
             , mBlendMap(new osg::Uniform("blendMap", 1))
             , mNormalMap(new osg::Uniform("normalMap", 2))
             , mColorMode(new osg::Uniform("colorMode", 2))
+            , mDiffuseArrayMap(new osg::Uniform("diffuseArrayMap", 0))
+            , mBlendMap0(new osg::Uniform("blendMap0", 1))
+            , mNormalArrayMap(new osg::Uniform("normalArrayMap", 2))
+            , mBlendMap1(new osg::Uniform("blendMap1", 3))
         {
         }
     };
+
+    // Chunks covering the same cells share their layer set, so the stacked layer arrays are
+    // shared between chunks as well. Keys hold references to keep the source textures (and
+    // with them the stacking) unique for the lifetime of the cache.
+    class LayerTextureArrays
+    {
+    public:
+        static osg::ref_ptr<osg::Texture2DArray> value(std::vector<osg::ref_ptr<osg::Texture2D>>&& sources)
+        {
+            static LayerTextureArrays instance;
+            return instance.get(std::move(sources));
+        }
+
+        osg::ref_ptr<osg::Texture2DArray> get(std::vector<osg::ref_ptr<osg::Texture2D>>&& sources)
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            auto found = mArrays.find(sources);
+            if (found == mArrays.end())
+            {
+                osg::ref_ptr<osg::Texture2DArray> array(new osg::Texture2DArray);
+                const osg::Texture2D& first = *sources.front();
+                array->setTextureSize(
+                    first.getImage(0)->s(), first.getImage(0)->t(), static_cast<int>(sources.size()));
+                for (std::size_t i = 0; i < sources.size(); ++i)
+                    array->setImage(static_cast<int>(i), sources[i]->getImage(0));
+                array->setWrap(osg::Texture::WRAP_S, osg::Texture::REPEAT);
+                array->setWrap(osg::Texture::WRAP_T, osg::Texture::REPEAT);
+                array->setFilter(osg::Texture::MIN_FILTER, first.getFilter(osg::Texture::MIN_FILTER));
+                array->setFilter(osg::Texture::MAG_FILTER, first.getFilter(osg::Texture::MAG_FILTER));
+                array->setMaxAnisotropy(first.getMaxAnisotropy());
+                array->setResizeNonPowerOfTwoHint(false);
+                found = mArrays.emplace(std::move(sources), std::move(array)).first;
+            }
+            return found->second;
+        }
+
+    private:
+        std::mutex mMutex;
+        std::map<std::vector<osg::ref_ptr<osg::Texture2D>>, osg::ref_ptr<osg::Texture2DArray>> mArrays;
+    };
+
+    bool isCompatibleLayerImage(const osg::Image* image, const osg::Image* first)
+    {
+        return image != nullptr && image->s() == first->s() && image->t() == first->t()
+            && image->getPixelFormat() == first->getPixelFormat() && image->getDataType() == first->getDataType();
+    }
 }
 
 namespace Terrain
@@ -338,4 +396,122 @@ namespace Terrain
         return passes;
     }
 
+    osg::ref_ptr<osg::StateSet> createTextureArrayPass(Resource::SceneManager* sceneManager,
+        const std::vector<TextureLayer>& layers, const std::vector<osg::ref_ptr<osg::Texture2D>>& blendmaps,
+        int blendmapScale, float layerTileSize)
+    {
+        constexpr std::size_t maxLayers = 8; // two RGBA blend maps worth of weights
+        if (layers.size() < 2 || layers.size() > maxLayers || blendmaps.size() != layers.size())
+            return nullptr;
+
+        const osg::Image* firstDiffuse = layers.front().mDiffuseMap ? layers.front().mDiffuseMap->getImage(0) : nullptr;
+        if (firstDiffuse == nullptr)
+            return nullptr;
+
+        const bool normalMaps = layers.front().mNormalMap != nullptr;
+        const bool specular = layers.front().mSpecular;
+        const osg::Image* firstNormal = normalMaps ? layers.front().mNormalMap->getImage(0) : nullptr;
+        if (normalMaps && firstNormal == nullptr)
+            return nullptr;
+
+        std::vector<osg::ref_ptr<osg::Texture2D>> diffuseSources;
+        std::vector<osg::ref_ptr<osg::Texture2D>> normalSources;
+        for (const TextureLayer& layer : layers)
+        {
+            // Parallax needs a per-layer offset before sampling, which a shared weighted sample
+            // can't provide; mixed specular flags would need per-layer shading. Fall back.
+            if ((layer.mNormalMap && layer.mParallax) || layer.mSpecular != specular)
+                return nullptr;
+            if ((layer.mNormalMap != nullptr) != normalMaps)
+                return nullptr;
+            if (layer.mDiffuseMap == nullptr || !isCompatibleLayerImage(layer.mDiffuseMap->getImage(0), firstDiffuse))
+                return nullptr;
+            if (normalMaps && !isCompatibleLayerImage(layer.mNormalMap->getImage(0), firstNormal))
+                return nullptr;
+            diffuseSources.push_back(layer.mDiffuseMap);
+            if (normalMaps)
+                normalSources.push_back(layer.mNormalMap);
+        }
+
+        // Pack the per-layer blend weights into RGBA maps, four layers per map.
+        const osg::Image* firstBlend = blendmaps.front()->getImage(0);
+        if (firstBlend == nullptr || firstBlend->getPixelFormat() != GL_ALPHA
+            || firstBlend->getDataType() != GL_UNSIGNED_BYTE)
+            return nullptr;
+        for (const osg::ref_ptr<osg::Texture2D>& blendmap : blendmaps)
+            if (!isCompatibleLayerImage(blendmap->getImage(0), firstBlend))
+                return nullptr;
+
+        std::vector<osg::ref_ptr<osg::Texture2D>> packedBlendmaps;
+        for (std::size_t group = 0; group < layers.size(); group += 4)
+        {
+            osg::ref_ptr<osg::Image> packed(new osg::Image);
+            packed->allocateImage(firstBlend->s(), firstBlend->t(), 1, GL_RGBA, GL_UNSIGNED_BYTE);
+            std::memset(packed->data(), 0, packed->getTotalSizeInBytes());
+            for (std::size_t channel = 0; channel < 4 && group + channel < layers.size(); ++channel)
+            {
+                const osg::Image* source = blendmaps[group + channel]->getImage(0);
+                for (int y = 0; y < source->t(); ++y)
+                {
+                    const unsigned char* sourceRow = source->data(0, y);
+                    unsigned char* packedRow = packed->data(0, y);
+                    for (int x = 0; x < source->s(); ++x)
+                        packedRow[4 * x + channel] = sourceRow[x];
+                }
+            }
+
+            osg::ref_ptr<osg::Texture2D> texture(new osg::Texture2D);
+            texture->setImage(packed);
+            texture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
+            texture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
+            texture->setResizeNonPowerOfTwoHint(false);
+            packedBlendmaps.push_back(texture);
+        }
+
+        osg::ref_ptr<osg::StateSet> stateset(new osg::StateSet);
+
+        stateset->setTextureAttributeAndModes(0, LayerTextureArrays::value(std::move(diffuseSources)));
+        if (layerTileSize != 1.f)
+            stateset->setTextureAttributeAndModes(0, LayerTexMat::value(layerTileSize), osg::StateAttribute::ON);
+        stateset->addUniform(UniformCollection::value().mDiffuseArrayMap);
+
+        stateset->setTextureAttributeAndModes(1, packedBlendmaps[0]);
+        stateset->setTextureAttributeAndModes(1, BlendmapTexMat::value(blendmapScale));
+        stateset->addUniform(UniformCollection::value().mBlendMap0);
+
+        bool reconstructNormalZ = false;
+        if (normalMaps)
+        {
+            stateset->setTextureAttributeAndModes(2, LayerTextureArrays::value(std::move(normalSources)));
+            stateset->addUniform(UniformCollection::value().mNormalArrayMap);
+
+            switch (SceneUtil::computeUnsizedPixelFormat(firstNormal->getPixelFormat()))
+            {
+                case GL_RG:
+                case GL_RG_INTEGER:
+                    reconstructNormalZ = true;
+            }
+        }
+
+        if (packedBlendmaps.size() > 1)
+        {
+            stateset->setTextureAttributeAndModes(3, packedBlendmaps[1]);
+            stateset->addUniform(UniformCollection::value().mBlendMap1);
+        }
+
+        Shader::ShaderManager::DefineMap defineMap;
+        defineMap["layerCount"] = std::to_string(layers.size());
+        defineMap["secondBlendMap"] = packedBlendmaps.size() > 1 ? "1" : "0";
+        defineMap["normalMap"] = normalMaps ? "1" : "0";
+        defineMap["specularMap"] = specular ? "1" : "0";
+        defineMap["writeNormals"] = "1";
+        defineMap["reconstructNormalZ"] = reconstructNormalZ ? "1" : "0";
+        Stereo::shaderStereoDefines(defineMap);
+
+        stateset->setAttributeAndModes(sceneManager->getShaderManager().getProgram("terrain_singlepass", defineMap));
+        stateset->addUniform(UniformCollection::value().mColorMode);
+
+        return stateset;
+    }
+
 }
@@ -28,6 +28,15 @@ namespace Terrain
         const std::vector<TextureLayer>& layers, const std::vector<osg::ref_ptr<osg::Texture2D>>& blendmaps,
         int blendmapScale, float layerTileSize);
 
+    /// Try to build a single stateset that splats all \a layers in one shader pass: the layer
+    /// textures are stacked into a shared texture array and the per-layer blend weights are
+    /// packed into RGBA blend maps. Returns nullptr when the layers can't be combined (more
+    /// than 8 layers, mismatched image sizes or formats, parallax layers), in which case the
+    /// caller falls back to one pass per layer via createPasses.
+    osg::ref_ptr<osg::StateSet> createTextureArrayPass(Resource::SceneManager* sceneManager,
+        const std::vector<TextureLayer>& layers, const std::vector<osg::ref_ptr<osg::Texture2D>>& blendmaps,
+        int blendmapScale, float layerTileSize);
+
 }
 
 #endif
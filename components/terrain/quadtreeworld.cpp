@@ -487,6 +487,10 @@ namespace Terrain
         {
             ViewDataEntry& entry = vd->getEntry(i);
             loadRenderingNode(entry, vd, cellWorldSize, mActiveGrid, false);
+            if (isCullVisitor && mOcclusionTestCallback
+                && mOcclusionTestCallback->isOccluded(
+                    static_cast<osgUtil::CullVisitor*>(&nv), entry.mRenderingNode->getBound()))
+                continue;
             entry.mRenderingNode->accept(nv);
         }
 
@@ -11,11 +11,17 @@
 
 namespace osg
 {
+    class BoundingSphere;
     class NodeVisitor;
     class Group;
     class Stats;
 }
 
+namespace osgUtil
+{
+    class CullVisitor;
+}
+
 namespace Terrain
 {
     class RootNode;
@@ -87,6 +93,21 @@ namespace Terrain
         };
         void addChunkManager(ChunkManager*);
 
+        /// Asked during cull whether a chunk's bound is known to be hidden, so occlusion
+        /// culling can veto its traversal.
+        class OcclusionTestCallback : public osg::Referenced
+        {
+        public:
+            virtual bool isOccluded(osgUtil::CullVisitor* cv, const osg::BoundingSphere& bound) = 0;
+
+        protected:
+            virtual ~OcclusionTestCallback() = default;
+        };
+        void setOcclusionTestCallback(osg::ref_ptr<OcclusionTestCallback> callback)
+        {
+            mOcclusionTestCallback = std::move(callback);
+        }
+
     private:
         void ensureQuadTreeBuilt();
         void loadRenderingNode(
@@ -106,6 +127,7 @@ namespace Terrain
         float mMinSize;
         bool mDebugTerrainChunks;
         std::unique_ptr<DebugChunkManager> mDebugChunkManager;
+        osg::ref_ptr<OcclusionTestCallback> mOcclusionTestCallback;
     };
 
 }
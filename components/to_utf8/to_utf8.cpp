@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <ios>
 #include <iterator>
 #include <stdexcept>
@@ -47,9 +49,24 @@ using namespace ToUTF8;
 
 namespace
 {
-    std::string_view::iterator skipAscii(std::string_view input)
+    // Find the first byte that ends an ASCII run: a zero terminator or a byte with the high
+    // bit set. Scans word-at-a-time, strings are almost always pure ASCII.
+    const char* skipAscii(const char* first, const char* last)
     {
-        return std::find_if(input.begin(), input.end(), [](unsigned char v) { return v == 0 || v >= 128; });
+        constexpr std::uint64_t ones = 0x0101010101010101ull;
+        constexpr std::uint64_t highBits = 0x8080808080808080ull;
+        while (last - first >= static_cast<std::ptrdiff_t>(sizeof(std::uint64_t)))
+        {
+            std::uint64_t word;
+            std::memcpy(&word, first, sizeof(word));
+            // Stop on a word containing a zero byte or a byte with the high bit set
+            if ((((word - ones) & ~word) | word) & highBits)
+                break;
+            first += sizeof(word);
+        }
+        while (first != last && *first != 0 && static_cast<unsigned char>(*first) < 128)
+            ++first;
+        return first;
     }
 
     std::basic_string_view<signed char> getTranslationArray(FromType sourceEncoding)
@@ -126,9 +143,21 @@ std::string_view StatelessUtf8Encoder::getUtf8(
     resize(outlen, bufferAllocationPolicy, buffer);
     char* out = buffer.data();
 
-    // Translate
-    for (auto it = input.begin(); it != input.end() && *it != 0; ++it)
-        copyFromArray(*it, out);
+    // Translate, copying ASCII runs in one block each
+    const char* const end = input.data() + input.size();
+    for (const char* it = input.data(); it != end && *it != 0;)
+    {
+        if (static_cast<unsigned char>(*it) < 128)
+        {
+            const char* const runEnd = skipAscii(it, end);
+            std::memcpy(out, it, runEnd - it);
+            out += runEnd - it;
+            it = runEnd;
+            continue;
+        }
+        copyFromArray(static_cast<unsigned char>(*it), out);
+        ++it;
+    }
 
     // Make sure that we wrote the correct number of bytes
     assert((out - buffer.data()) == (int)outlen);
@@ -192,23 +221,33 @@ std::pair<std::size_t, bool> StatelessUtf8Encoder::getLength(std::string_view in
 {
     // Do away with the ascii part of the string first (this is almost
     // always the entire string.)
-    auto it = skipAscii(input);
+    const char* const end = input.data() + input.size();
+    const char* it = skipAscii(input.data(), end);
 
     // If we're not at the null terminator at this point, then there
     // were some non-ascii characters to deal with. Go to slow-mode for
     // the rest of the string.
-    if (it == input.end() || *it == 0)
-        return { it - input.begin(), true };
+    if (it == end || *it == 0)
+        return { it - input.data(), true };
 
-    std::size_t len = it - input.begin();
+    std::size_t len = it - input.data();
 
-    do
+    while (it != end && *it != 0)
     {
+        // Mostly-ASCII strings: count whole ASCII runs at once.
+        if (static_cast<unsigned char>(*it) < 128)
+        {
+            const char* const runEnd = skipAscii(it, end);
+            len += runEnd - it;
+            it = runEnd;
+            continue;
+        }
+
         // Find the translated length of this character in the
         // lookup table.
         len += mTranslationArray[static_cast<unsigned char>(*it) * 6];
         ++it;
-    } while (it != input.end() && *it != 0);
+    }
 
     return { len, false };
 }
@@ -234,15 +273,16 @@ std::pair<std::size_t, bool> StatelessUtf8Encoder::getLengthLegacyEnc(std::strin
 {
     // Do away with the ascii part of the string first (this is almost
     // always the entire string.)
-    auto it = skipAscii(input);
+    const char* const ascii = skipAscii(input.data(), input.data() + input.size());
 
     // If we're not at the null terminator at this point, then there
     // were some non-ascii characters to deal with. Go to slow-mode for
     // the rest of the string.
-    if (it == input.end() || *it == 0)
-        return { it - input.begin(), true };
+    if (ascii == input.data() + input.size() || *ascii == 0)
+        return { ascii - input.data(), true };
 
-    std::size_t len = it - input.begin();
+    auto it = input.begin() + (ascii - input.data());
+    std::size_t len = ascii - input.data();
     std::size_t symbolLen = 0;
 
     do
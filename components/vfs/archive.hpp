@@ -6,6 +6,11 @@
 #include "filemap.hpp"
 #include "pathutil.hpp"
 
+namespace Resource
+{
+    struct CacheStats;
+}
+
 namespace VFS
 {
     class Archive
@@ -20,6 +25,9 @@ namespace VFS
         virtual bool contains(Path::NormalizedView file) const = 0;
 
         virtual std::string getDescription() const = 0;
+
+        /// Add this archive's decompression cache statistics to the given counters, if it has a cache.
+        virtual void getCacheStats(Resource::CacheStats& out) const {}
     };
 
 }
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 namespace VFS
 {
@@ -67,6 +68,12 @@ namespace VFS
 
         std::string getDescription() const override { return std::string{ "BSA: " } + mFile->getFilename(); }
 
+        void getCacheStats(Resource::CacheStats& out) const override
+        {
+            if constexpr (std::is_same_v<BSAFileType, Bsa::CompressedBSAFile>)
+                mFile->getCacheStats(out);
+        }
+
     private:
         std::unique_ptr<BSAFileType> mFile;
         std::vector<BsaArchiveFile<BSAFileType>> mResources;
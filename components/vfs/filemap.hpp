@@ -3,6 +3,8 @@
 
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace VFS
 {
@@ -14,6 +16,10 @@ namespace VFS
     }
 
     using FileMap = std::map<Path::Normalized, File*, std::less<>>;
+
+    // Flat sorted form of FileMap the Manager builds once after all archives are merged.
+    using FileEntry = std::pair<Path::Normalized, File*>;
+    using FileIndex = std::vector<FileEntry>;
 }
 
 #endif
@@ -1,6 +1,9 @@
 #include "filesystemarchive.hpp"
 
 #include <filesystem>
+#include <future>
+#include <utility>
+#include <vector>
 
 #include "pathutil.hpp"
 
@@ -11,6 +14,45 @@
 namespace VFS
 {
 
+    namespace
+    {
+        using IndexEntries = std::vector<std::pair<VFS::Path::Normalized, FileSystemArchiveFile>>;
+
+        IndexEntries enumerateFiles(const std::filesystem::path& path, std::size_t prefix)
+        {
+            IndexEntries result;
+
+            std::filesystem::recursive_directory_iterator iterator(path);
+
+            for (auto it = std::filesystem::begin(iterator), end = std::filesystem::end(iterator); it != end;)
+            {
+                const std::filesystem::directory_entry& entry = *it;
+
+                if (!entry.is_directory())
+                {
+                    const std::filesystem::path& filePath = entry.path();
+                    const std::string proper = Files::pathToUnicodeString(filePath);
+                    VFS::Path::Normalized searchable(std::string_view{ proper }.substr(prefix));
+
+                    result.emplace_back(std::move(searchable), FileSystemArchiveFile(filePath));
+                }
+
+                // Exception thrown by the operator++ may not contain the context of the error like what exact path
+                // caused the problem which makes it hard to understand what's going on when iteration happens over a
+                // directory with thousands of files and subdirectories.
+                const std::filesystem::path prevPath = entry.path();
+                std::error_code ec;
+                it.increment(ec);
+                if (ec != std::error_code())
+                    throw std::runtime_error("Failed to recursively iterate over \"" + Files::pathToUnicodeString(path)
+                        + "\" when incrementing to the next item from \"" + Files::pathToUnicodeString(prevPath)
+                        + "\": " + ec.message());
+            }
+
+            return result;
+        }
+    }
+
     FileSystemArchive::FileSystemArchive(const std::filesystem::path& path)
         : mPath(path)
     {
@@ -20,37 +62,52 @@ namespace VFS
         if (prefix > 0 && str[prefix - 1] != '\\' && str[prefix - 1] != '/')
             ++prefix;
 
-        std::filesystem::recursive_directory_iterator iterator(mPath);
+        // The enumeration is I/O bound and large mod setups keep hundreds of thousands of loose files, almost all of
+        // them below a handful of top level subdirectories (meshes, textures, ...), so walk those concurrently.
+        std::vector<std::future<IndexEntries>> subdirectories;
+        IndexEntries topLevel;
+
+        std::filesystem::directory_iterator iterator(mPath);
 
         for (auto it = std::filesystem::begin(iterator), end = std::filesystem::end(iterator); it != end;)
         {
             const std::filesystem::directory_entry& entry = *it;
 
-            if (!entry.is_directory())
+            if (entry.is_directory())
+                subdirectories.push_back(std::async(std::launch::async, enumerateFiles, entry.path(), prefix));
+            else
             {
                 const std::filesystem::path& filePath = entry.path();
                 const std::string proper = Files::pathToUnicodeString(filePath);
                 VFS::Path::Normalized searchable(std::string_view{ proper }.substr(prefix));
-                FileSystemArchiveFile file(filePath);
 
-                const auto inserted = mIndex.emplace(std::move(searchable), std::move(file));
-                if (!inserted.second)
-                    Log(Debug::Warning)
-                        << "Found duplicate file for '" << proper
-                        << "', please check your file system for two files with the same name in different cases.";
+                topLevel.emplace_back(std::move(searchable), FileSystemArchiveFile(filePath));
             }
 
-            // Exception thrown by the operator++ may not contain the context of the error like what exact path caused
-            // the problem which makes it hard to understand what's going on when iteration happens over a directory
-            // with thousands of files and subdirectories.
             const std::filesystem::path prevPath = entry.path();
             std::error_code ec;
             it.increment(ec);
             if (ec != std::error_code())
-                throw std::runtime_error("Failed to recursively iterate over \"" + Files::pathToUnicodeString(mPath)
+                throw std::runtime_error("Failed to iterate over \"" + Files::pathToUnicodeString(mPath)
                     + "\" when incrementing to the next item from \"" + Files::pathToUnicodeString(prevPath)
                     + "\": " + ec.message());
         }
+
+        const auto addEntries = [&](IndexEntries&& entries) {
+            for (auto& [searchable, file] : entries)
+            {
+                const std::filesystem::path filePath = file.getPath();
+                const auto inserted = mIndex.emplace(std::move(searchable), std::move(file));
+                if (!inserted.second)
+                    Log(Debug::Warning)
+                        << "Found duplicate file for '" << Files::pathToUnicodeString(filePath)
+                        << "', please check your file system for two files with the same name in different cases.";
+            }
+        };
+
+        addEntries(std::move(topLevel));
+        for (std::future<IndexEntries>& subdirectory : subdirectories)
+            addEntries(subdirectory.get());
     }
 
     void FileSystemArchive::listResources(FileMap& out)
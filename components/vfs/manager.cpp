@@ -1,5 +1,7 @@
 #include "manager.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <stdexcept>
 
@@ -14,12 +16,23 @@
 
 namespace VFS
 {
+    namespace
+    {
+        bool compareEntry(const FileEntry& entry, std::string_view value)
+        {
+            return entry.first.view() < value;
+        }
+
+        std::atomic<std::size_t> sIndexGeneration{ 0 };
+    }
+
     Manager::Manager() = default;
 
     Manager::~Manager() = default;
 
     void Manager::reset()
     {
+        mLookup.clear();
         mIndex.clear();
         mArchives.clear();
     }
@@ -31,10 +44,26 @@ namespace VFS
 
     void Manager::buildIndex()
     {
+        FileMap merged;
+        for (const auto& archive : mArchives)
+            archive->listResources(merged);
+
+        mLookup.clear();
         mIndex.clear();
+        mIndex.reserve(merged.size());
+        for (auto& [name, file] : merged)
+            mIndex.emplace_back(name, file);
 
-        for (const auto& archive : mArchives)
-            archive->listResources(mIndex);
+        mLookup.reserve(mIndex.size());
+        for (const FileEntry& entry : mIndex)
+            mLookup.emplace(entry.first.view(), entry.second);
+
+        sIndexGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t Manager::getIndexGeneration()
+    {
+        return sIndexGeneration.load(std::memory_order_relaxed);
     }
 
     Files::IStreamPtr Manager::find(Path::NormalizedView name) const
@@ -63,12 +92,12 @@ namespace VFS
 
     bool Manager::exists(const Path::Normalized& name) const
     {
-        return mIndex.find(name) != mIndex.end();
+        return mLookup.find(name.view()) != mLookup.end();
     }
 
     bool Manager::exists(Path::NormalizedView name) const
     {
-        return mIndex.find(name) != mIndex.end();
+        return mLookup.find(name.value()) != mLookup.end();
     }
 
     std::string Manager::getArchive(const Path::Normalized& name) const
@@ -86,8 +115,8 @@ namespace VFS
         std::string normalized = Files::pathToUnicodeString(name);
         Path::normalizeFilenameInPlace(normalized);
 
-        const auto found = mIndex.find(normalized);
-        if (found == mIndex.end())
+        const auto found = mLookup.find(normalized);
+        if (found == mLookup.end())
             throw std::runtime_error("Resource '" + normalized + "' is not found");
         return found->second->getPath();
     }
@@ -95,37 +124,44 @@ namespace VFS
     RecursiveDirectoryRange Manager::getRecursiveDirectoryIterator(std::string_view path) const
     {
         if (path.empty())
-            return { mIndex.begin(), mIndex.end() };
+            return { mIndex.data(), mIndex.data() + mIndex.size() };
         std::string normalized = Path::normalizeFilename(path);
-        const auto it = mIndex.lower_bound(normalized);
-        if (it == mIndex.end() || !it->first.view().starts_with(normalized))
+        const FileEntry* it = std::lower_bound(mIndex.data(), mIndex.data() + mIndex.size(), normalized, compareEntry);
+        if (it == mIndex.data() + mIndex.size() || !it->first.view().starts_with(normalized))
             return { it, it };
         ++normalized.back();
-        return { it, mIndex.lower_bound(normalized) };
+        return { it, std::lower_bound(it, mIndex.data() + mIndex.size(), std::string_view(normalized), compareEntry) };
     }
 
     RecursiveDirectoryRange Manager::getRecursiveDirectoryIterator(VFS::Path::NormalizedView path) const
     {
         if (path.value().empty())
-            return { mIndex.begin(), mIndex.end() };
-        const auto it = mIndex.lower_bound(path);
-        if (it == mIndex.end() || !it->first.view().starts_with(path.value()))
+            return { mIndex.data(), mIndex.data() + mIndex.size() };
+        const FileEntry* it
+            = std::lower_bound(mIndex.data(), mIndex.data() + mIndex.size(), path.value(), compareEntry);
+        if (it == mIndex.data() + mIndex.size() || !it->first.view().starts_with(path.value()))
             return { it, it };
         std::string copy(path.value());
         ++copy.back();
-        return { it, mIndex.lower_bound(copy) };
+        return { it, std::lower_bound(it, mIndex.data() + mIndex.size(), std::string_view(copy), compareEntry) };
     }
 
     RecursiveDirectoryRange Manager::getRecursiveDirectoryIterator() const
     {
-        return { mIndex.begin(), mIndex.end() };
+        return { mIndex.data(), mIndex.data() + mIndex.size() };
+    }
+
+    void Manager::getArchiveCacheStats(Resource::CacheStats& out) const
+    {
+        for (const auto& archive : mArchives)
+            archive->getCacheStats(out);
     }
 
     Files::IStreamPtr Manager::findNormalized(std::string_view normalizedPath) const
     {
         assert(Path::isNormalized(normalizedPath));
-        const auto it = mIndex.find(normalizedPath);
-        if (it == mIndex.end())
+        const auto it = mLookup.find(normalizedPath);
+        if (it == mLookup.end())
             return nullptr;
         return it->second->open();
     }
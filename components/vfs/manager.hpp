@@ -3,15 +3,22 @@
 
 #include <components/files/istreamptr.hpp>
 
+#include <cstddef>
 #include <filesystem>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "filemap.hpp"
 #include "pathutil.hpp"
 
+namespace Resource
+{
+    struct CacheStats;
+}
+
 namespace VFS
 {
     class Archive;
@@ -39,6 +46,12 @@ namespace VFS
         /// Build the file index. Should be called when all archives have been registered.
         void buildIndex();
 
+        /// Incremented by every buildIndex() call of any manager. Lets caches keyed on lookup
+        /// results (e.g. the corrected path memo in Misc::ResourceHelpers) detect that their
+        /// entries may have gone stale.
+        /// @note May be called from any thread.
+        static std::size_t getIndexGeneration();
+
         /// Does a file with this name exist?
         /// @note May be called from any thread once the index has been built.
         bool exists(const Path::Normalized& name) const;
@@ -77,10 +90,17 @@ namespace VFS
         /// @note May be called from any thread once the index has been built.
         std::filesystem::path getAbsoluteFileName(const std::filesystem::path& name) const;
 
+        /// Accumulate decompression cache statistics over all registered archives.
+        void getArchiveCacheStats(Resource::CacheStats& out) const;
+
     private:
         std::vector<std::unique_ptr<Archive>> mArchives;
 
-        FileMap mIndex;
+        // Flat sorted array of all files, used for prefix ranges, plus a hash table over its names
+        // for exact lookups. Both are filled once by buildIndex() and never modified afterwards,
+        // which is what makes queries safe without synchronization.
+        FileIndex mIndex;
+        std::unordered_map<std::string_view, File*> mLookup;
 
         inline Files::IStreamPtr findNormalized(std::string_view normalizedPath) const;
     };
@@ -11,7 +11,7 @@ namespace VFS
     class RecursiveDirectoryIterator
     {
     public:
-        RecursiveDirectoryIterator(FileMap::const_iterator it)
+        RecursiveDirectoryIterator(const FileEntry* it)
             : mIt(it)
         {
         }
@@ -29,7 +29,7 @@ namespace VFS
         friend bool operator==(const RecursiveDirectoryIterator& lhs, const RecursiveDirectoryIterator& rhs) = default;
 
     private:
-        FileMap::const_iterator mIt;
+        const FileEntry* mIt;
     };
 
     class RecursiveDirectoryRange
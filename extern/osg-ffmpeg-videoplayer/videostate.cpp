@@ -8,6 +8,7 @@
 #include <thread>
 #include <chrono>
 
+#include <osg/BufferObject>
 #include <osg/Texture2D>
 #include <utility>
 
@@ -295,12 +296,23 @@ void VideoState::video_display(VideoPicture *vp)
             mTexture->setWrap(osg::Texture::WRAP_T, osg::Texture::REPEAT);
         }
 
-        osg::ref_ptr<osg::Image> image = new osg::Image;
+        if (!mImage.get())
+        {
+            // One image is reused for every frame. It references the picture queue slot directly
+            // (the queue keeps a spare slot so the referenced data is not overwritten before the
+            // next display), and the pixel buffer object lets the driver transfer it to the GPU
+            // asynchronously instead of stalling the draw thread on a client-memory upload.
+            mImage = new osg::Image;
+            mImage->setDataVariance(osg::Object::DYNAMIC);
+            mImage->setPixelBufferObject(new osg::PixelBufferObject);
+        }
 
-        image->setImage(this->video_ctx->width, this->video_ctx->height,
+        mImage->setImage(this->video_ctx->width, this->video_ctx->height,
                         1, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, vp->rgbaFrame->data[0], osg::Image::NO_DELETE);
+        mImage->dirty();
 
-        mTexture->setImage(image);
+        if (mTexture->getImage() != mImage.get())
+            mTexture->setImage(mImage);
     }
 }
 
@@ -865,6 +877,7 @@ void VideoState::deinit()
         mTexture->setImage(nullptr);
         mTexture = nullptr;
     }
+    mImage = nullptr;
 
     // Deallocate RGBA frame queue.
     for (auto & i : this->pictq)
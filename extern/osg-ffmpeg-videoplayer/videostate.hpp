@@ -14,6 +14,7 @@
 
 namespace osg
 {
+    class Image;
     class Texture2D;
 }
 
@@ -167,6 +168,7 @@ struct VideoState {
     static int64_t istream_seek(void *user_data, int64_t offset, int whence);
 
     osg::ref_ptr<osg::Texture2D> mTexture;
+    osg::ref_ptr<osg::Image> mImage;
 
     MovieAudioFactory* mAudioFactory;
     std::unique_ptr<MovieAudioDecoder> mAudioDecoder;
@@ -20,6 +20,15 @@
 -- @param #string eventName
 -- @param eventData
 
+---
+-- Enable or disable coalescing for the given event name. While enabled, only the latest
+-- not yet delivered event with this name is kept per destination; older pending ones are
+-- replaced. Intended for high-frequency events where only the latest value matters.
+-- Disabled by default for every event.
+-- @function [parent=#core] setEventCoalescing
+-- @param #string eventName
+-- @param #boolean enable
+
 ---
 -- Simulation time in seconds.
 -- The number of simulation seconds passed in the game world since starting a new game.
@@ -287,6 +296,15 @@
 -- @type ObjectList
 -- @list <#GameObject>
 
+---
+-- Send a local event to every object in the list. The event data is serialized once
+-- and shared between the objects, which is cheaper than calling
+-- @{#GameObject.sendEvent} in a loop.
+-- @function [parent=#ObjectList] sendEvent
+-- @param self
+-- @param #string eventName
+-- @param eventData
+
 
 ---
 -- A cell of the game world.
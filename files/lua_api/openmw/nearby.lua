@@ -89,6 +89,20 @@
 --     radius = 10,
 -- })
 
+---
+-- Asynchronously cast ray from one point to another and pass the first collision to the callback.
+-- The ray is resolved on the physics threads alongside the next physics simulation, so the callback
+-- is normally invoked during the next frame.
+-- NOTE: `radius` is not supported, use @{#nearby.castRay} for sphere casts.
+-- @function [parent=#nearby] asyncCastRay
+-- @param openmw.async#Callback callback The callback to pass the result to (should accept a single argument @{openmw.nearby#RayCastingResult}).
+-- @param openmw.util#Vector3 from Start point of the ray.
+-- @param openmw.util#Vector3 to End point of the ray.
+-- @param #CastRayOptions options An optional table with additional optional arguments
+-- @usage nearby.asyncCastRay(async:callback(function(res)
+--     if res.hit then print('obstacle between A and B') end
+-- end), pointA, pointB, {ignore=self})
+
 ---
 -- A table of parameters for @{#nearby.castRenderingRay} and @{#nearby.asyncCastRenderingRay}
 -- @type CastRenderingRayOptions
@@ -1,13 +1,27 @@
 #version 120
 
+#if @useOVR_multiview
+#extension GL_EXT_texture_array : require
+#endif
+
 #include "lib/luminance/constants.glsl"
 
 varying vec2 uv;
+
+#if @useOVR_multiview
+uniform sampler2DArray sceneTex;
+#else
 uniform sampler2D sceneTex;
+#endif
 
 void main()
 {
-    float lum = dot(texture2D(sceneTex, uv).rgb, vec3(0.2126, 0.7152, 0.0722));
+#if @useOVR_multiview
+    vec3 color = (texture2DArray(sceneTex, vec3(uv, 0.0)).rgb + texture2DArray(sceneTex, vec3(uv, 1.0)).rgb) * 0.5;
+#else
+    vec3 color = texture2D(sceneTex, uv).rgb;
+#endif
+    float lum = dot(color, vec3(0.2126, 0.7152, 0.0722));
     lum = max(lum, epsilon);
 
     gl_FragColor.r = clamp((log2(lum) - minLog) * invLogLumRange, 0.0, 1.0);
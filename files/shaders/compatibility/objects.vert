@@ -79,24 +79,67 @@ uniform mat4 depthSpaceMatrix;
 uniform mat4 osg_ViewMatrixInverse;
 #endif
 
+#if @instancing
+attribute vec4 aOffset;
+attribute vec3 aRotation;
+
+mat4 rotation(in vec3 angle)
+{
+    float sin_x = sin(angle.x);
+    float cos_x = cos(angle.x);
+    float sin_y = sin(angle.y);
+    float cos_y = cos(angle.y);
+    float sin_z = sin(angle.z);
+    float cos_z = cos(angle.z);
+
+    return mat4(
+        cos_z*cos_y+sin_x*sin_y*sin_z, -sin_z*cos_x, cos_z*sin_y+sin_z*sin_x*cos_y, 0.0,
+        sin_z*cos_y+cos_z*sin_x*sin_y, cos_z*cos_x, sin_z*sin_y-cos_z*sin_x*cos_y, 0.0,
+        -sin_y*cos_x, sin_x, cos_x*cos_y, 0.0,
+        0.0, 0.0, 0.0, 1.0);
+}
+
+mat3 rotation3(in mat4 rot4)
+{
+    return mat3(
+        rot4[0].xyz,
+        rot4[1].xyz,
+        rot4[2].xyz);
+}
+#endif
+
 void main(void)
 {
+#if @instancing
+    mat4 instanceRotation = rotation(aRotation);
+    vec4 vertex = instanceRotation * (aOffset.w * gl_Vertex);
+    vertex = vec4(vertex.xyz + aOffset.xyz, 1.0);
+#else
+    vec4 vertex = gl_Vertex;
+#endif
+
 #if @particleOcclusion
     mat4 model = osg_ViewMatrixInverse * gl_ModelViewMatrix;
-    orthoDepthMapCoord = ((depthSpaceMatrix * model) * vec4(gl_Vertex.xyz, 1.0)).xyz;
+    orthoDepthMapCoord = ((depthSpaceMatrix * model) * vec4(vertex.xyz, 1.0)).xyz;
 #endif
 
-    gl_Position = modelToClip(gl_Vertex);
+    gl_Position = modelToClip(vertex);
 
-    vec4 viewPos = modelToView(gl_Vertex);
+    vec4 viewPos = modelToView(vertex);
     gl_ClipVertex = viewPos;
     passColor = gl_Color;
     passViewPos = viewPos.xyz;
     passNormal = gl_Normal.xyz;
+#if @instancing
+    passNormal = rotation3(instanceRotation) * passNormal;
+#endif
     normalToViewMatrix = gl_NormalMatrix;
 
 #if @normalMap || @diffuseParallax
     passTangent = gl_MultiTexCoord7.xyzw;
+#if @instancing
+    passTangent = vec4(rotation3(instanceRotation) * passTangent.xyz, passTangent.w);
+#endif
     normalToViewMatrix *= generateTangentSpace(passTangent, passNormal);
 #endif
 
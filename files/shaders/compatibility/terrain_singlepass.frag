@@ -0,0 +1,139 @@
+#version 120
+
+#if @useUBO
+    #extension GL_ARB_uniform_buffer_object : require
+#endif
+
+#if @useGPUShader4
+    #extension GL_EXT_gpu_shader4: require
+#endif
+
+#extension GL_EXT_texture_array : require
+
+varying vec2 uv;
+
+// All layer textures of the chunk live in array slices; the per-layer blend weights are
+// packed into RGBA blend maps, four layers per map, so up to 8 layers splat in one pass.
+uniform sampler2DArray diffuseArrayMap;
+
+#if @normalMap
+uniform sampler2DArray normalArrayMap;
+#endif
+
+uniform sampler2D blendMap0;
+#if @secondBlendMap
+uniform sampler2D blendMap1;
+#endif
+
+varying float euclideanDepth;
+varying float linearDepth;
+
+#define PER_PIXEL_LIGHTING (@normalMap || @specularMap || @forcePPL)
+
+#if !PER_PIXEL_LIGHTING
+centroid varying vec3 passLighting;
+centroid varying vec3 passSpecular;
+centroid varying vec3 shadowDiffuseLighting;
+centroid varying vec3 shadowSpecularLighting;
+#endif
+varying vec3 passViewPos;
+varying vec3 passNormal;
+
+uniform vec2 screenRes;
+uniform float far;
+
+#include "vertexcolors.glsl"
+#include "shadows_fragment.glsl"
+#include "lib/light/lighting.glsl"
+#include "fog.glsl"
+#include "compatibility/normals.glsl"
+
+void main()
+{
+    vec2 adjustedUV = (gl_TextureMatrix[0] * vec4(uv, 0.0, 1.0)).xy;
+    vec2 blendMapUV = (gl_TextureMatrix[1] * vec4(uv, 0.0, 1.0)).xy;
+
+    float weights[@layerCount];
+    vec4 packedWeights0 = texture2D(blendMap0, blendMapUV);
+    weights[0] = packedWeights0.r;
+#if @layerCount > 1
+    weights[1] = packedWeights0.g;
+#endif
+#if @layerCount > 2
+    weights[2] = packedWeights0.b;
+#endif
+#if @layerCount > 3
+    weights[3] = packedWeights0.a;
+#endif
+#if @secondBlendMap
+    vec4 packedWeights1 = texture2D(blendMap1, blendMapUV);
+    weights[4] = packedWeights1.r;
+#if @layerCount > 5
+    weights[5] = packedWeights1.g;
+#endif
+#if @layerCount > 6
+    weights[6] = packedWeights1.b;
+#endif
+#if @layerCount > 7
+    weights[7] = packedWeights1.a;
+#endif
+#endif
+
+    // Matches the result of the blended per-layer passes: a weighted sum over all layers.
+    vec4 diffuseTex = vec4(0.0);
+#if @normalMap
+    vec4 normalTex = vec4(0.0);
+#endif
+    for (int i = 0; i < @layerCount; ++i)
+    {
+        diffuseTex += texture2DArray(diffuseArrayMap, vec3(adjustedUV, float(i))) * weights[i];
+#if @normalMap
+        normalTex += texture2DArray(normalArrayMap, vec3(adjustedUV, float(i))) * weights[i];
+#endif
+    }
+
+    gl_FragData[0] = vec4(diffuseTex.xyz, 1.0);
+
+    vec4 diffuseColor = getDiffuseColor();
+    gl_FragData[0].a *= diffuseColor.a;
+
+#if @normalMap
+    vec3 normal = normalTex.xyz * 2.0 - 1.0;
+#if @reconstructNormalZ
+    normal.z = sqrt(max(1.0 - dot(normal.xy, normal.xy), 0.0));
+#endif
+    vec3 viewNormal = normalToView(normalize(normal));
+#else
+    vec3 viewNormal = normalize(gl_NormalMatrix * passNormal);
+#endif
+
+    float shadowing = unshadowedLightRatio(linearDepth);
+    vec3 lighting, specular;
+#if !PER_PIXEL_LIGHTING
+    lighting = passLighting + shadowDiffuseLighting * shadowing;
+    specular = passSpecular + shadowSpecularLighting * shadowing;
+#else
+#if @specularMap
+    float shininess = 128.0; // TODO: make configurable
+    vec3 specularColor = vec3(diffuseTex.a);
+#else
+    float shininess = gl_FrontMaterial.shininess;
+    vec3 specularColor = getSpecularColor().xyz;
+#endif
+    vec3 diffuseLight, ambientLight, specularLight;
+    doLighting(passViewPos, viewNormal, shininess, shadowing, diffuseLight, ambientLight, specularLight);
+    lighting = diffuseColor.xyz * diffuseLight + getAmbientColor().xyz * ambientLight + getEmissionColor().xyz;
+    specular = specularColor * specularLight;
+#endif
+
+    clampLightingResult(lighting);
+    gl_FragData[0].xyz = gl_FragData[0].xyz * lighting + specular;
+
+    gl_FragData[0] = applyFogAtDist(gl_FragData[0], euclideanDepth, linearDepth, far);
+
+#if !@disableNormals && @writeNormals
+    gl_FragData[1].xyz = viewNormal * 0.5 + 0.5;
+#endif
+
+    applyShadowDebugOverlay();
+}